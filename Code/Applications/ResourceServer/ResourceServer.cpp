@@ -5,6 +5,7 @@
 #include "EngineTools/Resource/ResourceCompilerRegistry.h"
 #include "Engine/Entity/EntityDescriptors.h"
 #include "Base/Resource/ResourceProviders/ResourceNetworkMessages.h"
+#include "Base/Resource/ResourceArchive.h"
 #include "Base/FileSystem/FileSystemUtils.h"
 #include "Base/Profiling.h"
 
@@ -548,7 +549,13 @@ namespace EE::Resource
                 }
 
                 float const percentageComplete = numComplete / m_packagingRequests.size();
-                return 0.05f + ( 0.95f * percentageComplete );
+                return 0.05f + ( 0.9f * percentageComplete );
+            }
+            break;
+
+            case PackagingStage::Archiving:
+            {
+                return 0.95f;
             }
             break;
 
@@ -594,10 +601,18 @@ namespace EE::Resource
             if ( isComplete )
             {
                 m_packagingRequests.clear();
+                m_context.m_taskSystem.ScheduleTask( &m_archivingTask );
+                m_packagingStage = PackagingStage::Archiving;
+            }
+        }
+        else if ( m_packagingStage == PackagingStage::Archiving )
+        {
+            if ( m_archivingTask.GetIsComplete() )
+            {
+                m_packagingRuntimeDependencies.clear();
                 m_packagingStage = PackagingStage::Complete;
             }
         }
-
     }
 
     void ResourceServer::RunPackagingTask()
@@ -633,6 +648,19 @@ namespace EE::Resource
         }
     }
 
+    void ResourceServer::RunArchivingTask()
+    {
+        if ( m_context.m_isExiting )
+        {
+            return;
+        }
+
+        if ( !ResourceArchiveWriter::WriteArchives( m_context.GetPackagedDataDirectory(), m_packagingRuntimeDependencies ) )
+        {
+            EE_LOG_ERROR( LogCategory::Resource, "Resource Server", "Failed to write resource archives to: %s", m_context.GetPackagedDataDirectory().c_str() );
+        }
+    }
+
     void ResourceServer::EnqueueResourceForPackaging( ResourceID const& resourceID )
     {
         EE_ASSERT( resourceID.IsValid() );
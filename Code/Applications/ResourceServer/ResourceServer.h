@@ -49,6 +49,7 @@ namespace EE::Resource
             None, // Not Packaging
             Preparing,
             Packaging,
+            Archiving,
             Complete
         };
 
@@ -182,6 +183,7 @@ namespace EE::Resource
 
         void UpdatePackaging();
         void RunPackagingTask();
+        void RunArchivingTask();
         void EnqueueResourceForPackaging( ResourceID const& resourceID );
 
         // Tools
@@ -210,6 +212,7 @@ namespace EE::Resource
         TVector<Request const*>                                     m_packagingRequests;
         TVector<ResourceID>                                         m_packagingRuntimeDependencies;
         PinnedLambdaTask                                            m_packagingTask = PinnedLambdaTask( 1, [this] () { RunPackagingTask(); } );
+        PinnedLambdaTask                                            m_archivingTask = PinnedLambdaTask( 1, [this] () { RunArchivingTask(); } );
         PackagingStage                                              m_packagingStage = PackagingStage::None;
 
         // File System Watcher
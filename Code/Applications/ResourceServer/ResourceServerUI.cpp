@@ -1004,7 +1004,7 @@ namespace EE::Resource
             // Packaging UI
             //-------------------------------------------------------------------------
 
-            bool const disablePackagingUI = ( packagingStage == ResourceServer::PackagingStage::Preparing ) || ( packagingStage == ResourceServer::PackagingStage::Packaging );
+            bool const disablePackagingUI = ( packagingStage == ResourceServer::PackagingStage::Preparing ) || ( packagingStage == ResourceServer::PackagingStage::Packaging ) || ( packagingStage == ResourceServer::PackagingStage::Archiving );
             ImGui::BeginDisabled( disablePackagingUI );
             {
                 InlineString previewStr;
@@ -0,0 +1,101 @@
+#include "Game/_Module/GameModule.h"
+#include "Engine/_Module/_AutoGenerated/TypeInfo/TypeRegistration.h"
+#include "Engine/Engine.h"
+#include "Base/Application/ApplicationGlobalState.h"
+#include "Base/Logging/SystemLog.h"
+#include <atomic>
+#include <cinttypes>
+#include <csignal>
+#include <iostream>
+
+//-------------------------------------------------------------------------
+// Dedicated Simulation Server
+//-------------------------------------------------------------------------
+// Runs the engine headless: the entity worlds (animation, physics, navmesh and gameplay systems) are updated on a fixed timestep,
+// but there is no window, render device, render world or tools UI. This keeps the per-instance cost low enough to run many instances per machine.
+//
+// Usage: EsotericaServer -map <map> [-tickrate <hz>] [-workers <n>] [-packaged]
+
+namespace EE
+{
+    class ServerEngine final : public Engine
+    {
+    public:
+
+        ServerEngine( TFunction<bool( EE::String const& error )>&& errorHandler )
+            : Engine( eastl::forward<TFunction<bool( EE::String const& error )>&&>( errorHandler ), Mode::Headless )
+        {
+            m_modules.emplace_back( EE::New<GameModule>() );
+        }
+
+        virtual void RegisterTypes() override
+        {
+            TypeSystem::Reflection::RegisterTypes( *m_pTypeRegistry );
+        }
+
+        virtual void UnregisterTypes() override
+        {
+            TypeSystem::Reflection::UnregisterTypes( *m_pTypeRegistry );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        virtual void CreateToolsUI() override { EE_UNREACHABLE_CODE(); } // No tools UI when headless
+        #endif
+    };
+}
+
+//-------------------------------------------------------------------------
+
+static std::atomic<bool> g_exitRequested = false;
+
+static void OnExitSignal( int )
+{
+    g_exitRequested = true;
+}
+
+//-------------------------------------------------------------------------
+
+int main( int argc, char* argv[] )
+{
+    int result = 0;
+    {
+        EE::ApplicationGlobalState globalState( "Server Main Thread" );
+
+        auto FatalErrorHandler = [] ( EE::String const& error ) -> bool
+        {
+            std::cerr << "Fatal Error: " << error.c_str() << std::endl;
+            return false;
+        };
+
+        EE::ServerEngine engine{ EE::TFunction<bool( EE::String const& error )>( FatalErrorHandler ) };
+
+        std::signal( SIGINT, OnExitSignal );
+        std::signal( SIGTERM, OnExitSignal );
+
+        if ( engine.Initialize( argc, argv ) )
+        {
+            while ( !g_exitRequested )
+            {
+                if ( !engine.Update() )
+                {
+                    result = -1;
+                    break;
+                }
+            }
+
+            EE::Engine::FramePacingStats const& stats = engine.GetFramePacingStats();
+            EE_LOG_MESSAGE( EE::LogCategory::System, "Server", "Shutting down after %" PRIu64 " ticks (Avg: %.2fms, Max: %.2fms, Late: %" PRIu64 ", Skipped: %" PRIu64 ")", stats.m_numTicks, stats.GetAverageTickTime().ToFloat(), stats.m_maxTickTime.ToFloat(), stats.m_numLateTicks, stats.m_numSkippedTicks );
+        }
+        else
+        {
+            result = -1;
+        }
+
+        if ( !engine.Shutdown() )
+        {
+            result = -1;
+        }
+    }
+
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,503 @@
+#include "AnimationBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Instance.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Definition.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskPosePool.h"
+#include "Engine/Animation/TaskSystem/Animation_PoseSampleCache.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationSkeleton.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationClip.h"
+#include "Engine/Animation/ResourceLoaders/ResourceLoader_AnimationGraph.h"
+#include "Engine/Animation/AnimationBlender.h"
+#include "Engine/Animation/AnimationBoneMask.h"
+#include "Engine/Animation/AnimationFloatChannels.h"
+#include "Base/Resource/ResourceSystem.h"
+#include "Base/Resource/ResourceProviders/ResourceProvider_Package.h"
+#include "Base/Resource/Settings/Settings_Resource.h"
+#include "Base/Settings/SettingsRegistry.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Timers.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    namespace
+    {
+        using Benchmark::StageResult;
+
+        // Run a function for every instance across the task system workers and record the time and allocations
+        template<typename Function>
+        static void RunStage( EE::TaskSystem& taskSystem, int32_t numInstances, bool isMeasuredFrame, StageResult& stageResult, Function&& function )
+        {
+            uint64_t numAllocations = 0, numAllocatedBytes = 0;
+            Benchmark::ClaimAllocations( numAllocations, numAllocatedBytes );
+
+            Timer<PlatformClock> timer;
+            timer.Start();
+
+            AsyncTask stageTask( (uint32_t) numInstances, [&function] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    function( (int32_t) i, threadnum );
+                }
+            } );
+
+            taskSystem.ScheduleTask( &stageTask );
+            taskSystem.WaitForTask( &stageTask );
+
+            double const elapsedTimeMS = timer.GetElapsedTimeMilliseconds().ToFloat();
+            Benchmark::ClaimAllocations( numAllocations, numAllocatedBytes );
+
+            if ( isMeasuredFrame )
+            {
+                stageResult.AddFrame( elapsedTimeMS, numAllocations, numAllocatedBytes );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        // The sample cache stats accumulated over all measured frames, only available in development builds
+        struct SampleCacheResult
+        {
+            void AddFrame( PoseSampleCache const& sampleCache )
+            {
+                #if EE_DEVELOPMENT_TOOLS
+                PoseSampleCache::Stats const& stats = sampleCache.GetStatsForLastFrame();
+                m_numLookups += stats.m_numLookups;
+                m_numHits += stats.m_numHits;
+                m_numSharedEntries += stats.m_numSharedEntries;
+                #endif
+            }
+
+            double GetHitRate() const { return ( m_numLookups > 0 ) ? double( m_numHits ) / m_numLookups : 0.0; }
+
+        public:
+
+            uint64_t                        m_numLookups = 0;
+            uint64_t                        m_numHits = 0;
+            uint64_t                        m_numSharedEntries = 0;
+        };
+
+        static bool WriteResults( BenchmarkSettings const& settings, char const* pMode, char const* pSubject, int32_t numWorkers, TVector<StageResult>& stages, SampleCacheResult const* pSampleCacheResult = nullptr )
+        {
+            int32_t const numMeasuredPoses = settings.m_numInstances * settings.m_numFrames;
+
+            double totalTimeMS = 0.0;
+            for ( StageResult const& stage : stages )
+            {
+                totalTimeMS += stage.m_totalTimeMS;
+            }
+
+            String json;
+            json.append_sprintf( "{\n" );
+            json.append_sprintf( "  \"mode\": \"%s\",\n", pMode );
+            json.append_sprintf( "  \"subject\": \"%s\",\n", pSubject );
+            json.append_sprintf( "  \"numInstances\": %d,\n", settings.m_numInstances );
+            json.append_sprintf( "  \"numFrames\": %d,\n", settings.m_numFrames );
+            json.append_sprintf( "  \"numWarmupFrames\": %d,\n", settings.m_numWarmupFrames );
+            json.append_sprintf( "  \"numWorkers\": %d,\n", numWorkers );
+            json.append_sprintf( "  \"seed\": %u,\n", settings.m_seed );
+            json.append_sprintf( "  \"instanceSpeedVariation\": %.3f,\n", settings.m_instanceSpeedVariation );
+            #if EE_DEVELOPMENT_TOOLS
+            json.append_sprintf( "  \"allocationTracking\": true,\n" );
+            #else
+            json.append_sprintf( "  \"allocationTracking\": false,\n" );
+            #endif
+            json.append_sprintf( "  \"totalTimeMS\": %.4f,\n", totalTimeMS );
+            json.append_sprintf( "  \"posesPerSecond\": %.2f,\n", ( totalTimeMS > 0.0 ) ? numMeasuredPoses / ( totalTimeMS / 1000.0 ) : 0.0 );
+            json.append_sprintf( "  \"sampleCacheEnabled\": %s,\n", ( pSampleCacheResult != nullptr ) ? "true" : "false" );
+
+            #if EE_DEVELOPMENT_TOOLS
+            if ( pSampleCacheResult != nullptr )
+            {
+                json.append_sprintf( "  \"sampleCache\": {\n" );
+                json.append_sprintf( "    \"numLookups\": %llu,\n", (unsigned long long) pSampleCacheResult->m_numLookups );
+                json.append_sprintf( "    \"numHits\": %llu,\n", (unsigned long long) pSampleCacheResult->m_numHits );
+                json.append_sprintf( "    \"numSharedEntries\": %llu,\n", (unsigned long long) pSampleCacheResult->m_numSharedEntries );
+                json.append_sprintf( "    \"hitRate\": %.4f\n", pSampleCacheResult->GetHitRate() );
+                json.append_sprintf( "  },\n" );
+            }
+            #endif
+
+            json.append_sprintf( "  \"stages\": [\n" );
+
+            for ( int32_t i = 0; i < (int32_t) stages.size(); i++ )
+            {
+                StageResult& stage = stages[i];
+                json.append_sprintf( "    {\n" );
+                json.append_sprintf( "      \"name\": \"%s\",\n", stage.m_pName );
+                Benchmark::AppendStageTimings( json, stage, "      " );
+                json.append_sprintf( "      \"posesPerSecond\": %.2f,\n", stage.GetItemsPerSecond( numMeasuredPoses ) );
+                json.append_sprintf( "      \"numAllocations\": %llu,\n", (unsigned long long) stage.m_numAllocations );
+                json.append_sprintf( "      \"numAllocatedBytes\": %llu,\n", (unsigned long long) stage.m_numAllocatedBytes );
+                json.append_sprintf( "      \"allocationsPerFrame\": %.2f\n", settings.m_numFrames > 0 ? double( stage.m_numAllocations ) / settings.m_numFrames : 0.0 );
+                json.append_sprintf( "    }%s\n", ( i < (int32_t) stages.size() - 1 ) ? "," : "" );
+            }
+
+            json.append_sprintf( "  ]\n" );
+            json.append_sprintf( "}\n" );
+
+            return Benchmark::WriteResults( settings.m_outputFilePath, json );
+        }
+
+        //-------------------------------------------------------------------------
+        // Synthetic Benchmark
+        //-------------------------------------------------------------------------
+
+        // Skeletons can only be created by the resource pipeline, so we serialize the synthetic skeleton data in the compiled skeleton layout and read it back
+        static void CreateSyntheticSkeleton( int32_t numBones, Math::RNG const& rng, Skeleton& outSkeleton )
+        {
+            EE_ASSERT( numBones > 1 );
+
+            TVector<StringID> boneIDs;
+            TVector<Transform> parentSpaceReferencePose;
+            TVector<int32_t> parentIndices;
+            TVector<TBitFlags<BoneFlags>> boneFlags;
+            int32_t const numBonesToSampleAtLowLOD = numBones / 2;
+            TVector<Skeleton::SecondarySkeleton> secondarySkeletons;
+            THashMap<StringID, int32_t> boneIndexLUT;
+            TVector<FloatChannelSet> floatChannelSets;
+
+            for ( int32_t i = 0; i < numBones; i++ )
+            {
+                InlineString boneName;
+                boneName.sprintf( "Bone_%d", i );
+                boneIDs.emplace_back( StringID( boneName.c_str() ) );
+                boneIndexLUT.insert( TPair<StringID, int32_t>( boneIDs.back(), i ) );
+                boneFlags.emplace_back();
+
+                // Build a set of branching chains (i.e. a spine with limbs)
+                parentIndices.emplace_back( ( i == 0 ) ? InvalidIndex : ( ( i % 8 == 1 ) ? Math::Max( 0, i - 8 ) : i - 1 ) );
+
+                Quaternion const rotation( Radians( rng.GetFloat( -0.5f, 0.5f ) ), Radians( rng.GetFloat( -0.5f, 0.5f ) ), Radians( rng.GetFloat( -0.5f, 0.5f ) ) );
+                parentSpaceReferencePose.emplace_back( Transform( rotation, Vector( 0.0f, 0.0f, 0.1f ) ) );
+            }
+
+            Serialization::BinaryOutputArchive outputArchive;
+            outputArchive << boneIDs << parentSpaceReferencePose << parentIndices << boneFlags << numBonesToSampleAtLowLOD << secondarySkeletons << boneIndexLUT << floatChannelSets;
+
+            Blob skeletonData;
+            outputArchive.GetAsBinaryBlob( skeletonData );
+
+            Serialization::BinaryInputArchive inputArchive;
+            inputArchive.ReadFromBlob( skeletonData );
+            inputArchive << outSkeleton;
+            EE_ASSERT( outSkeleton.IsValid() );
+        }
+
+        static void RandomizePose( Math::RNG const& rng, Pose& pose )
+        {
+            for ( int32_t i = 0; i < pose.GetNumBones(); i++ )
+            {
+                Quaternion const rotation( Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ), Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ), Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ) );
+                pose.SetRotation( i, rotation );
+            }
+        }
+
+        static bool RunSyntheticBenchmark( BenchmarkSettings const& settings, EE::TaskSystem& taskSystem )
+        {
+            struct SyntheticInstance
+            {
+                SyntheticInstance( Skeleton const* pSkeleton )
+                    : m_sourcePose( pSkeleton )
+                    , m_targetPose( pSkeleton )
+                    , m_resultPose( pSkeleton )
+                {}
+
+                Pose                        m_sourcePose;
+                Pose                        m_targetPose;
+                Pose                        m_resultPose;
+                float                       m_blendWeight = 0.5f;
+            };
+
+            Math::RNG rng( settings.m_seed );
+
+            Skeleton skeleton;
+            CreateSyntheticSkeleton( Math::Max( settings.m_numSyntheticBones, 2 ), rng, skeleton );
+            BoneMask const boneMask( &skeleton, 1.0f );
+
+            TVector<SyntheticInstance*> instances;
+            for ( int32_t i = 0; i < settings.m_numInstances; i++ )
+            {
+                SyntheticInstance* pInstance = instances.emplace_back( EE::New<SyntheticInstance>( &skeleton ) );
+                RandomizePose( rng, pInstance->m_sourcePose );
+                RandomizePose( rng, pInstance->m_targetPose );
+                pInstance->m_blendWeight = rng.GetFloat( 0.1f, 0.9f );
+            }
+
+            // Run
+            //-------------------------------------------------------------------------
+
+            TVector<StageResult> stages = { StageResult( "ParentSpaceBlend" ), StageResult( "ModelSpaceBlend" ), StageResult( "CalculateModelSpaceTransforms" ) };
+
+            for ( int32_t frameIdx = 0; frameIdx < settings.m_numWarmupFrames + settings.m_numFrames; frameIdx++ )
+            {
+                bool const isMeasuredFrame = frameIdx >= settings.m_numWarmupFrames;
+
+                RunStage( taskSystem, settings.m_numInstances, isMeasuredFrame, stages[0], [&instances] ( int32_t instanceIdx, uint32_t threadIdx )
+                {
+                    SyntheticInstance* pInstance = instances[instanceIdx];
+                    Blender::ParentSpaceBlend( Skeleton::LOD::High, &pInstance->m_sourcePose, &pInstance->m_targetPose, pInstance->m_blendWeight, nullptr, &pInstance->m_resultPose );
+                } );
+
+                RunStage( taskSystem, settings.m_numInstances, isMeasuredFrame, stages[1], [&instances, &boneMask] ( int32_t instanceIdx, uint32_t threadIdx )
+                {
+                    SyntheticInstance* pInstance = instances[instanceIdx];
+                    Blender::ModelSpaceBlend( Skeleton::LOD::High, &pInstance->m_sourcePose, &pInstance->m_targetPose, pInstance->m_blendWeight, &boneMask, &pInstance->m_resultPose );
+                } );
+
+                RunStage( taskSystem, settings.m_numInstances, isMeasuredFrame, stages[2], [&instances] ( int32_t instanceIdx, uint32_t threadIdx )
+                {
+                    instances[instanceIdx]->m_resultPose.CalculateModelSpaceTransforms();
+                } );
+            }
+
+            // Shutdown
+            //-------------------------------------------------------------------------
+
+            for ( SyntheticInstance*& pInstance : instances )
+            {
+                EE::Delete( pInstance );
+            }
+
+            InlineString subject;
+            subject.sprintf( "Synthetic_%dBones", skeleton.GetNumBones() );
+            return WriteResults( settings, "Synthetic", subject.c_str(), (int32_t) taskSystem.GetNumWorkers(), stages );
+        }
+
+        //-------------------------------------------------------------------------
+        // Graph Benchmark
+        //-------------------------------------------------------------------------
+
+        // Perturb the control parameters, we dont know the valid values for ID parameters so they keep their defaults
+        static void RandomizeControlParameters( GraphInstance* pGraphInstance, Math::RNG const& rng, float changeProbability )
+        {
+            int32_t const numControlParameters = pGraphInstance->GetNumControlParameters();
+            for ( int16_t i = 0; i < numControlParameters; i++ )
+            {
+                if ( rng.GetFloat() > changeProbability )
+                {
+                    continue;
+                }
+
+                switch ( pGraphInstance->GetControlParameterType( i ) )
+                {
+                    case GraphValueType::Bool:
+                    {
+                        pGraphInstance->SetControlParameterValue( i, rng.GetFloat() > 0.5f );
+                    }
+                    break;
+
+                    case GraphValueType::Float:
+                    {
+                        pGraphInstance->SetControlParameterValue( i, rng.GetFloat() );
+                    }
+                    break;
+
+                    case GraphValueType::Vector:
+                    {
+                        pGraphInstance->SetControlParameterValue( i, Float3( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), 0.0f ) );
+                    }
+                    break;
+
+                    case GraphValueType::Target:
+                    {
+                        Target const target( Quaternion::Identity, Vector( rng.GetFloat( -5.0f, 5.0f ), rng.GetFloat( -5.0f, 5.0f ), rng.GetFloat( 0.0f, 2.0f ) ) );
+                        pGraphInstance->SetControlParameterValue( i, target );
+                    }
+                    break;
+
+                    default:
+                    break;
+                }
+            }
+        }
+
+        static bool RunGraphBenchmark( BenchmarkSettings const& settings, TypeSystem::TypeRegistry const& typeRegistry, EE::TaskSystem& taskSystem )
+        {
+            // Create the minimal resource setup needed to load animation data
+            //-------------------------------------------------------------------------
+
+            SettingsRegistry settingsRegistry( typeRegistry );
+            if ( !settingsRegistry.Initialize( settings.m_iniFilePath ) )
+            {
+                EE_LOG_ERROR( LogCategory::Animation, "Benchmark", "Failed to load settings: %s", settings.m_iniFilePath.c_str() );
+                return false;
+            }
+
+            Resource::ResourceSettings* pResourceSettings = settingsRegistry.GetSettings<Resource::ResourceSettings>();
+            EE_ASSERT( pResourceSettings != nullptr );
+
+            Resource::PackagedResourceProvider resourceProvider( *pResourceSettings );
+            Resource::ResourceProvider* pResourceProvider = &resourceProvider;
+            if ( !pResourceProvider->Initialize() )
+            {
+                EE_LOG_ERROR( LogCategory::Animation, "Benchmark", "Failed to initialize resource provider" );
+                settingsRegistry.Shutdown();
+                return false;
+            }
+
+            Resource::ResourceSystem resourceSystem( taskSystem );
+            resourceSystem.Initialize( pResourceProvider );
+
+            SkeletonLoader skeletonLoader;
+            AnimationClipLoader animationClipLoader;
+            GraphLoader graphLoader;
+            animationClipLoader.SetTypeRegistryPtr( &typeRegistry );
+            graphLoader.SetTypeRegistryPtr( &typeRegistry );
+            resourceSystem.RegisterResourceLoader( &skeletonLoader );
+            resourceSystem.RegisterResourceLoader( &animationClipLoader );
+            resourceSystem.RegisterResourceLoader( &graphLoader );
+
+            // Load graph
+            //-------------------------------------------------------------------------
+
+            TResourcePtr<GraphDefinition> graphDefinition( settings.m_graphID );
+            resourceSystem.LoadResource( graphDefinition );
+            resourceSystem.WaitForAllRequestsToComplete();
+
+            bool succeeded = graphDefinition.IsLoaded();
+            if ( succeeded )
+            {
+                PoseSampleCache poseSampleCache;
+                TVector<GraphInstance*> graphInstances;
+                TVector<Math::RNG> instanceRNGs;
+                TVector<Transform> instanceTransforms;
+                TVector<Seconds> instanceDeltaTimes;
+
+                // One arena per thread that can execute our jobs (all workers + main thread)
+                TVector<PoseBufferArena*> poseBufferArenas;
+                for ( uint32_t i = 0; i < taskSystem.GetNumWorkers() + 1; i++ )
+                {
+                    poseBufferArenas.emplace_back( EE::New<PoseBufferArena>() );
+                }
+
+                Math::RNG rng( settings.m_seed );
+                for ( int32_t i = 0; i < settings.m_numInstances; i++ )
+                {
+                    GraphInstance* pGraphInstance = graphInstances.emplace_back( EE::New<GraphInstance>( graphDefinition.GetPtr() ) );
+                    instanceRNGs.emplace_back( rng.GetUInt() );
+                    instanceTransforms.emplace_back( Transform( Quaternion::Identity, Vector( rng.GetFloat( -50.0f, 50.0f ), rng.GetFloat( -50.0f, 50.0f ), 0.0f ) ) );
+                    instanceDeltaTimes.emplace_back( settings.m_deltaTime * rng.GetFloat( 1.0f - settings.m_instanceSpeedVariation, 1.0f + settings.m_instanceSpeedVariation ) );
+
+                    // Without the cache every instance decodes its own poses, which is the common case for non-crowd characters
+                    if ( settings.m_useSampleCache )
+                    {
+                        pGraphInstance->SetPoseSampleCache( &poseSampleCache );
+                    }
+                }
+
+                // Run
+                //-------------------------------------------------------------------------
+
+                TVector<StageResult> stages = { StageResult( "EvaluateGraph" ), StageResult( "PrePhysicsPoseTasks" ), StageResult( "PostPhysicsPoseTasks" ) };
+                SampleCacheResult sampleCacheResult;
+
+                for ( int32_t frameIdx = 0; frameIdx < settings.m_numWarmupFrames + settings.m_numFrames; frameIdx++ )
+                {
+                    bool const isMeasuredFrame = frameIdx >= settings.m_numWarmupFrames;
+
+                    // All borrowed buffers from the previous frame have been returned, so the arenas can be reused
+                    for ( PoseBufferArena* pArena : poseBufferArenas )
+                    {
+                        pArena->Reset();
+                    }
+
+                    RunStage( taskSystem, settings.m_numInstances, isMeasuredFrame, stages[0], [&] ( int32_t instanceIdx, uint32_t threadIdx )
+                    {
+                        GraphInstance* pGraphInstance = graphInstances[instanceIdx];
+                        RandomizeControlParameters( pGraphInstance, instanceRNGs[instanceIdx], settings.m_parameterChangeProbability );
+                        pGraphInstance->EvaluateGraph( instanceDeltaTimes[instanceIdx], instanceTransforms[instanceIdx], nullptr, nullptr );
+                    } );
+
+                    RunStage( taskSystem, settings.m_numInstances, isMeasuredFrame, stages[1], [&] ( int32_t instanceIdx, uint32_t threadIdx )
+                    {
+                        graphInstances[instanceIdx]->ExecutePrePhysicsPoseTasks( instanceTransforms[instanceIdx], poseBufferArenas[threadIdx] );
+                    } );
+
+                    RunStage( taskSystem, settings.m_numInstances, isMeasuredFrame, stages[2], [&] ( int32_t instanceIdx, uint32_t threadIdx )
+                    {
+                        graphInstances[instanceIdx]->ExecutePostPhysicsPoseTasks( poseBufferArenas[threadIdx] );
+                    } );
+
+                    if ( settings.m_useSampleCache )
+                    {
+                        poseSampleCache.Reset();
+
+                        if ( isMeasuredFrame )
+                        {
+                            sampleCacheResult.AddFrame( poseSampleCache );
+                        }
+                    }
+                }
+
+                succeeded = WriteResults( settings, "Graph", settings.m_graphID.c_str(), (int32_t) taskSystem.GetNumWorkers(), stages, settings.m_useSampleCache ? &sampleCacheResult : nullptr );
+
+                // Destroy instances
+                //-------------------------------------------------------------------------
+
+                for ( GraphInstance*& pGraphInstance : graphInstances )
+                {
+                    EE::Delete( pGraphInstance );
+                }
+
+                for ( PoseBufferArena*& pArena : poseBufferArenas )
+                {
+                    EE::Delete( pArena );
+                }
+            }
+            else
+            {
+                EE_LOG_ERROR( LogCategory::Animation, "Benchmark", "Failed to load graph: %s. Only animation resources can be loaded by the benchmark.", settings.m_graphID.c_str() );
+            }
+
+            // Shutdown
+            //-------------------------------------------------------------------------
+
+            if ( !graphDefinition.IsUnloaded() )
+            {
+                resourceSystem.UnloadResource( graphDefinition );
+                resourceSystem.WaitForAllRequestsToComplete();
+            }
+
+            resourceSystem.UnregisterResourceLoader( &graphLoader );
+            resourceSystem.UnregisterResourceLoader( &animationClipLoader );
+            resourceSystem.UnregisterResourceLoader( &skeletonLoader );
+            animationClipLoader.ClearTypeRegistryPtr();
+            graphLoader.ClearTypeRegistryPtr();
+
+            resourceSystem.Shutdown();
+            pResourceProvider->Shutdown();
+            settingsRegistry.Shutdown();
+
+            return succeeded;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool RunBenchmark( TypeSystem::TypeRegistry const& typeRegistry, BenchmarkSettings const& settings )
+    {
+        if ( settings.m_numInstances <= 0 || settings.m_numFrames <= 0 )
+        {
+            EE_LOG_ERROR( LogCategory::Animation, "Benchmark", "Invalid benchmark settings, need at least one instance and one frame" );
+            return false;
+        }
+
+        EE::TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+        taskSystem.Initialize();
+        TaskSystem::InitializeTaskTypesList( typeRegistry );
+
+        bool const succeeded = settings.m_graphID.IsValid() ? RunGraphBenchmark( settings, typeRegistry, taskSystem ) : RunSyntheticBenchmark( settings, taskSystem );
+
+        TaskSystem::ShutdownTaskTypesList();
+        taskSystem.Shutdown();
+
+        return succeeded;
+    }
+}
\ No newline at end of file
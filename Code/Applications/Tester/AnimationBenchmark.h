@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Base/Resource/ResourceID.h"
+#include "Base/FileSystem/FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::TypeSystem { class TypeRegistry; }
+
+//-------------------------------------------------------------------------
+// Animation Benchmark
+//-------------------------------------------------------------------------
+// Headless throughput benchmark for the animation runtime, used to catch performance regressions in the blender, clip sampling and graph nodes
+//
+// Graph Mode: Loads a compiled graph variation (and all of its dependencies) from the compiled data directory and creates N instances of it.
+//             Each frame the instances' control parameters are randomly perturbed, then the graphs are evaluated and their pre and post-physics
+//             pose tasks are executed across the task system workers, exactly as the animation world system does.
+//
+// Synthetic Mode: Used when no graph is supplied, builds a synthetic skeleton and measures the blender and model space pose calculation directly.
+//                 This needs no compiled data so can run anywhere.
+//
+// Results (per-stage frame timings, poses/sec and allocation counts) are written as JSON so they can be compared between builds
+// The pose sample cache is disabled by default, when enabled its hit rate is also reported (development builds only)
+
+namespace EE::Animation
+{
+    struct BenchmarkSettings
+    {
+        ResourceID                          m_graphID;                                  // The graph variation to benchmark, the synthetic benchmark is run if this is not set
+        FileSystem::Path                    m_iniFilePath;                              // The ini file with the resource settings, needed to find the compiled data
+        FileSystem::Path                    m_outputFilePath;                           // If not set, the results are printed to stdout
+        int32_t                             m_numInstances = 64;
+        int32_t                             m_numFrames = 300;
+        int32_t                             m_numWarmupFrames = 30;                     // Frames that are run before we start measuring
+        int32_t                             m_numSyntheticBones = 100;
+        uint32_t                            m_seed = 1;
+        float                               m_parameterChangeProbability = 0.05f;      // The per-frame probability that each control parameter is changed
+        float                               m_deltaTime = 1.0f / 30.0f;
+        float                               m_instanceSpeedVariation = 0.1f;           // Each instance's delta time is randomly scaled by up to this amount so that instances dont update in lockstep
+        bool                                m_useSampleCache = false;                   // Share sampled poses between instances via the pose sample cache
+    };
+
+    // Run the benchmark and output the results, returns false if the benchmark could not be run
+    bool RunBenchmark( TypeSystem::TypeRegistry const& typeRegistry, BenchmarkSettings const& settings );
+}
\ No newline at end of file
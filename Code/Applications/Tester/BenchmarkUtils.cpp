@@ -0,0 +1,75 @@
+#include "BenchmarkUtils.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/Memory/Memory.h"
+#include "Base/Math/Math.h"
+#include "Base/Logging/Log.h"
+#include <EASTL/sort.h>
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmark
+{
+    void StageResult::AddFrame( double frameTimeMS, uint64_t numAllocations, uint64_t numAllocatedBytes )
+    {
+        m_frameTimesMS.emplace_back( frameTimeMS );
+        m_totalTimeMS += frameTimeMS;
+        m_numAllocations += numAllocations;
+        m_numAllocatedBytes += numAllocatedBytes;
+    }
+
+    double StageResult::GetPercentileTimeMS( float percentile )
+    {
+        if ( m_frameTimesMS.empty() )
+        {
+            return 0.0;
+        }
+
+        eastl::sort( m_frameTimesMS.begin(), m_frameTimesMS.end() );
+        int32_t const idx = Math::Clamp( (int32_t) Math::Round( percentile * ( m_frameTimesMS.size() - 1 ) ), 0, (int32_t) m_frameTimesMS.size() - 1 );
+        return m_frameTimesMS[idx];
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ClaimAllocations( uint64_t& outNumAllocations, uint64_t& outNumAllocatedBytes )
+    {
+        outNumAllocations = 0;
+        outNumAllocatedBytes = 0;
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( Memory::MemoryAllocator* pAllocator = Memory::MemoryAllocator::GetHead(); pAllocator != nullptr; pAllocator = pAllocator->GetNextItem() )
+        {
+            outNumAllocations += pAllocator->ClaimAccumulatedAllocations();
+            outNumAllocatedBytes += pAllocator->ClaimAccumulatedBytes();
+        }
+        #endif
+    }
+
+    void AppendStageTimings( String& json, StageResult& stage, char const* pIndent )
+    {
+        json.append_sprintf( "%s\"totalTimeMS\": %.4f,\n", pIndent, stage.m_totalTimeMS );
+        json.append_sprintf( "%s\"averageFrameTimeMS\": %.4f,\n", pIndent, stage.GetAverageTimeMS() );
+        json.append_sprintf( "%s\"medianFrameTimeMS\": %.4f,\n", pIndent, stage.GetPercentileTimeMS( 0.5f ) );
+        json.append_sprintf( "%s\"p95FrameTimeMS\": %.4f,\n", pIndent, stage.GetPercentileTimeMS( 0.95f ) );
+        json.append_sprintf( "%s\"maxFrameTimeMS\": %.4f,\n", pIndent, stage.GetPercentileTimeMS( 1.0f ) );
+    }
+
+    bool WriteResults( FileSystem::Path const& outputFilePath, String const& json )
+    {
+        if ( !outputFilePath.IsValid() )
+        {
+            std::cout << json.c_str();
+            return true;
+        }
+
+        outputFilePath.EnsureDirectoryExists();
+        if ( !FileSystem::WriteTextFile( outputFilePath.c_str(), json.c_str(), json.length() ) )
+        {
+            EE_LOG_ERROR( LogCategory::FileSystem, "Benchmark", "Failed to write results to: %s", outputFilePath.c_str() );
+            return false;
+        }
+
+        return true;
+    }
+}
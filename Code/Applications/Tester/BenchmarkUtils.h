@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Base/FileSystem/FileSystemPath.h"
+#include "Base/Types/String.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Benchmark Utils
+//-------------------------------------------------------------------------
+// Shared helpers for the headless benchmarks: per-stage frame timings, allocation tracking and the JSON results output
+
+namespace EE::Benchmark
+{
+    // Timings and allocations for a single benchmark stage, all frames are wall clock times for the whole stage
+    struct StageResult
+    {
+        StageResult( char const* pName ) : m_pName( pName ) {}
+
+        void AddFrame( double frameTimeMS, uint64_t numAllocations = 0, uint64_t numAllocatedBytes = 0 );
+
+        double GetAverageTimeMS() const { return m_frameTimesMS.empty() ? 0.0 : m_totalTimeMS / m_frameTimesMS.size(); }
+
+        // Get a percentile (0-1) of the frame times, sorts the frame times
+        double GetPercentileTimeMS( float percentile );
+
+        // Get the throughput for a number of items (poses, queries, etc...) processed over all measured frames
+        double GetItemsPerSecond( int64_t numItems ) const { return ( m_totalTimeMS > 0.0 ) ? numItems / ( m_totalTimeMS / 1000.0 ) : 0.0; }
+
+    public:
+
+        char const*                     m_pName = nullptr;
+        TVector<double>                 m_frameTimesMS;
+        double                          m_totalTimeMS = 0.0;
+        uint64_t                        m_numAllocations = 0;
+        uint64_t                        m_numAllocatedBytes = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Claim all the allocations that occurred since the last claim, allocation tracking is only available in development builds
+    void ClaimAllocations( uint64_t& outNumAllocations, uint64_t& outNumAllocatedBytes );
+
+    // Append the frame timings for a stage (total, average, median, p95 and max) as JSON fields, each field is followed by a comma
+    void AppendStageTimings( String& json, StageResult& stage, char const* pIndent );
+
+    // Write the JSON results to the output file, the results are printed to stdout if the path is not set
+    bool WriteResults( FileSystem::Path const& outputFilePath, String const& json );
+}
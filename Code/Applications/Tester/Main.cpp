@@ -16,6 +16,8 @@
 #include "Base/Math/Matrix43.h"
 #include "Base/Math/Matrix.h"
 #include "Base/Settings/IniFile.h"
+#include "AnimationBenchmark.h"
+#include "PhysicsBenchmark.h"
 
 //-------------------------------------------------------------------------
 
@@ -31,6 +33,81 @@ int main( int argc, char *argv[] )
         TypeSystem::TypeRegistry typeRegistry;
         TypeSystem::Reflection::RegisterTypes( typeRegistry );
 
+        // Benchmarks
+        //-------------------------------------------------------------------------
+
+        CommandLineParser cmdLine;
+        cmdLine.AddOptionalBoolArg( "anim-benchmark", "Run the headless animation benchmark" );
+        cmdLine.AddOptionalStringArg( "graph", "The graph variation to benchmark, a synthetic benchmark is run if not set" );
+        cmdLine.AddOptionalStringArg( "output", "The file to write the JSON results to, printed to stdout if not set" );
+        cmdLine.AddOptionalIntArg( "instances", "The number of graph instances", 64 );
+        cmdLine.AddOptionalIntArg( "frames", "The number of measured frames", 300 );
+        cmdLine.AddOptionalIntArg( "warmup-frames", "The number of frames to run before measuring", 30 );
+        cmdLine.AddOptionalIntArg( "bones", "The number of bones in the synthetic skeleton", 100 );
+        cmdLine.AddOptionalIntArg( "seed", "The random seed", 1 );
+        cmdLine.AddOptionalBoolArg( "sample-cache", "Share sampled poses between graph instances via the pose sample cache" );
+        cmdLine.AddOptionalBoolArg( "physics-benchmark", "Run the headless physics query benchmark" );
+        cmdLine.AddOptionalIntArg( "queries", "The number of physics queries per frame", 4096 );
+        cmdLine.AddOptionalIntArg( "boxes", "The number of static boxes in the physics world", 2000 );
+
+        if ( !cmdLine.Parse( argc, argv ) )
+        {
+            std::cout << cmdLine.GetErrorMessage() << std::endl;
+            cmdLine.PrintHelp();
+            numTestFailures++;
+        }
+        else if ( cmdLine.GetBoolArg( "anim-benchmark" ) )
+        {
+            Animation::BenchmarkSettings benchmarkSettings;
+            benchmarkSettings.m_iniFilePath = FileSystem::GetCurrentProcessPath().Append( "Esoterica.ini" );
+            benchmarkSettings.m_numInstances = (int32_t) cmdLine.GetIntArg( "instances" );
+            benchmarkSettings.m_numFrames = (int32_t) cmdLine.GetIntArg( "frames" );
+            benchmarkSettings.m_numWarmupFrames = (int32_t) cmdLine.GetIntArg( "warmup-frames" );
+            benchmarkSettings.m_numSyntheticBones = (int32_t) cmdLine.GetIntArg( "bones" );
+            benchmarkSettings.m_seed = (uint32_t) cmdLine.GetIntArg( "seed" );
+            benchmarkSettings.m_useSampleCache = cmdLine.GetBoolArg( "sample-cache" );
+
+            if ( cmdLine.HasStringArg( "graph" ) )
+            {
+                benchmarkSettings.m_graphID = ResourceID( cmdLine.GetStringArg( "graph" ) );
+            }
+
+            if ( cmdLine.HasStringArg( "output" ) )
+            {
+                benchmarkSettings.m_outputFilePath = FileSystem::Path( cmdLine.GetStringArg( "output" ) );
+            }
+
+            if ( !Animation::RunBenchmark( typeRegistry, benchmarkSettings ) )
+            {
+                numTestFailures++;
+            }
+
+            TypeSystem::Reflection::UnregisterTypes( typeRegistry );
+            return numTestFailures;
+        }
+        else if ( cmdLine.GetBoolArg( "physics-benchmark" ) )
+        {
+            Physics::BenchmarkSettings benchmarkSettings;
+            benchmarkSettings.m_numQueries = (int32_t) cmdLine.GetIntArg( "queries" );
+            benchmarkSettings.m_numStaticBoxes = (int32_t) cmdLine.GetIntArg( "boxes" );
+            benchmarkSettings.m_numFrames = (int32_t) cmdLine.GetIntArg( "frames" );
+            benchmarkSettings.m_numWarmupFrames = (int32_t) cmdLine.GetIntArg( "warmup-frames" );
+            benchmarkSettings.m_seed = (uint32_t) cmdLine.GetIntArg( "seed" );
+
+            if ( cmdLine.HasStringArg( "output" ) )
+            {
+                benchmarkSettings.m_outputFilePath = FileSystem::Path( cmdLine.GetStringArg( "output" ) );
+            }
+
+            if ( !Physics::RunBenchmark( benchmarkSettings ) )
+            {
+                numTestFailures++;
+            }
+
+            TypeSystem::Reflection::UnregisterTypes( typeRegistry );
+            return numTestFailures;
+        }
+
         //-------------------------------------------------------------------------
 
     /*    String a( "TestStringA" );
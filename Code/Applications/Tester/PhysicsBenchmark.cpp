@@ -0,0 +1,266 @@
+#include "PhysicsBenchmark.h"
+#include "BenchmarkUtils.h"
+#include "Engine/Physics/Physics.h"
+#include "Engine/Physics/PhysicsWorld.h"
+#include "Engine/Physics/PhysicsMaterial.h"
+#include "Base/Systems.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Time/Timers.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    namespace
+    {
+        // Timings and hit counts for a single benchmark stage, all frames are wall clock times for all the queries in the frame
+        struct QueryStageResult : public Benchmark::StageResult
+        {
+            using Benchmark::StageResult::StageResult;
+
+            int64_t                         m_numHits = 0;
+            int32_t                         m_numHitsThisFrame = 0;                         // Used to validate that all the stages agree for every frame
+        };
+
+        // Time a single frame of a stage, the function returns the number of hits
+        template<typename Function>
+        static void RunStage( bool isMeasuredFrame, QueryStageResult& stageResult, Function&& function )
+        {
+            Timer<PlatformClock> timer;
+            timer.Start();
+
+            int32_t const numHits = function();
+
+            double const elapsedTimeMS = timer.GetElapsedTimeMilliseconds().ToFloat();
+            stageResult.m_numHitsThisFrame = numHits;
+
+            if ( isMeasuredFrame )
+            {
+                stageResult.AddFrame( elapsedTimeMS );
+                stageResult.m_numHits += numHits;
+            }
+        }
+
+        // All the stages run the same queries against the same world so they need to report the same number of hits
+        static bool ValidateHitCounts( TVector<QueryStageResult> const& stages, int32_t frameIdx )
+        {
+            bool hitCountsMatch = true;
+            for ( int32_t i = 1; i < (int32_t) stages.size(); i++ )
+            {
+                if ( stages[i].m_numHitsThisFrame != stages[0].m_numHitsThisFrame )
+                {
+                    EE_LOG_ERROR( LogCategory::Physics, "Benchmark", "Hit count mismatch in frame %d: %s reported %d hits, %s reported %d hits", frameIdx, stages[0].m_pName, stages[0].m_numHitsThisFrame, stages[i].m_pName, stages[i].m_numHitsThisFrame );
+                    hitCountsMatch = false;
+                }
+            }
+
+            return hitCountsMatch;
+        }
+
+        //-------------------------------------------------------------------------
+
+        static bool WriteResults( BenchmarkSettings const& settings, int32_t numWorkers, bool hitCountsMatch, TVector<QueryStageResult>& stages )
+        {
+            int64_t const numMeasuredQueries = int64_t( settings.m_numQueries ) * settings.m_numFrames;
+
+            String json;
+            json.append_sprintf( "{\n" );
+            json.append_sprintf( "  \"mode\": \"PhysicsQueries\",\n" );
+            json.append_sprintf( "  \"numStaticBoxes\": %d,\n", settings.m_numStaticBoxes );
+            json.append_sprintf( "  \"numQueries\": %d,\n", settings.m_numQueries );
+            json.append_sprintf( "  \"numFrames\": %d,\n", settings.m_numFrames );
+            json.append_sprintf( "  \"numWarmupFrames\": %d,\n", settings.m_numWarmupFrames );
+            json.append_sprintf( "  \"numWorkers\": %d,\n", numWorkers );
+            json.append_sprintf( "  \"seed\": %u,\n", settings.m_seed );
+            json.append_sprintf( "  \"hitCountsMatch\": %s,\n", hitCountsMatch ? "true" : "false" );
+            json.append_sprintf( "  \"stages\": [\n" );
+
+            for ( int32_t i = 0; i < (int32_t) stages.size(); i++ )
+            {
+                QueryStageResult& stage = stages[i];
+                json.append_sprintf( "    {\n" );
+                json.append_sprintf( "      \"name\": \"%s\",\n", stage.m_pName );
+                Benchmark::AppendStageTimings( json, stage, "      " );
+                json.append_sprintf( "      \"queriesPerSecond\": %.2f,\n", stage.GetItemsPerSecond( numMeasuredQueries ) );
+                json.append_sprintf( "      \"numHits\": %lld\n", (long long) stage.m_numHits );
+                json.append_sprintf( "    }%s\n", ( i < (int32_t) stages.size() - 1 ) ? "," : "" );
+            }
+
+            json.append_sprintf( "  ]\n" );
+            json.append_sprintf( "}\n" );
+
+            return Benchmark::WriteResults( settings.m_outputFilePath, json );
+        }
+
+        //-------------------------------------------------------------------------
+
+        static void CreateStaticBoxes( PhysicsWorld* pWorld, BenchmarkSettings const& settings, Math::RNG const& rng )
+        {
+            ScopedWriteLock const sl( pWorld );
+
+            b3BodyDef bodyDef = b3DefaultBodyDef();
+            bodyDef.type = b3_staticBody;
+
+            b3ShapeDef const shapeDef = b3DefaultShapeDef();
+
+            float const extents = settings.m_worldHalfExtents;
+            for ( int32_t i = 0; i < settings.m_numStaticBoxes; i++ )
+            {
+                Quaternion const rotation( Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ), Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ), Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ) );
+                bodyDef.rotation = ToBox3D( rotation );
+                bodyDef.position = ToBox3D( Vector( rng.GetFloat( -extents, extents ), rng.GetFloat( -extents, extents ), rng.GetFloat( -extents, extents ) ) );
+                b3BodyId const bodyID = b3CreateBody( pWorld->GetWorldID(), &bodyDef );
+
+                b3BoxHull const box = b3MakeBoxHull( rng.GetFloat( 0.5f, 4.0f ), rng.GetFloat( 0.5f, 4.0f ), rng.GetFloat( 0.5f, 4.0f ) );
+                b3CreateHullShape( bodyID, &shapeDef, &box.base );
+            }
+        }
+
+        static void CreateQueries( BenchmarkSettings const& settings, Math::RNG const& rng, BatchCastQueries& outQueries )
+        {
+            QueryRules rules( QueryCategory::Visibility );
+            rules.SetCollidesWithAll();
+
+            outQueries.Clear();
+            outQueries.Reserve( settings.m_numQueries );
+            int32_t const ruleIdx = outQueries.AddRules( rules );
+
+            float const extents = settings.m_worldHalfExtents;
+            for ( int32_t i = 0; i < settings.m_numQueries; i++ )
+            {
+                Vector const start( rng.GetFloat( -extents, extents ), rng.GetFloat( -extents, extents ), rng.GetFloat( -extents, extents ) );
+                Vector const direction = Vector( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ) ).GetNormalized3();
+                Vector const end = Vector::MultiplyAdd( direction, Vector( settings.m_queryLength ), start );
+
+                if ( rng.GetFloat() < settings.m_sphereCastProbability )
+                {
+                    outQueries.AddSphereCast( rng.GetFloat( 0.1f, 1.0f ), start, end, ruleIdx );
+                }
+                else
+                {
+                    outQueries.AddRayCast( start, end, ruleIdx );
+                }
+            }
+        }
+
+        // Execute a single query the same way gameplay code does, returns true if we hit something
+        static bool ExecutePerCallQuery( PhysicsWorld* pWorld, BatchCastQueries const& queries, int32_t queryIdx )
+        {
+            ScopedReadLock const sl( pWorld );
+
+            CastQuery query( queries.m_rules[queries.m_ruleIndices[queryIdx]] );
+            Vector const start( queries.m_starts[queryIdx] );
+            Vector const end( queries.m_ends[queryIdx] );
+
+            float const radius = queries.m_radii[queryIdx];
+            return ( radius > 0.0f ) ? pWorld->SphereCast( radius, start, end, query ) : pWorld->RayCast( start, end, query );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool RunBenchmark( BenchmarkSettings const& settings )
+    {
+        if ( settings.m_numQueries <= 0 || settings.m_numFrames <= 0 || settings.m_numStaticBoxes <= 0 )
+        {
+            EE_LOG_ERROR( LogCategory::Physics, "Benchmark", "Invalid benchmark settings, need at least one query, one frame and one static box" );
+            return false;
+        }
+
+        EE::TaskSystem taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 );
+        taskSystem.Initialize();
+
+        Core::Initialize();
+
+        MaterialRegistry materialRegistry;
+        materialRegistry.Initialize();
+
+        SystemRegistry systemRegistry;
+        systemRegistry.RegisterSystem( &taskSystem );
+        systemRegistry.RegisterSystem( &materialRegistry );
+
+        // Create world and queries
+        //-------------------------------------------------------------------------
+
+        Math::RNG rng( settings.m_seed );
+
+        PhysicsWorld* pWorld = EE::New<PhysicsWorld>( systemRegistry, true );
+        CreateStaticBoxes( pWorld, settings, rng );
+
+        BatchCastQueries queries;
+        CreateQueries( settings, rng, queries );
+        BatchCastResults results;
+
+        // Run
+        //-------------------------------------------------------------------------
+
+        TVector<QueryStageResult> stages = { QueryStageResult( "PerCall" ), QueryStageResult( "PerCallWide" ), QueryStageResult( "Batch" ) };
+        bool hitCountsMatch = true;
+
+        for ( int32_t frameIdx = 0; frameIdx < settings.m_numWarmupFrames + settings.m_numFrames; frameIdx++ )
+        {
+            bool const isMeasuredFrame = frameIdx >= settings.m_numWarmupFrames;
+
+            RunStage( isMeasuredFrame, stages[0], [&] ()
+            {
+                int32_t numHits = 0;
+                for ( int32_t i = 0; i < settings.m_numQueries; i++ )
+                {
+                    numHits += ExecutePerCallQuery( pWorld, queries, i ) ? 1 : 0;
+                }
+                return numHits;
+            } );
+
+            RunStage( isMeasuredFrame, stages[1], [&] ()
+            {
+                std::atomic<int32_t> numHits = 0;
+                AsyncTask queryTask( (uint32_t) settings.m_numQueries, [&] ( TaskSetPartition range, uint32_t threadnum )
+                {
+                    int32_t numRangeHits = 0;
+                    for ( uint32_t i = range.start; i < range.end; i++ )
+                    {
+                        numRangeHits += ExecutePerCallQuery( pWorld, queries, (int32_t) i ) ? 1 : 0;
+                    }
+                    numHits += numRangeHits;
+                } );
+
+                taskSystem.ScheduleTask( &queryTask );
+                taskSystem.WaitForTask( &queryTask );
+                return numHits.load();
+            } );
+
+            RunStage( isMeasuredFrame, stages[2], [&] ()
+            {
+                pWorld->BatchCast( queries, results );
+
+                int32_t numHits = 0;
+                for ( uint8_t hasHit : results.m_hasHit )
+                {
+                    numHits += hasHit;
+                }
+                return numHits;
+            } );
+
+            hitCountsMatch &= ValidateHitCounts( stages, frameIdx );
+        }
+
+        bool const succeeded = WriteResults( settings, (int32_t) taskSystem.GetNumWorkers(), hitCountsMatch, stages ) && hitCountsMatch;
+
+        // Shutdown
+        //-------------------------------------------------------------------------
+
+        EE::Delete( pWorld );
+
+        systemRegistry.UnregisterSystem( &materialRegistry );
+        systemRegistry.UnregisterSystem( &taskSystem );
+
+        materialRegistry.Shutdown();
+        Core::Shutdown();
+        taskSystem.Shutdown();
+
+        return succeeded;
+    }
+}
\ No newline at end of file
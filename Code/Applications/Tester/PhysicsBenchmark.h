@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Base/FileSystem/FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+// Physics Query Benchmark
+//-------------------------------------------------------------------------
+// Headless throughput benchmark for physics scene queries, used to compare the batched cast API against the per-call query path
+//
+// Builds a world of randomly placed static boxes, then each frame runs the same set of random ray and sphere casts through:
+//  * Per-call: one read lock, query object and cast per query on the calling thread (i.e. how gameplay code currently issues queries)
+//  * Per-call wide: the per-call path split across the task system workers
+//  * Batch: a single batched cast
+//
+// Results (per-stage frame timings, queries/sec and hit counts) are written as JSON so they can be compared between builds
+// The hit counts are compared between all stages every frame, any mismatch is logged and fails the benchmark
+
+namespace EE::Physics
+{
+    struct BenchmarkSettings
+    {
+        FileSystem::Path                    m_outputFilePath;                           // If not set, the results are printed to stdout
+        int32_t                             m_numStaticBoxes = 2000;
+        int32_t                             m_numQueries = 4096;                        // The number of queries per frame
+        int32_t                             m_numFrames = 100;
+        int32_t                             m_numWarmupFrames = 10;                     // Frames that are run before we start measuring
+        uint32_t                            m_seed = 1;
+        float                               m_worldHalfExtents = 100.0f;                // The boxes and query start points are placed within this extents around the origin
+        float                               m_queryLength = 50.0f;
+        float                               m_sphereCastProbability = 0.25f;            // The probability that a query is a sphere cast rather than a ray cast
+    };
+
+    // Run the benchmark and output the results, returns false if the benchmark could not be run
+    bool RunBenchmark( BenchmarkSettings const& settings );
+}
\ No newline at end of file
@@ -23,6 +23,7 @@ namespace EE
         TypeSystem::TypeRegistry*           m_pTypeRegistry = nullptr;
         SettingsRegistry*                   m_pSettingsRegistry = nullptr;
         Resource::ResourceSystem*           m_pResourceSystem = nullptr;
+        bool                                m_isHeadless = false;           // Headless engines have no window, render device or UI, modules should skip creating those systems
     };
 
     //-------------------------------------------------------------------------
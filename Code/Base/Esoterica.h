@@ -2,6 +2,7 @@
 
 #include "_Module/API.h"
 #include <stdint.h>
+#include <stdarg.h>
 
 //-------------------------------------------------------------------------
 
@@ -54,6 +55,8 @@ namespace EE::Platform
 
 #if _WIN32
 #include "Platform/Platform_Win32.h"
+#elif __linux__
+#include "Platform/Platform_Linux.h"
 #endif
 
 //-------------------------------------------------------------------------
@@ -245,7 +245,7 @@ namespace EE
             {
                 ClearSubFilename(); // Sub-filenames are not allowed!!!
 
-                EE_ASSERT( _stricmp( rhs.GetExtension().c_str(), T::GetStaticExtension().c_str() ) == 0 );
+                EE_ASSERT( StringUtils::CompareInsensitive( rhs.GetExtension().c_str(), T::GetStaticExtension().c_str() ) == 0 );
                 DataPath::operator=( rhs );
             }
         }
@@ -429,7 +429,7 @@ namespace EE::FileSystem
             return false;
         }
 
-        return _stricmp( inExtension, &m_fullpath.at( extensionIdx ) ) == 0;
+        return StringUtils::CompareInsensitive( inExtension, &m_fullpath.at( extensionIdx ) ) == 0;
     }
 
     char const* Path::GetExtension() const
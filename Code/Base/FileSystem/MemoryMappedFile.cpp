@@ -0,0 +1,32 @@
+#include "MemoryMappedFile.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    MemoryMappedFile::MemoryMappedFile( MemoryMappedFile&& rhs )
+    {
+        *this = std::move( rhs );
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=( MemoryMappedFile&& rhs )
+    {
+        if ( this != &rhs )
+        {
+            Close();
+
+            m_filePath = std::move( rhs.m_filePath );
+            m_pData = rhs.m_pData;
+            m_size = rhs.m_size;
+            m_pFileHandle = rhs.m_pFileHandle;
+            m_pMappingHandle = rhs.m_pMappingHandle;
+
+            rhs.m_pData = nullptr;
+            rhs.m_size = 0;
+            rhs.m_pFileHandle = nullptr;
+            rhs.m_pMappingHandle = nullptr;
+        }
+
+        return *this;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+// Read-only memory mapped file
+//-------------------------------------------------------------------------
+// Maps the entire file into the address space of the process, pages are faulted in by the OS on access
+// Used for large packed files where we want to serve reads as views into the file rather than copies
+
+namespace EE::FileSystem
+{
+    class EE_BASE_API MemoryMappedFile
+    {
+    public:
+
+        MemoryMappedFile() = default;
+        MemoryMappedFile( MemoryMappedFile const& ) = delete;
+        MemoryMappedFile( MemoryMappedFile&& rhs );
+        ~MemoryMappedFile() { Close(); }
+
+        MemoryMappedFile& operator=( MemoryMappedFile const& ) = delete;
+        MemoryMappedFile& operator=( MemoryMappedFile&& rhs );
+
+        bool Open( Path const& filePath );
+        void Close();
+
+        inline bool IsOpen() const { return m_pData != nullptr; }
+        inline uint8_t const* GetData() const { EE_ASSERT( IsOpen() ); return m_pData; }
+        inline size_t GetSize() const { return m_size; }
+        inline Path const& GetFilePath() const { return m_filePath; }
+
+        // Hint to the OS that we will soon need the specified range of the file
+        void Prefetch( size_t offset, size_t size ) const;
+
+    private:
+
+        Path                m_filePath;
+        uint8_t const*      m_pData = nullptr;
+        size_t              m_size = 0;
+        void*               m_pFileHandle = nullptr;
+        void*               m_pMappingHandle = nullptr;
+    };
+}
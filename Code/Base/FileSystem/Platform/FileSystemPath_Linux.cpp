@@ -0,0 +1,136 @@
+#ifdef __linux__
+#include "../FileSystemPath.h"
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    char const Path::s_pathDelimiter = '/';
+
+    //-------------------------------------------------------------------------
+
+    void Path::EnsureCorrectPathStringFormat()
+    {
+        struct stat fileStat;
+        if ( stat( m_fullpath.c_str(), &fileStat ) != 0 )
+        {
+            return;
+        }
+
+        bool const isPathADirectory = S_ISDIR( fileStat.st_mode );
+
+        //-------------------------------------------------------------------------
+
+        // Add trailing delimiter for directories
+        if ( isPathADirectory && !IsDirectoryPath() )
+        {
+            m_fullpath += s_pathDelimiter;
+            UpdatePathInternals();
+        }
+
+        // Remove trailing delimiter for files
+        else if ( !isPathADirectory && IsDirectoryPath() )
+        {
+            m_fullpath.pop_back();
+            UpdatePathInternals();
+        }
+    }
+
+    bool Path::GetFullPathString( char const* pPath, String& outPath )
+    {
+        if ( pPath == nullptr || pPath[0] == 0 )
+        {
+            outPath.clear();
+            return false;
+        }
+
+        // Paths authored on windows use backslashes, so accept either delimiter
+        InlineString inputPath( pPath );
+        for ( char& c : inputPath )
+        {
+            if ( c == '\\' )
+            {
+                c = s_pathDelimiter;
+            }
+        }
+
+        // Make the path absolute
+        InlineString workingBuffer;
+        if ( inputPath[0] != s_pathDelimiter )
+        {
+            char cwd[PATH_MAX];
+            if ( getcwd( cwd, PATH_MAX ) == nullptr )
+            {
+                outPath.clear();
+                return false;
+            }
+
+            workingBuffer = cwd;
+            workingBuffer += s_pathDelimiter;
+        }
+        workingBuffer += inputPath;
+
+        // Resolve '.' and '..' and remove duplicate delimiters, this is done lexically (like on windows) so it works for paths that dont exist yet
+        TInlineVector<InlineString, 32> pathElements;
+        StringUtils::Split( workingBuffer, pathElements, "/" );
+
+        InlineString fullPath;
+        TInlineVector<size_t, 32> elementStartIndices;
+        for ( InlineString const& element : pathElements )
+        {
+            if ( element == "." )
+            {
+                continue;
+            }
+
+            if ( element == ".." )
+            {
+                if ( !elementStartIndices.empty() )
+                {
+                    fullPath.resize( elementStartIndices.back() );
+                    elementStartIndices.pop_back();
+                }
+                continue;
+            }
+
+            elementStartIndices.emplace_back( fullPath.length() );
+            fullPath += s_pathDelimiter;
+            fullPath += element;
+        }
+
+        // Preserve the trailing delimiter and ensure directory paths have the final slash appended
+        bool isDirectoryPath = workingBuffer.back() == s_pathDelimiter || fullPath.empty();
+        if ( !isDirectoryPath )
+        {
+            struct stat fileStat;
+            isDirectoryPath = stat( fullPath.c_str(), &fileStat ) == 0 && S_ISDIR( fileStat.st_mode );
+        }
+
+        if ( isDirectoryPath )
+        {
+            fullPath += s_pathDelimiter;
+        }
+
+        outPath = fullPath.c_str();
+        return true;
+    }
+
+    bool Path::GetCorrectCaseForPath( char const* pPath, String& outPath )
+    {
+        // The file system is case sensitive, so the only thing to resolve are links
+        char buffer[PATH_MAX];
+        if ( realpath( pPath, buffer ) != nullptr )
+        {
+            outPath = buffer;
+            return true;
+        }
+
+        outPath = pPath;
+        return false;
+    }
+}
+#endif
\ No newline at end of file
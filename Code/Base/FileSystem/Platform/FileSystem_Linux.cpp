@@ -0,0 +1,166 @@
+#ifdef __linux__
+#include "../FileSystem.h"
+#include "Base/Platform/PlatformUtils_Linux.h"
+#include "Base/Math/Math.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    Path GetCurrentProcessPath()
+    {
+        return Path( EE::Platform::Linux::GetCurrentModulePath() ).GetParentDirectory();
+    }
+
+    bool Exists( char const* pPath )
+    {
+        struct stat fileStat;
+        return stat( pPath, &fileStat ) == 0;
+    }
+
+    bool IsReadOnly( char const* pPath )
+    {
+        return Exists( pPath ) && access( pPath, W_OK ) != 0;
+    }
+
+    bool IsExistingFile( char const* pPath )
+    {
+        struct stat fileStat;
+        return stat( pPath, &fileStat ) == 0 && !S_ISDIR( fileStat.st_mode );
+    }
+
+    bool IsExistingDirectory( char const* pPath )
+    {
+        struct stat fileStat;
+        return stat( pPath, &fileStat ) == 0 && S_ISDIR( fileStat.st_mode );
+    }
+
+    bool IsFileReadOnly( char const* pPath )
+    {
+        return IsExistingFile( pPath ) && access( pPath, W_OK ) != 0;
+    }
+
+    uint64_t GetFileModifiedTime( char const* path )
+    {
+        struct stat fileStat;
+        if ( stat( path, &fileStat ) != 0 )
+        {
+            return 0;
+        }
+
+        // Return the time in the same units as the win32 file times (100ns intervals since 1601) so that serialized timestamps are comparable across platforms
+        constexpr static uint64_t const s_secondsBetween1601And1970 = 11644473600ull;
+        return ( uint64_t( fileStat.st_mtim.tv_sec ) + s_secondsBetween1601And1970 ) * 10000000ull + uint64_t( fileStat.st_mtim.tv_nsec ) / 100;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool WriteFileToDisk( char const* pPath, void const* pData, size_t size, bool overwrite = true, bool flushToDisk = false )
+    {
+        int32_t const flags = O_WRONLY | O_CREAT | O_CLOEXEC | ( overwrite ? O_TRUNC : O_EXCL );
+        int32_t const fileDescriptor = open( pPath, flags, 0644 );
+        if ( fileDescriptor < 0 )
+        {
+            String const errorString = Platform::Linux::GetLastErrorMessage();
+            EE_LOG_ERROR( LogCategory::FileSystem, "WriteFile", "Failed to open file handle for write: %s, Error: %s", pPath, errorString.c_str() );
+            return false;
+        }
+
+        bool success = true;
+        uint8_t const* pWritePtr = static_cast<uint8_t const*>( pData );
+        size_t remainingBytes = size;
+
+        while ( remainingBytes > 0 )
+        {
+            ssize_t const bytesWritten = write( fileDescriptor, pWritePtr, remainingBytes );
+            if ( bytesWritten < 0 && errno == EINTR )
+            {
+                continue;
+            }
+
+            if ( bytesWritten <= 0 )
+            {
+                String const errorString = Platform::Linux::GetLastErrorMessage();
+                EE_LOG_ERROR( LogCategory::FileSystem, "WriteFile", "Failed to write file: %s, Error: %s", pPath, errorString.c_str() );
+                success = false;
+                break;
+            }
+
+            pWritePtr += bytesWritten;
+            remainingBytes -= (size_t) bytesWritten;
+        }
+
+        if ( success && flushToDisk )
+        {
+            success = ( fsync( fileDescriptor ) == 0 );
+        }
+
+        close( fileDescriptor );
+        return success;
+    }
+
+    bool ReadBinaryFile( char const* pPath, Blob& fileData )
+    {
+        EE_ASSERT( pPath != nullptr );
+
+        // Open file handle
+        int32_t const fileDescriptor = open( pPath, O_RDONLY | O_CLOEXEC );
+        if ( fileDescriptor < 0 )
+        {
+            String errorString = Platform::Linux::GetLastErrorMessage();
+            EE_LOG_ERROR( LogCategory::FileSystem, "ReadBinaryFile", "Failed to open file handle for read: %s, Error: %s", pPath, errorString.c_str() );
+            return false;
+        }
+
+        posix_fadvise( fileDescriptor, 0, 0, POSIX_FADV_SEQUENTIAL );
+
+        // Get file size
+        struct stat fileStat;
+        if ( fstat( fileDescriptor, &fileStat ) != 0 )
+        {
+            String const errorString = Platform::Linux::GetLastErrorMessage();
+            EE_LOG_ERROR( LogCategory::FileSystem, "ReadBinaryFile", "Failed to get file size for: %s, Error: %s", pPath, errorString.c_str() );
+            close( fileDescriptor );
+            return false;
+        }
+
+        // Allocate destination memory
+        size_t const fileSize = (size_t) fileStat.st_size;
+        fileData.resize( fileSize );
+
+        // Read file
+        static constexpr size_t const defaultReadBufferSize = 65536;
+        size_t remainingBytesToRead = fileSize;
+
+        uint8_t* pBuffer = fileData.data();
+        while ( remainingBytesToRead != 0 )
+        {
+            size_t const numBytesToRead = Math::Min( defaultReadBufferSize, remainingBytesToRead );
+            ssize_t const bytesRead = read( fileDescriptor, pBuffer, numBytesToRead );
+            if ( bytesRead < 0 && errno == EINTR )
+            {
+                continue;
+            }
+
+            if ( bytesRead <= 0 )
+            {
+                fileData.clear();
+                String const errorString = Platform::Linux::GetLastErrorMessage();
+                EE_LOG_ERROR( LogCategory::FileSystem, "ReadBinaryFile", "Failed to get read from binary file: %s, Error: %s", pPath, errorString.c_str() );
+                close( fileDescriptor );
+                return false;
+            }
+
+            pBuffer += bytesRead;
+            remainingBytesToRead -= (size_t) bytesRead;
+        }
+
+        close( fileDescriptor );
+        return true;
+    }
+}
+#endif
\ No newline at end of file
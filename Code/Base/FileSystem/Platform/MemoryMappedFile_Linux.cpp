@@ -0,0 +1,87 @@
+#ifdef __linux__
+#include "../MemoryMappedFile.h"
+#include "Base/Platform/PlatformUtils_Linux.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    bool MemoryMappedFile::Open( Path const& filePath )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+        EE_ASSERT( !IsOpen() );
+
+        // Open file handle
+        //-------------------------------------------------------------------------
+
+        int32_t const fileDescriptor = open( filePath.c_str(), O_RDONLY | O_CLOEXEC );
+        if ( fileDescriptor < 0 )
+        {
+            String const errorString = Platform::Linux::GetLastErrorMessage();
+            EE_LOG_ERROR( LogCategory::FileSystem, "Memory Mapped File", "Failed to open file handle for read: %s, Error: %s", filePath.c_str(), errorString.c_str() );
+            return false;
+        }
+
+        struct stat fileStat;
+        if ( fstat( fileDescriptor, &fileStat ) != 0 || fileStat.st_size == 0 )
+        {
+            EE_LOG_ERROR( LogCategory::FileSystem, "Memory Mapped File", "Failed to get file size or file is empty: %s", filePath.c_str() );
+            close( fileDescriptor );
+            return false;
+        }
+
+        // Map file
+        //-------------------------------------------------------------------------
+
+        size_t const fileSize = (size_t) fileStat.st_size;
+        void* pView = mmap( nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+
+        // The mapping keeps its own reference to the file, so we dont need to keep the descriptor around
+        close( fileDescriptor );
+
+        if ( pView == MAP_FAILED )
+        {
+            String const errorString = Platform::Linux::GetLastErrorMessage();
+            EE_LOG_ERROR( LogCategory::FileSystem, "Memory Mapped File", "Failed to map view of file: %s, Error: %s", filePath.c_str(), errorString.c_str() );
+            return false;
+        }
+
+        madvise( pView, fileSize, MADV_RANDOM );
+
+        //-------------------------------------------------------------------------
+
+        m_filePath = filePath;
+        m_pData = (uint8_t const*) pView;
+        m_size = fileSize;
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if ( m_pData != nullptr )
+        {
+            munmap( const_cast<uint8_t*>( m_pData ), m_size );
+            m_pData = nullptr;
+        }
+
+        m_size = 0;
+        m_filePath.Clear();
+    }
+
+    void MemoryMappedFile::Prefetch( size_t offset, size_t size ) const
+    {
+        EE_ASSERT( IsOpen() );
+        EE_ASSERT( offset + size <= m_size );
+
+        // madvise requires a page aligned start address
+        static size_t const s_pageSize = (size_t) sysconf( _SC_PAGESIZE );
+        uintptr_t const startAddress = uintptr_t( m_pData + offset );
+        uintptr_t const alignedStartAddress = startAddress & ~uintptr_t( s_pageSize - 1 );
+        madvise( (void*) alignedStartAddress, size + ( startAddress - alignedStartAddress ), MADV_WILLNEED );
+    }
+}
+#endif
\ No newline at end of file
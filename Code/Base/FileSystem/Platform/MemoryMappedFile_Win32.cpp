@@ -0,0 +1,101 @@
+#ifdef _WIN32
+#include "../MemoryMappedFile.h"
+#include "Base/Platform/PlatformUtils_Win32.h"
+#include <windows.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    bool MemoryMappedFile::Open( Path const& filePath )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+        EE_ASSERT( !IsOpen() );
+
+        // Open file handle
+        //-------------------------------------------------------------------------
+
+        HANDLE hFile = CreateFileA( filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr );
+        if ( hFile == INVALID_HANDLE_VALUE )
+        {
+            String const errorString = Platform::Win32::GetLastErrorMessage();
+            EE_LOG_ERROR( LogCategory::FileSystem, "Memory Mapped File", "Failed to open file handle for read: %s, Error: %s", filePath.c_str(), errorString.c_str() );
+            return false;
+        }
+
+        LARGE_INTEGER fileSizeLI;
+        if ( !GetFileSizeEx( hFile, &fileSizeLI ) || fileSizeLI.QuadPart == 0 )
+        {
+            EE_LOG_ERROR( LogCategory::FileSystem, "Memory Mapped File", "Failed to get file size or file is empty: %s", filePath.c_str() );
+            CloseHandle( hFile );
+            return false;
+        }
+
+        // Map file
+        //-------------------------------------------------------------------------
+
+        HANDLE hMapping = CreateFileMappingA( hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( hMapping == nullptr )
+        {
+            String const errorString = Platform::Win32::GetLastErrorMessage();
+            EE_LOG_ERROR( LogCategory::FileSystem, "Memory Mapped File", "Failed to create file mapping: %s, Error: %s", filePath.c_str(), errorString.c_str() );
+            CloseHandle( hFile );
+            return false;
+        }
+
+        void* pView = MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+        if ( pView == nullptr )
+        {
+            String const errorString = Platform::Win32::GetLastErrorMessage();
+            EE_LOG_ERROR( LogCategory::FileSystem, "Memory Mapped File", "Failed to map view of file: %s, Error: %s", filePath.c_str(), errorString.c_str() );
+            CloseHandle( hMapping );
+            CloseHandle( hFile );
+            return false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_filePath = filePath;
+        m_pData = (uint8_t const*) pView;
+        m_size = (size_t) fileSizeLI.QuadPart;
+        m_pFileHandle = hFile;
+        m_pMappingHandle = hMapping;
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if ( m_pData != nullptr )
+        {
+            UnmapViewOfFile( m_pData );
+            m_pData = nullptr;
+        }
+
+        if ( m_pMappingHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pMappingHandle );
+            m_pMappingHandle = nullptr;
+        }
+
+        if ( m_pFileHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pFileHandle );
+            m_pFileHandle = nullptr;
+        }
+
+        m_size = 0;
+        m_filePath.Clear();
+    }
+
+    void MemoryMappedFile::Prefetch( size_t offset, size_t size ) const
+    {
+        EE_ASSERT( IsOpen() );
+        EE_ASSERT( offset + size <= m_size );
+
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = (void*) ( m_pData + offset );
+        range.NumberOfBytes = size;
+        PrefetchVirtualMemory( GetCurrentProcess(), 1, &range, 0 );
+    }
+}
+#endif
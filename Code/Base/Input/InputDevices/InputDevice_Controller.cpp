@@ -1,5 +1,5 @@
 #include "InputDevice_Controller.h"
-#include "Base\Math\Vector.h"
+#include "Base/Math/Vector.h"
 
 //-------------------------------------------------------------------------
 
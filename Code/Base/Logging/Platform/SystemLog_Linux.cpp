@@ -0,0 +1,30 @@
+#ifdef __linux__
+#include "Base/Esoterica.h"
+#include <stdio.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::SystemLog
+{
+    void TraceMessage( const char* format, ... )
+    {
+        constexpr size_t const bufferSize = 2048;
+        char messageBuffer[bufferSize]; // Dont make this static as we need this to be threadsafe!!!
+
+        va_list args;
+        va_start( args, format );
+        int32_t numCharsWritten = vsnprintf( messageBuffer, bufferSize - 1, format, args );
+        va_end( args );
+
+        // Add newline
+        if ( numCharsWritten > 0 && numCharsWritten < int32_t( bufferSize - 1 ) )
+        {
+            messageBuffer[numCharsWritten] = '\n';
+            messageBuffer[numCharsWritten + 1] = 0;
+        }
+
+        // There is no debugger output channel on this platform, so trace to stderr instead
+        fputs( messageBuffer, stderr );
+    }
+}
+#endif
\ No newline at end of file
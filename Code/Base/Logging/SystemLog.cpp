@@ -272,7 +272,7 @@ namespace EE::SystemLog
         va_list args;
         va_start( args, pAssertInfoFormat );
         char buffer[512];
-        vsprintf_s( buffer, 512, pAssertInfoFormat, args );
+        vsnprintf( buffer, 512, pAssertInfoFormat, args );
         va_end( args );
 
         LogAssert( pFile, line, &buffer[0] );
@@ -1,4 +1,5 @@
 #include "AABBTree.h"
+#include "Base/Math/Intersection.h"
 #include "Base/Types/Color.h"
 #include "Base/Drawing/DebugDrawing.h"
 
@@ -62,26 +63,53 @@ namespace EE::Math
         EE_ASSERT( newBox.IsValid() );
 
         // All boxes must have a non-zero unique userdata value as that is also used as the ID
-        auto const Comparator = [] ( Node const& node, uint64_t userData ) { return !node.m_isFree && node.IsLeafNode() && node.m_userData == userData; };
-        EE_ASSERT( userData != 0 && !VectorContains( m_nodes, userData, Comparator ) );
+        EE_ASSERT( userData != 0 && !ContainsBox( userData ) );
+
+        int32_t leafNodeIdx = InvalidIndex;
 
         // First box
         if ( m_rootNodeIdx == InvalidIndex )
         {
-            RequestNode( newBox, userData );
-            m_rootNodeIdx = 0;
+            leafNodeIdx = RequestNode( newBox, userData );
+            m_rootNodeIdx = leafNodeIdx;
         }
         // If the root node is a leaf, the new box is a sibling
         else if ( m_nodes[m_rootNodeIdx].IsLeafNode() )
         {
-            InsertNode( m_rootNodeIdx, newBox, userData );
+            leafNodeIdx = InsertNode( m_rootNodeIdx, newBox, userData );
         }
         else // Find the best leaf node to create a sibling to
         {
             uint32_t bestNodeIdx = FindBestLeafNodeToCreateSiblingFor( m_rootNodeIdx, newBox );
             EE_ASSERT( bestNodeIdx != InvalidIndex );
-            InsertNode( bestNodeIdx, newBox, userData );
+            leafNodeIdx = InsertNode( bestNodeIdx, newBox, userData );
+        }
+
+        m_leafNodeIndices[userData] = leafNodeIdx;
+    }
+
+    bool AABBTree::UpdateBox( AABB const& aabb, uint64_t userData, float margin )
+    {
+        EE_ASSERT( aabb.IsValid() && margin >= 0.0f );
+
+        auto iter = m_leafNodeIndices.find( userData );
+        EE_ASSERT( iter != m_leafNodeIndices.end() );
+
+        // Nothing to do if the box is still contained by the stored (inflated) box
+        AABB const& storedBox = m_nodes[iter->second].m_bounds;
+        if ( storedBox.ContainsPoint( aabb.GetMin() ) && storedBox.ContainsPoint( aabb.GetMax() ) )
+        {
+            return false;
         }
+
+        // Re-insert the box
+        RemoveNode( iter->second );
+        m_leafNodeIndices.erase( iter );
+
+        AABB inflatedBox = aabb;
+        inflatedBox.Expand( Vector( margin ) );
+        InsertBox( inflatedBox, userData );
+        return true;
     }
 
     void AABBTree::UpdateBranchNodeBounds( int32_t nodeIdx )
@@ -93,7 +121,7 @@ namespace EE::Math
         currentNode.m_volume = currentNode.m_bounds.GetVolume();
     }
 
-    void AABBTree::InsertNode( int32_t originalLeafNodeIdx, AABB const& newSiblingBox, uint64_t userData )
+    int32_t AABBTree::InsertNode( int32_t originalLeafNodeIdx, AABB const& newSiblingBox, uint64_t userData )
     {
         EE_ASSERT( newSiblingBox.IsValid() );
 
@@ -142,12 +170,18 @@ namespace EE::Math
             UpdateBranchNodeBounds( parentIndex );
             parentIndex = m_nodes[parentIndex].m_parentNodeIdx;
         }
+
+        return newSiblingNodeIdx;
     }
 
     void AABBTree::RemoveBox( uint64_t userData )
     {
-        int32_t const nodeToRemoveIdx = VectorFindIndex( m_nodes, userData, [] ( Node const& node, uint64_t userData ) { return !node.m_isFree && node.IsLeafNode() && node.m_userData == userData; } );
-        EE_ASSERT( nodeToRemoveIdx != InvalidIndex && m_nodes[nodeToRemoveIdx].IsLeafNode() );
+        auto iter = m_leafNodeIndices.find( userData );
+        EE_ASSERT( iter != m_leafNodeIndices.end() );
+
+        int32_t const nodeToRemoveIdx = iter->second;
+        EE_ASSERT( !m_nodes[nodeToRemoveIdx].m_isFree && m_nodes[nodeToRemoveIdx].IsLeafNode() && m_nodes[nodeToRemoveIdx].m_userData == userData );
+        m_leafNodeIndices.erase( iter );
         RemoveNode( nodeToRemoveIdx );
     }
 
@@ -271,6 +305,44 @@ namespace EE::Math
         return outResults.size() > 0;
     }
 
+    bool AABBTree::FindOverlaps( Ray const& ray, TVector<uint64_t>& outResults ) const
+    {
+        outResults.clear();
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        // Iterative traversal, this is called a lot for batched queries so we avoid the recursion
+        TInlineVector<int32_t, 64> nodeStack;
+        nodeStack.emplace_back( m_rootNodeIdx );
+
+        while ( !nodeStack.empty() )
+        {
+            Node const& currentNode = m_nodes[nodeStack.back()];
+            nodeStack.pop_back();
+
+            if ( !Math::IntersectRayBox( ray, currentNode.m_bounds ) )
+            {
+                continue;
+            }
+
+            if ( currentNode.IsLeafNode() )
+            {
+                EE_ASSERT( currentNode.m_userData != 0 );
+                outResults.push_back( currentNode.m_userData );
+            }
+            else
+            {
+                nodeStack.emplace_back( currentNode.m_leftNodeIdx );
+                nodeStack.emplace_back( currentNode.m_rightNodeIdx );
+            }
+        }
+
+        return outResults.size() > 0;
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
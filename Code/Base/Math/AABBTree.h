@@ -2,10 +2,11 @@
 
 #include "Base/Math/BoundingVolumes.h"
 #include "Base/Types/Arrays.h"
+#include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
-namespace EE { class DebugDrawContext; }
+namespace EE { class DebugDrawContext; class Ray; }
 
 //-------------------------------------------------------------------------
 
@@ -41,12 +42,21 @@ namespace EE::Math
         AABBTree();
 
         inline bool IsEmpty() const { return m_rootNodeIdx == InvalidIndex; }
+        inline int32_t GetNumBoxes() const { return (int32_t) m_leafNodeIndices.size(); }
 
         void InsertBox( AABB const& aabb, uint64_t userData );
         void RemoveBox( uint64_t userData );
+        inline bool ContainsBox( uint64_t userData ) const { return m_leafNodeIndices.find( userData ) != m_leafNodeIndices.end(); }
+
+        // Update the bounds for an existing box, the tree is only modified if the new box is no longer contained by the stored box
+        // When the tree is modified, the stored box is inflated by the supplied margin so that small movements don't require further updates
+        // Returns true if the tree was modified
+        bool UpdateBox( AABB const& aabb, uint64_t userData, float margin = 0.0f );
 
         EE_FORCE_INLINE void InsertBox( AABB const& aabb, void* pUserData ) { InsertBox( aabb, reinterpret_cast<uint64_t>( pUserData ) ); }
         EE_FORCE_INLINE void RemoveBox( void* pUserData ) { RemoveBox( reinterpret_cast<uint64_t>( pUserData ) ); }
+        EE_FORCE_INLINE bool ContainsBox( void* pUserData ) const { return ContainsBox( reinterpret_cast<uint64_t>( pUserData ) ); }
+        EE_FORCE_INLINE bool UpdateBox( AABB const& aabb, void* pUserData, float margin = 0.0f ) { return UpdateBox( aabb, reinterpret_cast<uint64_t>( pUserData ), margin ); }
 
         bool FindOverlaps( AABB const& queryBox, TVector<uint64_t>& outResults ) const;
 
@@ -56,13 +66,22 @@ namespace EE::Math
             return FindOverlaps( queryBox, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
         }
 
+        // Find all boxes intersected by the ray, this is const and so can safely be called from multiple threads at once
+        bool FindOverlaps( Ray const& ray, TVector<uint64_t>& outResults ) const;
+
+        template<typename T>
+        bool FindOverlaps( Ray const& ray, TVector<T*>& outResults ) const
+        {
+            return FindOverlaps( ray, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
         #if EE_DEVELOPMENT_TOOLS
         void DrawDebug( DebugDrawContext& drawingContext ) const;
         #endif
 
     private:
 
-        void InsertNode( int32_t leafNodeIdx, AABB const& newSiblingBox, uint64_t userData );
+        int32_t InsertNode( int32_t leafNodeIdx, AABB const& newSiblingBox, uint64_t userData );
         void RemoveNode( int32_t nodeToRemoveIdx );
         void UpdateBranchNodeBounds( int32_t nodeIdx );
 
@@ -80,9 +99,10 @@ namespace EE::Math
 
     private:
 
-        TVector<Node>       m_nodes;
-        int32_t               m_rootNodeIdx = InvalidIndex;
-        int32_t               m_freeNodeIdx = 0;
+        TVector<Node>                   m_nodes;
+        THashMap<uint64_t, int32_t>     m_leafNodeIndices;  // Leaf node index for each box, leaf nodes never move so these remain valid until the box is removed
+        int32_t                         m_rootNodeIdx = InvalidIndex;
+        int32_t                         m_freeNodeIdx = 0;
     };
 }
 
@@ -3,6 +3,8 @@
 #include "Base/_Module/API.h"
 #include "Base/Esoterica.h"
 #include "Base/ThirdParty/pcg/include/pcg_random.hpp"
+#include <math.h>
+#include <limits.h>
 
 //-------------------------------------------------------------------------
 
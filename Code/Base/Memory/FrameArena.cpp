@@ -0,0 +1,263 @@
+#include "FrameArena.h"
+#include <mutex>
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Memory
+{
+    namespace Allocators
+    {
+        MemoryAllocator g_frameArena( "Frame Arena" );
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace FrameArena
+    {
+        constexpr static size_t const s_defaultBlockSize = 256 * 1024;
+        constexpr static size_t const s_blockAlignment = 64;
+
+        // Blocks (other than the first) that have not been used for this many frames are released, so that a one-off spike doesnt hold onto the memory forever
+        constexpr static uint64_t const s_numUnusedFramesBeforeRelease = 120;
+
+        //-------------------------------------------------------------------------
+
+        struct Block
+        {
+            Block*                  m_pNext = nullptr;
+            uint8_t*                m_pStart = nullptr;
+            uint8_t*                m_pEnd = nullptr;
+            uint64_t                m_lastUsedFrameIdx = 0;
+        };
+
+        constexpr static size_t const s_blockHeaderSize = ( sizeof( Block ) + s_blockAlignment - 1 ) & ~( s_blockAlignment - 1 );
+
+        // Each thread's blocks form a list, the blocks before (and including) the current block are in use this frame, the ones after it are free
+        struct ThreadArena
+        {
+            Block*                  m_pFirstBlock = nullptr;
+            Block*                  m_pCurrentBlock = nullptr;
+            uint8_t*                m_pCursor = nullptr;
+            ThreadArena*            m_pNextArena = nullptr;
+        };
+
+        //-------------------------------------------------------------------------
+
+        static std::mutex                   g_arenaListMutex;
+        static ThreadArena*                 g_pArenaList = nullptr;
+        static std::atomic<uint64_t>        g_frameIdx = 0;
+        static std::atomic<size_t>          g_reservedMemory = 0;
+        static thread_local ThreadArena*    t_pThreadArena = nullptr;
+
+        //-------------------------------------------------------------------------
+
+        static Block* CreateBlock( size_t minUsableSize )
+        {
+            size_t const usableSize = std::max( s_defaultBlockSize, minUsableSize );
+            size_t const totalSize = s_blockHeaderSize + usableSize;
+
+            uint8_t* pMemory = reinterpret_cast<uint8_t*>( Allocators::g_frameArena.Alloc( totalSize, s_blockAlignment ) );
+            EE_ASSERT( pMemory != nullptr );
+
+            Block* pBlock = new ( pMemory ) Block();
+            pBlock->m_pStart = pMemory + s_blockHeaderSize;
+            pBlock->m_pEnd = pBlock->m_pStart + usableSize;
+            pBlock->m_lastUsedFrameIdx = g_frameIdx.load( std::memory_order_relaxed );
+
+            g_reservedMemory.fetch_add( totalSize );
+            return pBlock;
+        }
+
+        static void DestroyBlock( Block* pBlock )
+        {
+            g_reservedMemory.fetch_sub( size_t( pBlock->m_pEnd - reinterpret_cast<uint8_t*>( pBlock ) ) );
+
+            void* pMemory = pBlock;
+            Allocators::g_frameArena.Free( pMemory );
+        }
+
+        static ThreadArena* GetThreadArena()
+        {
+            if ( t_pThreadArena == nullptr )
+            {
+                ThreadArena* pArena = new ( Allocators::g_frameArena.Alloc( sizeof( ThreadArena ), EE_DEFAULT_ALIGNMENT ) ) ThreadArena();
+                pArena->m_pFirstBlock = CreateBlock( s_defaultBlockSize );
+                pArena->m_pCurrentBlock = pArena->m_pFirstBlock;
+                pArena->m_pCursor = pArena->m_pFirstBlock->m_pStart;
+
+                {
+                    std::lock_guard<std::mutex> lock( g_arenaListMutex );
+                    pArena->m_pNextArena = g_pArenaList;
+                    g_pArenaList = pArena;
+                }
+
+                t_pThreadArena = pArena;
+            }
+
+            return t_pThreadArena;
+        }
+
+        // Move to the next block that can fit the requested allocation, creating a new block if none of the free ones are big enough
+        static uint8_t* AllocateFromNextBlock( ThreadArena* pArena, size_t size, size_t alignment )
+        {
+            size_t const requiredSize = size + alignment;
+
+            Block* pPreviousBlock = pArena->m_pCurrentBlock;
+            Block* pBlock = pPreviousBlock->m_pNext;
+            while ( pBlock != nullptr && size_t( pBlock->m_pEnd - pBlock->m_pStart ) < requiredSize )
+            {
+                pPreviousBlock = pBlock;
+                pBlock = pBlock->m_pNext;
+            }
+
+            if ( pBlock == nullptr )
+            {
+                pBlock = CreateBlock( requiredSize );
+            }
+            else
+            {
+                pPreviousBlock->m_pNext = pBlock->m_pNext;
+            }
+
+            // Insert the block directly after the current one and make it current
+            pBlock->m_pNext = pArena->m_pCurrentBlock->m_pNext;
+            pBlock->m_lastUsedFrameIdx = g_frameIdx.load( std::memory_order_relaxed );
+            pArena->m_pCurrentBlock->m_pNext = pBlock;
+            pArena->m_pCurrentBlock = pBlock;
+
+            return pBlock->m_pStart + CalculatePaddingForAlignment( pBlock->m_pStart, alignment );
+        }
+
+        //-------------------------------------------------------------------------
+
+        void* Alloc( size_t size, size_t alignment, MemoryAllocator& category )
+        {
+            EE_ASSERT( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+
+            if ( size == 0 )
+            {
+                return nullptr;
+            }
+
+            ThreadArena* pArena = GetThreadArena();
+
+            size_t const padding = CalculatePaddingForAlignment( pArena->m_pCursor, alignment );
+            size_t const availableSize = size_t( pArena->m_pCurrentBlock->m_pEnd - pArena->m_pCursor );
+
+            uint8_t* pMemory = nullptr;
+            if ( padding + size <= availableSize )
+            {
+                pMemory = pArena->m_pCursor + padding;
+            }
+            else
+            {
+                pMemory = AllocateFromNextBlock( pArena, size, alignment );
+            }
+
+            pArena->m_pCursor = pMemory + size;
+
+            #if EE_DEVELOPMENT_TOOLS
+            category.RecordFrameAllocation( size );
+            #endif
+
+            EE_ASSERT( IsAligned( pMemory, alignment ) );
+            return pMemory;
+        }
+
+        void Reset()
+        {
+            uint64_t const frameIdx = g_frameIdx.load();
+
+            {
+                std::lock_guard<std::mutex> lock( g_arenaListMutex );
+
+                for ( ThreadArena* pArena = g_pArenaList; pArena != nullptr; pArena = pArena->m_pNextArena )
+                {
+                    // Stomp all the memory used this frame, to catch anyone holding onto frame memory
+                    #ifdef EE_DEBUG
+                    for ( Block* pBlock = pArena->m_pFirstBlock; pBlock != nullptr; pBlock = pBlock->m_pNext )
+                    {
+                        uint8_t* pUsedEnd = ( pBlock == pArena->m_pCurrentBlock ) ? pArena->m_pCursor : pBlock->m_pEnd;
+                        memset( pBlock->m_pStart, 0xCD, size_t( pUsedEnd - pBlock->m_pStart ) );
+
+                        if ( pBlock == pArena->m_pCurrentBlock )
+                        {
+                            break;
+                        }
+                    }
+                    #endif
+
+                    // Release any stale blocks, we always keep the first block
+                    Block* pPreviousBlock = pArena->m_pFirstBlock;
+                    Block* pBlock = pPreviousBlock->m_pNext;
+                    while ( pBlock != nullptr )
+                    {
+                        if ( ( frameIdx - pBlock->m_lastUsedFrameIdx ) > s_numUnusedFramesBeforeRelease )
+                        {
+                            pPreviousBlock->m_pNext = pBlock->m_pNext;
+                            DestroyBlock( pBlock );
+                            pBlock = pPreviousBlock->m_pNext;
+                        }
+                        else
+                        {
+                            pPreviousBlock = pBlock;
+                            pBlock = pBlock->m_pNext;
+                        }
+                    }
+
+                    pArena->m_pFirstBlock->m_lastUsedFrameIdx = frameIdx + 1;
+                    pArena->m_pCurrentBlock = pArena->m_pFirstBlock;
+                    pArena->m_pCursor = pArena->m_pFirstBlock->m_pStart;
+                }
+            }
+
+            // Update the per-category high-water marks
+            #if EE_DEVELOPMENT_TOOLS
+            for ( MemoryAllocator* pMemoryAllocator = MemoryAllocator::GetHead(); pMemoryAllocator != nullptr; pMemoryAllocator = pMemoryAllocator->GetNextItem() )
+            {
+                pMemoryAllocator->EndFrame();
+            }
+            #endif
+
+            g_frameIdx.fetch_add( 1 );
+        }
+
+        void Shutdown()
+        {
+            std::lock_guard<std::mutex> lock( g_arenaListMutex );
+
+            ThreadArena* pArena = g_pArenaList;
+            while ( pArena != nullptr )
+            {
+                Block* pBlock = pArena->m_pFirstBlock;
+                while ( pBlock != nullptr )
+                {
+                    Block* pNextBlock = pBlock->m_pNext;
+                    DestroyBlock( pBlock );
+                    pBlock = pNextBlock;
+                }
+
+                ThreadArena* pNextArena = pArena->m_pNextArena;
+                void* pMemory = pArena;
+                Allocators::g_frameArena.Free( pMemory );
+                pArena = pNextArena;
+            }
+
+            g_pArenaList = nullptr;
+
+            // Only the calling thread's pointer can be cleared, the other threads are expected to have been shutdown at this point
+            t_pThreadArena = nullptr;
+        }
+
+        uint64_t GetFrameIndex()
+        {
+            return g_frameIdx.load();
+        }
+
+        size_t GetReservedMemory()
+        {
+            return g_reservedMemory.load();
+        }
+    }
+}
\ No newline at end of file
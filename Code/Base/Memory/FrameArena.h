@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Base/Memory/Memory.h"
+#include <type_traits>
+
+//-------------------------------------------------------------------------
+// Frame Arena
+//-------------------------------------------------------------------------
+// A linear (bump) allocator for transient per-frame data, each thread gets its own set of blocks so allocation is lock free.
+// All frame allocations are released in one go when the arena is reset at the end of the engine frame (after the FrameEnd stage).
+//
+// Rules:
+// * Frame memory is only valid until the end of the current frame, never store it in anything that outlives the frame.
+// * Frees are no-ops, so containers that grow repeatedly will waste the memory of their previous buffers - reserve if you know the size.
+// * Tasks that span multiple frames must not allocate from the arena.
+//
+// Allocations are attributed to a memory allocator category, which tracks the per-frame usage and the high-water mark for that category.
+// Use the TFrameVector/TInlineFrameVector containers (Arrays.h) to opt in.
+
+namespace EE::Memory
+{
+    namespace Allocators
+    {
+        EE_BASE_API extern MemoryAllocator g_frameArena;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace FrameArena
+    {
+        // Allocate transient memory from the calling thread's arena, this memory is released when the arena is reset
+        [[nodiscard]] EE_BASE_API void* Alloc( size_t size, size_t alignment = EE_DEFAULT_ALIGNMENT, MemoryAllocator& category = Allocators::g_frameArena );
+
+        template<typename T>
+        [[nodiscard]] EE_FORCE_INLINE T* AllocArray( size_t numElements, MemoryAllocator& category = Allocators::g_frameArena )
+        {
+            static_assert( std::is_trivially_destructible<T>::value, "Frame arena memory is never destructed" );
+            return reinterpret_cast<T*>( Alloc( sizeof( T ) * numElements, alignof( T ) > EE_DEFAULT_ALIGNMENT ? alignof( T ) : EE_DEFAULT_ALIGNMENT, category ) );
+        }
+
+        // Release all frame allocations (for all threads), must be called once per frame when no tasks are running
+        EE_BASE_API void Reset();
+
+        // Release all the memory held by the arena, called on memory system shutdown
+        EE_BASE_API void Shutdown();
+
+        // The number of times the arena has been reset
+        EE_BASE_API uint64_t GetFrameIndex();
+
+        // The total number of bytes reserved by all threads' arenas
+        EE_BASE_API size_t GetReservedMemory();
+    }
+}
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "Memory.h"
+#include "FrameArena.h"
 
 //-------------------------------------------------------------------------
 
@@ -9,10 +10,13 @@
 #endif
 
 #include <immintrin.h>
+#include <atomic>
 
 #ifdef _WIN32
 // TODO: Get rid of this
 #include <windows.h>
+#elif __linux__
+#include <sys/mman.h>
 #endif
 
 //-------------------------------------------------------------------------
@@ -57,6 +61,10 @@ namespace EE
         void Shutdown()
         {
             EE_ASSERT( g_isMemorySystemInitialized );
+
+            // Release all the frame arena blocks, these are held until shutdown so need to be freed before we check for leaks
+            FrameArena::Shutdown();
+
             g_isMemorySystemInitialized = false;
 
             #if EE_USE_CUSTOM_ALLOCATOR
@@ -209,7 +217,7 @@ namespace EE
             // Copy remaining 128-bit block. It should have up to 1 block.
             if ( numBlocks128 )
             {
-                _mm_store_si128( pDst128, _mm_stream_load_si128( pSrc128 ) );
+                _mm_store_si128( pDst128, _mm_stream_load_si128( const_cast<__m128i*>( pSrc128 ) ) );
             }
 
             // Copy remaining 32-bit blocks. It should have up to 3 blocks.
@@ -226,20 +234,36 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
-        static int64_t volatile s_totalVirtualMemoryCommitted = 0;
+        static std::atomic<int64_t> s_totalVirtualMemoryCommitted = 0;
 
         void* VirtualMemoryReserve( size_t size )
         {
             EE_ASSERT( size );
+
+            #if _WIN32
             return VirtualAlloc( 0, size, MEM_RESERVE, PAGE_READWRITE );
+            #else
+            // Reserve the address range without backing it, the pages are inaccessible until they are committed
+            void* pMemory = mmap( nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+            return ( pMemory == MAP_FAILED ) ? nullptr : pMemory;
+            #endif
         }
 
         void VirtualMemoryCommit( void* pStart, size_t size )
         {
             EE_ASSERT( pStart );
             EE_ASSERT( size );
+
+            #if _WIN32
             VirtualAlloc( pStart, size, MEM_COMMIT, PAGE_READWRITE );
-            InterlockedAdd64( &s_totalVirtualMemoryCommitted, size );
+            #else
+            // Physical pages are only allocated on first touch, so committing just makes the range accessible
+            int32_t const result = mprotect( pStart, size, PROT_READ | PROT_WRITE );
+            EE_ASSERT( result == 0 );
+            madvise( pStart, size, MADV_WILLNEED );
+            #endif
+
+            s_totalVirtualMemoryCommitted.fetch_add( int64_t( size ) );
         }
 
         void VirtualMemoryFree( void* pMemory, size_t reservedSize, size_t committedSize )
@@ -247,8 +271,14 @@ namespace EE
             EE_ASSERT( pMemory );
             EE_ASSERT( reservedSize );
             EE_ASSERT( committedSize );
+
+            #if _WIN32
             VirtualFree( pMemory, 0, MEM_RELEASE );
-            InterlockedAdd64( &s_totalVirtualMemoryCommitted, -int64_t( committedSize ) );
+            #else
+            munmap( pMemory, reservedSize );
+            #endif
+
+            s_totalVirtualMemoryCommitted.fetch_sub( int64_t( committedSize ) );
         }
 
         //-------------------------------------------------------------------------
@@ -322,6 +352,12 @@ namespace EE
     {
         return m_numAllocationsAccumulated.exchange( 0 );
     }
+
+    void Memory::MemoryAllocator::EndFrame()
+    {
+        m_numFrameBytesLastFrame = m_numFrameBytes.exchange( 0 );
+        m_frameBytesHighWaterMark = std::max( m_frameBytesHighWaterMark, m_numFrameBytesLastFrame );
+    }
     #endif
 
     void* Memory::MemoryAllocator::Alloc( size_t size, size_t alignment )
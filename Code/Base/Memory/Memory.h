@@ -22,8 +22,10 @@
 
 #else
 
-#define EE_STACK_ALLOC( x )
-#define EE_STACK_ARRAY_ALLOC( type, numElements )
+#include <alloca.h>
+
+#define EE_STACK_ALLOC( x ) alloca( x )
+#define EE_STACK_ARRAY_ALLOC( type, numElements ) reinterpret_cast<type*>( alloca( sizeof( type ) * numElements ) );
 
 #endif
 
@@ -162,6 +164,14 @@ namespace EE
             uint64_t ClaimAccumulatedBytes();
             uint64_t ClaimAccumulatedAllocations();
 
+            // Frame arena usage (see FrameArena.h), these are transient allocations so are not included in the byte/allocation counts above
+            EE_FORCE_INLINE void RecordFrameAllocation( size_t size ) { m_numFrameBytes.fetch_add( size ); }
+            EE_FORCE_INLINE uint64_t GetNumFrameBytesLastFrame() const { return m_numFrameBytesLastFrame; }
+            EE_FORCE_INLINE uint64_t GetFrameBytesHighWaterMark() const { return m_frameBytesHighWaterMark; }
+
+            // Called by the frame arena when it is reset, updates the high-water mark
+            void EndFrame();
+
         private:
 
             // These atomics need to be FIRST in the memory layout - aligned to cache line!
@@ -169,10 +179,12 @@ namespace EE
             eastl::atomic<uint64_t>     m_numAllocations = 0;
             eastl::atomic<uint64_t>     m_numBytesAccumulated = 0;
             eastl::atomic<uint64_t>     m_numAllocationsAccumulated = 0;
+            eastl::atomic<uint64_t>     m_numFrameBytes = 0;
 
             char const*                 m_pName = nullptr;
 
-            uint64_t                    m_padding[2] = {};
+            uint64_t                    m_numFrameBytesLastFrame = 0;
+            uint64_t                    m_frameBytesHighWaterMark = 0;
         };
         #else
         class EE_BASE_API MemoryAllocator
@@ -0,0 +1,130 @@
+#ifdef __linux__
+#include "PlatformUtils_Linux.h"
+#include "Base/Memory/Memory.h"
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <string.h>
+#include <unistd.h>
+#include <limits.h>
+
+extern char** environ;
+
+//-------------------------------------------------------------------------
+
+namespace EE::Platform::Linux
+{
+    namespace
+    {
+        static String ReadLink( char const* pLinkPath )
+        {
+            char buffer[PATH_MAX];
+            ssize_t const length = readlink( pLinkPath, buffer, PATH_MAX - 1 );
+            if ( length <= 0 )
+            {
+                return String();
+            }
+
+            return String( buffer, (size_t) length );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    uint32_t GetProcessID( char const* processName )
+    {
+        EE_ASSERT( processName != nullptr );
+
+        // The kernel truncates the process name stored in 'comm', so compare against the name of the executable instead
+        uint32_t processID = 0;
+        DIR* pProcDirectory = opendir( "/proc" );
+        if ( pProcDirectory == nullptr )
+        {
+            return processID;
+        }
+
+        dirent* pEntry = nullptr;
+        while ( ( pEntry = readdir( pProcDirectory ) ) != nullptr )
+        {
+            char* pEnd = nullptr;
+            long const pid = strtol( pEntry->d_name, &pEnd, 10 );
+            if ( *pEnd != 0 || pid <= 0 )
+            {
+                continue;
+            }
+
+            String const exePath = GetProcessPath( (uint32_t) pid );
+            size_t const lastDelimiterIdx = exePath.rfind( '/' );
+            char const* pExeName = ( lastDelimiterIdx == String::npos ) ? exePath.c_str() : exePath.c_str() + lastDelimiterIdx + 1;
+            if ( strcmp( pExeName, processName ) == 0 )
+            {
+                processID = (uint32_t) pid;
+                break;
+            }
+        }
+
+        closedir( pProcDirectory );
+        return processID;
+    }
+
+    uint32_t StartProcess( char const* exePath, char const* cmdLine )
+    {
+        EE_ASSERT( exePath != nullptr );
+
+        // Use exec so that the returned ID is the ID of the started process rather than the shell's
+        InlineString fullCmdLine( InlineString::CtorSprintf(), "exec \"%s\"", exePath );
+        if ( cmdLine != nullptr )
+        {
+            fullCmdLine.append_sprintf( " %s", cmdLine );
+        }
+
+        char shellPath[] = "/bin/sh";
+        char shellArg[] = "-c";
+        char* args[] = { shellPath, shellArg, fullCmdLine.data(), nullptr };
+
+        pid_t pid = 0;
+        if ( posix_spawn( &pid, shellPath, nullptr, nullptr, args, environ ) == 0 )
+        {
+            return (uint32_t) pid;
+        }
+
+        return 0;
+    }
+
+    bool KillProcess( uint32_t processID )
+    {
+        EE_ASSERT( processID != 0 );
+        return kill( (pid_t) processID, SIGKILL ) == 0;
+    }
+
+    String GetProcessPath( uint32_t processID )
+    {
+        EE_ASSERT( processID != 0 );
+
+        char linkPath[64];
+        snprintf( linkPath, 64, "/proc/%u/exe", processID );
+        return ReadLink( linkPath );
+    }
+
+    String GetCurrentModulePath()
+    {
+        return ReadLink( "/proc/self/exe" );
+    }
+
+    String GetLastErrorMessage()
+    {
+        char buffer[256];
+        char const* pMessage = strerror_r( errno, buffer, 256 );
+        return String( pMessage );
+    }
+
+    void OpenInExplorer( char const* path )
+    {
+        EE_ASSERT( path != nullptr && path[0] != 0 );
+        InlineString cmdLine( InlineString::CtorSprintf(), "\"%s\" > /dev/null 2>&1", path );
+        StartProcess( "xdg-open", cmdLine.c_str() );
+    }
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+#ifdef __linux__
+
+#include "Base/_Module/API.h"
+#include "Base/Types/String.h"
+
+//-------------------------------------------------------------------------
+// Platform Specific Helpers/Functions
+//-------------------------------------------------------------------------
+
+namespace EE::Platform::Linux
+{
+    // Processes
+    //-------------------------------------------------------------------------
+
+    EE_BASE_API uint32_t GetProcessID( char const* processName );
+    EE_BASE_API String GetProcessPath( uint32_t processID );
+    EE_BASE_API String GetCurrentModulePath();
+    EE_BASE_API String GetLastErrorMessage();
+
+    // Try to start a process and returns the process ID, the command line is interpreted by the shell
+    EE_BASE_API uint32_t StartProcess( char const* exePath, char const* cmdLine = nullptr );
+
+    // Kill a running process
+    EE_BASE_API bool KillProcess( uint32_t processID );
+
+    // Check if a named process is currently running
+    inline bool IsProcessRunning( char const* processName, uint32_t* pProcessID ) { return GetProcessID( processName ) != 0; }
+
+    // Open a path in the desktop's file browser
+    EE_BASE_API void OpenInExplorer( char const* path );
+}
+#endif
\ No newline at end of file
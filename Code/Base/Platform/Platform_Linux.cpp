@@ -0,0 +1,22 @@
+#ifdef __linux__
+#include "Platform.h"
+#include "Base/Esoterica.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Platform
+{
+    //-------------------------------------------------------------------------
+    // Platform
+    //-------------------------------------------------------------------------
+
+    void Initialize()
+    {
+        // Crash handling is not implemented for this platform, core dumps should be used instead
+    }
+
+    void Shutdown()
+    {
+    }
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+#ifdef __linux__
+
+#include <signal.h>
+
+//-------------------------------------------------------------------------
+
+#define EE_FORCE_INLINE inline __attribute__((always_inline))
+
+//-------------------------------------------------------------------------
+// Dev Defines
+//-------------------------------------------------------------------------
+
+#if __clang__
+    #define EE_DISABLE_OPTIMIZATION _Pragma( "clang optimize off" )
+    #define EE_ENABLE_OPTIMIZATION _Pragma( "clang optimize on" )
+#else
+    #define EE_DISABLE_OPTIMIZATION _Pragma( "GCC push_options" ) _Pragma( "GCC optimize (\"O0\")" )
+    #define EE_ENABLE_OPTIMIZATION _Pragma( "GCC pop_options" )
+#endif
+
+#if EE_DEVELOPMENT_TOOLS
+    #define EE_DEBUG_BREAK() raise( SIGTRAP )
+#endif
+
+#endif
\ No newline at end of file
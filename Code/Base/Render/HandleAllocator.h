@@ -2,7 +2,11 @@
 
 #include "Base/Types/Arrays.h"
 #include "Base/Math/Math.h"
+#if _WIN32
 #include <intrin.h>
+#else
+#include <immintrin.h>
+#endif
 
 //-------------------------------------------------------------------------
 
@@ -153,7 +157,11 @@ namespace EE::Render
         EE_FORCE_INLINE static uint32_t CountTrailingZeros( uint64_t value )
         {
             EE_ASSERT( value != 0 );
+            #if _WIN32
             return uint32_t( _tzcnt_u64( value ) );
+            #else
+            return uint32_t( __builtin_ctzll( value ) ); // BMI isnt part of the targeted instruction set
+            #endif
         }
 
         // Number of consecutive free slots at the START of a page.
@@ -165,7 +173,7 @@ namespace EE::Render
             {
                 return 64;
             }
-            return uint32_t( _tzcnt_u64( pageMask ) );
+            return CountTrailingZeros( pageMask );
         }
 
         // Number of consecutive free slots at the END of a page.
@@ -176,7 +184,11 @@ namespace EE::Render
             {
                 return 64;
             }
+            #if _WIN32
             return uint32_t( _lzcnt_u64( pageMask ) );
+            #else
+            return uint32_t( __builtin_clzll( pageMask ) );
+            #endif
         }
 
         //-------------------------------------------------------------------------
@@ -21,6 +21,10 @@ namespace EE::Resource
 
         constexpr static char const *const s_additionalDataFileExtension = "bin";
 
+        // Should the compiled resource data (everything after the resource header) be compressed?
+        // Resources can hide this with their own value to opt-in, this is a trade of load time CPU cost vs disk size and read time
+        constexpr static bool const s_compressCompiledData = false;
+
         // Get the path for the additional data file for a given resource
         EE_FORCE_INLINE static FileSystem::Path GetAdditionalDataFilePath( FileSystem::Path const& resourcePath )
         {
@@ -0,0 +1,238 @@
+#include "ResourceArchive.h"
+#include "Base/FileSystem/FileSystem.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/FileSystem/FileStreams.h"
+#include "Base/Math/Math.h"
+#include "Base/Profiling.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ResourceArchive::Open( FileSystem::Path const& archivePath )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+        EE_ASSERT( !IsOpen() );
+
+        if ( !m_mappedFile.Open( archivePath ) )
+        {
+            return false;
+        }
+
+        // Validate header
+        //-------------------------------------------------------------------------
+
+        uint8_t const* pData = m_mappedFile.GetData();
+        size_t const fileSize = m_mappedFile.GetSize();
+
+        if ( fileSize < sizeof( ResourceArchiveHeader ) )
+        {
+            EE_LOG_ERROR( LogCategory::Resource, "Resource Archive", "Invalid archive file (too small): %s", archivePath.c_str() );
+            Close();
+            return false;
+        }
+
+        ResourceArchiveHeader header;
+        memcpy( &header, pData, sizeof( ResourceArchiveHeader ) );
+
+        if ( header.m_magic != ResourceArchiveHeader::s_magic || header.m_version != ResourceArchiveHeader::s_version )
+        {
+            EE_LOG_ERROR( LogCategory::Resource, "Resource Archive", "Invalid archive header or version mismatch: %s", archivePath.c_str() );
+            Close();
+            return false;
+        }
+
+        uint64_t const tocSize = uint64_t( header.m_numEntries ) * sizeof( ResourceArchiveEntry );
+        if ( header.m_tocOffset < sizeof( ResourceArchiveHeader ) || header.m_tocOffset + tocSize > fileSize || ( header.m_tocOffset % alignof( ResourceArchiveEntry ) ) != 0 )
+        {
+            EE_LOG_ERROR( LogCategory::Resource, "Resource Archive", "Invalid archive table of contents: %s", archivePath.c_str() );
+            Close();
+            return false;
+        }
+
+        // Set TOC
+        //-------------------------------------------------------------------------
+
+        m_pEntries = reinterpret_cast<ResourceArchiveEntry const*>( pData + header.m_tocOffset );
+        m_numEntries = header.m_numEntries;
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( uint32_t i = 0; i < m_numEntries; i++ )
+        {
+            EE_ASSERT( m_pEntries[i].m_offset + m_pEntries[i].m_size <= header.m_tocOffset );
+            EE_ASSERT( i == 0 || m_pEntries[i - 1].m_resourcePathID < m_pEntries[i].m_resourcePathID );
+        }
+        #endif
+
+        // The TOC is hit on every request so make sure it is resident
+        m_mappedFile.Prefetch( (size_t) header.m_tocOffset, (size_t) tocSize );
+
+        return true;
+    }
+
+    void ResourceArchive::Close()
+    {
+        m_mappedFile.Close();
+        m_pEntries = nullptr;
+        m_numEntries = 0;
+    }
+
+    bool ResourceArchive::TryGetResourceData( ResourceID const& resourceID, TArrayView<uint8_t const>& outData ) const
+    {
+        EE_ASSERT( IsOpen() );
+        EE_ASSERT( resourceID.IsValid() );
+
+        uint64_t const pathID = resourceID.GetPathID();
+        auto const pEnd = m_pEntries + m_numEntries;
+        auto const pFoundEntry = eastl::lower_bound( m_pEntries, pEnd, pathID, [] ( ResourceArchiveEntry const& entry, uint64_t ID ) { return entry.m_resourcePathID < ID; } );
+        if ( pFoundEntry == pEnd || pFoundEntry->m_resourcePathID != pathID )
+        {
+            return false;
+        }
+
+        outData = TArrayView<uint8_t const>( m_mappedFile.GetData() + pFoundEntry->m_offset, (size_t) pFoundEntry->m_size );
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    namespace ResourceArchiveWriter
+    {
+        static FileSystem::Path GetArchivePath( FileSystem::Path const& directoryPath, int32_t archiveIdx )
+        {
+            TInlineString<32> const archiveName( TInlineString<32>::CtorSprintf(), "Resources_%03d.%s", archiveIdx, ResourceArchive::s_archiveExtension );
+            return directoryPath + archiveName.c_str();
+        }
+
+        static bool FinalizeArchive( FileSystem::OutputFileStream& stream, TVector<ResourceArchiveEntry> const& entries, uint64_t currentOffset )
+        {
+            static uint8_t const padding[ResourceArchiveHeader::s_dataAlignment] = { 0 };
+
+            ResourceArchiveHeader header;
+            header.m_numEntries = (uint32_t) entries.size();
+            header.m_tocOffset = Math::RoundUpToNearestMultiple64( currentOffset, ResourceArchiveHeader::s_dataAlignment );
+
+            stream.Write( padding, (size_t) ( header.m_tocOffset - currentOffset ) );
+            stream.Write( entries.data(), entries.size() * sizeof( ResourceArchiveEntry ) );
+
+            stream.GetStream().seekp( 0 );
+            stream.Write( &header, sizeof( ResourceArchiveHeader ) );
+            stream.Close();
+            return true;
+        }
+
+        bool WriteArchives( FileSystem::Path const& compiledDataDirectoryPath, TVector<ResourceID> const& resourceIDs, uint64_t maxArchiveSize )
+        {
+            EE_PROFILE_FUNCTION_RESOURCE();
+            EE_ASSERT( compiledDataDirectoryPath.IsDirectoryPath() );
+
+            // Remove stale archives
+            //-------------------------------------------------------------------------
+
+            TVector<FileSystem::Path> existingArchives;
+            FileSystem::GetDirectoryContents( compiledDataDirectoryPath, existingArchives, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::NoRecursion, { ResourceArchive::s_archiveExtension } );
+            for ( auto const& archivePath : existingArchives )
+            {
+                FileSystem::EraseFile( archivePath );
+            }
+
+            // Sort resources by ID - this is the TOC order, and remove any duplicates
+            //-------------------------------------------------------------------------
+
+            TVector<ResourceID> sortedResourceIDs = resourceIDs;
+            eastl::sort( sortedResourceIDs.begin(), sortedResourceIDs.end(), [] ( ResourceID const& a, ResourceID const& b ) { return a.GetPathID() < b.GetPathID(); } );
+
+            for ( size_t i = 1; i < sortedResourceIDs.size(); i++ )
+            {
+                if ( sortedResourceIDs[i].GetPathID() != sortedResourceIDs[i - 1].GetPathID() )
+                {
+                    continue;
+                }
+
+                // Duplicate entry
+                if ( sortedResourceIDs[i].GetString().comparei( sortedResourceIDs[i - 1].GetString() ) == 0 )
+                {
+                    sortedResourceIDs.erase( sortedResourceIDs.begin() + i );
+                    i--;
+                    continue;
+                }
+
+                EE_LOG_ERROR( LogCategory::Resource, "Resource Archive", "Resource path ID collision: %s and %s", sortedResourceIDs[i].c_str(), sortedResourceIDs[i - 1].c_str() );
+                return false;
+            }
+
+            // Write archives
+            //-------------------------------------------------------------------------
+
+            static uint8_t const padding[ResourceArchiveHeader::s_dataAlignment] = { 0 };
+            ResourceArchiveHeader const placeholderHeader;
+
+            TVector<ResourceArchiveEntry> entries;
+            FileSystem::OutputFileStream* pStream = nullptr;
+            uint64_t currentOffset = 0;
+            int32_t archiveIdx = 0;
+            Blob resourceData;
+
+            auto CloseCurrentArchive = [&] ()
+            {
+                if ( pStream != nullptr )
+                {
+                    FinalizeArchive( *pStream, entries, currentOffset );
+                    EE::Delete( pStream );
+                    entries.clear();
+                    archiveIdx++;
+                }
+            };
+
+            for ( ResourceID const& resourceID : sortedResourceIDs )
+            {
+                FileSystem::Path const compiledFilePath = resourceID.GetCompiledFileSystemPath( compiledDataDirectoryPath );
+                if ( !FileSystem::ReadBinaryFile( compiledFilePath, resourceData ) )
+                {
+                    EE_LOG_ERROR( LogCategory::Resource, "Resource Archive", "Failed to read compiled resource: %s", compiledFilePath.c_str() );
+                    CloseCurrentArchive();
+                    return false;
+                }
+
+                uint64_t const alignedOffset = Math::RoundUpToNearestMultiple64( currentOffset, ResourceArchiveHeader::s_dataAlignment );
+
+                // Split archive if we have exceeded the max size
+                if ( pStream != nullptr && !entries.empty() && ( alignedOffset + resourceData.size() ) > maxArchiveSize )
+                {
+                    CloseCurrentArchive();
+                }
+
+                if ( pStream == nullptr )
+                {
+                    pStream = EE::New<FileSystem::OutputFileStream>( GetArchivePath( compiledDataDirectoryPath, archiveIdx ) );
+                    if ( !pStream->IsValid() )
+                    {
+                        EE::Delete( pStream );
+                        return false;
+                    }
+
+                    pStream->Write( &placeholderHeader, sizeof( ResourceArchiveHeader ) );
+                    currentOffset = sizeof( ResourceArchiveHeader );
+                }
+
+                uint64_t const dataOffset = Math::RoundUpToNearestMultiple64( currentOffset, ResourceArchiveHeader::s_dataAlignment );
+                pStream->Write( padding, (size_t) ( dataOffset - currentOffset ) );
+                pStream->Write( resourceData.data(), resourceData.size() );
+                currentOffset = dataOffset + resourceData.size();
+
+                ResourceArchiveEntry& entry = entries.emplace_back();
+                entry.m_resourcePathID = resourceID.GetPathID();
+                entry.m_offset = dataOffset;
+                entry.m_size = resourceData.size();
+            }
+
+            CloseCurrentArchive();
+
+            EE_LOG_MESSAGE( LogCategory::Resource, "Resource Archive", "Packed %u resources into %d archive(s)", (uint32_t) sortedResourceIDs.size(), archiveIdx );
+            return true;
+        }
+    }
+    #endif
+}
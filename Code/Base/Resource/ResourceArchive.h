@@ -0,0 +1,92 @@
+#pragma once
+
+#include "ResourceID.h"
+#include "Base/FileSystem/MemoryMappedFile.h"
+
+//-------------------------------------------------------------------------
+// Resource Archive
+//-------------------------------------------------------------------------
+// Packed container for compiled resources used by packaged builds
+//
+// Layout: [Header][Resource Data][Table of Contents]
+//
+// The TOC is a flat array of entries sorted by the resource path ID so that lookups are a binary search directly on the mapped memory.
+// Resource data is aligned to 'ResourceArchiveHeader::s_dataAlignment' so loaders can alias the mapped data if needed.
+// The archive is memory mapped in its entirety and resources are served as views into the mapping i.e. no per-resource file operations.
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    struct ResourceArchiveHeader
+    {
+        constexpr static uint32_t const s_magic = uint32_t( 'E' ) | ( uint32_t( 'E' ) << 8 ) | ( uint32_t( 'P' ) << 16 ) | ( uint32_t( 'K' ) << 24 ); // 'EEPK' in file order, avoids compiler specific multi-char literals
+        constexpr static uint32_t const s_version = 1;
+        constexpr static uint32_t const s_dataAlignment = 16;
+
+    public:
+
+        uint32_t                m_magic = s_magic;
+        uint32_t                m_version = s_version;
+        uint32_t                m_numEntries = 0;
+        uint32_t                m_dataAlignment = s_dataAlignment;
+        uint64_t                m_tocOffset = 0;
+    };
+
+    struct ResourceArchiveEntry
+    {
+        uint64_t                m_resourcePathID = 0;
+        uint64_t                m_offset = 0;
+        uint64_t                m_size = 0;
+    };
+
+    static_assert( std::is_trivially_copyable<ResourceArchiveHeader>::value && sizeof( ResourceArchiveHeader ) == 24, "Archive header is written directly to disk and must have a stable layout" );
+    static_assert( std::is_trivially_copyable<ResourceArchiveEntry>::value && sizeof( ResourceArchiveEntry ) == 24, "Archive entries are written directly to disk and must have a stable layout" );
+
+    //-------------------------------------------------------------------------
+
+    class EE_BASE_API ResourceArchive
+    {
+    public:
+
+        constexpr static char const* const s_archiveExtension = "eepak";
+
+    public:
+
+        ResourceArchive() = default;
+        ResourceArchive( ResourceArchive const& ) = delete;
+        ResourceArchive( ResourceArchive&& ) = default;
+
+        ResourceArchive& operator=( ResourceArchive const& ) = delete;
+        ResourceArchive& operator=( ResourceArchive&& ) = default;
+
+        // Map the archive and validate the header and TOC
+        bool Open( FileSystem::Path const& archivePath );
+        void Close();
+
+        inline bool IsOpen() const { return m_mappedFile.IsOpen(); }
+        inline FileSystem::Path const& GetFilePath() const { return m_mappedFile.GetFilePath(); }
+        inline uint32_t GetNumResources() const { return m_numEntries; }
+
+        // Find the data for a given resource, the returned view is valid for as long as the archive is open
+        bool TryGetResourceData( ResourceID const& resourceID, TArrayView<uint8_t const>& outData ) const;
+
+    private:
+
+        FileSystem::MemoryMappedFile        m_mappedFile;
+        ResourceArchiveEntry const*         m_pEntries = nullptr;
+        uint32_t                            m_numEntries = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    namespace ResourceArchiveWriter
+    {
+        constexpr static uint64_t const s_defaultMaxArchiveSize = 2ull * 1024 * 1024 * 1024; // 2GB
+
+        // Packs the compiled data for the list of resources into one or more archives in the output directory (any existing archives in that directory are deleted)
+        // Resources are split across multiple archives once an archive exceeds the max archive size
+        EE_BASE_API bool WriteArchives( FileSystem::Path const& compiledDataDirectoryPath, TVector<ResourceID> const& resourceIDs, uint64_t maxArchiveSize = s_defaultMaxArchiveSize );
+    }
+    #endif
+}
@@ -8,9 +8,10 @@
 namespace EE::Resource
 {
     // Describes the contents of a resource, every resource has a header
+    // The serialized resource data (payload) follows the header, it may optionally be compressed in which case it is stored as a single binary blob
     struct ResourceHeader
     {
-        EE_SERIALIZE( m_version, m_resourceType, m_installDependencies, m_sourceResourceHash );
+        EE_SERIALIZE( m_version, m_resourceType, m_installDependencies, m_sourceResourceHash, m_uncompressedPayloadSize );
 
     public:
 
@@ -28,11 +29,14 @@ namespace EE::Resource
 
         void AddInstallDependency( ResourceID resourceID ) { VectorEmplaceBackUnique( m_installDependencies, resourceID ); }
 
+        inline bool IsPayloadCompressed() const { return m_uncompressedPayloadSize > 0; }
+
     public:
 
         int32_t                 m_version = -1;
         ResourceTypeID          m_resourceType;
         TVector<ResourceID>     m_installDependencies;
         uint64_t                m_sourceResourceHash = 0;
+        uint32_t                m_uncompressedPayloadSize = 0;  // Non-zero if the payload is compressed
     };
 }
\ No newline at end of file
@@ -0,0 +1,177 @@
+#include "ResourceIOQueue.h"
+#include "Base/Time/Timers.h"
+#include "Base/Profiling.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    void ResourceIOQueue::ReadRequest::Reset()
+    {
+        EE_ASSERT( !IsPending() );
+        m_mappedFile.Close();
+        m_data = TArrayView<uint8_t const>();
+        m_filePath.Clear();
+        m_status = Status::None;
+        m_readTime = 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    ResourceIOQueue::~ResourceIOQueue()
+    {
+        EE_ASSERT( !m_isRunning );
+    }
+
+    void ResourceIOQueue::Initialize()
+    {
+        EE_ASSERT( !m_isRunning );
+        m_exitRequested = false;
+        m_isRunning = true;
+        m_thread = Threading::Thread( [this] () { ProcessRequests(); } );
+    }
+
+    void ResourceIOQueue::Shutdown()
+    {
+        EE_ASSERT( m_isRunning );
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_exitRequested = true;
+        }
+
+        m_wakeCondition.notify_one();
+        m_thread.join();
+        m_isRunning = false;
+
+        EE_ASSERT( m_submittedRequests.empty() );
+    }
+
+    void ResourceIOQueue::SubmitRead( ReadRequest* pRequest )
+    {
+        EE_ASSERT( m_isRunning );
+        EE_ASSERT( pRequest != nullptr && !pRequest->IsPending() );
+        EE_ASSERT( !pRequest->m_data.empty() || pRequest->m_filePath.IsValid() );
+
+        pRequest->m_status = ReadRequest::Status::Pending;
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_submittedRequests.emplace_back( pRequest );
+        }
+
+        m_wakeCondition.notify_one();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceIOQueue::ProcessRequests()
+    {
+        Threading::SetCurrentThreadName( "Resource I/O" );
+        EE_PROFILE_THREAD_START( "Resource I/O" );
+
+        TVector<ReadRequest*> batch;
+
+        while ( true )
+        {
+            // Wait for work and grab the whole batch
+            //-------------------------------------------------------------------------
+
+            {
+                Threading::Lock lock( m_mutex );
+                m_wakeCondition.wait( lock, [this] () { return m_exitRequested || !m_submittedRequests.empty(); } );
+
+                // Complete all outstanding reads before exiting, requests may be waiting on them
+                if ( m_exitRequested && m_submittedRequests.empty() )
+                {
+                    break;
+                }
+
+                batch.swap( m_submittedRequests );
+            }
+
+            // Sort reads so that we service them in file/offset order
+            //-------------------------------------------------------------------------
+            // Views into the same archive sort by address which is the same as the offset order in the archive.
+            // Loose files come after all the archive reads and are sorted by path so we read a directory at a time.
+
+            eastl::sort( batch.begin(), batch.end(), [] ( ReadRequest const* pA, ReadRequest const* pB )
+            {
+                bool const isArchiveA = !pA->m_data.empty();
+                bool const isArchiveB = !pB->m_data.empty();
+                if ( isArchiveA != isArchiveB )
+                {
+                    return isArchiveA;
+                }
+
+                if ( isArchiveA )
+                {
+                    return pA->m_data.data() < pB->m_data.data();
+                }
+
+                return pA->m_filePath.GetString() < pB->m_filePath.GetString();
+            } );
+
+            // Service reads
+            //-------------------------------------------------------------------------
+
+            {
+                EE_PROFILE_SCOPE_IO( "Service Resource Reads" );
+
+                for ( ReadRequest* pRequest : batch )
+                {
+                    ServiceRequest( pRequest );
+                }
+            }
+
+            batch.clear();
+        }
+
+        EE_PROFILE_THREAD_END();
+    }
+
+    void ResourceIOQueue::ServiceRequest( ReadRequest* pRequest )
+    {
+        EE_ASSERT( pRequest->IsPending() );
+
+        Milliseconds readTime = 0;
+        bool succeeded = true;
+
+        {
+            ScopedTimer<PlatformClock> timer( readTime );
+
+            // Map loose files
+            if ( pRequest->m_data.empty() )
+            {
+                if ( pRequest->m_mappedFile.Open( pRequest->m_filePath ) )
+                {
+                    pRequest->m_data = TArrayView<uint8_t const>( pRequest->m_mappedFile.GetData(), pRequest->m_mappedFile.GetSize() );
+                }
+                else
+                {
+                    succeeded = false;
+                }
+            }
+
+            // Fault in all pages so that the deserialization never blocks on the disk
+            if ( succeeded && !pRequest->m_data.empty() )
+            {
+                static constexpr size_t const s_pageSize = 4096;
+
+                uint8_t const* pData = pRequest->m_data.data();
+                size_t const dataSize = pRequest->m_data.size();
+
+                uint8_t volatile checksum = 0;
+                for ( size_t offset = 0; offset < dataSize; offset += s_pageSize )
+                {
+                    checksum ^= pData[offset];
+                }
+                checksum ^= pData[dataSize - 1];
+            }
+        }
+
+        pRequest->m_readTime = readTime;
+        pRequest->m_status.store( succeeded ? ReadRequest::Status::Succeeded : ReadRequest::Status::Failed, std::memory_order_release );
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Base/_Module/API.h"
+#include "Base/FileSystem/MemoryMappedFile.h"
+#include "Base/Threading/Threading.h"
+#include "Base/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Resource I/O Queue
+//-------------------------------------------------------------------------
+// A dedicated I/O stage for the resource system, this ensures that the task system workers never block on disk reads
+//
+// Resource requests submit reads to this queue, a dedicated I/O thread services them and the request continues once the data is resident.
+// Reads are serviced in batches sorted by file and offset so that we read archives front to back instead of seeking all over the place.
+//
+// * Loose files are memory mapped by the I/O thread
+// * For both loose files and archive data, the I/O thread faults in all the pages of the resource data so that deserialization doesn't block
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    class EE_BASE_API ResourceIOQueue
+    {
+    public:
+
+        struct EE_BASE_API ReadRequest
+        {
+            enum class Status : uint8_t
+            {
+                None,
+                Pending,
+                Succeeded,
+                Failed,
+            };
+
+        public:
+
+            inline bool IsPending() const { return m_status.load( std::memory_order_acquire ) == Status::Pending; }
+            inline bool IsComplete() const { Status const status = m_status.load( std::memory_order_acquire ); return status == Status::Succeeded || status == Status::Failed; }
+            inline bool HasSucceeded() const { return m_status.load( std::memory_order_acquire ) == Status::Succeeded; }
+
+            // Get the resident data, only valid once the request has succeeded and for as long as the request (or the archive the data came from) is alive
+            inline TArrayView<uint8_t const> GetData() const { EE_ASSERT( HasSucceeded() ); return m_data; }
+
+            // Release any held data
+            void Reset();
+
+        public:
+
+            FileSystem::Path                    m_filePath;             // The file to read, only used if we dont already have a data view
+            TArrayView<uint8_t const>           m_data;                 // Optional view to already mapped data (i.e. an archive), otherwise this is set upon completion
+            FileSystem::MemoryMappedFile        m_mappedFile;           // The mapping for loose files, owned by the request
+            std::atomic<Status>                 m_status = Status::None;
+            Milliseconds                        m_readTime = 0;
+        };
+
+    public:
+
+        ResourceIOQueue() = default;
+        ResourceIOQueue( ResourceIOQueue const& ) = delete;
+        ResourceIOQueue& operator=( ResourceIOQueue const& ) = delete;
+        ~ResourceIOQueue();
+
+        inline bool IsRunning() const { return m_isRunning; }
+        void Initialize();
+        void Shutdown();
+
+        // Submit a read - the request needs to remain valid until it completes
+        void SubmitRead( ReadRequest* pRequest );
+
+    private:
+
+        void ProcessRequests();
+        void ServiceRequest( ReadRequest* pRequest );
+
+    private:
+
+        Threading::Thread                   m_thread;
+        Threading::Mutex                    m_mutex;
+        Threading::ConditionVariable        m_wakeCondition;
+        TVector<ReadRequest*>               m_submittedRequests;
+        bool                                m_isRunning = false;
+        bool                                m_exitRequested = false;
+    };
+}
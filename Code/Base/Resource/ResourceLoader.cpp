@@ -4,12 +4,13 @@
 #include "Base/Serialization/BinarySerialization.h"
 #include "Base/Time/Timers.h"
 #include "Base/Profiling.h"
+#include "Base/ThirdParty/lzav/lzav_estoerica.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Resource
 {
-    LoadResult ResourceLoader::Load( ResourceID const& resourceID, FileSystem::Path const& resourcePath, ResourceRecord* pResourceRecord ) const
+    LoadResult ResourceLoader::Load( ResourceID const& resourceID, FileSystem::Path const& resourcePath, TArrayView<uint8_t const> rawResourceData, ResourceRecord* pResourceRecord ) const
     {
         // First load!
         if ( pResourceRecord->m_pResource == nullptr )
@@ -17,23 +18,32 @@ namespace EE::Resource
             // Read file and create archive
             //-------------------------------------------------------------------------
 
-            Blob rawResourceData;
             Serialization::BinaryInputArchive archive;
 
             {
                 EE_PROFILE_SCOPE_IO( "Read File" );
 
-                #if EE_DEVELOPMENT_TOOLS
-                ScopedTimer<PlatformClock> timer( pResourceRecord->m_fileReadTime );
-                #endif
-
-                if ( !FileSystem::ReadBinaryFile( resourcePath, rawResourceData ) )
+                // Resource data is already resident (read by the I/O stage or a mapped archive) so read directly from it
+                if ( !rawResourceData.empty() )
                 {
-                    LogError( pResourceRecord, "Failed to read resource file from disk (%s)", resourceID.c_str() );
-                    return LoadResult::Failed;
+                    archive.ReadFromData( rawResourceData.data(), rawResourceData.size() );
+                    EE_DEVELOPMENT_TOOLS_ONLY( pResourceRecord->m_rawDataSize = rawResourceData.size() );
                 }
+                // Map the loose file, deserialization will copy directly out of the mapped pages so we never hold a second copy of the file
+                else
+                {
+                    #if EE_DEVELOPMENT_TOOLS
+                    ScopedTimer<PlatformClock> timer( pResourceRecord->m_fileReadTime );
+                    #endif
 
-                archive.ReadFromBlob( rawResourceData );
+                    if ( !archive.ReadFromMappedFile( resourcePath ) )
+                    {
+                        LogError( pResourceRecord, "Failed to read resource file from disk (%s)", resourceID.c_str() );
+                        return LoadResult::Failed;
+                    }
+
+                    EE_DEVELOPMENT_TOOLS_ONLY( pResourceRecord->m_rawDataSize = archive.GetSourceDataSize() );
+                }
             }
 
             // Load contents from raw file data
@@ -56,8 +66,42 @@ namespace EE::Resource
                     pResourceRecord->m_installDependencyResourceIDs.push_back( depResourceID );
                 }
 
+                // Decompress the payload, the resource is then deserialized directly from the decompressed buffer
+                Blob decompressedPayload;
+                Serialization::BinaryInputArchive payloadArchive;
+                Serialization::BinaryInputArchive* pPayloadArchive = &archive;
+
+                if ( header.IsPayloadCompressed() )
+                {
+                    EE_PROFILE_SCOPE_IO( "Decompress Payload" );
+
+                    #if EE_DEVELOPMENT_TOOLS
+                    ScopedTimer<PlatformClock> timer( pResourceRecord->m_decompressionTime );
+                    #endif
+
+                    TArrayView<uint8_t const> const compressedPayload = archive.ReadBinaryDataView();
+                    decompressedPayload.resize( header.m_uncompressedPayloadSize );
+                    int32_t const decompressedSize = lzav::lzav_decompress( compressedPayload.data(), decompressedPayload.data(), (int32_t) compressedPayload.size(), (int32_t) decompressedPayload.size() );
+                    if ( decompressedSize != (int32_t) header.m_uncompressedPayloadSize )
+                    {
+                        LogError( pResourceRecord, "Failed to decompress resource data (%s)", resourceID.c_str() );
+                        return LoadResult::Failed;
+                    }
+
+                    payloadArchive.ReadFromBlob( decompressedPayload );
+                    pPayloadArchive = &payloadArchive;
+                }
+
+                #if EE_DEVELOPMENT_TOOLS
+                pResourceRecord->m_uncompressedDataSize = header.IsPayloadCompressed() ? header.m_uncompressedPayloadSize : pResourceRecord->m_rawDataSize;
+                #endif
+
                 // Perform resource load
-                LoadResult loadResult = Load( resourceID, resourcePath, pResourceRecord, &archive );
+                LoadResult loadResult = Load( resourceID, resourcePath, pResourceRecord, pPayloadArchive );
+
+                #if EE_DEVELOPMENT_TOOLS
+                pResourceRecord->m_numBytesCopied = pPayloadArchive->GetNumBytesCopied();
+                #endif
 
                 // Loaders must always set a valid resource data ptr, even if the resource internally is invalid
                 // This is enforced to prevent leaks from occurring when a loader allocates a resource, then tries to 
@@ -90,7 +90,8 @@ namespace EE::Resource
 
         // This function loads is responsible to deserialize the compiled resource data, read the resource header for install dependencies and to create the new runtime resource object
         // This function will continue being called until either "LoadResult::Succeeded" or "LoadResult::Failed" is returned
-        LoadResult Load( ResourceID const& resourceID, FileSystem::Path const& resourcePath, ResourceRecord* pResourceRecord ) const;
+        // If the raw resource data is supplied (i.e. the resource is already resident in memory), it will be deserialized in place instead of reading the resource file
+        LoadResult Load( ResourceID const& resourceID, FileSystem::Path const& resourcePath, TArrayView<uint8_t const> rawResourceData, ResourceRecord* pResourceRecord ) const;
 
     protected:
 
@@ -1,6 +1,7 @@
 #include "ResourceProvider_Package.h"
 #include "Base/Resource/ResourceRequest.h"
 #include "Base/Resource/Settings/Settings_Resource.h"
+#include "Base/FileSystem/FileSystemUtils.h"
 
 //-------------------------------------------------------------------------
 
@@ -13,13 +14,49 @@ namespace EE::Resource
 
     bool PackagedResourceProvider::Initialize()
     {
+        EE_ASSERT( m_archives.empty() );
+
+        TVector<FileSystem::Path> archivePaths;
+        FileSystem::GetDirectoryContents( m_settings.m_compiledResourceDirectoryPath, archivePaths, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::NoRecursion, { ResourceArchive::s_archiveExtension } );
+
+        m_archives.reserve( archivePaths.size() );
+        for ( auto const& archivePath : archivePaths )
+        {
+            ResourceArchive archive;
+            if ( !archive.Open( archivePath ) )
+            {
+                EE_LOG_ERROR( LogCategory::Resource, "Packaged Resource Provider", "Failed to open resource archive: %s", archivePath.c_str() );
+                return false;
+            }
+
+            m_archives.emplace_back( std::move( archive ) );
+        }
+
         return true;
     }
 
+    void PackagedResourceProvider::Shutdown()
+    {
+        m_archives.clear();
+    }
+
     void PackagedResourceProvider::RequestRawResource( ResourceRequest* pRequest )
     {
         ResourceID const& resourceID = pRequest->GetResourceID();
         FileSystem::Path const resourceFilePath = resourceID.GetCompiledFileSystemPath( m_settings.m_compiledResourceDirectoryPath );
+
+        // Try to serve the request from the archives
+        TArrayView<uint8_t const> resourceData;
+        for ( auto const& archive : m_archives )
+        {
+            if ( archive.TryGetResourceData( resourceID, resourceData ) )
+            {
+                pRequest->OnRawResourceRequestComplete( resourceFilePath.c_str(), resourceData );
+                return;
+            }
+        }
+
+        // Fallback to loose files
         pRequest->OnRawResourceRequestComplete( resourceFilePath.c_str(), String() );
     }
 
@@ -27,4 +64,4 @@ namespace EE::Resource
     {
          // Do Nothing
     }
-}
\ No newline at end of file
+}
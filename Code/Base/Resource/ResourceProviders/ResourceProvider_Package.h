@@ -1,8 +1,13 @@
 #pragma once
 
 #include "Base/Resource/ResourceProvider.h"
+#include "Base/Resource/ResourceArchive.h"
 
 //-------------------------------------------------------------------------
+// Serves resources for packaged builds
+//-------------------------------------------------------------------------
+// If the compiled data directory contains resource archives, all archives are memory mapped on initialization and
+// requests are served as views into the mapped data. Any resources not present in an archive fall back to the loose compiled files.
 
 namespace EE::Resource
 {
@@ -21,7 +26,12 @@ namespace EE::Resource
     private:
 
         virtual bool Initialize() override;
+        virtual void Shutdown() override;
         virtual void RequestRawResource( ResourceRequest* pRequest ) override;
         virtual void CancelRequest( ResourceRequest* pRequest ) override;
+
+    private:
+
+        TVector<ResourceArchive>        m_archives;
     };
-}
\ No newline at end of file
+}
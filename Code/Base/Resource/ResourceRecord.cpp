@@ -36,7 +36,7 @@ namespace EE::Resource
 
     Milliseconds ResourceRecord::GetLoadTime() const
     {
-        return m_stageDurations[(uint8_t) ResourceLoadStage::WaitForRawResourceRequest] + m_stageDurations[(uint8_t) ResourceLoadStage::LoadResource];
+        return m_stageDurations[(uint8_t) ResourceLoadStage::WaitForRawResourceRequest] + m_stageDurations[(uint8_t) ResourceLoadStage::ReadRawResource] + m_stageDurations[(uint8_t) ResourceLoadStage::LoadResource];
     }
 
     Milliseconds ResourceRecord::GetInstallTime() const
@@ -77,6 +77,10 @@ namespace EE::Resource
         inline ResourceLoadStage GetLoadStage() const;
 
         inline Milliseconds GetFileReadTime() const { return m_fileReadTime; }
+        inline size_t GetRawDataSize() const { return m_rawDataSize; }
+        inline size_t GetNumBytesCopied() const { return m_numBytesCopied; }
+        inline size_t GetUncompressedDataSize() const { return m_uncompressedDataSize; }
+        inline Milliseconds GetDecompressionTime() const { return m_decompressionTime; }
         Milliseconds GetLoadStageTime( ResourceLoadStage stage ) const;
         Milliseconds GetLoadTime() const;
         Milliseconds GetInstallTime() const;
@@ -97,8 +101,12 @@ namespace EE::Resource
         #if EE_DEVELOPMENT_TOOLS
         uint64_t                                m_sourceResourceHash = 0;
         ResourceLoadStage                       m_loadStage = (ResourceLoadStage) -1;
-        Milliseconds                            m_stageDurations[7] = { 0, 0, 0, 0, 0, 0, 0 };
+        Milliseconds                            m_stageDurations[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
         Milliseconds                            m_fileReadTime = 0;
+        size_t                                  m_rawDataSize = 0;                              // The size of the compiled resource data
+        size_t                                  m_numBytesCopied = 0;                           // The number of bytes copied out of the compiled data during deserialization
+        size_t                                  m_uncompressedDataSize = 0;                     // The size of the compiled resource data once decompressed (same as the raw size for uncompressed resources)
+        Milliseconds                            m_decompressionTime = 0;
         String                                  m_compilationLog;
         String                                  m_errorLog;
         #endif
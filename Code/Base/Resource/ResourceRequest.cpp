@@ -13,6 +13,7 @@ namespace EE::Resource
         {
             "RequestRawResource",
             "WaitForRawResourceRequest",
+            "ReadRawResource",
             "LoadResource",
             "WaitForInstallDependencies",
             "InstallResource",
@@ -229,6 +230,15 @@ namespace EE::Resource
                 }
                 break;
 
+                case ResourceLoadStage::ReadRawResource:
+                {
+                    EE_ASSERT( m_readRequest.IsComplete() );
+                    m_readRequest.Reset();
+                    m_rawResourceData = TArrayView<uint8_t const>();
+                    SetStage( ResourceLoadStage::Complete );
+                }
+                break;
+
                 case ResourceLoadStage::LoadResource:
                 {
                     SetStage( ResourceLoadStage::UnloadResource );
@@ -292,6 +302,12 @@ namespace EE::Resource
             }
             break;
 
+            case ResourceLoadStage::ReadRawResource:
+            {
+                ReadRawResource( requestContext );
+            }
+            break;
+
             case ResourceLoadStage::LoadResource:
             {
                 LoadResource( requestContext );
@@ -377,10 +393,72 @@ namespace EE::Resource
         else // Continue the load operation
         {
             m_rawResourcePath = filePath;
-            SetStage( ResourceLoadStage::LoadResource );
+            m_rawResourceData = TArrayView<uint8_t const>();
+            m_readRequest.m_filePath = m_rawResourcePath;
+            SetStage( ResourceLoadStage::ReadRawResource );
         }
     }
 
+    void ResourceRequest::OnRawResourceRequestComplete( String const& filePath, TArrayView<uint8_t const> rawResourceData )
+    {
+        EE_ASSERT( !filePath.empty() && !rawResourceData.empty() );
+        m_rawResourcePath = filePath;
+        m_rawResourceData = TArrayView<uint8_t const>();
+        m_readRequest.m_data = rawResourceData;
+        SetStage( ResourceLoadStage::ReadRawResource );
+    }
+
+    void ResourceRequest::ReadRawResource( RequestContext& requestContext )
+    {
+        EE_PROFILE_SCOPE_RESOURCE( "Read Raw Resource" );
+        EE_ASSERT( m_stage == ResourceLoadStage::ReadRawResource );
+
+        // Submit the read to the I/O stage
+        if ( !m_readRequest.IsPending() && !m_readRequest.IsComplete() )
+        {
+            // No I/O stage available, the loader will read the data itself
+            if ( requestContext.m_submitReadRequestFunction == nullptr )
+            {
+                m_rawResourceData = m_readRequest.m_data;
+                SetStage( ResourceLoadStage::LoadResource );
+                return;
+            }
+
+            requestContext.m_submitReadRequestFunction( &m_readRequest );
+            return;
+        }
+
+        // Wait for the read to complete, we are not allowed to switch request type while the read is in flight
+        if ( m_readRequest.IsPending() )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_pResourceRecord->m_fileReadTime = m_readRequest.m_readTime;
+        #endif
+
+        if ( !m_readRequest.HasSucceeded() )
+        {
+            LogError( "Failed to read resource file from disk (%s)", m_pResourceRecord->GetResourceID().c_str() );
+            m_readRequest.Reset();
+            SetLoadFailed();
+            SetStage( ResourceLoadStage::Complete );
+            return;
+        }
+
+        // Check if we need to switch type
+        if ( ProcessSwitchRequestType( requestContext ) )
+        {
+            return;
+        }
+
+        m_rawResourceData = m_readRequest.GetData();
+        SetStage( ResourceLoadStage::LoadResource );
+    }
+
     void ResourceRequest::LoadResource( RequestContext& requestContext )
     {
         EE_PROFILE_FUNCTION_RESOURCE();
@@ -398,7 +476,7 @@ namespace EE::Resource
         // Load resource
         //-------------------------------------------------------------------------
 
-        LoadResult const loadResult = m_pResourceLoader->Load( GetResourceID(), m_rawResourcePath, m_pResourceRecord );
+        LoadResult const loadResult = m_pResourceLoader->Load( GetResourceID(), m_rawResourcePath, m_rawResourceData, m_pResourceRecord );
 
         // Still loading
         if ( loadResult == LoadResult::InProgress )
@@ -406,6 +484,10 @@ namespace EE::Resource
             return;
         }
 
+        // Release the raw data, loaders are not allowed to hold onto it
+        m_rawResourceData = TArrayView<uint8_t const>();
+        m_readRequest.Reset();
+
         // Check if we need to switch type
         if ( ProcessSwitchRequestType( requestContext ) )
         {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ResourceLoader.h"
+#include "ResourceIOQueue.h"
 #include "Base/Types/Function.h"
 #include "Base/Time/Timers.h"
 
@@ -15,6 +16,7 @@ namespace EE::Resource
         // Load Stages
         RequestRawResource,
         WaitForRawResourceRequest,
+        ReadRawResource,
         LoadResource,
 
         // Install Stages
@@ -56,6 +58,7 @@ namespace EE::Resource
         {
             TFunction<void( ResourceRequest* )> m_createRawRequestRequestFunction;
             TFunction<void( ResourceRequest* )> m_cancelRawRequestRequestFunction;
+            TFunction<void( ResourceIOQueue::ReadRequest* )> m_submitReadRequestFunction;
             TFunction<void( ResourceRequesterID const&, ResourcePtr& )> m_loadResourceFunction;
             TFunction<void( ResourceRequesterID const&, ResourcePtr& )> m_unloadResourceFunction;
         };
@@ -88,6 +91,10 @@ namespace EE::Resource
         // Called by the resource provider once the request operation completes and provides the raw resource data
         void OnRawResourceRequestComplete( String const& filePath, String const& log );
 
+        // Called by the resource provider once the request operation completes and the raw resource data is already resident in memory (i.e. a mapped archive)
+        // The data needs to remain valid for the lifetime of the provider
+        void OnRawResourceRequestComplete( String const& filePath, TArrayView<uint8_t const> rawResourceData );
+
         // This will interrupt a load task and convert it into an unload task
         void RequestSwitchToLoadTask();
 
@@ -103,6 +110,7 @@ namespace EE::Resource
 
         void RequestRawResource( RequestContext& requestContext );
         void WaitForRawResourceRequest( RequestContext& requestContext );
+        void ReadRawResource( RequestContext& requestContext );
         void LoadResource( RequestContext& requestContext );
         void RequestInstallDependencies( RequestContext& requestContext );
         void WaitForInstallDependencies( RequestContext& requestContext );
@@ -124,6 +132,8 @@ namespace EE::Resource
         ResourceRecord*                         m_pResourceRecord = nullptr;
         ResourceLoader*                         m_pResourceLoader = nullptr;
         FileSystem::Path                        m_rawResourcePath;
+        TArrayView<uint8_t const>               m_rawResourceData;
+        ResourceIOQueue::ReadRequest            m_readRequest;
         InstallDependencyList                   m_pendingInstallDependencies;
         InstallDependencyList                   m_installDependencies;
         RequestType                             m_requestType = RequestType::Invalid;
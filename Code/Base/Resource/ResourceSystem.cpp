@@ -26,11 +26,13 @@ namespace EE::Resource
     {
         EE_ASSERT( pResourceProvider != nullptr && ( pResourceProvider->IsReady() || pResourceProvider->IsConnecting() ) );
         m_pResourceProvider = pResourceProvider;
+        m_ioQueue.Initialize();
     }
 
     void ResourceSystem::Shutdown()
     {
         WaitForAllRequestsToComplete();
+        m_ioQueue.Shutdown();
         m_pResourceProvider = nullptr;
     }
 
@@ -435,6 +437,7 @@ namespace EE::Resource
             ResourceRequest::RequestContext context;
             context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
             context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
+            context.m_submitReadRequestFunction = [this] ( ResourceIOQueue::ReadRequest* pReadRequest ) { m_ioQueue.SubmitRead( pReadRequest ); };
             context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
             context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
 
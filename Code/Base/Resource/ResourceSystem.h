@@ -2,6 +2,7 @@
 
 #include "Base/_Module/API.h"
 #include "ResourcePtr.h"
+#include "ResourceIOQueue.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Threading/TaskSystem.h"
 #include "Base/Systems.h"
@@ -180,6 +181,7 @@ namespace EE::Resource
         TVector<ResourceRequest*>                               m_completedRequests;
 
         // ASync
+        ResourceIOQueue                                         m_ioQueue;
         AsyncTask                                               m_asyncProcessingTask;
         std::atomic<bool>                                       m_isAsyncTaskRunning = false;
 
@@ -32,6 +32,7 @@ namespace EE::Serialization
         EE_ASSERT( pData != nullptr );
         EE_ASSERT( m_pReader == nullptr );
         m_pReader = EE::New<mpack_reader_t>();
+        m_numBytesCopied = 0;
         mpack_reader_init_data( m_pReader, pData, size );
         mpack_reader_set_error_handler( m_pReader, &MPackReaderError );
     }
@@ -105,6 +106,7 @@ namespace EE::Serialization
 
         mpack_read_bytes( m_pReader, (char*) blob.data(), expectedSize );
         mpack_done_bin( m_pReader );
+        m_numBytesCopied += expectedSize;
     }
 
     void BinaryReader::ReadValue( String& v )
@@ -122,6 +124,7 @@ namespace EE::Serialization
 
             mpack_read_bytes( m_pReader, v.data(), expectedLength );
             mpack_done_str( m_pReader );
+            m_numBytesCopied += expectedLength;
         }
     }
 
@@ -140,6 +143,7 @@ namespace EE::Serialization
 
             mpack_read_bytes( m_pReader, v.data(), expectedLength );
             mpack_done_str( m_pReader );
+            m_numBytesCopied += expectedLength;
         }
     }
 
@@ -165,12 +169,66 @@ namespace EE::Serialization
         }
     }
 
+    void BinaryReader::ReadStringIDs( StringID* pIDs, size_t numIDs )
+    {
+        // Read all strings into a single buffer, nil entries are stored as empty strings
+        TVector<char> stringData;
+        TVector<size_t> stringOffsets;
+        stringOffsets.resize( numIDs );
+
+        for ( size_t i = 0; i < numIDs; i++ )
+        {
+            stringOffsets[i] = stringData.size();
+
+            if ( mpack_peek_tag( m_pReader ).type == mpack_type_nil )
+            {
+                mpack_expect_nil( m_pReader );
+                stringData.push_back( 0 );
+            }
+            else
+            {
+                size_t const expectedLength = mpack_expect_str( m_pReader );
+                stringData.resize( stringOffsets[i] + expectedLength + 1 );
+                mpack_read_bytes( m_pReader, stringData.data() + stringOffsets[i], expectedLength );
+                mpack_done_str( m_pReader );
+                stringData.back() = 0;
+            }
+        }
+
+        // Intern all the strings at once
+        TVector<char const*> strings;
+        strings.resize( numIDs );
+        for ( size_t i = 0; i < numIDs; i++ )
+        {
+            strings[i] = stringData.data() + stringOffsets[i];
+        }
+
+        StringID::CreateMultiple( strings.data(), numIDs, pIDs );
+    }
+
     void BinaryReader::ReadBinaryData( void* pData, size_t size )
     {
         size_t const expectedSize = mpack_expect_bin( m_pReader );
         EE_ASSERT( expectedSize == size );
         mpack_read_bytes( m_pReader, (char*) pData, expectedSize );
         mpack_done_bin( m_pReader );
+        m_numBytesCopied += expectedSize;
+    }
+
+    TArrayView<uint8_t const> BinaryReader::ReadBinaryDataView()
+    {
+        size_t const size = mpack_expect_bin( m_pReader );
+        char const* pData = mpack_read_bytes_inplace( m_pReader, size );
+        mpack_done_bin( m_pReader );
+        return TArrayView<uint8_t const>( (uint8_t const*) pData, size );
+    }
+
+    TArrayView<uint8_t const> BinaryReader::GetRemainingData() const
+    {
+        EE_ASSERT( m_pReader != nullptr );
+        char const* pData = nullptr;
+        size_t const size = mpack_reader_remaining( m_pReader, &pData );
+        return TArrayView<uint8_t const>( (uint8_t const*) pData, size );
     }
 
     //-------------------------------------------------------------------------
@@ -329,17 +387,19 @@ namespace EE::Serialization
     {
         m_serializer.Reset();
         m_fileData.clear();
+        m_mappedFile.Close();
+        m_sourceDataSize = 0;
     }
 
     bool BinaryInputArchive::ReadFromData( uint8_t const* pData, size_t size )
     {
         if ( m_serializer.IsReading() )
         {
-            m_serializer.Reset();
-            m_fileData.clear();
+            Reset();
         }
 
         m_serializer.BeginReading( (char const*) pData, size );
+        m_sourceDataSize = size;
         return true;
     }
 
@@ -349,8 +409,7 @@ namespace EE::Serialization
 
         if ( m_serializer.IsReading() )
         {
-            m_serializer.Reset();
-            m_fileData.clear();
+            Reset();
         }
 
         //-------------------------------------------------------------------------
@@ -360,6 +419,7 @@ namespace EE::Serialization
             if ( FileSystem::ReadBinaryFile( filePath, m_fileData ) )
             {
                 m_serializer.BeginReading( (char const*) m_fileData.data(), m_fileData.size() );
+                m_sourceDataSize = m_fileData.size();
             }
             else
             {
@@ -372,6 +432,27 @@ namespace EE::Serialization
         return false;
     }
 
+    bool BinaryInputArchive::ReadFromMappedFile( FileSystem::Path const& filePath )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+
+        if ( m_serializer.IsReading() )
+        {
+            Reset();
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( !m_mappedFile.Open( filePath ) )
+        {
+            return false;
+        }
+
+        m_serializer.BeginReading( (char const*) m_mappedFile.GetData(), m_mappedFile.GetSize() );
+        m_sourceDataSize = m_mappedFile.GetSize();
+        return true;
+    }
+
     bool BinaryInputArchive::ReadFromBlob( Blob const& blob )
     {
         return ReadFromData( blob.data(), blob.size() );
@@ -2,6 +2,7 @@
 
 #include "Base/Types/Containers_ForwardDecl.h"
 #include "Base/Types/Arrays.h"
+#include "Base/FileSystem/MemoryMappedFile.h"
 #include <type_traits>
 
 //-------------------------------------------------------------------------
@@ -10,7 +11,6 @@ struct mpack_reader_t;
 struct mpack_writer_t;
 
 namespace EE { class StringID; }
-namespace EE::FileSystem { class Path; }
 
 //-------------------------------------------------------------------------
 
@@ -31,15 +31,21 @@ namespace EE::Serialization
 
         BinaryReader( BinaryReader const& rhs ) = delete;
         BinaryReader& operator=( BinaryReader const& rhs ) = delete;
-        BinaryReader( BinaryReader&& rhs ) { m_pReader = rhs.m_pReader; rhs.m_pReader = nullptr; }
-        BinaryReader& operator=( BinaryReader&& rhs ) { m_pReader = rhs.m_pReader; rhs.m_pReader = nullptr; return *this; }
+        BinaryReader( BinaryReader&& rhs ) { m_pReader = rhs.m_pReader; m_numBytesCopied = rhs.m_numBytesCopied; rhs.m_pReader = nullptr; rhs.m_numBytesCopied = 0; }
+        BinaryReader& operator=( BinaryReader&& rhs ) { m_pReader = rhs.m_pReader; m_numBytesCopied = rhs.m_numBytesCopied; rhs.m_pReader = nullptr; rhs.m_numBytesCopied = 0; return *this; }
 
         void Reset();
 
         inline bool IsReading() const { return m_pReader != nullptr; }
+
+        // Read directly from the supplied memory, no copy of the source data is made so the data needs to remain valid until we end reading
+        // This is also what we use for memory mapped files, in which case all reads are copied straight out of the mapped pages
         void BeginReading( char const* pData, size_t size );
         void EndReading();
 
+        // The total number of bytes that were copied out of the source data by the various read functions
+        inline size_t GetNumBytesCopied() const { return m_numBytesCopied; }
+
         void ReadValue( bool& v );
         void ReadValue( int8_t& v );
         void ReadValue( int16_t& v );
@@ -56,11 +62,22 @@ namespace EE::Serialization
         void ReadValue( InlineString& v );
         void ReadValue( StringID& v);
 
+        // Read a sequence of string IDs, all the strings are read first and then interned in one go which greatly reduces string cache locking
+        void ReadStringIDs( StringID* pIDs, size_t numIDs );
+
         void ReadBinaryData( void* pData, size_t size );
 
+        // Get a view of the next binary data block without copying it, the view points directly into the source data
+        // Only valid for as long as the source data is valid (i.e. the lifetime of the mapped file or the source buffer)
+        TArrayView<uint8_t const> ReadBinaryDataView();
+
+        // Get a view of all the source data that has not yet been read, this does not consume the data
+        TArrayView<uint8_t const> GetRemainingData() const;
+
     private:
 
         mpack_reader_t* m_pReader = nullptr;
+        size_t          m_numBytesCopied = 0;
     };
 
     //-------------------------------------------------------------------------
@@ -421,6 +438,10 @@ namespace EE::Serialization
                         m_serializer.WriteBinaryData( pArrayData, dataSize );
                     }
                 }
+                else if constexpr ( std::is_same<T, StringID>::value && std::is_same<Serializer, BinaryReader>::value )
+                {
+                    m_serializer.ReadStringIDs( pArrayData, numElements );
+                }
                 else // Individually serialize each element
                 {
                     for ( auto i = 0u; i < numElements; i++ )
@@ -453,9 +474,26 @@ namespace EE::Serialization
         bool ReadFromBlob( Blob const& blob );
         bool ReadFromFile( FileSystem::Path const& filePath );
 
+        // Memory map the file and read directly from the mapping, this avoids reading the whole file into an intermediate buffer
+        bool ReadFromMappedFile( FileSystem::Path const& filePath );
+
+        // Get a view of the next binary data block without copying it - see BinaryReader::ReadBinaryDataView
+        inline TArrayView<uint8_t const> ReadBinaryDataView() { return m_serializer.ReadBinaryDataView(); }
+
+        // Get a view of all the source data that has not yet been read - see BinaryReader::GetRemainingData
+        inline TArrayView<uint8_t const> GetRemainingData() const { return m_serializer.GetRemainingData(); }
+
+        // The number of bytes that were copied out of the source data so far
+        inline size_t GetNumBytesCopied() const { return m_serializer.GetNumBytesCopied(); }
+
+        // The total size of the source data we are reading from
+        inline size_t GetSourceDataSize() const { return m_sourceDataSize; }
+
     private:
 
-        Blob        m_fileData; // If we read from file, then we store the file data here
+        Blob                            m_fileData; // If we read from file, then we store the file data here
+        FileSystem::MemoryMappedFile    m_mappedFile; // If we read from a mapped file, the mapping is kept alive here
+        size_t                          m_sourceDataSize = 0;
     };
 
     //-------------------------------------------------------------------------
@@ -27,6 +27,15 @@ namespace EE::Serialization
         inline bool IsReading() const { return m_isReading; }
         inline bool IsWriting() const { return !m_isReading; }
 
+        // Get the number of bits that have been written or read so far
+        inline uint32_t GetNumBitsProcessed() const { return m_bitPos; }
+
+        // Clear all data and prepare the archive for writing - allows large archives to be reused without reallocating
+        void ResetForWriting();
+
+        // Clear all data and copy the supplied data in for reading - allows large archives to be reused without reallocating
+        void ResetForReading( Blob const& inData );
+
         // Write
         //-------------------------------------------------------------------------
 
@@ -85,6 +94,28 @@ namespace EE::Serialization
 
     //-------------------------------------------------------------------------
 
+    template<size_t N>
+    void TBitArchive<N>::ResetForWriting()
+    {
+        m_bits.reset();
+        m_bitPos = 0;
+        m_isReading = false;
+    }
+
+    template<size_t N>
+    void TBitArchive<N>::ResetForReading( Blob const& inData )
+    {
+        size_t const numBytesToCopy = inData.size();
+        EE_ASSERT( numBytesToCopy < N / 8 );
+
+        m_bits.reset();
+        memcpy( m_bits.data(), inData.data(), numBytesToCopy );
+        m_bitPos = 0;
+        m_isReading = true;
+    }
+
+    //-------------------------------------------------------------------------
+
     template<size_t N>
     void TBitArchive<N>::WriteBool( bool value )
     {
@@ -46,6 +46,15 @@ namespace EE
 
         template<typename T>
         inline T* GetSystem() const
+        {
+            T* pSystem = TryGetSystem<T>();
+            EE_ASSERT( pSystem != nullptr );
+            return pSystem;
+        }
+
+        // Get an optional system (i.e. one that might not be registered like the render system when running headless), returns nullptr if not registered
+        template<typename T>
+        inline T* TryGetSystem() const
         {
             static_assert( std::is_base_of<EE::ISystem, T>::value, "T is not derived from ISystem" );
 
@@ -57,7 +66,6 @@ namespace EE
                 }
             }
 
-            EE_UNREACHABLE_CODE();
             return nullptr;
         }
 
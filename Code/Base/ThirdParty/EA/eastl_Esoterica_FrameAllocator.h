@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Base/_Module/API.h"
+#include "Base/Esoterica.h"
+#include "Base/Memory/FrameArena.h"
+#include <EABase/eabase.h>
+#include <EASTL/internal/config.h>
+
+//-------------------------------------------------------------------------
+// EASTL adapter for the frame arena
+//-------------------------------------------------------------------------
+// Containers using this allocator must not outlive the frame! Deallocation is a no-op, the memory is released when the arena is reset.
+
+namespace eastl
+{
+    class FrameAllocator
+    {
+    public:
+
+        inline FrameAllocator( EE::Memory::MemoryAllocator& memoryAllocator )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            m_pMemoryAllocator = &memoryAllocator;
+            #endif
+        }
+
+        inline explicit FrameAllocator( char const* pName = "EASTL frame allocator" )
+        {
+            set_name( pName );
+        }
+
+        inline FrameAllocator( FrameAllocator const& alloc )
+            #if EE_DEVELOPMENT_TOOLS
+            : m_pMemoryAllocator( alloc.m_pMemoryAllocator )
+            #endif
+        {
+            set_name( alloc.get_name() );
+        }
+
+        inline FrameAllocator( FrameAllocator const& x, char const* pName )
+            #if EE_DEVELOPMENT_TOOLS
+            : m_pMemoryAllocator( x.m_pMemoryAllocator )
+            #endif
+        {
+            set_name( pName );
+        }
+
+        inline FrameAllocator& operator=( FrameAllocator const& x )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            EE_ASSERT( m_pMemoryAllocator == x.m_pMemoryAllocator ); // DO NOT MIX DIFFERENT ALLOCATORS! This will break the memory tracking system.
+            #endif
+            return *this;
+        }
+
+        inline void* allocate( size_t n, int flags = 0 )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            return EE::Memory::FrameArena::Alloc( n, EE_DEFAULT_ALIGNMENT, *m_pMemoryAllocator );
+            #else
+            return EE::Memory::FrameArena::Alloc( n, EE_DEFAULT_ALIGNMENT );
+            #endif
+        }
+
+        inline void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
+        {
+            if ( EE_DEFAULT_ALIGNMENT > alignment ) { alignment = EE_DEFAULT_ALIGNMENT; }
+
+            #if EE_DEVELOPMENT_TOOLS
+            return EE::Memory::FrameArena::Alloc( n, alignment, *m_pMemoryAllocator );
+            #else
+            return EE::Memory::FrameArena::Alloc( n, alignment );
+            #endif
+        }
+
+        inline void deallocate( void* p, size_t n )
+        {
+            // Do nothing, frame memory is released when the arena is reset
+        }
+
+        inline char const* get_name() const
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            return m_pMemoryAllocator->GetName();
+            #else
+            return EASTL_ALLOCATOR_DEFAULT_NAME;
+            #endif
+        }
+
+        inline void set_name( char const* pName )
+        {
+            // Not used right now
+        }
+
+    protected:
+
+        #if EE_DEVELOPMENT_TOOLS
+        EE::Memory::MemoryAllocator* m_pMemoryAllocator = &EE::Memory::Allocators::g_frameArena;
+        #endif
+    };
+
+    //-------------------------------------------------------------------------
+
+    // All frame allocators share the same arena so memory can be freely exchanged between them
+    inline bool operator==( FrameAllocator const& a, FrameAllocator const& b ) { return true; }
+    inline bool operator!=( FrameAllocator const& a, FrameAllocator const& b ) { return false; }
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+#ifdef __linux__
+#include "Base/Threading/Threading.h"
+#include "Base/Types/Arrays.h"
+#include <atomic>
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Threading
+{
+    namespace
+    {
+        static bool ReadIntegerFromFile( char const* pFilePath, int32_t& outValue )
+        {
+            FILE* pFile = fopen( pFilePath, "r" );
+            if ( pFile == nullptr )
+            {
+                return false;
+            }
+
+            bool const result = fscanf( pFile, "%d", &outValue ) == 1;
+            fclose( pFile );
+            return result;
+        }
+
+        static ProcessorInfo CalculateProcessorInfo()
+        {
+            ProcessorInfo procInfo;
+
+            int32_t const numConfiguredCPUs = (int32_t) sysconf( _SC_NPROCESSORS_CONF );
+            TVector<uint64_t> physicalCoreIDs;
+
+            for ( int32_t cpuIdx = 0; cpuIdx < numConfiguredCPUs; cpuIdx++ )
+            {
+                char path[128];
+                int32_t isOnline = 1;
+                snprintf( path, 128, "/sys/devices/system/cpu/cpu%d/online", cpuIdx );
+                ReadIntegerFromFile( path, isOnline ); // cpu0 has no 'online' entry and is always online
+                if ( isOnline == 0 )
+                {
+                    continue;
+                }
+
+                procInfo.m_numLogicalCores++;
+
+                // Logical cores that share a package and core ID are hyperthreads of the same physical core
+                int32_t packageID = 0, coreID = cpuIdx;
+                snprintf( path, 128, "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpuIdx );
+                ReadIntegerFromFile( path, packageID );
+                snprintf( path, 128, "/sys/devices/system/cpu/cpu%d/topology/core_id", cpuIdx );
+                ReadIntegerFromFile( path, coreID );
+
+                uint64_t const physicalCoreID = ( uint64_t( uint32_t( packageID ) ) << 32 ) | uint32_t( coreID );
+                if ( !VectorContains( physicalCoreIDs, physicalCoreID ) )
+                {
+                    physicalCoreIDs.emplace_back( physicalCoreID );
+                }
+            }
+
+            procInfo.m_numPhysicalCores = (uint16_t) physicalCoreIDs.size();
+
+            // Fallback in case sysfs is not available (e.g. in some containers)
+            if ( procInfo.m_numLogicalCores == 0 )
+            {
+                procInfo.m_numLogicalCores = (uint16_t) sysconf( _SC_NPROCESSORS_ONLN );
+                procInfo.m_numPhysicalCores = procInfo.m_numLogicalCores;
+            }
+
+            return procInfo;
+        }
+
+        //-------------------------------------------------------------------------
+
+        // The sync event state is stored directly in the native handle storage, 0 = reset, 1 = signaled
+        EE_FORCE_INLINE std::atomic_ref<uint32_t> GetEventState( void* const& nativeHandle )
+        {
+            static_assert( sizeof( void* ) >= sizeof( uint32_t ), "Native handle storage is too small for the futex word" );
+            return std::atomic_ref<uint32_t>( *reinterpret_cast<uint32_t*>( const_cast<void**>( &nativeHandle ) ) );
+        }
+
+        EE_FORCE_INLINE long FutexWait( void* const& nativeHandle, uint32_t expectedValue, timespec const* pTimeout )
+        {
+            return syscall( SYS_futex, const_cast<void**>( &nativeHandle ), FUTEX_WAIT_PRIVATE, expectedValue, pTimeout, nullptr, 0 );
+        }
+
+        EE_FORCE_INLINE void FutexWakeAll( void* const& nativeHandle )
+        {
+            syscall( SYS_futex, const_cast<void**>( &nativeHandle ), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0 );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    ProcessorInfo GetProcessorInfo()
+    {
+        // Reading the topology is not free, and it cannot change while we are running
+        static ProcessorInfo const s_processorInfo = CalculateProcessorInfo();
+        return s_processorInfo;
+    }
+
+    //-------------------------------------------------------------------------
+
+    ThreadID GetCurrentThreadID()
+    {
+        thread_local static ThreadID const s_threadID = (ThreadID) syscall( SYS_gettid );
+        return s_threadID;
+    }
+
+    void SetCurrentThreadName( char const* pName )
+    {
+        EE_ASSERT( pName != nullptr );
+
+        // Thread names are limited to 16 chars (including the null terminator)
+        char threadName[16];
+        strncpy( threadName, pName, 15 );
+        threadName[15] = 0;
+        pthread_setname_np( pthread_self(), threadName );
+    }
+
+    bool SetCurrentThreadAffinityMask( uint64_t processorMask )
+    {
+        EE_ASSERT( processorMask != 0 );
+
+        cpu_set_t cpuSet;
+        CPU_ZERO( &cpuSet );
+        for ( int32_t i = 0; i < 64; i++ )
+        {
+            if ( processorMask & ( 1ull << i ) )
+            {
+                CPU_SET( i, &cpuSet );
+            }
+        }
+
+        return pthread_setaffinity_np( pthread_self(), sizeof( cpu_set_t ), &cpuSet ) == 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    SyncEvent::SyncEvent()
+        : m_pNativeHandle( nullptr )
+    {
+        GetEventState( m_pNativeHandle ).store( 0, std::memory_order_relaxed );
+    }
+
+    SyncEvent::~SyncEvent()
+    {
+        m_pNativeHandle = nullptr;
+    }
+
+    void SyncEvent::Signal()
+    {
+        if ( GetEventState( m_pNativeHandle ).exchange( 1, std::memory_order_release ) == 0 )
+        {
+            FutexWakeAll( m_pNativeHandle );
+        }
+    }
+
+    void SyncEvent::Reset()
+    {
+        GetEventState( m_pNativeHandle ).store( 0, std::memory_order_release );
+    }
+
+    void SyncEvent::Wait() const
+    {
+        while ( GetEventState( m_pNativeHandle ).load( std::memory_order_acquire ) == 0 )
+        {
+            // Spurious wake ups and EAGAIN (state changed before we slept) are handled by re-checking the state
+            FutexWait( m_pNativeHandle, 0, nullptr );
+        }
+    }
+
+    void SyncEvent::Wait( Milliseconds maxWaitTime ) const
+    {
+        timespec currentTime;
+        clock_gettime( CLOCK_MONOTONIC, &currentTime );
+        int64_t const deadlineNS = int64_t( currentTime.tv_sec ) * 1000000000 + currentTime.tv_nsec + int64_t( maxWaitTime.ToFloat() * 1000000.0f );
+
+        while ( GetEventState( m_pNativeHandle ).load( std::memory_order_acquire ) == 0 )
+        {
+            clock_gettime( CLOCK_MONOTONIC, &currentTime );
+            int64_t const remainingNS = deadlineNS - ( int64_t( currentTime.tv_sec ) * 1000000000 + currentTime.tv_nsec );
+            if ( remainingNS <= 0 )
+            {
+                break;
+            }
+
+            // The futex timeout is relative and measured against the monotonic clock
+            timespec const timeout = { time_t( remainingNS / 1000000000 ), long( remainingNS % 1000000000 ) };
+            FutexWait( m_pNativeHandle, 0, &timeout );
+        }
+    }
+}
+#endif
\ No newline at end of file
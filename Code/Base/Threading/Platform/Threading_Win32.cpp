@@ -72,6 +72,12 @@ namespace EE::Threading
         SetThreadDescription( pNativeThreadHandle, wThreadName );
     }
 
+    bool SetCurrentThreadAffinityMask( uint64_t processorMask )
+    {
+        EE_ASSERT( processorMask != 0 );
+        return SetThreadAffinityMask( GetCurrentThread(), (DWORD_PTR) processorMask ) != 0;
+    }
+
     //-------------------------------------------------------------------------
 
     SyncEvent::SyncEvent()
@@ -46,7 +46,7 @@ namespace EE
     TaskSystem::TaskSystem( int32_t numWorkers )
         : m_numWorkers( numWorkers )
     {
-        EE_ASSERT( numWorkers > 0 );
+        EE_ASSERT( numWorkers >= 0 );
     }
 
     TaskSystem::~TaskSystem()
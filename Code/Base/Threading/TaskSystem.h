@@ -47,6 +47,14 @@ namespace EE
             return m_numWorkers;
         }
 
+        // Change the number of worker threads, this is only allowed before the task system is initialized
+        // With no workers, tasks are executed by the threads waiting on them
+        inline void SetNumWorkers( int32_t numWorkers )
+        {
+            EE_ASSERT( !m_initialized && numWorkers >= 0 );
+            m_numWorkers = numWorkers;
+        }
+
         inline void WaitForAll()
         { 
             m_taskScheduler.WaitforAll();
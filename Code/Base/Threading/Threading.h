@@ -5,6 +5,8 @@
 #include "Base/ThirdParty/concurrentqueue/concurrentqueue.h"
 #include <mutex>
 #include <shared_mutex>
+#include <condition_variable>
+#include <thread>
 
 //-------------------------------------------------------------------------
 
@@ -133,4 +135,7 @@ namespace EE::Threading
     EE_BASE_API void Shutdown();
     EE_BASE_API ThreadID GetCurrentThreadID();
     EE_BASE_API void SetCurrentThreadName( char const* pName );
+
+    // Restrict the current thread to the logical processors set in the mask, returns false if the affinity could not be set
+    EE_BASE_API bool SetCurrentThreadAffinityMask( uint64_t processorMask );
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include "Time.h"
 #include <chrono>
 
+#if __linux__
+#include <time.h>
+#endif
+
 //-------------------------------------------------------------------------
 
 namespace EE
@@ -20,9 +24,16 @@ namespace EE
 
     Nanoseconds PlatformClock::GetTime()
     {
+        #if __linux__
+        // The standard high resolution clock is the (adjustable) wall clock with libstdc++, so read the monotonic clock directly
+        timespec time;
+        clock_gettime( CLOCK_MONOTONIC, &time );
+        return Nanoseconds( uint64_t( time.tv_sec ) * 1000000000ull + uint64_t( time.tv_nsec ) );
+        #else
         auto const time = std::chrono::high_resolution_clock::now();
         uint64_t const numNanosecondsSinceEpoch = time.time_since_epoch().count();
         return Nanoseconds( numNanosecondsSinceEpoch );
+        #endif
     }
 
     //-------------------------------------------------------------------------
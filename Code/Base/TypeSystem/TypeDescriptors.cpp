@@ -351,73 +351,78 @@ namespace EE::TypeSystem
 
         for ( auto const& propertyDesc : m_properties )
         {
-            EE_ASSERT( propertyDesc.IsValid() );
+            RestoreProperty( typeRegistry, pTypeInfo, pTypeInstance, propertyDesc );
+        }
 
-            // Resolve a property path for a given instance
-            auto resolvedPath = ResolvePropertyPath( typeRegistry, pTypeInstance, propertyDesc.m_path );
-            if ( !resolvedPath.IsValid() )
-            {
-                EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Tried to set the value for an invalid property (%s) for type (%s)", propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
-                continue;
-            }
+        return pTypeInstance;
+    }
 
-            //-------------------------------------------------------------------------
+    void TypeDescriptor::RestoreProperty( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, IReflectedType* pTypeInstance, PropertyDescriptor const& propertyDesc ) const
+    {
+        EE_ASSERT( propertyDesc.IsValid() );
 
-            ResolvedPropertyPathElement const& resolvedProperty = resolvedPath.m_pathElements.back();
+        // Resolve a property path for a given instance
+        auto resolvedPath = ResolvePropertyPath( typeRegistry, pTypeInstance, propertyDesc.m_path );
+        if ( !resolvedPath.IsValid() )
+        {
+            EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Tried to set the value for an invalid property (%s) for type (%s)", propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+            return;
+        }
 
-            if ( resolvedProperty.IsDynamicArray() && !resolvedProperty.IsArrayElement() )
+        //-------------------------------------------------------------------------
+
+        ResolvedPropertyPathElement const& resolvedProperty = resolvedPath.m_pathElements.back();
+
+        if ( resolvedProperty.IsDynamicArray() && !resolvedProperty.IsArrayElement() )
+        {
+            int32_t numElements = 0;
+            if ( TypeSystem::Conversion::ConvertBinaryToNativeType( typeRegistry, GetCoreTypeID( CoreTypeID::Int32 ), TypeID(), propertyDesc.m_byteValue, &numElements ) )
             {
-                int32_t numElements = 0;
-                if ( TypeSystem::Conversion::ConvertBinaryToNativeType( typeRegistry, GetCoreTypeID( CoreTypeID::Int32 ), TypeID(), propertyDesc.m_byteValue, &numElements ) )
-                {
-                    EE_ASSERT( numElements >= 0 && numElements < 100000 );
-                    auto pParentTypeInfo = typeRegistry.GetTypeInfo( resolvedProperty.m_pPropertyInfo->m_parentTypeID );
-                    EE_ASSERT( pParentTypeInfo != nullptr );
-                    pParentTypeInfo->SetArraySize( resolvedProperty.m_pParentInstance, resolvedProperty.m_pPropertyInfo->m_ID.ToUint(), numElements );
-                }
-                else
-                {
-                    EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Failed to convert array size value for property (%s) on type: %s", propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
-                }
+                EE_ASSERT( numElements >= 0 && numElements < 100000 );
+                auto pParentTypeInfo = typeRegistry.GetTypeInfo( resolvedProperty.m_pPropertyInfo->m_parentTypeID );
+                EE_ASSERT( pParentTypeInfo != nullptr );
+                pParentTypeInfo->SetArraySize( resolvedProperty.m_pParentInstance, resolvedProperty.m_pPropertyInfo->m_ID.ToUint(), numElements );
             }
-            else if ( resolvedProperty.IsTypeInstance() )
+            else
             {
-                TypeID instanceTypeID;
-                if ( TypeSystem::Conversion::ConvertBinaryToNativeType( typeRegistry, GetCoreTypeID( CoreTypeID::TypeID ), TypeID(), propertyDesc.m_byteValue, &instanceTypeID ) )
-                {
-                    auto pInstanceContainer = (TypeInstance*) resolvedProperty.m_pPropertyAddress;
-
-                    if ( instanceTypeID.IsValid() )
-                    {
-                        TypeInfo const* pInstanceTypeInfo = typeRegistry.GetTypeInfo( instanceTypeID );
-                        if ( pInstanceTypeInfo == nullptr )
-                        {
-                            EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Invalid instance type (%s) for an property (%s) for type (%s)", instanceTypeID.c_str(), propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
-                            continue;
-                        }
+                EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Failed to convert array size value for property (%s) on type: %s", propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+            }
+        }
+        else if ( resolvedProperty.IsTypeInstance() )
+        {
+            TypeID instanceTypeID;
+            if ( TypeSystem::Conversion::ConvertBinaryToNativeType( typeRegistry, GetCoreTypeID( CoreTypeID::TypeID ), TypeID(), propertyDesc.m_byteValue, &instanceTypeID ) )
+            {
+                auto pInstanceContainer = (TypeInstance*) resolvedProperty.m_pPropertyAddress;
 
-                        pInstanceContainer->CreateInstance( pInstanceTypeInfo );
-                    }
-                    else
+                if ( instanceTypeID.IsValid() )
+                {
+                    TypeInfo const* pInstanceTypeInfo = typeRegistry.GetTypeInfo( instanceTypeID );
+                    if ( pInstanceTypeInfo == nullptr )
                     {
-                        pInstanceContainer->DestroyInstance();
+                        EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Invalid instance type (%s) for an property (%s) for type (%s)", instanceTypeID.c_str(), propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+                        return;
                     }
+
+                    pInstanceContainer->CreateInstance( pInstanceTypeInfo );
                 }
                 else
                 {
-                    EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Failed to read type instance ID value for property (%s) on type: %s", propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+                    pInstanceContainer->DestroyInstance();
                 }
             }
-            else // Set actual property value
+            else
             {
-                if ( !Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyDesc.m_byteValue, resolvedProperty.m_pPropertyAddress ) )
-                {
-                    EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Failed to convert property value for property (%s) on type: %s", propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
-                }
+                EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Failed to read type instance ID value for property (%s) on type: %s", propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+            }
+        }
+        else // Set actual property value
+        {
+            if ( !Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyDesc.m_byteValue, resolvedProperty.m_pPropertyAddress ) )
+            {
+                EE_LOG_ERROR( LogCategory::TypeSystem, "Type Descriptor", "Failed to convert property value for property (%s) on type: %s", propertyDesc.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
             }
         }
-
-        return pTypeInstance;
     }
 
     //-------------------------------------------------------------------------
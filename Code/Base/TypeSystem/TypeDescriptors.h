@@ -5,6 +5,7 @@
 #include "CoreTypeIDs.h"
 #include "CoreTypeConversions.h"
 #include "TypeRegistry.h"
+#include "TypeInstantiationProgram.h"
 
 //-------------------------------------------------------------------------
 
@@ -44,6 +45,8 @@ namespace EE::TypeSystem
     {
         EE_SERIALIZE( m_typeID, m_properties );
 
+        friend struct TypeInstantiationProgram;
+
     public:
 
         // Create a type descriptor from a given reflected instance
@@ -65,8 +68,9 @@ namespace EE::TypeSystem
         //-------------------------------------------------------------------------
 
         // Create a new instance of the described type!
+        // If a validated instantiation program (compiled from this descriptor) is supplied, it will be used instead of restoring the properties via reflection
         template<typename T>
-        [[nodiscard]] inline T* CreateType( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo ) const
+        [[nodiscard]] inline T* CreateType( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, TypeInstantiationProgram const* pProgram = nullptr ) const
         {
             EE_ASSERT( pTypeInfo != nullptr && pTypeInfo->m_ID == m_typeID );
             EE_ASSERT( pTypeInfo->IsDerivedFrom<T>() );
@@ -76,7 +80,15 @@ namespace EE::TypeSystem
             EE_ASSERT( pTypeInstance != nullptr );
 
             // Set properties
-            RestorePropertyState( typeRegistry, pTypeInfo, pTypeInstance );
+            if ( pProgram != nullptr && pProgram->IsValidated() )
+            {
+                pProgram->Execute( typeRegistry, pTypeInfo, *this, pTypeInstance );
+            }
+            else
+            {
+                RestorePropertyState( typeRegistry, pTypeInfo, pTypeInstance );
+            }
+
             pTypeInstance->PostDeserialize( typeRegistry );
             return reinterpret_cast<T*>( pTypeInstance );
         }
@@ -136,6 +148,7 @@ namespace EE::TypeSystem
     private:
 
         void* RestorePropertyState( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, IReflectedType* pTypeInstance ) const;
+        void RestoreProperty( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, IReflectedType* pTypeInstance, PropertyDescriptor const& propertyDesc ) const;
 
     public:
 
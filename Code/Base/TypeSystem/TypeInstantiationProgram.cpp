@@ -0,0 +1,363 @@
+#include "TypeInstantiationProgram.h"
+#include "TypeDescriptors.h"
+#include "TypeRegistry.h"
+#include "Base/Resource/ResourcePtr.h"
+#include "Base/Encoding/Hash.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::TypeSystem
+{
+    static void AppendTypeLayout( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, TVector<uint64_t>& layoutData )
+    {
+        EE_ASSERT( pTypeInfo != nullptr );
+
+        layoutData.emplace_back( pTypeInfo->m_ID.ToUint() );
+        layoutData.emplace_back( (uint64_t) pTypeInfo->m_size );
+
+        for ( PropertyInfo const& propertyInfo : pTypeInfo->m_properties )
+        {
+            layoutData.emplace_back( propertyInfo.m_ID.ToUint() );
+            layoutData.emplace_back( propertyInfo.m_typeID.ToUint() );
+            layoutData.emplace_back( ( uint64_t( uint32_t( propertyInfo.m_offset ) ) << 32 ) | uint32_t( propertyInfo.m_size ) );
+            layoutData.emplace_back( ( uint64_t( propertyInfo.m_flags.Get() ) << 32 ) | uint32_t( propertyInfo.m_arraySize ) );
+
+            // Nested structures are part of the layout, since the program writes directly into them
+            if ( propertyInfo.IsStructureProperty() && !propertyInfo.IsArrayProperty() )
+            {
+                TypeInfo const* pNestedTypeInfo = typeRegistry.GetTypeInfo( propertyInfo.m_typeID );
+                if ( pNestedTypeInfo != nullptr )
+                {
+                    AppendTypeLayout( typeRegistry, pNestedTypeInfo, layoutData );
+                }
+            }
+        }
+    }
+
+    uint64_t TypeInstantiationProgram::CalculateLayoutHash( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo )
+    {
+        TVector<uint64_t> layoutData;
+        AppendTypeLayout( typeRegistry, pTypeInfo, layoutData );
+        return Hash::GetHash64( layoutData.data(), layoutData.size() * sizeof( uint64_t ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    // Can the value of this core type be copied directly into an instance
+    static bool IsTriviallyCopyableCoreType( CoreTypeID coreType )
+    {
+        switch ( coreType )
+        {
+            case CoreTypeID::Bool:
+            case CoreTypeID::Uint8:
+            case CoreTypeID::Int8:
+            case CoreTypeID::Uint16:
+            case CoreTypeID::Int16:
+            case CoreTypeID::Uint32:
+            case CoreTypeID::Int32:
+            case CoreTypeID::Uint64:
+            case CoreTypeID::Int64:
+            case CoreTypeID::Float:
+            case CoreTypeID::Double:
+            case CoreTypeID::UUID:
+            case CoreTypeID::Color:
+            case CoreTypeID::Float2:
+            case CoreTypeID::Float3:
+            case CoreTypeID::Float4:
+            case CoreTypeID::Vector:
+            case CoreTypeID::Quaternion:
+            case CoreTypeID::Matrix:
+            case CoreTypeID::Transform:
+            case CoreTypeID::Microseconds:
+            case CoreTypeID::Milliseconds:
+            case CoreTypeID::Seconds:
+            case CoreTypeID::Percentage:
+            case CoreTypeID::Degrees:
+            case CoreTypeID::Radians:
+            case CoreTypeID::EulerAngles:
+            case CoreTypeID::IntRange:
+            case CoreTypeID::FloatRange:
+            case CoreTypeID::BitFlags:
+            case CoreTypeID::TBitFlags:
+            case CoreTypeID::ResourceTypeID:
+            return true;
+
+            default:
+            return false;
+        }
+    }
+
+    bool TypeInstantiationProgram::Compile( TypeRegistry const& typeRegistry, TypeDescriptor const& typeDesc, TypeInstantiationProgram& outProgram )
+    {
+        outProgram = TypeInstantiationProgram();
+
+        TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( typeDesc.m_typeID );
+        if ( pTypeInfo == nullptr )
+        {
+            EE_LOG_ERROR( LogCategory::TypeSystem, "Type Instantiation Program", "Unknown type (%s)", typeDesc.m_typeID.c_str() );
+            return false;
+        }
+
+        outProgram.m_layoutHash = CalculateLayoutHash( typeRegistry, pTypeInfo );
+
+        //-------------------------------------------------------------------------
+
+        struct PendingCopy
+        {
+            uint32_t    m_offset;
+            uint32_t    m_dataOffset;
+            uint32_t    m_size;
+        };
+
+        TVector<PendingCopy> pendingCopies;
+        Blob pendingData;
+
+        alignas( 16 ) uint8_t valueBuffer[256];
+
+        int32_t const numProperties = (int32_t) typeDesc.m_properties.size();
+        for ( int32_t propertyIdx = 0; propertyIdx < numProperties; propertyIdx++ )
+        {
+            PropertyDescriptor const& propertyDesc = typeDesc.m_properties[propertyIdx];
+
+            // Statically resolve the property path, anything that goes through an array or type instance cannot be known at compile time
+            //-------------------------------------------------------------------------
+
+            TypeInfo const* pParentTypeInfo = pTypeInfo;
+            PropertyInfo const* pPropertyInfo = nullptr;
+            uint32_t offset = 0;
+            bool canCompile = propertyDesc.IsValid();
+
+            int32_t const numPathElements = (int32_t) propertyDesc.m_path.GetNumElements();
+            for ( int32_t i = 0; i < numPathElements && canCompile; i++ )
+            {
+                PropertyPath::PathElement const& pathElement = propertyDesc.m_path[i];
+                if ( pathElement.IsArrayElement() )
+                {
+                    canCompile = false;
+                    break;
+                }
+
+                pPropertyInfo = pParentTypeInfo->GetPropertyInfo( pathElement.m_ID );
+                if ( pPropertyInfo == nullptr || pPropertyInfo->IsArrayProperty() || pPropertyInfo->IsTypeInstanceProperty() )
+                {
+                    canCompile = false;
+                    break;
+                }
+
+                offset += (uint32_t) pPropertyInfo->m_offset;
+
+                if ( i < numPathElements - 1 )
+                {
+                    pParentTypeInfo = pPropertyInfo->IsStructureProperty() ? typeRegistry.GetTypeInfo( pPropertyInfo->m_typeID ) : nullptr;
+                    canCompile = ( pParentTypeInfo != nullptr );
+                }
+            }
+
+            if ( !canCompile || pPropertyInfo == nullptr || pPropertyInfo->IsStructureProperty() )
+            {
+                outProgram.m_fallbackPropertyIndices.emplace_back( propertyIdx );
+                continue;
+            }
+
+            // Convert the value
+            //-------------------------------------------------------------------------
+
+            CoreTypeID const coreType = IsCoreType( pPropertyInfo->m_typeID ) ? GetCoreType( pPropertyInfo->m_typeID ) : CoreTypeID::Invalid;
+
+            if ( pPropertyInfo->IsEnumProperty() || IsTriviallyCopyableCoreType( coreType ) )
+            {
+                if ( pPropertyInfo->m_size <= 0 || pPropertyInfo->m_size > sizeof( valueBuffer ) )
+                {
+                    outProgram.m_fallbackPropertyIndices.emplace_back( propertyIdx );
+                    continue;
+                }
+
+                memset( valueBuffer, 0, sizeof( valueBuffer ) );
+                if ( !Conversion::ConvertBinaryToNativeType( typeRegistry, *pPropertyInfo, propertyDesc.m_byteValue, valueBuffer ) )
+                {
+                    EE_LOG_ERROR( LogCategory::TypeSystem, "Type Instantiation Program", "Failed to convert property value for property (%s) on type: %s", propertyDesc.m_path.ToString().c_str(), pTypeInfo->GetTypeName() );
+                    return false;
+                }
+
+                PendingCopy& copy = pendingCopies.emplace_back();
+                copy.m_offset = offset;
+                copy.m_dataOffset = (uint32_t) pendingData.size();
+                copy.m_size = (uint32_t) pPropertyInfo->m_size;
+                pendingData.insert( pendingData.end(), valueBuffer, valueBuffer + pPropertyInfo->m_size );
+                continue;
+            }
+
+            //-------------------------------------------------------------------------
+
+            FixupOp fixup;
+            fixup.m_offset = offset;
+            bool succeeded = false;
+
+            switch ( coreType )
+            {
+                case CoreTypeID::StringID:
+                {
+                    StringID value;
+                    succeeded = Conversion::ConvertBinaryToNativeType( typeRegistry, *pPropertyInfo, propertyDesc.m_byteValue, &value );
+                    fixup.m_type = FixupType::StringID;
+                    fixup.m_valueIdx = (uint32_t) outProgram.m_stringIDs.size();
+                    outProgram.m_stringIDs.emplace_back( value );
+                }
+                break;
+
+                case CoreTypeID::TypeID:
+                {
+                    TypeID value;
+                    succeeded = Conversion::ConvertBinaryToNativeType( typeRegistry, *pPropertyInfo, propertyDesc.m_byteValue, &value );
+                    fixup.m_type = FixupType::TypeID;
+                    fixup.m_valueIdx = (uint32_t) outProgram.m_stringIDs.size();
+                    outProgram.m_stringIDs.emplace_back( value.ToStringID() );
+                }
+                break;
+
+                case CoreTypeID::String:
+                {
+                    String value;
+                    succeeded = Conversion::ConvertBinaryToNativeType( typeRegistry, *pPropertyInfo, propertyDesc.m_byteValue, &value );
+                    fixup.m_type = FixupType::String;
+                    fixup.m_valueIdx = (uint32_t) outProgram.m_strings.size();
+                    outProgram.m_strings.emplace_back( value );
+                }
+                break;
+
+                case CoreTypeID::ResourceID:
+                {
+                    ResourceID value;
+                    succeeded = Conversion::ConvertBinaryToNativeType( typeRegistry, *pPropertyInfo, propertyDesc.m_byteValue, &value );
+                    fixup.m_type = FixupType::ResourceID;
+                    fixup.m_valueIdx = (uint32_t) outProgram.m_resourceIDs.size();
+                    outProgram.m_resourceIDs.emplace_back( value );
+                }
+                break;
+
+                case CoreTypeID::ResourcePtr:
+                case CoreTypeID::TResourcePtr:
+                {
+                    Resource::ResourcePtr value;
+                    succeeded = Conversion::ConvertBinaryToNativeType( typeRegistry, *pPropertyInfo, propertyDesc.m_byteValue, &value );
+                    fixup.m_type = FixupType::ResourcePtr;
+                    fixup.m_valueIdx = (uint32_t) outProgram.m_resourceIDs.size();
+                    outProgram.m_resourceIDs.emplace_back( value.GetResourceID() );
+                }
+                break;
+
+                default:
+                {
+                    outProgram.m_fallbackPropertyIndices.emplace_back( propertyIdx );
+                    continue;
+                }
+                break;
+            }
+
+            if ( !succeeded )
+            {
+                EE_LOG_ERROR( LogCategory::TypeSystem, "Type Instantiation Program", "Failed to convert property value for property (%s) on type: %s", propertyDesc.m_path.ToString().c_str(), pTypeInfo->GetTypeName() );
+                return false;
+            }
+
+            outProgram.m_fixupOps.emplace_back( fixup );
+        }
+
+        // Merge copies into contiguous spans
+        //-------------------------------------------------------------------------
+        // If the same property is described multiple times, the last value wins (same as restoring the descriptor)
+
+        eastl::stable_sort( pendingCopies.begin(), pendingCopies.end(), [] ( PendingCopy const& a, PendingCopy const& b ) { return a.m_offset < b.m_offset; } );
+
+        for ( int32_t i = 0; i < (int32_t) pendingCopies.size(); i++ )
+        {
+            PendingCopy const& copy = pendingCopies[i];
+            if ( i < (int32_t) pendingCopies.size() - 1 && pendingCopies[i + 1].m_offset == copy.m_offset )
+            {
+                continue;
+            }
+
+            bool const canMergeWithPrevious = !outProgram.m_copyOps.empty() && ( outProgram.m_copyOps.back().m_offset + outProgram.m_copyOps.back().m_size ) == copy.m_offset;
+            if ( canMergeWithPrevious )
+            {
+                outProgram.m_copyOps.back().m_size += copy.m_size;
+            }
+            else
+            {
+                CopyOp& copyOp = outProgram.m_copyOps.emplace_back();
+                copyOp.m_offset = copy.m_offset;
+                copyOp.m_dataOffset = (uint32_t) outProgram.m_podData.size();
+                copyOp.m_size = copy.m_size;
+            }
+
+            outProgram.m_podData.insert( outProgram.m_podData.end(), pendingData.begin() + copy.m_dataOffset, pendingData.begin() + copy.m_dataOffset + copy.m_size );
+        }
+
+        return true;
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    void TypeInstantiationProgram::Execute( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, TypeDescriptor const& typeDesc, IReflectedType* pTypeInstance ) const
+    {
+        EE_ASSERT( m_isValidated );
+        EE_ASSERT( pTypeInfo != nullptr && pTypeInfo->m_ID == typeDesc.m_typeID );
+
+        uint8_t* pInstanceData = reinterpret_cast<uint8_t*>( pTypeInstance );
+
+        for ( CopyOp const& copyOp : m_copyOps )
+        {
+            memcpy( pInstanceData + copyOp.m_offset, m_podData.data() + copyOp.m_dataOffset, copyOp.m_size );
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( FixupOp const& fixupOp : m_fixupOps )
+        {
+            void* pPropertyAddress = pInstanceData + fixupOp.m_offset;
+
+            switch ( fixupOp.m_type )
+            {
+                case FixupType::StringID:
+                {
+                    *reinterpret_cast<StringID*>( pPropertyAddress ) = m_stringIDs[fixupOp.m_valueIdx];
+                }
+                break;
+
+                case FixupType::TypeID:
+                {
+                    *reinterpret_cast<TypeID*>( pPropertyAddress ) = TypeID( m_stringIDs[fixupOp.m_valueIdx] );
+                }
+                break;
+
+                case FixupType::String:
+                {
+                    *reinterpret_cast<String*>( pPropertyAddress ) = m_strings[fixupOp.m_valueIdx];
+                }
+                break;
+
+                case FixupType::ResourceID:
+                {
+                    *reinterpret_cast<ResourceID*>( pPropertyAddress ) = m_resourceIDs[fixupOp.m_valueIdx];
+                }
+                break;
+
+                case FixupType::ResourcePtr:
+                {
+                    *reinterpret_cast<Resource::ResourcePtr*>( pPropertyAddress ) = Resource::ResourcePtr( m_resourceIDs[fixupOp.m_valueIdx] );
+                }
+                break;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t propertyIdx : m_fallbackPropertyIndices )
+        {
+            typeDesc.RestoreProperty( typeRegistry, pTypeInfo, pTypeInstance, typeDesc.m_properties[propertyIdx] );
+        }
+    }
+}
\ No newline at end of file
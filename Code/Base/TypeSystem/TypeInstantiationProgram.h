@@ -0,0 +1,103 @@
+#pragma once
+#include "Base/_Module/API.h"
+#include "Base/Serialization/BinarySerialization.h"
+#include "Base/Resource/ResourceID.h"
+#include "TypeID.h"
+
+//-------------------------------------------------------------------------
+// Type Instantiation Program
+//-------------------------------------------------------------------------
+// A precompiled form of a type descriptor's property values, used to speed up instantiating types at runtime
+//
+// Restoring a type descriptor resolves every property path and converts every value through the reflection system, for each instance created.
+// The program does this work once at compile time and bakes the result into:
+//  * Copy ops - contiguous spans of trivially copyable property data that are memcpy'd directly into the instance
+//  * Fixup ops - values that need to be constructed (string IDs, strings, resource IDs/ptrs)
+//  * Fallback properties - anything the program cant express (arrays, type instances) is restored via the regular reflection path
+//
+// The program is only valid for the exact type layout it was compiled against, the layout hash is verified on load and if it doesnt match
+// (i.e. a build with a different property set like a shipping build) the program is ignored and the type descriptor is used instead.
+
+namespace EE { class IReflectedType; }
+
+//-------------------------------------------------------------------------
+
+namespace EE::TypeSystem
+{
+    class TypeRegistry;
+    class TypeInfo;
+    class TypeDescriptor;
+
+    //-------------------------------------------------------------------------
+
+    struct EE_BASE_API TypeInstantiationProgram
+    {
+        EE_SERIALIZE( m_layoutHash, m_copyOps, m_fixupOps, m_podData, m_stringIDs, m_strings, m_resourceIDs, m_fallbackPropertyIndices );
+
+    public:
+
+        // Copy a contiguous span of pre-converted data into the instance
+        struct CopyOp
+        {
+            EE_SERIALIZE( m_offset, m_dataOffset, m_size );
+
+            uint32_t                                m_offset = 0;       // Byte offset in the instance
+            uint32_t                                m_dataOffset = 0;   // Byte offset in the pod data
+            uint32_t                                m_size = 0;
+        };
+
+        enum class FixupType : uint8_t
+        {
+            StringID = 0,
+            TypeID,
+            String,
+            ResourceID,
+            ResourcePtr,
+        };
+
+        // Construct a non-trivial value in the instance
+        struct FixupOp
+        {
+            EE_SERIALIZE( m_offset, m_valueIdx, m_type );
+
+            uint32_t                                m_offset = 0;       // Byte offset in the instance
+            uint32_t                                m_valueIdx = 0;     // Index into the value array for this fixup type
+            FixupType                               m_type = FixupType::StringID;
+        };
+
+    public:
+
+        // Calculate a hash of the memory layout of all the reflected properties of a type (including any nested structures)
+        static uint64_t CalculateLayoutHash( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo );
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Compile a program from a type descriptor, returns false if the descriptor is invalid
+        static bool Compile( TypeRegistry const& typeRegistry, TypeDescriptor const& typeDesc, TypeInstantiationProgram& outProgram );
+        #endif
+
+    public:
+
+        inline bool IsValid() const { return m_layoutHash != 0; }
+
+        // Is this program safe to execute, only true once the program has been validated against the runtime type layout
+        inline bool IsValidated() const { return m_isValidated; }
+
+        // Check the layout this program was compiled against matches the runtime layout, needs to be called once after loading
+        inline bool Validate( uint64_t runtimeLayoutHash ) { m_isValidated = IsValid() && ( m_layoutHash == runtimeLayoutHash ); return m_isValidated; }
+
+        // Set the described property values on a newly created instance
+        void Execute( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, TypeDescriptor const& typeDesc, IReflectedType* pTypeInstance ) const;
+
+    public:
+
+        uint64_t                                    m_layoutHash = 0;
+        TVector<CopyOp>                             m_copyOps;
+        TVector<FixupOp>                            m_fixupOps;
+        Blob                                        m_podData;
+        TVector<StringID>                           m_stringIDs;
+        TVector<String>                             m_strings;
+        TVector<ResourceID>                         m_resourceIDs;
+        TVector<int32_t>                            m_fallbackPropertyIndices; // The indices of the type descriptor properties that need to be restored via reflection
+        bool                                        m_isValidated = false; // Not serialized
+    };
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Base/ThirdParty/EA/eastl_Esoterica_TrackedAllocator.h"
+#include "Base/ThirdParty/EA/eastl_Esoterica_FrameAllocator.h"
 
 #include "EASTL/vector.h"
 #include "EASTL/fixed_vector.h"
@@ -24,6 +25,10 @@ namespace EE
 
     template<typename T> using TAlignedVector = eastl::vector<T, eastl::TrackedAlignedAllocator>;
 
+    // Transient containers allocated from the frame arena, these must not outlive the frame (see FrameArena.h)
+    template<typename T> using TFrameVector = eastl::vector<T, eastl::FrameAllocator>;
+    template<typename T, eastl_size_t S> using TInlineFrameVector = eastl::fixed_vector<T, S, true, eastl::FrameAllocator>;
+
     using Blob = TVector<uint8_t>;
 
     template<typename T> using TArrayView = eastl::span<T, size_t( -1 )>;
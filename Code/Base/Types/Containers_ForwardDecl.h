@@ -42,6 +42,8 @@ namespace eastl
     template <size_t Alignment> class TrackedAllocatorBase;
     using TrackedAllocator = TrackedAllocatorBase<16>;
     using TrackedAlignedAllocator = TrackedAllocatorBase<32>;
+
+    class FrameAllocator;
 }
 
 //-------------------------------------------------------------------------
@@ -58,6 +60,9 @@ namespace EE
 
     template <typename T> using TAlignedVector = eastl::vector<T, eastl::TrackedAlignedAllocator>;
 
+    template<typename T> using TFrameVector = eastl::vector<T, eastl::FrameAllocator>;
+    template<typename T, size_t S> using TInlineFrameVector = eastl::fixed_vector<T, S, true, eastl::FrameAllocator>;
+
     using Blob = TVector<uint8_t>;
 
     template <typename T> using TArrayView = eastl::span<T, size_t( -1 )>;
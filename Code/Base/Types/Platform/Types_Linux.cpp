@@ -0,0 +1,37 @@
+#ifdef __linux__
+#include "../UUID.h"
+#include <strings.h>
+#include <sys/random.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    UUID UUID::GenerateID()
+    {
+        UUID newID;
+        ssize_t const numBytesRead = getrandom( newID.m_data.m_U8, 16, 0 );
+        EE_ASSERT( numBytesRead == 16 );
+
+        // Mark as a random (version 4, variant 1) UUID - same as the IDs generated on other platforms
+        newID.m_data.m_U8[6] = ( newID.m_data.m_U8[6] & 0x0F ) | 0x40;
+        newID.m_data.m_U8[8] = ( newID.m_data.m_U8[8] & 0x3F ) | 0x80;
+        return newID;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace StringUtils
+    {
+        int32_t CompareInsensitive( char const* pStr0, char const* pStr1 )
+        {
+            return strcasecmp( pStr0, pStr1 );
+        }
+
+        int32_t CompareInsensitive( char const* pStr0, char const* pStr1, size_t n )
+        {
+            return strncasecmp( pStr0, pStr1, n );
+        }
+    }
+}
+#endif
\ No newline at end of file
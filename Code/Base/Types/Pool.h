@@ -1,96 +1,291 @@
 #pragma once
 #include "Arrays.h"
 
-// Simple Pool Helper
 //-------------------------------------------------------------------------
-// Notes:
-//  * Pool value type must be default constructible
-//  * Pool ordering is non-deterministic
-//  * Pool will grow to match desired size
-//  * DO NOT rely on the address of any item in this pool. Always use the index to access the items.
+// Pool Handle
+//-------------------------------------------------------------------------
+// 32-bit generational handle: the lower bits are the slot index and the upper bits the slot generation
+// A handle to a destroyed item will fail validation even if its slot has been reused (until the generation wraps)
 
 namespace EE
 {
-    template<typename T, size_t MinimumPoolSize = 10>
-    class TPool
+    template<typename T>
+    struct TPoolHandle
     {
+        constexpr static uint32_t const s_numIndexBits = 20;
+        constexpr static uint32_t const s_numGenerationBits = 32 - s_numIndexBits;
+        constexpr static uint32_t const s_indexMask = ( 1u << s_numIndexBits ) - 1;
+        constexpr static uint32_t const s_generationMask = ( 1u << s_numGenerationBits ) - 1;
+        constexpr static uint32_t const s_maxNumSlots = s_indexMask; // The max index value is reserved for the invalid handle
+        constexpr static uint32_t const s_invalidValue = 0xFFFFFFFF;
+
+    public:
+
+        TPoolHandle() = default;
+        explicit TPoolHandle( uint32_t index, uint32_t generation ) : m_value( ( ( generation & s_generationMask ) << s_numIndexBits ) | ( index & s_indexMask ) ) { EE_ASSERT( index < s_maxNumSlots ); }
+
+        inline bool IsValid() const { return m_value != s_invalidValue; }
+        inline void Clear() { m_value = s_invalidValue; }
+
+        inline uint32_t GetIndex() const { return m_value & s_indexMask; }
+        inline uint32_t GetGeneration() const { return m_value >> s_numIndexBits; }
+        inline uint32_t GetValue() const { return m_value; }
+
+        inline bool operator==( TPoolHandle const& rhs ) const { return m_value == rhs.m_value; }
+        inline bool operator!=( TPoolHandle const& rhs ) const { return m_value != rhs.m_value; }
+
     private:
 
-        static constexpr float const GrowthRate = 1.5f;
+        uint32_t m_value = s_invalidValue;
+    };
+
+    //-------------------------------------------------------------------------
+    // Object Pool
+    //-------------------------------------------------------------------------
+    // Notes:
+    //  * Create/Destroy are O(1), free slots are kept in a free-list
+    //  * Items are stored in fixed size chunks, so item addresses are stable for the lifetime of the item
+    //  * Items are constructed on create and destructed on destroy, the value type does not need to be default constructible
+    //  * Iteration only visits live items, the iteration order is non-deterministic (destroy swaps the last live item into the removed position)
+    //  * Do not create/destroy items while iterating!
+    //
+    // Optional hot data (HotType): a second, densely packed array stored alongside the live item list (structure-of-arrays)
+    // Use this for the small set of fields that are touched every frame, so that bulk updates only touch contiguous memory
+    //
+    // e.g.
+    //      TPool<Projectile, Transform> m_projectiles;
+    //      auto handle = m_projectiles.Create( ... );
+    //      for ( Transform& transform : m_projectiles.GetHotData() ) { ... }
+
+    template<typename T, typename HotType = void, uint32_t ChunkSizeLog2 = 6>
+    class TPool
+    {
+        constexpr static bool const s_hasHotData = !std::is_void<HotType>::value;
+        constexpr static uint32_t const s_chunkSize = 1u << ChunkSizeLog2;
+        constexpr static uint32_t const s_chunkIndexMask = s_chunkSize - 1;
 
-        struct Buffer
+        struct NoHotData {};
+        using HotStorageType = typename std::conditional<s_hasHotData, HotType, NoHotData>::type;
+
+        struct Slot
         {
-            T       m_value;
-            bool    m_isUsed = false;
+            uint32_t        m_generation = 0;
+            int32_t         m_liveIdx = InvalidIndex;       // Index into the live lists, InvalidIndex if the slot is free
+            int32_t         m_nextFreeSlotIdx = InvalidIndex;
         };
 
     public:
 
-        TPool( size_t initialSize = MinimumPoolSize )
-            : m_pool( initialSize )
-        {}
+        using Handle = TPoolHandle<T>;
+
+        //-------------------------------------------------------------------------
+
+        template<bool IsConst>
+        class TIterator
+        {
+            using PoolType = typename std::conditional<IsConst, TPool const, TPool>::type;
+            using ValueType = typename std::conditional<IsConst, T const, T>::type;
+
+        public:
+
+            TIterator( PoolType* pPool, int32_t liveIdx ) : m_pPool( pPool ), m_liveIdx( liveIdx ) {}
+
+            inline ValueType& operator*() const { return *m_pPool->GetItemAddress( m_pPool->m_liveHandles[m_liveIdx].GetIndex() ); }
+            inline ValueType* operator->() const { return m_pPool->GetItemAddress( m_pPool->m_liveHandles[m_liveIdx].GetIndex() ); }
+            inline Handle GetHandle() const { return m_pPool->m_liveHandles[m_liveIdx]; }
+
+            inline TIterator& operator++() { ++m_liveIdx; return *this; }
+            inline bool operator==( TIterator const& rhs ) const { return m_liveIdx == rhs.m_liveIdx; }
+            inline bool operator!=( TIterator const& rhs ) const { return m_liveIdx != rhs.m_liveIdx; }
+
+        private:
+
+            PoolType*       m_pPool = nullptr;
+            int32_t         m_liveIdx = 0;
+        };
+
+        using iterator = TIterator<false>;
+        using const_iterator = TIterator<true>;
+
+    public:
+
+        TPool() = default;
+        TPool( TPool const& ) = delete;
+        TPool& operator=( TPool const& ) = delete;
 
         ~TPool()
         {
-            #if EE_DEVELOPMENT_TOOLS
-            for ( auto const& buffer : m_pool )
+            // All items should have been destroyed by the owner
+            EE_ASSERT( m_liveHandles.empty() );
+            Reset();
+
+            for ( T*& pChunk : m_chunks )
             {
-                EE_ASSERT( !buffer.m_isUsed );
+                EE::Free( pChunk );
             }
-            #endif
         }
 
-        inline T& GetBuffer( size_t idx )
-        {
-            EE_ASSERT( idx < m_pool.size() && m_pool[idx].m_isUsed );
-            return m_pool[idx].m_value;
-        }
+        // Items
+        //-------------------------------------------------------------------------
+
+        inline int32_t GetNumItems() const { return (int32_t) m_liveHandles.size(); }
+        inline bool IsEmpty() const { return m_liveHandles.empty(); }
 
-        inline size_t RequestBuffer( T&& value )
+        // The number of slots that have been allocated (i.e. the high-water mark)
+        inline int32_t GetCapacity() const { return (int32_t) m_slots.size(); }
+
+        template<typename... ConstructorParams>
+        Handle Create( ConstructorParams&&... params )
         {
-            EE_ASSERT( m_firstFreeBufferIdx < m_pool.size() && !m_pool[m_firstFreeBufferIdx].m_isUsed );
-            m_pool[m_firstFreeBufferIdx] = std::move( value );
-            m_pool[m_firstFreeBufferIdx].m_isUsed = true;
+            // Get a free slot
+            //-------------------------------------------------------------------------
 
-            // Find the next free buffer
-            while ( m_firstFreeBufferIdx < m_pool.size() && m_pool[m_firstFreeBufferIdx].m_isUsed )
+            uint32_t slotIdx = 0;
+            if ( m_firstFreeSlotIdx != InvalidIndex )
+            {
+                slotIdx = (uint32_t) m_firstFreeSlotIdx;
+                m_firstFreeSlotIdx = m_slots[slotIdx].m_nextFreeSlotIdx;
+            }
+            else
             {
-                m_firstFreeBufferIdx++;
+                slotIdx = (uint32_t) m_slots.size();
+                EE_ASSERT( slotIdx < Handle::s_maxNumSlots );
+                m_slots.emplace_back();
+
+                // Allocate a new chunk if needed
+                if ( ( slotIdx >> ChunkSizeLog2 ) == m_chunks.size() )
+                {
+                    m_chunks.emplace_back( reinterpret_cast<T*>( EE::Alloc( sizeof( T ) * s_chunkSize, alignof( T ) > EE_DEFAULT_ALIGNMENT ? alignof( T ) : EE_DEFAULT_ALIGNMENT ) ) );
+                }
             }
 
-            // If we've completely filled the pool, grow the pool
-            if ( m_firstFreeBufferIdx == m_pool.size() )
+            // Create item
+            //-------------------------------------------------------------------------
+
+            Slot& slot = m_slots[slotIdx];
+            slot.m_liveIdx = (int32_t) m_liveHandles.size();
+            slot.m_nextFreeSlotIdx = InvalidIndex;
+
+            Handle const handle( slotIdx, slot.m_generation );
+            m_liveHandles.emplace_back( handle );
+
+            if constexpr ( s_hasHotData )
             {
-                size_t const newSize = (size_t) Math::Ceiling( GrowthRate * m_pool.size() );
-                m_pool.resize( newSize );
+                m_hotData.emplace_back();
             }
+
+            new ( GetItemAddress( slotIdx ) ) T( std::forward<ConstructorParams>( params )... );
+            return handle;
         }
 
-        inline void ReleaseBuffer( size_t idx )
+        void Destroy( Handle handle )
         {
-            EE_ASSERT( idx < m_pool.size() && m_pool[idx].m_isUsed );
+            EE_ASSERT( IsValid( handle ) );
+
+            uint32_t const slotIdx = handle.GetIndex();
+            Slot& slot = m_slots[slotIdx];
+
+            GetItemAddress( slotIdx )->~T();
+
+            // Swap the last live item into the removed position
+            int32_t const lastLiveIdx = (int32_t) m_liveHandles.size() - 1;
+            if ( slot.m_liveIdx != lastLiveIdx )
+            {
+                Handle const movedHandle = m_liveHandles[lastLiveIdx];
+                m_liveHandles[slot.m_liveIdx] = movedHandle;
+                m_slots[movedHandle.GetIndex()].m_liveIdx = slot.m_liveIdx;
+
+                if constexpr ( s_hasHotData )
+                {
+                    m_hotData[slot.m_liveIdx] = std::move( m_hotData[lastLiveIdx] );
+                }
+            }
 
-            m_pool[idx] = T();
-            m_pool[idx].m_isUsed = false;
+            m_liveHandles.pop_back();
 
-            if ( idx < m_firstFreeBufferIdx )
+            if constexpr ( s_hasHotData )
             {
-                m_firstFreeBufferIdx = (int32_t) idx;
+                m_hotData.pop_back();
             }
+
+            // Release slot, bumping the generation invalidates all existing handles
+            slot.m_generation = ( slot.m_generation + 1 ) & Handle::s_generationMask;
+            slot.m_liveIdx = InvalidIndex;
+            slot.m_nextFreeSlotIdx = m_firstFreeSlotIdx;
+            m_firstFreeSlotIdx = (int32_t) slotIdx;
         }
 
+        // Destroy all items, the allocated memory is kept
         void Reset()
         {
-            m_pool.clear();
-            m_firstFreeBufferIdx = InvalidIndex;
+            while ( !m_liveHandles.empty() )
+            {
+                Destroy( m_liveHandles.back() );
+            }
         }
 
-        inline T const& operator[]( size_t idx ) const { return GetBuffer( idx ); }
-        inline T& operator[]( size_t idx ) { return GetBuffer( idx ); }
+        // Is this handle referring to a live item
+        inline bool IsValid( Handle handle ) const
+        {
+            if ( !handle.IsValid() || handle.GetIndex() >= m_slots.size() )
+            {
+                return false;
+            }
+
+            Slot const& slot = m_slots[handle.GetIndex()];
+            return slot.m_liveIdx != InvalidIndex && slot.m_generation == handle.GetGeneration();
+        }
+
+        // Access
+        //-------------------------------------------------------------------------
+
+        // Returns nullptr if the handle is stale
+        inline T* TryGet( Handle handle ) { return IsValid( handle ) ? GetItemAddress( handle.GetIndex() ) : nullptr; }
+        inline T const* TryGet( Handle handle ) const { return IsValid( handle ) ? GetItemAddress( handle.GetIndex() ) : nullptr; }
+
+        inline T& Get( Handle handle ) { EE_ASSERT( IsValid( handle ) ); return *GetItemAddress( handle.GetIndex() ); }
+        inline T const& Get( Handle handle ) const { EE_ASSERT( IsValid( handle ) ); return *GetItemAddress( handle.GetIndex() ); }
+
+        inline T& operator[]( Handle handle ) { return Get( handle ); }
+        inline T const& operator[]( Handle handle ) const { return Get( handle ); }
+
+        // Hot data
+        //-------------------------------------------------------------------------
+
+        template<bool Enabled = s_hasHotData, typename = typename std::enable_if<Enabled>::type>
+        inline HotStorageType& GetHotData( Handle handle ) { EE_ASSERT( IsValid( handle ) ); return m_hotData[m_slots[handle.GetIndex()].m_liveIdx]; }
+
+        template<bool Enabled = s_hasHotData, typename = typename std::enable_if<Enabled>::type>
+        inline HotStorageType const& GetHotData( Handle handle ) const { EE_ASSERT( IsValid( handle ) ); return m_hotData[m_slots[handle.GetIndex()].m_liveIdx]; }
+
+        // The hot data for all live items, in the same order as 'GetLiveHandles'
+        template<bool Enabled = s_hasHotData, typename = typename std::enable_if<Enabled>::type>
+        inline TArrayView<HotStorageType> GetHotData() { return TArrayView<HotStorageType>( m_hotData.data(), m_hotData.size() ); }
+
+        template<bool Enabled = s_hasHotData, typename = typename std::enable_if<Enabled>::type>
+        inline TArrayView<HotStorageType const> GetHotData() const { return TArrayView<HotStorageType const>( m_hotData.data(), m_hotData.size() ); }
+
+        // Iteration
+        //-------------------------------------------------------------------------
+
+        // The handles for all live items
+        inline TArrayView<Handle const> GetLiveHandles() const { return TArrayView<Handle const>( m_liveHandles.data(), m_liveHandles.size() ); }
+
+        inline iterator begin() { return iterator( this, 0 ); }
+        inline iterator end() { return iterator( this, (int32_t) m_liveHandles.size() ); }
+        inline const_iterator begin() const { return const_iterator( this, 0 ); }
+        inline const_iterator end() const { return const_iterator( this, (int32_t) m_liveHandles.size() ); }
+
+    private:
+
+        EE_FORCE_INLINE T* GetItemAddress( uint32_t slotIdx ) const { return m_chunks[slotIdx >> ChunkSizeLog2] + ( slotIdx & s_chunkIndexMask ); }
 
     private:
 
-        int32_t                                               m_firstFreeBufferIdx = InvalidIndex;
-        TInlineVector<Buffer, MinimumPoolSize>              m_pool;
+        TInlineVector<T*, 8>                m_chunks;
+        TVector<Slot>                       m_slots;
+        TVector<Handle>                     m_liveHandles;
+        TVector<HotStorageType>             m_hotData;
+        int32_t                             m_firstFreeSlotIdx = InvalidIndex;
     };
 }
\ No newline at end of file
@@ -278,7 +278,8 @@ namespace EE
             size_t const origStringLength = strlen( string );
             InlineString tmp = string;
             tmp.rtrim();
-            strncpy_s( string, origStringLength + 1, tmp.c_str(), tmp.length() );
+            EE_ASSERT( tmp.length() <= origStringLength );
+            memcpy( string, tmp.c_str(), tmp.length() + 1 );
         }
 
         template<typename StringType, typename StringTypeVector>
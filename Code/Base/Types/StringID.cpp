@@ -28,19 +28,67 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    // Each shard is cache line aligned so that the locks of different shards never share a line
+    struct alignas( 64 ) StringCacheShard
+    {
+        Threading::ReadWriteMutex       m_mutex;
+        StringIDHashMap                 m_cache;
+    };
+
+    //-------------------------------------------------------------------------
+
     #if EE_DEVELOPMENT_TOOLS
     StringID::DebuggerInfo*             StringID::s_pDebuggerInfo = nullptr;
     #endif
 
-    static Threading::Mutex*            g_pStringCacheMutex = nullptr;
-    static StringIDHashMap*             g_pStringCache = nullptr;
+    static StringCacheShard*            g_pStringCacheShards = nullptr;
+
+    //-------------------------------------------------------------------------
+
+    // Add a string to the cache, the shard write lock needs to be held
+    static void AddToCacheLocked( uint32_t shardIdx, uint64_t ID, char const* pStr )
+    {
+        StringCacheShard& shard = g_pStringCacheShards[shardIdx];
+        auto iter = shard.m_cache.find( ID );
+        if ( iter == shard.m_cache.end() )
+        {
+            shard.m_cache[ID] = String( pStr, Memory::Allocators::g_stringID );
+
+            #if EE_DEVELOPMENT_TOOLS
+            StringID::s_pDebuggerInfo->m_shards[shardIdx].m_pBuckets = shard.m_cache.GetBuckets();
+            StringID::s_pDebuggerInfo->m_shards[shardIdx].m_numBuckets = shard.m_cache.bucket_count();
+            #endif
+        }
+        else
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            EE_ASSERT( iter->second == pStr );
+            #endif
+        }
+    }
+
+    // Check if a string is already in the cache, the shard read (or write) lock needs to be held
+    static bool IsInCacheLocked( uint32_t shardIdx, uint64_t ID, char const* pStr )
+    {
+        StringCacheShard const& shard = g_pStringCacheShards[shardIdx];
+        auto iter = shard.m_cache.find( ID );
+        if ( iter == shard.m_cache.end() )
+        {
+            return false;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        EE_ASSERT( iter->second == pStr );
+        #endif
+
+        return true;
+    }
 
     //-------------------------------------------------------------------------
 
     void StringID::Initialize()
     {
-        g_pStringCacheMutex = EE::New<Threading::Mutex>();
-        g_pStringCache = EE::New<StringIDHashMap>();
+        g_pStringCacheShards = EE::NewArray<StringCacheShard>( s_numCacheShards );
 
         #if EE_DEVELOPMENT_TOOLS
         s_pDebuggerInfo = EE::New<StringID::DebuggerInfo>();
@@ -53,8 +101,7 @@ namespace EE
         EE::Delete( s_pDebuggerInfo );
         #endif
 
-        EE::Delete( g_pStringCache );
-        EE::Delete( g_pStringCacheMutex );
+        EE::DeleteArray( g_pStringCacheShards );
     }
 
     //-------------------------------------------------------------------------
@@ -62,30 +109,25 @@ namespace EE
     StringID::StringID( char const* pStr )
     {
         // If this is nullptr then you are likely trying to statically allocate a stringID, this is not allowed and you need to use the "StaticStringID" type instead!
-        EE_ASSERT( g_pStringCacheMutex != nullptr );
+        EE_ASSERT( g_pStringCacheShards != nullptr );
 
-        if ( pStr != nullptr && strlen( pStr ) > 0 )
+        if ( pStr != nullptr && pStr[0] != 0 )
         {
             m_ID = Hash::GetHash64( pStr );
 
-            // Cache the string
-            Threading::ScopeLock lock( *g_pStringCacheMutex );
-            auto iter = g_pStringCache->find( m_ID );
-            if ( iter == g_pStringCache->end() )
+            // The vast majority of IDs already exist, so first check with only a read lock
+            uint32_t const shardIdx = GetCacheShardIndex( m_ID );
             {
-                ( *g_pStringCache )[m_ID] = String( pStr, Memory::Allocators::g_stringID );
-
-                #if EE_DEVELOPMENT_TOOLS
-                s_pDebuggerInfo->m_pBuckets = g_pStringCache->GetBuckets();
-                s_pDebuggerInfo->m_numBuckets = g_pStringCache->bucket_count();
-                #endif
-            }
-            else
-            {
-                #if EE_DEVELOPMENT_TOOLS
-                EE_ASSERT( iter->second == pStr );
-                #endif
+                Threading::ScopeLockRead lock( g_pStringCacheShards[shardIdx].m_mutex );
+                if ( IsInCacheLocked( shardIdx, m_ID, pStr ) )
+                {
+                    return;
+                }
             }
+
+            // Cache the string
+            Threading::ScopeLockWrite lock( g_pStringCacheShards[shardIdx].m_mutex );
+            AddToCacheLocked( shardIdx, m_ID, pStr );
         }
     }
 
@@ -93,6 +135,91 @@ namespace EE
         : StringID( str.c_str() )
     {}
 
+    void StringID::CreateMultiple( char const* const* pStrings, size_t numStrings, StringID* pOutIDs )
+    {
+        EE_ASSERT( g_pStringCacheShards != nullptr );
+        EE_ASSERT( pStrings != nullptr && pOutIDs != nullptr );
+
+        if ( numStrings == 0 )
+        {
+            return;
+        }
+
+        // Hash all strings and bucket them per shard
+        //-------------------------------------------------------------------------
+
+        uint32_t shardCounts[s_numCacheShards + 1] = { 0 };
+        for ( size_t i = 0; i < numStrings; i++ )
+        {
+            char const* pStr = pStrings[i];
+            if ( pStr != nullptr && pStr[0] != 0 )
+            {
+                pOutIDs[i] = StringID( Hash::GetHash64( pStr ) );
+                shardCounts[GetCacheShardIndex( pOutIDs[i].m_ID ) + 1]++;
+            }
+            else
+            {
+                pOutIDs[i] = StringID();
+            }
+        }
+
+        // Prefix sum to get the start offset for each shard
+        for ( uint32_t shardIdx = 1; shardIdx <= s_numCacheShards; shardIdx++ )
+        {
+            shardCounts[shardIdx] += shardCounts[shardIdx - 1];
+        }
+
+        TVector<uint32_t> sortedIndices;
+        sortedIndices.resize( shardCounts[s_numCacheShards] );
+
+        uint32_t shardOffsets[s_numCacheShards];
+        memcpy( shardOffsets, shardCounts, sizeof( shardOffsets ) );
+        for ( size_t i = 0; i < numStrings; i++ )
+        {
+            if ( pOutIDs[i].IsValid() )
+            {
+                sortedIndices[shardOffsets[GetCacheShardIndex( pOutIDs[i].m_ID )]++] = (uint32_t) i;
+            }
+        }
+
+        // Process each shard with a single read lock and, only if needed, a single write lock
+        //-------------------------------------------------------------------------
+
+        TInlineVector<uint32_t, 32> missingIndices;
+        for ( uint32_t shardIdx = 0; shardIdx < s_numCacheShards; shardIdx++ )
+        {
+            uint32_t const shardStart = shardCounts[shardIdx];
+            uint32_t const shardEnd = shardCounts[shardIdx + 1];
+            if ( shardStart == shardEnd )
+            {
+                continue;
+            }
+
+            missingIndices.clear();
+
+            {
+                Threading::ScopeLockRead lock( g_pStringCacheShards[shardIdx].m_mutex );
+                for ( uint32_t i = shardStart; i < shardEnd; i++ )
+                {
+                    uint32_t const stringIdx = sortedIndices[i];
+                    if ( !IsInCacheLocked( shardIdx, pOutIDs[stringIdx].m_ID, pStrings[stringIdx] ) )
+                    {
+                        missingIndices.emplace_back( stringIdx );
+                    }
+                }
+            }
+
+            if ( !missingIndices.empty() )
+            {
+                Threading::ScopeLockWrite lock( g_pStringCacheShards[shardIdx].m_mutex );
+                for ( uint32_t stringIdx : missingIndices )
+                {
+                    AddToCacheLocked( shardIdx, pOutIDs[stringIdx].m_ID, pStrings[stringIdx] );
+                }
+            }
+        }
+    }
+
     char const* StringID::c_str() const
     {
         if ( m_ID == 0 )
@@ -102,9 +229,11 @@ namespace EE
 
         {
             // Get cached string
-            Threading::ScopeLock lock( *g_pStringCacheMutex );
-            auto iter = g_pStringCache->find( m_ID );
-            if ( iter != g_pStringCache->end() )
+            uint32_t const shardIdx = GetCacheShardIndex( m_ID );
+            StringCacheShard& shard = g_pStringCacheShards[shardIdx];
+            Threading::ScopeLockRead lock( shard.m_mutex );
+            auto iter = shard.m_cache.find( m_ID );
+            if ( iter != shard.m_cache.end() )
             {
                 return iter->second.c_str();
             }
@@ -10,6 +10,9 @@
 // Deterministic numeric ID generated from a string
 // StringIDs are CASE-SENSITIVE!
 // Uses the 64bit default hash
+//
+// The string cache is split into shards (selected by the top bits of the ID), each with its own read/write lock
+// Lookups only take a shared lock so concurrent creation of existing IDs never contends
 
 namespace eastl
 {
@@ -30,10 +33,18 @@ namespace EE
 
         using StringIDHashNode = eastl::hash_node<eastl::pair<const uint64_t, String>, false>;
 
+        constexpr static uint32_t const s_numCacheShardBits = 6;
+        constexpr static uint32_t const s_numCacheShards = 1u << s_numCacheShardBits;
+
         struct DebuggerInfo
         {
-            StringIDHashNode const* const*  m_pBuckets = nullptr;
-            size_t                          m_numBuckets = 0;
+            struct Shard
+            {
+                StringIDHashNode const* const*  m_pBuckets = nullptr;
+                size_t                          m_numBuckets = 0;
+            };
+
+            Shard                           m_shards[s_numCacheShards];
         };
 
         #if EE_DEVELOPMENT_TOOLS
@@ -46,6 +57,13 @@ namespace EE
         // Shutdown global state for StringID system
         static void Shutdown();
 
+        // Create multiple IDs at once, this is significantly cheaper than creating them individually since each cache shard is only locked once
+        // Null or empty strings result in invalid IDs
+        static void CreateMultiple( char const* const* pStrings, size_t numStrings, StringID* pOutIDs );
+
+        // Get the cache shard that stores the string for a given ID
+        EE_FORCE_INLINE static uint32_t GetCacheShardIndex( uint64_t ID ) { return uint32_t( ID >> ( 64 - s_numCacheShardBits ) ); }
+
     public:
 
         StringID() = default;
@@ -8,6 +8,22 @@
 
 namespace EE
 {
+    inline std::ostream& operator<<( std::ostream& s, String const& val )
+    {
+        if ( !val.empty() )
+        {
+            s.write( val.c_str(), std::min<size_t>( val.size(), val.length() ) );
+        }
+        else
+        {
+            s.write( "''", 2 );
+        }
+
+        return s;
+    }
+
+    //-------------------------------------------------------------------------
+
     class CommandLineParser
     {
         template<typename T>
@@ -251,20 +267,6 @@ namespace EE
         mutable String          m_errorMsg;
     };
 
-    std::ostream& operator<<( std::ostream & s, String const& val )
-    {
-        if ( !val.empty() )
-        {
-            std::cout.write( val.c_str(), std::min<size_t>( val.size(), val.length() ) );
-        }
-        else
-        {
-            std::cout.write( "''", 2 );
-        }
-
-        return s;
-    }
-
     //-------------------------------------------------------------------------
 
     inline bool CommandLineParser::Parse( int32_t argc, char *argv[] )
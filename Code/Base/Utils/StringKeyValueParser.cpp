@@ -128,7 +128,7 @@ namespace EE
 
         for ( KV const& kv : m_keyValues )
         {
-            if ( _stricmp( kv.m_key.c_str(), pKey ) == 0 )
+            if ( StringUtils::CompareInsensitive( kv.m_key.c_str(), pKey ) == 0 )
             {
                 return true;
             }
@@ -143,7 +143,7 @@ namespace EE
 
         for ( KV const& kv : m_keyValues )
         {
-            if ( _stricmp( kv.m_key.c_str(), pKey ) == 0 )
+            if ( StringUtils::CompareInsensitive( kv.m_key.c_str(), pKey ) == 0 )
             {
                 if ( kv.m_value.empty() )
                 {
@@ -163,7 +163,7 @@ namespace EE
 
         for ( KV const& kv : m_keyValues )
         {
-            if ( _stricmp( kv.m_key.c_str(), pKey ) == 0 )
+            if ( StringUtils::CompareInsensitive( kv.m_key.c_str(), pKey ) == 0 )
             {
                 if ( !kv.m_value.empty() )
                 {
@@ -3,10 +3,14 @@
 //-------------------------------------------------------------------------
 
 #if EE_DLL
-    #if ESOTERICA_BASE
-        #define EE_BASE_API __declspec(dllexport)
+    #if _WIN32
+        #if ESOTERICA_BASE
+            #define EE_BASE_API __declspec(dllexport)
+        #else
+            #define EE_BASE_API __declspec(dllimport)
+        #endif
     #else
-        #define EE_BASE_API __declspec(dllimport)
+        #define EE_BASE_API __attribute__((visibility("default")))
     #endif
 #else
     #define EE_BASE_API
@@ -70,10 +70,11 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
-    BaseModule::BaseModule()
-        : m_taskSystem( Threading::GetProcessorInfo().m_numPhysicalCores - 1 )
+    BaseModule::BaseModule( bool isHeadless )
+        : m_taskSystem( Math::Max( Threading::GetProcessorInfo().m_numPhysicalCores - 1, 0 ) )
         , m_settingsRegistry( m_typeRegistry )
         , m_resourceSystem( m_taskSystem )
+        , m_isHeadless( isHeadless )
     {}
 
     ModuleContext BaseModule::GetModuleContext() const
@@ -86,6 +87,7 @@ namespace EE
         moduleContext.m_pSettingsRegistry = &mutableModule->m_settingsRegistry;
         moduleContext.m_pResourceSystem = &mutableModule->m_resourceSystem;
         moduleContext.m_pSystemRegistry = &mutableModule->m_systemRegistry;
+        moduleContext.m_isHeadless = m_isHeadless;
         return moduleContext;
     }
 
@@ -154,7 +156,10 @@ namespace EE
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
-        m_imguiSystem.Initialize( &m_inputSystem, true );
+        if ( !m_isHeadless )
+        {
+            m_imguiSystem.Initialize( &m_inputSystem, true );
+        }
         #endif
 
         // Register Systems
@@ -184,13 +189,19 @@ namespace EE
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
-        m_imguiSystem.Shutdown();
+        if ( !m_isHeadless )
+        {
+            m_imguiSystem.Shutdown();
+        }
         #endif
 
         // Rendering
         //-------------------------------------------------------------------------
 
-        Render::RHI::ReportDeviceMemoryLeaks();
+        if ( !m_isHeadless )
+        {
+            Render::RHI::ReportDeviceMemoryLeaks();
+        }
 
         // Input
         //-------------------------------------------------------------------------
@@ -23,7 +23,7 @@ namespace EE
 
     public:
 
-        BaseModule();
+        BaseModule( bool isHeadless = false );
 
         ModuleContext GetModuleContext() const;
 
@@ -39,6 +39,7 @@ namespace EE
         inline Resource::ResourceSystem* GetResourceSystem() { return &m_resourceSystem; }
         inline Resource::ResourceProvider* GetResourceProvider() { return m_pResourceProvider; }
         inline SettingsRegistry* GetSettingsRegistry() { return &m_settingsRegistry; }
+        inline bool IsHeadless() const { return m_isHeadless; }
 
         #if EE_DEVELOPMENT_TOOLS
         inline ImGuiX::ImguiSystem* GetImguiSystem() { return &m_imguiSystem; }
@@ -53,6 +54,7 @@ namespace EE
         Input::InputSystem               m_inputSystem;
         Resource::ResourceSystem         m_resourceSystem;
         Resource::ResourceProvider*      m_pResourceProvider = nullptr;
+        bool                             m_isHeadless = false;
 
         #if EE_DEVELOPMENT_TOOLS
         ImGuiX::ImguiSystem              m_imguiSystem;
@@ -106,6 +106,8 @@ namespace EE::Animation
         pResultPose->m_state = Pose::State::ParentSpacePose;
     }
 
+    //-------------------------------------------------------------------------
+
     void Blender::ApplyAdditiveFloatChannelsToReferencePose( FloatChannelSetValues const &additive, float const blendWeight, FloatChannelSetValues &result )
     {
         EE_ASSERT( additive.m_pSet == result.m_pSet );
@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "AnimationBoneMask.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationTransformBlock.h"
 #include "Base/Math/Quaternion.h"
 #include "Base/Types/BitFlags.h"
 #include "Base/TypeSystem/ReflectedType.h"
@@ -55,6 +56,12 @@ namespace EE::Animation
             {
                 return Vector::Lerp( fc0, fc1, t );
             }
+
+            EE_FORCE_INLINE static void BlendBlock( TransformBlock const& block0, TransformBlock const& block1, Vector const& t, TransformBlock& result )
+            {
+                TransformBlock::FastSLerpRotations( block0, block1, t, result );
+                TransformBlock::LerpTranslationScale( block0, block1, t, result );
+            }
         };
 
         struct AdditiveBlendFunction
@@ -74,10 +81,23 @@ namespace EE::Animation
             {
                 return Vector::MultiplyAdd( fc1, Vector( t ), fc0 );
             }
+
+            EE_FORCE_INLINE static void BlendBlock( TransformBlock const& block0, TransformBlock const& block1, Vector const& t, TransformBlock& result )
+            {
+                TransformBlock targetBlock;
+                TransformBlock::MultiplyRotations( block1, block0, targetBlock );
+                TransformBlock::SLerpRotations( block0, targetBlock, t, result );
+                TransformBlock::MultiplyAddTranslationScale( block0, block1, t, result );
+            }
         };
 
     private:
 
+        // Blend a set of transforms four bones at a time, the optional bone weights are applied in the same pass
+        // Bones with a zero weight keep the source transform and, unless layering, bones with a full weight take the target transform
+        template<typename BlendFunction>
+        static inline void BlendTransforms( int32_t numBones, Transform const* pSource, Transform const* pTarget, float const blendWeight, float const* pBoneWeights, bool isLayeredBlend, Transform* pResult );
+
         // Basic parent space blend
         template<typename BlendFunction>
         static inline void ParentSpaceBlend( Skeleton::LOD skeletonLOD, Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, Pose* pResultPose, bool isLayeredBlend );
@@ -179,6 +199,66 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    template<typename BlendFunction>
+    void Blender::BlendTransforms( int32_t numBones, Transform const* pSource, Transform const* pTarget, float const blendWeight, float const* pBoneWeights, bool isLayeredBlend, Transform* pResult )
+    {
+        Vector const vBlendWeight( blendWeight );
+        TransformBlock sourceBlock, targetBlock, resultBlock;
+
+        int32_t boneIdx = 0;
+        for ( ; boneIdx + TransformBlock::s_numBones <= numBones; boneIdx += TransformBlock::s_numBones )
+        {
+            sourceBlock.Load( &pSource[boneIdx] );
+            targetBlock.Load( &pTarget[boneIdx] );
+
+            if ( pBoneWeights != nullptr )
+            {
+                Vector const vBoneBlendWeights = vBlendWeight * Vector( &pBoneWeights[boneIdx] );
+                BlendFunction::BlendBlock( sourceBlock, targetBlock, vBoneBlendWeights, resultBlock );
+                TransformBlock::Select( resultBlock, sourceBlock, vBoneBlendWeights.EqualsZero(), resultBlock );
+
+                if ( !isLayeredBlend )
+                {
+                    TransformBlock::Select( resultBlock, targetBlock, vBoneBlendWeights.Equal( Vector::One ), resultBlock );
+                }
+            }
+            else
+            {
+                BlendFunction::BlendBlock( sourceBlock, targetBlock, vBlendWeight, resultBlock );
+            }
+
+            resultBlock.Store( &pResult[boneIdx] );
+        }
+
+        // Remaining bones
+        //-------------------------------------------------------------------------
+
+        for ( ; boneIdx < numBones; boneIdx++ )
+        {
+            float const boneBlendWeight = ( pBoneWeights != nullptr ) ? blendWeight * pBoneWeights[boneIdx] : blendWeight;
+
+            // If the bone has been masked out
+            if ( boneBlendWeight == 0.0f )
+            {
+                pResult[boneIdx] = pSource[boneIdx];
+            }
+            // If we're not blending on top of a pose, then we can skip the blend
+            else if ( !isLayeredBlend && boneBlendWeight == 1.0f )
+            {
+                pResult[boneIdx] = pTarget[boneIdx];
+            }
+            else // Perform Blend
+            {
+                Transform const& sourceTransform = pSource[boneIdx];
+                Transform const& targetTransform = pTarget[boneIdx];
+                Transform::DirectlySetRotation( pResult[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
+                Transform::DirectlySetTranslationScale( pResult[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     // Parent Space Blend
     template<typename BlendFunction>
     void Blender::ParentSpaceBlend( Skeleton::LOD skeletonLOD, Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, Pose* pResultPose, bool isLayeredBlend )
@@ -210,14 +290,7 @@ namespace EE::Animation
         else // Blend
         {
             int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
-            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
-            {
-                Transform const& sourceTransform = pSourcePose->m_parentSpaceTransforms[boneIdx];
-                Transform const& targetTransform = pTargetPose->m_parentSpaceTransforms[boneIdx];
-                Transform::DirectlySetRotation( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), blendWeight ) );
-                Transform::DirectlySetTranslationScale( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), blendWeight ) );
-            }
-
+            BlendTransforms<BlendFunction>( numBones, pSourcePose->m_parentSpaceTransforms.data(), pTargetPose->m_parentSpaceTransforms.data(), blendWeight, nullptr, isLayeredBlend, pResultPose->m_parentSpaceTransforms.data() );
             pResultPose->ClearModelSpaceTransforms();
         }
 
@@ -292,28 +365,8 @@ namespace EE::Animation
         else // Perform blend
         {
             int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
-            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
-            {
-                // If the bone has been masked out
-                float const boneBlendWeight = blendWeight * pBoneMask->GetWeight( boneIdx );
-                if ( boneBlendWeight == 0.0f )
-                {
-                    pResultPose->SetTransform( boneIdx, pSourcePose->GetTransform( boneIdx ) );
-                }
-                // If we're not blending on top of a pose, then we can skip the blend
-                else if ( !isLayeredBlend && boneBlendWeight == 1.0f )
-                {
-                    pResultPose->SetTransform( boneIdx, pTargetPose->GetTransform( boneIdx ) );
-                }
-                else // Perform Blend
-                {
-                    Transform const& sourceTransform = pSourcePose->m_parentSpaceTransforms[boneIdx];
-                    Transform const& targetTransform = pTargetPose->m_parentSpaceTransforms[boneIdx];
-                    Transform::DirectlySetRotation( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
-                    Transform::DirectlySetTranslationScale( pResultPose->m_parentSpaceTransforms[boneIdx], BlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
-                }
-            }
-
+            EE_ASSERT( pBoneMask->GetNumWeights() >= numBones );
+            BlendTransforms<BlendFunction>( numBones, pSourcePose->m_parentSpaceTransforms.data(), pTargetPose->m_parentSpaceTransforms.data(), blendWeight, pBoneMask->GetWeights().data(), isLayeredBlend, pResultPose->m_parentSpaceTransforms.data() );
             pResultPose->ClearModelSpaceTransforms();
         }
 
@@ -392,36 +445,9 @@ namespace EE::Animation
             TVector<Transform> const& referencePose = pAdditivePose->GetSkeleton()->GetParentSpaceReferencePose();
             int32_t const numBones = pResultPose->GetNumBones( skeletonLOD );
 
-            if ( pBoneMask != nullptr )
-            {
-                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
-                {
-                    Transform const& sourceTransform = referencePose[boneIdx];
-
-                    // If the bone has been masked out
-                    float const boneBlendWeight = blendWeight * pBoneMask->GetWeight( boneIdx );
-                    if ( boneBlendWeight == 0.0f )
-                    {
-                        pResultPose->SetTransform( boneIdx, sourceTransform );
-                    }
-                    else
-                    {
-                        Transform const& targetTransform = pAdditivePose->m_parentSpaceTransforms[boneIdx];
-                        Transform::DirectlySetRotation( pResultPose->m_parentSpaceTransforms[boneIdx], AdditiveBlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight ) );
-                        Transform::DirectlySetTranslationScale( pResultPose->m_parentSpaceTransforms[boneIdx], AdditiveBlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), boneBlendWeight ) );
-                    }
-                }
-            }
-            else // No mask
-            {
-                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
-                {
-                    Transform const& sourceTransform = referencePose[boneIdx];
-                    Transform const& targetTransform = pAdditivePose->m_parentSpaceTransforms[boneIdx];
-                    Transform::DirectlySetRotation( pResultPose->m_parentSpaceTransforms[boneIdx], AdditiveBlendFunction::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), blendWeight ) );
-                    Transform::DirectlySetTranslationScale( pResultPose->m_parentSpaceTransforms[boneIdx], AdditiveBlendFunction::BlendTranslationAndScale( sourceTransform.GetTranslationAndScale(), targetTransform.GetTranslationAndScale(), blendWeight ) );
-                }
-            }
+            float const* pBoneWeights = ( pBoneMask != nullptr ) ? pBoneMask->GetWeights().data() : nullptr;
+            EE_ASSERT( pBoneMask == nullptr || pBoneMask->GetNumWeights() >= numBones );
+            BlendTransforms<AdditiveBlendFunction>( numBones, referencePose.data(), pAdditivePose->m_parentSpaceTransforms.data(), blendWeight, pBoneWeights, true, pResultPose->m_parentSpaceTransforms.data() );
 
         }
 
@@ -1,4 +1,6 @@
 #include "AnimationClip.h"
+#include "AnimationClipDecoding.h"
+#include "AnimationClipKeyframeReduction.h"
 #include "Base/Drawing/DebugDrawing.h"
 #include "Base/Profiling.h"
 
@@ -6,7 +8,7 @@
 
 namespace EE::Animation
 {
-    void AnimationClip::GetPose( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod, bool sampleFloatChannels ) const
+    void AnimationClip::GetPose( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod, bool sampleFloatChannels, KeyframeReducedCursor* pCursor ) const
     {
         EE_ASSERT( IsValid() );
         EE_ASSERT( pOutPose != nullptr && pOutPose->GetSkeleton() == m_skeleton.GetPtr() );
@@ -16,11 +18,269 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
-        int32_t const numBones = m_skeleton->GetNumBones( lod );
+        SamplePose( frameTime, m_skeleton->GetNumBones( lod ), pOutPose->m_parentSpaceTransforms.data(), false, pCursor );
 
+        // Flag the pose as being set
+        pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::ParentSpacePose;
+
+        // Float Channels
+        //-------------------------------------------------------------------------
+
+        if ( sampleFloatChannels )
+        {
+            size_t const numFloatChannelData = m_floatChannelSetData.size();
+            for ( size_t i = 0; i < numFloatChannelData; i++ )
+            {
+                for ( size_t p = 0; p < pOutPose->m_floatChannelSetValues.size(); p++ )
+                {
+                    if ( pOutPose->m_floatChannelSetValues[p].GetSetID() == m_floatChannelSetData[i].GetSetID() )
+                    {
+                        m_floatChannelSetData[i].GetValues( frameTime, pOutPose->m_floatChannelSetValues[i] );
+                    }
+                }
+            }
+        }
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void AnimationClip::GetPoseReference( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( pOutPose != nullptr && pOutPose->GetSkeleton() == m_skeleton.GetPtr() );
+        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
+
+        pOutPose->ClearModelSpaceTransforms();
+        SamplePose( frameTime, m_skeleton->GetNumBones( lod ), pOutPose->m_parentSpaceTransforms.data(), true, nullptr );
+        pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::ParentSpacePose;
+    }
+    #endif
+
+    void AnimationClip::SamplePose( FrameTime const& frameTime, int32_t numBones, Transform* pOutTransforms, bool useReferenceDecoder, KeyframeReducedCursor* pCursor ) const
+    {
+        auto Decode = [this, numBones, useReferenceDecoder, pCursor] ( int32_t frameIdx, int32_t nextFrameIdx, float percentageThrough, Transform* pTransforms )
+        {
+            if ( m_isKeyframeReduced )
+            {
+                float const frameTime = float( frameIdx ) + ( ( nextFrameIdx != InvalidIndex ) ? percentageThrough : 0.0f );
+                DecodeKeyframeReducedPose( frameTime, numBones, pTransforms, pCursor );
+                return;
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            if ( useReferenceDecoder )
+            {
+                DecodePoseReference( frameIdx, nextFrameIdx, percentageThrough, numBones, pTransforms );
+                return;
+            }
+            #endif
+
+            DecodePose( frameIdx, nextFrameIdx, percentageThrough, numBones, pTransforms );
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Exactly on a key frame, so just read the pose
+        if ( frameTime.IsExactlyAtKeyFrame() )
+        {
+            Decode( frameTime.GetLowerBoundFrameIndex(), InvalidIndex, 0.0f, pOutTransforms );
+            return;
+        }
+
+        float const percentageThrough = frameTime.GetPercentageThrough();
+
+        // Read and interpolate both frames in a single pass
+        if ( m_modelSpaceBoneSamplingIndices.empty() )
+        {
+            Decode( frameTime.GetLowerBoundFrameIndex(), frameTime.GetUpperBoundFrameIndex(), percentageThrough, pOutTransforms );
+            return;
+        }
+
+        // Model space sampling - we need both source poses so read them separately
+        //-------------------------------------------------------------------------
+
+        Decode( frameTime.GetLowerBoundFrameIndex(), InvalidIndex, 0.0f, pOutTransforms );
+
+        TInlineVector<Transform, 200> tmpPose;
+        tmpPose.resize( numBones );
+        Decode( frameTime.GetUpperBoundFrameIndex(), InvalidIndex, 0.0f, tmpPose.data() );
+
+        auto CalculateModelSpaceTransformsForPose = [this] ( Transform* pLocalSpaceTransforms, TInlineVector<Transform, 30> &outModelSpaceTransforms )
+        {
+            int32_t const numBonesInChain = (int32_t) m_modelSpaceSamplingChain.size();
+            outModelSpaceTransforms.resize( numBonesInChain );
+
+            for ( int32_t i = 0; i < numBonesInChain; i++ )
+            {
+                int32_t const boneIdx = m_modelSpaceSamplingChain[i].m_boneIdx;
+                if ( boneIdx == 0 )
+                {
+                    outModelSpaceTransforms[i] = Transform::Identity;
+                }
+                else
+                {
+                    int32_t parentChainIdx = m_modelSpaceSamplingChain[i].m_parentChainLinkIdx;
+                    outModelSpaceTransforms[i] = pLocalSpaceTransforms[boneIdx] * outModelSpaceTransforms[parentChainIdx];
+                }
+            }
+        };
+
+        // Calculate all the required model space chains
+        //-------------------------------------------------------------------------
+
+        TInlineVector<Transform, 30> modelSpaceSourceTransforms;
+        CalculateModelSpaceTransformsForPose( pOutTransforms, modelSpaceSourceTransforms );
+
+        TInlineVector<Transform, 30> modelSpaceTargetTransforms;
+        CalculateModelSpaceTransformsForPose( tmpPose.data(), modelSpaceTargetTransforms );
+
+        for ( auto i = 0; i < numBones; i++ )
+        {
+            pOutTransforms[i] = Transform::SLerp( pOutTransforms[i], tmpPose[i], percentageThrough );
+        }
+
+        TInlineVector<Transform, 30> modelSpaceResultTransforms;
+        CalculateModelSpaceTransformsForPose( pOutTransforms, modelSpaceResultTransforms );
+
+        // Blend specified bones in model space and convert back to local
+        //-------------------------------------------------------------------------
+
+        for ( int32_t linkIdx : m_modelSpaceBoneSamplingIndices )
+        {
+            ModelSpaceSamplingChainLink const &info = m_modelSpaceSamplingChain[linkIdx];
+            Transform const blendedModelSpaceTransform = Transform::SLerp( modelSpaceSourceTransforms[linkIdx], modelSpaceTargetTransforms[linkIdx], percentageThrough );
+            if ( info.m_parentChainLinkIdx != InvalidIndex )
+            {
+                pOutTransforms[info.m_boneIdx] = blendedModelSpaceTransform * modelSpaceResultTransforms[info.m_parentChainLinkIdx].GetInverse();
+            }
+            else
+            {
+                pOutTransforms[info.m_boneIdx] = blendedModelSpaceTransform;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationClip::DecodePose( int32_t frameIdx, int32_t nextFrameIdx, float percentageThrough, int32_t numBones, Transform* pOutTransforms ) const
+    {
+        bool const shouldInterpolate = nextFrameIdx != InvalidIndex;
+
+        // Set all static values, animated values will be overwritten below
+        //-------------------------------------------------------------------------
+        // The constant rotation is identity for animated tracks and the translation/scale range starts are the static values for static tracks
+
+        for ( int32_t i = 0; i < numBones; i++ )
+        {
+            TrackDefinition const& trackDef = m_trackDefs[i];
+            Transform::DirectlySetRotation( pOutTransforms[i], trackDef.GetStaticRotationValue() );
+            Transform::DirectlySetTranslationScale( pOutTransforms[i], Vector( trackDef.m_translationRangeX.m_rangeStart, trackDef.m_translationRangeY.m_rangeStart, trackDef.m_translationRangeZ.m_rangeStart, trackDef.m_scaleRange.m_rangeStart ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        uint16_t const* pFrameData = m_compressedPoseData.data() + m_compressedPoseOffsets[frameIdx];
+        uint16_t const* pNextFrameData = shouldInterpolate ? m_compressedPoseData.data() + m_compressedPoseOffsets[nextFrameIdx] : nullptr;
+
+        __m128 const vT = _mm_set1_ps( percentageThrough );
+
+        // Rotations
+        //-------------------------------------------------------------------------
+
+        {
+            int32_t const numTracks = AnimationClipDecoding::GetNumTracksToDecode( m_animatedRotationBoneIndices, numBones );
+            for ( int32_t blockStartIdx = 0; blockStartIdx < numTracks; blockStartIdx += s_numTracksPerDecodeBlock )
+            {
+                int32_t const dataOffset = blockStartIdx * 3;
+                AnimationClipDecoding::QuaternionX4 rotations = AnimationClipDecoding::DecodeRotations( pFrameData + dataOffset );
+
+                if ( shouldInterpolate )
+                {
+                    AnimationClipDecoding::QuaternionX4 const nextRotations = AnimationClipDecoding::DecodeRotations( pNextFrameData + dataOffset );
+                    rotations = AnimationClipDecoding::SLerp( rotations, nextRotations, vT );
+                }
+
+                _MM_TRANSPOSE4_PS( rotations.m_x, rotations.m_y, rotations.m_z, rotations.m_w );
+                __m128 const transposed[4] = { rotations.m_x, rotations.m_y, rotations.m_z, rotations.m_w };
+
+                int32_t const numTracksInBlock = Math::Min( s_numTracksPerDecodeBlock, numTracks - blockStartIdx );
+                for ( int32_t i = 0; i < numTracksInBlock; i++ )
+                {
+                    Transform::DirectlySetRotation( pOutTransforms[m_animatedRotationBoneIndices[blockStartIdx + i]], Quaternion( Vector( transposed[i] ) ) );
+                }
+            }
+        }
+
+        // Translations
+        //-------------------------------------------------------------------------
+
+        {
+            int32_t const streamOffset = GetTranslationStreamOffset();
+            int32_t const numTracks = AnimationClipDecoding::GetNumTracksToDecode( m_animatedTranslationBoneIndices, numBones );
+            for ( int32_t blockStartIdx = 0; blockStartIdx < numTracks; blockStartIdx += s_numTracksPerDecodeBlock )
+            {
+                int32_t const dataOffset = streamOffset + blockStartIdx * 3;
+                Float4 const* pRanges = &m_translationDecodeRanges[( blockStartIdx / s_numTracksPerDecodeBlock ) * s_numTranslationDecodeRangesPerBlock];
+                AnimationClipDecoding::Float3X4 translations = AnimationClipDecoding::DecodeTranslations( pFrameData + dataOffset, pRanges );
+
+                if ( shouldInterpolate )
+                {
+                    AnimationClipDecoding::Float3X4 const nextTranslations = AnimationClipDecoding::DecodeTranslations( pNextFrameData + dataOffset, pRanges );
+                    translations.m_x = AnimationClipDecoding::Lerp( translations.m_x, nextTranslations.m_x, vT );
+                    translations.m_y = AnimationClipDecoding::Lerp( translations.m_y, nextTranslations.m_y, vT );
+                    translations.m_z = AnimationClipDecoding::Lerp( translations.m_z, nextTranslations.m_z, vT );
+                }
+
+                __m128 w = _mm_setzero_ps();
+                _MM_TRANSPOSE4_PS( translations.m_x, translations.m_y, translations.m_z, w );
+                __m128 const transposed[4] = { translations.m_x, translations.m_y, translations.m_z, w };
+
+                int32_t const numTracksInBlock = Math::Min( s_numTracksPerDecodeBlock, numTracks - blockStartIdx );
+                for ( int32_t i = 0; i < numTracksInBlock; i++ )
+                {
+                    pOutTransforms[m_animatedTranslationBoneIndices[blockStartIdx + i]].SetTranslation( Vector( transposed[i] ) );
+                }
+            }
+        }
+
+        // Scales
+        //-------------------------------------------------------------------------
+
+        {
+            int32_t const streamOffset = GetScaleStreamOffset();
+            int32_t const numTracks = AnimationClipDecoding::GetNumTracksToDecode( m_animatedScaleBoneIndices, numBones );
+            for ( int32_t blockStartIdx = 0; blockStartIdx < numTracks; blockStartIdx += s_numTracksPerDecodeBlock )
+            {
+                int32_t const dataOffset = streamOffset + blockStartIdx;
+                Float4 const* pRanges = &m_scaleDecodeRanges[( blockStartIdx / s_numTracksPerDecodeBlock ) * s_numScaleDecodeRangesPerBlock];
+                __m128 scales = AnimationClipDecoding::DecodeScales( pFrameData + dataOffset, pRanges );
+
+                if ( shouldInterpolate )
+                {
+                    __m128 const nextScales = AnimationClipDecoding::DecodeScales( pNextFrameData + dataOffset, pRanges );
+                    scales = AnimationClipDecoding::Lerp( scales, nextScales, vT );
+                }
+
+                alignas( 16 ) float scaleValues[4];
+                _mm_store_ps( scaleValues, scales );
+
+                int32_t const numTracksInBlock = Math::Min( s_numTracksPerDecodeBlock, numTracks - blockStartIdx );
+                for ( int32_t i = 0; i < numTracksInBlock; i++ )
+                {
+                    pOutTransforms[m_animatedScaleBoneIndices[blockStartIdx + i]].SetScale( scaleValues[i] );
+                }
+            }
+        }
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void AnimationClip::DecodePoseReference( int32_t frameIdx, int32_t nextFrameIdx, float percentageThrough, int32_t numBones, Transform* pOutTransforms ) const
+    {
         auto ReadCompressedPose = [&] ( int32_t poseIdx, Transform outTransforms[] )
         {
-            uint16_t const* pReadPtr = m_compressedPoseData.data() + m_compressedPoseOffsets[poseIdx];
+            uint16_t const* pFrameData = m_compressedPoseData.data() + m_compressedPoseOffsets[poseIdx];
+            uint16_t const* pRotationReadPtr = pFrameData;
+            uint16_t const* pTranslationReadPtr = pFrameData + GetTranslationStreamOffset();
+            uint16_t const* pScaleReadPtr = pFrameData + GetScaleStreamOffset();
 
             for ( auto i = 0; i < numBones; i++ )
             {
@@ -36,8 +296,8 @@ namespace EE::Animation
                 }
                 else
                 {
-                    rotation = DecodeRotation( pReadPtr );
-                    pReadPtr += 3; // Rotations are 48bits (3 x uint16_t)
+                    rotation = DecodeRotation( pRotationReadPtr );
+                    pRotationReadPtr += 3; // Rotations are 48bits (3 x uint16_t)
                 }
 
                 //-------------------------------------------------------------------------
@@ -50,8 +310,8 @@ namespace EE::Animation
                 }
                 else
                 {
-                    translationScale = DecodeTranslation( pReadPtr, trackSettings );
-                    pReadPtr += 3; // Translations are 48bits (3 x uint16_t)
+                    translationScale = DecodeTranslation( pTranslationReadPtr, trackSettings );
+                    pTranslationReadPtr += 3; // Translations are 48bits (3 x uint16_t)
                 }
 
                 //-------------------------------------------------------------------------
@@ -62,8 +322,8 @@ namespace EE::Animation
                 }
                 else
                 {
-                    translationScale.m_w = DecodeScale( pReadPtr, trackSettings );
-                    pReadPtr += 1; // Scales are 16bits (1 x uint16_t)
+                    translationScale.m_w = DecodeScale( pScaleReadPtr, trackSettings );
+                    pScaleReadPtr += 1; // Scales are 16bits (1 x uint16_t)
                 }
 
                 //-------------------------------------------------------------------------
@@ -75,105 +335,178 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
-        // Read the lower frame pose into the output pose
-        ReadCompressedPose( frameTime.GetLowerBoundFrameIndex(), pOutPose->m_parentSpaceTransforms.data() );
+        ReadCompressedPose( frameIdx, pOutTransforms );
 
-        // If we're not exactly at a key frame we need to read the upper frame pose and blend
-        if ( !frameTime.IsExactlyAtKeyFrame() )
+        if ( nextFrameIdx != InvalidIndex )
         {
             TInlineVector<Transform, 200> tmpPose;
             tmpPose.resize( numBones );
-            ReadCompressedPose( frameTime.GetUpperBoundFrameIndex(), tmpPose.data() );
+            ReadCompressedPose( nextFrameIdx, tmpPose.data() );
 
-            if ( m_modelSpaceBoneSamplingIndices.empty() )
+            for ( auto i = 0; i < numBones; i++ )
             {
-                float const percentageThrough = frameTime.GetPercentageThrough();
-                for ( auto i = 0; i < numBones; i++ )
-                {
-                    pOutPose->m_parentSpaceTransforms[i] = Transform::SLerp( pOutPose->m_parentSpaceTransforms[i], tmpPose[i], percentageThrough );
-                }
+                pOutTransforms[i] = Transform::SLerp( pOutTransforms[i], tmpPose[i], percentageThrough );
             }
-            else
+        }
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    void AnimationClip::DecodeKeyframeReducedPose( float frameTime, int32_t numBones, Transform* pOutTransforms, KeyframeReducedCursor* pCursor ) const
+    {
+        EE_ASSERT( m_isKeyframeReduced );
+
+        uint16_t* pIntervalIndices = nullptr;
+        if ( pCursor != nullptr )
+        {
+            if ( pCursor->m_pClip != this )
             {
-                auto CalculateModelSpaceTransformsForPose = [this] ( Transform* pLocalSpaceTransforms, TInlineVector<Transform, 30> &outModelSpaceTransforms )
-                {
-                    int32_t const numBonesInChain = (int32_t) m_modelSpaceSamplingChain.size();
-                    outModelSpaceTransforms.resize( numBonesInChain );
+                pCursor->m_pClip = this;
+                pCursor->m_intervalIndices.clear();
+                pCursor->m_intervalIndices.resize( m_reducedChannels.size(), 0 );
+            }
 
-                    for ( int32_t i = 0; i < numBonesInChain; i++ )
-                    {
-                        int32_t const boneIdx = m_modelSpaceSamplingChain[i].m_boneIdx;
-                        if ( boneIdx == 0 )
-                        {
-                            outModelSpaceTransforms[i] = Transform::Identity;
-                        }
-                        else
-                        {
-                            int32_t parentChainIdx = m_modelSpaceSamplingChain[i].m_parentChainLinkIdx;
-                            outModelSpaceTransforms[i] = pLocalSpaceTransforms[boneIdx] * outModelSpaceTransforms[parentChainIdx];
-                        }
-                    }
-                };
+            EE_ASSERT( pCursor->m_intervalIndices.size() == m_reducedChannels.size() );
+            pIntervalIndices = pCursor->m_intervalIndices.data();
+        }
 
-                // Calculate all the required model space chains
-                //-------------------------------------------------------------------------
+        for ( int32_t i = 0; i < numBones; i++ )
+        {
+            DecodeKeyframeReducedTransform( frameTime, i, pOutTransforms[i], pIntervalIndices );
+        }
+    }
 
-                TInlineVector<Transform, 30> modelSpaceSourceTransforms;
-                CalculateModelSpaceTransformsForPose( pOutPose->m_parentSpaceTransforms.data(), modelSpaceSourceTransforms );
+    void AnimationClip::DecodeKeyframeReducedTransform( float frameTime, int32_t boneIdx, Transform& outTransform, uint16_t* pIntervalIndices ) const
+    {
+        EE_ASSERT( m_isKeyframeReduced );
 
-                TInlineVector<Transform, 30> modelSpaceTargetTransforms;
-                CalculateModelSpaceTransformsForPose( tmpPose.data(), modelSpaceTargetTransforms );
+        TrackDefinition const& trackDef = m_trackDefs[boneIdx];
+        int32_t const firstChannelIdx = boneIdx * KeyframeReduction::g_numChannelsPerTrack;
+        uint8_t const* pKeyData = m_reducedKeyData.data();
 
-                float const percentageThrough = frameTime.GetPercentageThrough();
-                for ( auto i = 0; i < numBones; i++ )
-                {
-                    pOutPose->m_parentSpaceTransforms[i] = Transform::SLerp( pOutPose->m_parentSpaceTransforms[i], tmpPose[i], percentageThrough );
-                }
+        uint64_t keyBitOffset0 = 0, keyBitOffset1 = 0;
+        float percentageThrough = 0.0f;
 
-                TInlineVector<Transform, 30> modelSpaceResultTransforms;
-                CalculateModelSpaceTransformsForPose( pOutPose->m_parentSpaceTransforms.data(), modelSpaceResultTransforms );
+        // Rotation
+        //-------------------------------------------------------------------------
 
-                // Blend specified bones in model space and convert back to local
-                //-------------------------------------------------------------------------
+        Quaternion rotation = trackDef.GetStaticRotationValue();
 
-                for ( int32_t linkIdx : m_modelSpaceBoneSamplingIndices )
-                {
-                    ModelSpaceSamplingChainLink const &info = m_modelSpaceSamplingChain[linkIdx];
-                    Transform const blendedModelSpaceTransform = Transform::SLerp( modelSpaceSourceTransforms[linkIdx], modelSpaceTargetTransforms[linkIdx], percentageThrough );
-                    if ( info.m_parentChainLinkIdx != InvalidIndex )
-                    {
-                        pOutPose->m_parentSpaceTransforms[info.m_boneIdx] = blendedModelSpaceTransform * modelSpaceResultTransforms[info.m_parentChainLinkIdx].GetInverse();
-                    }
-                    else
-                    {
-                        pOutPose->m_parentSpaceTransforms[info.m_boneIdx] = blendedModelSpaceTransform;
-                    }
-                }
+        int32_t channelIdx = firstChannelIdx + KeyframeReduction::Rotation;
+        KeyframeReducedChannel const* pChannel = &m_reducedChannels[channelIdx];
+        if ( pChannel->IsAnimated() )
+        {
+            FindReducedKeys( channelIdx, frameTime, ( pIntervalIndices != nullptr ) ? &pIntervalIndices[channelIdx] : nullptr, keyBitOffset0, keyBitOffset1, percentageThrough );
+            rotation = KeyframeReduction::ReadRotationKey( pKeyData, keyBitOffset0, pChannel->m_numBitsPerComponent );
+            if ( percentageThrough > 0.0f )
+            {
+                Quaternion const nextRotation = KeyframeReduction::ReadRotationKey( pKeyData, keyBitOffset1, pChannel->m_numBitsPerComponent );
+                rotation = Quaternion::SLerp( rotation, nextRotation, percentageThrough );
             }
         }
 
-        // Flag the pose as being set
-        pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::ParentSpacePose;
+        // Translation
+        //-------------------------------------------------------------------------
 
-        // Float Channels
+        Vector translationScale( trackDef.m_translationRangeX.m_rangeStart, trackDef.m_translationRangeY.m_rangeStart, trackDef.m_translationRangeZ.m_rangeStart, trackDef.m_scaleRange.m_rangeStart );
+
+        channelIdx = firstChannelIdx + KeyframeReduction::Translation;
+        pChannel = &m_reducedChannels[channelIdx];
+        if ( pChannel->IsAnimated() )
+        {
+            FindReducedKeys( channelIdx, frameTime, ( pIntervalIndices != nullptr ) ? &pIntervalIndices[channelIdx] : nullptr, keyBitOffset0, keyBitOffset1, percentageThrough );
+            Vector translation = KeyframeReduction::ReadTranslationKey( pKeyData, keyBitOffset0, pChannel->m_numBitsPerComponent, trackDef.m_translationRangeX, trackDef.m_translationRangeY, trackDef.m_translationRangeZ );
+            if ( percentageThrough > 0.0f )
+            {
+                Vector const nextTranslation = KeyframeReduction::ReadTranslationKey( pKeyData, keyBitOffset1, pChannel->m_numBitsPerComponent, trackDef.m_translationRangeX, trackDef.m_translationRangeY, trackDef.m_translationRangeZ );
+                translation = Vector::Lerp( translation, nextTranslation, percentageThrough );
+            }
+
+            translationScale = Vector::Select( translation, translationScale, Vector::Select0001 );
+        }
+
+        // Scale
         //-------------------------------------------------------------------------
 
-        if ( sampleFloatChannels )
+        channelIdx = firstChannelIdx + KeyframeReduction::Scale;
+        pChannel = &m_reducedChannels[channelIdx];
+        if ( pChannel->IsAnimated() )
         {
-            size_t const numFloatChannelData = m_floatChannelSetData.size();
-            for ( size_t i = 0; i < numFloatChannelData; i++ )
+            FindReducedKeys( channelIdx, frameTime, ( pIntervalIndices != nullptr ) ? &pIntervalIndices[channelIdx] : nullptr, keyBitOffset0, keyBitOffset1, percentageThrough );
+            float scale = KeyframeReduction::ReadScaleKey( pKeyData, keyBitOffset0, pChannel->m_numBitsPerComponent, trackDef.m_scaleRange );
+            if ( percentageThrough > 0.0f )
             {
-                for ( size_t p = 0; p < pOutPose->m_floatChannelSetValues.size(); p++ )
+                float const nextScale = KeyframeReduction::ReadScaleKey( pKeyData, keyBitOffset1, pChannel->m_numBitsPerComponent, trackDef.m_scaleRange );
+                scale += ( nextScale - scale ) * percentageThrough;
+            }
+
+            translationScale.SetW( scale );
+        }
+
+        //-------------------------------------------------------------------------
+
+        Transform::DirectlySetRotation( outTransform, rotation );
+        Transform::DirectlySetTranslationScale( outTransform, translationScale );
+    }
+
+    void AnimationClip::FindReducedKeys( int32_t channelIdx, float frameTime, uint16_t* pCachedIntervalIdx, uint64_t& outKeyBitOffset0, uint64_t& outKeyBitOffset1, float& outPercentageThrough ) const
+    {
+        KeyframeReducedChannel const& channel = m_reducedChannels[channelIdx];
+        EE_ASSERT( channel.m_numKeys >= 2 );
+
+        uint16_t const* pKeyFrames = m_reducedKeyFrameIndices.data() + channel.m_firstKeyIdx;
+        int32_t const lastIntervalIdx = channel.m_numKeys - 2;
+
+        auto IsInInterval = [pKeyFrames, lastIntervalIdx, frameTime] ( int32_t intervalIdx )
+        {
+            return frameTime >= pKeyFrames[intervalIdx] && ( frameTime < pKeyFrames[intervalIdx + 1] || intervalIdx == lastIntervalIdx );
+        };
+
+        auto BinarySearch = [pKeyFrames, &channel, lastIntervalIdx, frameTime] ()
+        {
+            uint16_t const* pUpperBound = eastl::upper_bound( pKeyFrames, pKeyFrames + channel.m_numKeys, frameTime );
+            return Math::Clamp( int32_t( pUpperBound - pKeyFrames ) - 1, 0, lastIntervalIdx );
+        };
+
+        // Check the cached interval and the one following it first, this covers sequential playback
+        // Anything else (no cursor, seeks or looping) falls back to a binary search
+        int32_t intervalIdx;
+        if ( pCachedIntervalIdx != nullptr )
+        {
+            intervalIdx = Math::Min( (int32_t) *pCachedIntervalIdx, lastIntervalIdx );
+            if ( !IsInInterval( intervalIdx ) )
+            {
+                if ( intervalIdx < lastIntervalIdx && IsInInterval( intervalIdx + 1 ) )
                 {
-                    if ( pOutPose->m_floatChannelSetValues[p].GetSetID() == m_floatChannelSetData[i].GetSetID() )
-                    {
-                        m_floatChannelSetData[i].GetValues( frameTime, pOutPose->m_floatChannelSetValues[i] );
-                    }
+                    intervalIdx++;
+                }
+                else
+                {
+                    intervalIdx = BinarySearch();
                 }
+
+                *pCachedIntervalIdx = (uint16_t) intervalIdx;
             }
         }
+        else
+        {
+            intervalIdx = BinarySearch();
+        }
+
+        //-------------------------------------------------------------------------
+
+        float const intervalStart = pKeyFrames[intervalIdx];
+        float const intervalEnd = pKeyFrames[intervalIdx + 1];
+        outPercentageThrough = Math::Clamp( ( frameTime - intervalStart ) / ( intervalEnd - intervalStart ), 0.0f, 1.0f );
+
+        uint32_t const keySize = KeyframeReduction::GetKeySizeInBits( KeyframeReduction::GetChannelType( channelIdx ), channel.m_numBitsPerComponent );
+        outKeyBitOffset0 = channel.m_dataBitOffset + uint64_t( intervalIdx ) * keySize;
+        outKeyBitOffset1 = outKeyBitOffset0 + keySize;
     }
 
+    //-------------------------------------------------------------------------
+
     Transform AnimationClip::GetParentSpaceTransform( FrameTime const& frameTime, int32_t boneIdx ) const
     {
         Transform transform;
@@ -196,10 +529,16 @@ namespace EE::Animation
         EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
         EE_ASSERT( m_skeleton->IsValidBoneIndex( boneIdx ) );
 
+        if ( m_isKeyframeReduced )
+        {
+            DecodeKeyframeReducedTransform( frameTime.ToFloat(), boneIdx, outTransform, nullptr );
+            return;
+        }
+
         auto ReadCompressedTransform = [&] ( int32_t poseIdx, Transform& outDecompressedTransform )
         {
             TrackDefinition const& trackSettings = m_trackDefs[boneIdx];
-            uint16_t const* pReadPtr = m_compressedPoseData.data() + m_compressedPoseOffsets[poseIdx] + trackSettings.m_trackReadOffset;
+            uint16_t const* pFrameData = m_compressedPoseData.data() + m_compressedPoseOffsets[poseIdx];
 
             Quaternion rotation;
             if ( trackSettings.IsRotationTrackStatic() )
@@ -208,8 +547,8 @@ namespace EE::Animation
             }
             else
             {
-                rotation = DecodeRotation( pReadPtr );
-                pReadPtr += 3; // Rotations are 48bits (3 x uint16_t)
+                int32_t const streamIdx = AnimationClipDecoding::GetStreamIndex( m_animatedRotationBoneIndices, boneIdx );
+                rotation = DecodeRotation( pFrameData + streamIdx * 3 ); // Rotations are 48bits (3 x uint16_t)
             }
 
             //-------------------------------------------------------------------------
@@ -222,8 +561,8 @@ namespace EE::Animation
             }
             else
             {
-                translationScale = DecodeTranslation( pReadPtr, trackSettings );
-                pReadPtr += 3; // Translations are 48bits (3 x uint16_t)
+                int32_t const streamIdx = AnimationClipDecoding::GetStreamIndex( m_animatedTranslationBoneIndices, boneIdx );
+                translationScale = DecodeTranslation( pFrameData + GetTranslationStreamOffset() + streamIdx * 3, trackSettings ); // Translations are 48bits (3 x uint16_t)
             }
 
             //-------------------------------------------------------------------------
@@ -234,8 +573,8 @@ namespace EE::Animation
             }
             else
             {
-                translationScale.m_w = DecodeScale( pReadPtr, trackSettings );
-                pReadPtr += 1; // Scales are 16bits (1 x uint16_t)
+                int32_t const streamIdx = AnimationClipDecoding::GetStreamIndex( m_animatedScaleBoneIndices, boneIdx );
+                translationScale.m_w = DecodeScale( pFrameData + GetScaleStreamOffset() + streamIdx, trackSettings ); // Scales are 16bits (1 x uint16_t)
             }
 
             //-------------------------------------------------------------------------
@@ -16,12 +16,13 @@
 namespace EE::Animation
 {
     class Event;
+    class AnimationClip;
 
     //-------------------------------------------------------------------------
 
     struct TrackDefinition
     {
-        EE_SERIALIZE( m_translationRangeX, m_translationRangeY, m_translationRangeZ, m_scaleRange, m_trackReadOffset, m_constantRotation, m_isRotationStatic, m_isTranslationStatic, m_isScaleStatic );
+        EE_SERIALIZE( m_translationRangeX, m_translationRangeY, m_translationRangeZ, m_scaleRange, m_constantRotation, m_isRotationStatic, m_isTranslationStatic, m_isScaleStatic );
 
         friend class AnimationClipCompiler;
 
@@ -50,7 +51,6 @@ namespace EE::Animation
         Quantization::FloatRange                m_translationRangeY;
         Quantization::FloatRange                m_translationRangeZ;
         Quantization::FloatRange                m_scaleRange;
-        int32_t                                 m_trackReadOffset = 0; // Offset into compressed pose data for this track (in terms of uint16s)
 
     private:
 
@@ -77,6 +77,38 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    // A single channel (rotation, translation or scale) of a keyframe reduced track - see 'AnimationClipKeyframeReduction.h' for the encoding
+    struct KeyframeReducedChannel
+    {
+        EE_SERIALIZE( m_firstKeyIdx, m_dataBitOffset, m_numKeys, m_numBitsPerComponent );
+
+        // Static channels have no keys and use the value from the track definition
+        inline bool IsAnimated() const { return m_numKeys > 0; }
+
+    public:
+
+        uint32_t                                m_firstKeyIdx = 0; // The index of the first key frame index for this channel
+        uint32_t                                m_dataBitOffset = 0; // The bit offset of the first key in the packed key data
+        uint16_t                                m_numKeys = 0;
+        uint8_t                                 m_numBitsPerComponent = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // The last key interval sampled for each channel of a keyframe reduced clip, this makes sequential playback O(1) per channel
+    // Each sampling instance (graph node, clip player) owns its own cursor, it is reset automatically when used with a different clip
+    struct KeyframeReducedCursor
+    {
+        inline void Reset() { m_pClip = nullptr; m_intervalIndices.clear(); }
+
+    public:
+
+        AnimationClip const*                    m_pClip = nullptr;
+        TVector<uint16_t>                       m_intervalIndices;
+    };
+
+    //-------------------------------------------------------------------------
+
     struct ModelSpaceSamplingChainLink
     {
         EE_SERIALIZE( m_boneIdx, m_parentBoneIdx, m_parentChainLinkIdx );
@@ -90,12 +122,23 @@ namespace EE::Animation
 
     class EE_ENGINE_API AnimationClip : public Resource::IResource
     {
-        EE_RESOURCE( "anim", "Animation Clip", Colors::Orchid, 66, false );
-        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_compressedPoseData, m_compressedPoseOffsets, m_trackDefs, m_rootMotion, m_isAdditive, m_modelSpaceSamplingChain, m_modelSpaceBoneSamplingIndices, m_compressedFloatCurveData, m_compressedFloatCurveOffsets, m_floatCurveDefs );
+        EE_RESOURCE( "anim", "Animation Clip", Colors::Orchid, 68, false );
+        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_compressedPoseData, m_compressedPoseOffsets, m_trackDefs, m_animatedRotationBoneIndices, m_animatedTranslationBoneIndices, m_animatedScaleBoneIndices, m_translationDecodeRanges, m_scaleDecodeRanges, m_isKeyframeReduced, m_reducedChannels, m_reducedKeyFrameIndices, m_reducedKeyData, m_rootMotion, m_isAdditive, m_modelSpaceSamplingChain, m_modelSpaceBoneSamplingIndices, m_compressedFloatCurveData, m_compressedFloatCurveOffsets, m_floatCurveDefs );
 
         friend class AnimationClipCompiler;
         friend class AnimationClipLoader;
 
+    public:
+
+        constexpr static bool const s_compressCompiledData = true;
+
+        // The pose data is decoded in blocks of this many tracks at a time, all the pose data streams are padded to a multiple of this
+        constexpr static int32_t const s_numTracksPerDecodeBlock = 4;
+
+        // The number of decode ranges we store per block of translation/scale tracks
+        constexpr static int32_t const s_numTranslationDecodeRangesPerBlock = 6;
+        constexpr static int32_t const s_numScaleDecodeRangesPerBlock = 2;
+
     private:
 
         EE_FORCE_INLINE static Quaternion DecodeRotation( uint16_t const* pData )
@@ -141,11 +184,20 @@ namespace EE::Animation
         inline FrameTime GetFrameTime( Seconds const timeThroughAnimation ) const { return GetFrameTime( IsSingleFrameAnimation() ? Percentage( 0.0f ) : Percentage( timeThroughAnimation / m_duration ) ); }
         inline SyncTrack const& GetSyncTrack() const{ return m_syncTrack; }
 
+        // Was this clip compiled with keyframe reduction (i.e. only the keys needed to stay within the compression error bound are stored)
+        inline bool IsKeyframeReduced() const { return m_isKeyframeReduced; }
+
         // Pose
         //-------------------------------------------------------------------------
 
-        void GetPose( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod = Skeleton::LOD::High, bool sampleFloatChannels = true ) const;
-        inline void GetPose( Percentage percentageThrough, Pose* pOutPose, Skeleton::LOD lod = Skeleton::LOD::High, bool sampleFloatChannels = true ) const { GetPose( GetFrameTime( percentageThrough ), pOutPose, lod, sampleFloatChannels ); }
+        // The optional cursor is only used by keyframe reduced clips, sequential sampling through the same cursor avoids searching for keys
+        void GetPose( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod = Skeleton::LOD::High, bool sampleFloatChannels = true, KeyframeReducedCursor* pCursor = nullptr ) const;
+        inline void GetPose( Percentage percentageThrough, Pose* pOutPose, Skeleton::LOD lod = Skeleton::LOD::High, bool sampleFloatChannels = true, KeyframeReducedCursor* pCursor = nullptr ) const { GetPose( GetFrameTime( percentageThrough ), pOutPose, lod, sampleFloatChannels, pCursor ); }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Sample the pose using the scalar reference decoder (one track at a time), this is only used to validate and benchmark the SIMD decoder
+        void GetPoseReference( FrameTime const& frameTime, Pose* pOutPose, Skeleton::LOD lod = Skeleton::LOD::High ) const;
+        #endif
 
         // Get a single parent space transform
         Transform GetParentSpaceTransform( FrameTime const& frameTime, int32_t boneIdx ) const;
@@ -229,6 +281,28 @@ namespace EE::Animation
 
         void GetParentSpaceTransform( FrameTime const& frameTime, int32_t boneIdx, Transform& outTransform ) const;
 
+        // Sample the parent space transforms for the first 'numBones' bones, handles keyframe interpolation and model space sampling
+        void SamplePose( FrameTime const& frameTime, int32_t numBones, Transform* pOutTransforms, bool useReferenceDecoder, KeyframeReducedCursor* pCursor ) const;
+
+        // Decode the pose for a given frame, if a valid next frame is supplied, we will interpolate towards it as part of the same pass
+        void DecodePose( int32_t frameIdx, int32_t nextFrameIdx, float percentageThrough, int32_t numBones, Transform* pOutTransforms ) const;
+
+        #if EE_DEVELOPMENT_TOOLS
+        void DecodePoseReference( int32_t frameIdx, int32_t nextFrameIdx, float percentageThrough, int32_t numBones, Transform* pOutTransforms ) const;
+        #endif
+
+        // Decode a keyframe reduced pose/transform for a given frame time (frame index + percentage through the frame)
+        // The interval indices are the cursor entries for this clip, if not supplied the keys are found via a binary search
+        void DecodeKeyframeReducedPose( float frameTime, int32_t numBones, Transform* pOutTransforms, KeyframeReducedCursor* pCursor ) const;
+        void DecodeKeyframeReducedTransform( float frameTime, int32_t boneIdx, Transform& outTransform, uint16_t* pIntervalIndices ) const;
+
+        // Find the pair of keys to interpolate between for the specified keyframe reduced channel, this uses (and updates) the cached interval if supplied
+        void FindReducedKeys( int32_t channelIdx, float frameTime, uint16_t* pCachedIntervalIdx, uint64_t& outKeyBitOffset0, uint64_t& outKeyBitOffset1, float& outPercentageThrough ) const;
+
+        // Get the offsets (in uint16s) for the translation and scale streams in each frame's pose data (rotations always start at 0)
+        inline int32_t GetTranslationStreamOffset() const { return (int32_t) m_animatedRotationBoneIndices.size() * 3; }
+        inline int32_t GetScaleStreamOffset() const { return GetTranslationStreamOffset() + (int32_t) m_animatedTranslationBoneIndices.size() * 3; }
+
     private:
 
         TResourcePtr<Skeleton>                      m_skeleton;
@@ -239,6 +313,20 @@ namespace EE::Animation
         TVector<uint16_t>                           m_compressedPoseData;
         TVector<uint32_t>                           m_compressedPoseOffsets;
 
+        // The pose data for each frame is laid out as three streams (rotations, translations, scales) so that we can decode multiple tracks at once
+        // Each stream only contains the animated (non-static) tracks sorted by bone index and is padded to a multiple of 's_numTracksPerDecodeBlock'
+        TVector<uint16_t>                           m_animatedRotationBoneIndices; // The bone index for each entry in the rotation stream (padded entries have an invalid bone index)
+        TVector<uint16_t>                           m_animatedTranslationBoneIndices; // The bone index for each entry in the translation stream (padded entries have an invalid bone index)
+        TVector<uint16_t>                           m_animatedScaleBoneIndices; // The bone index for each entry in the scale stream (padded entries have an invalid bone index)
+        TVector<Float4>                             m_translationDecodeRanges; // Per block: range start X/Y/Z and range length X/Y/Z for each track in the block
+        TVector<Float4>                             m_scaleDecodeRanges; // Per block: range start and range length for each track in the block
+
+        // Keyframe reduced pose data, this replaces the uniform per-frame pose data above when set
+        bool                                        m_isKeyframeReduced = false;
+        TVector<KeyframeReducedChannel>             m_reducedChannels; // 3 channels per bone: rotation, translation and scale
+        TVector<uint16_t>                           m_reducedKeyFrameIndices; // The frame index for each key (sorted per channel)
+        TVector<uint8_t>                            m_reducedKeyData; // The bit-packed key values (padded so we can always do a 64bit read)
+
         TVector<FloatCurveDefinition>               m_floatCurveDefs;
         TVector<uint16_t>                           m_compressedFloatCurveData;
         TVector<uint32_t>                           m_compressedFloatCurveOffsets;
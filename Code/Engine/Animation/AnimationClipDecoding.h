@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Base/Math/SIMD.h"
+#include "Base/Math/Vector.h"
+#include "Base/Types/Arrays.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+// SIMD Animation Clip Decoding
+//-------------------------------------------------------------------------
+// Decodes the compressed pose data for 4 tracks at once, all values are stored as SoA (i.e. one register per component)
+// These need to match the scalar decoders in the animation clip (Quantization::EncodedQuaternion and Quantization::DecodeFloat)
+
+namespace EE::Animation::AnimationClipDecoding
+{
+    struct QuaternionX4
+    {
+        __m128  m_x;
+        __m128  m_y;
+        __m128  m_z;
+        __m128  m_w;
+    };
+
+    struct Float3X4
+    {
+        __m128  m_x;
+        __m128  m_y;
+        __m128  m_z;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Get the number of entries in an animated track stream we need to decode for the specified number of bones (LOD)
+    EE_FORCE_INLINE int32_t GetNumTracksToDecode( TVector<uint16_t> const& streamBoneIndices, int32_t numBones )
+    {
+        auto iter = eastl::lower_bound( streamBoneIndices.begin(), streamBoneIndices.end(), (uint16_t) numBones );
+        return (int32_t) ( iter - streamBoneIndices.begin() );
+    }
+
+    // Get the index of a given bone in an animated track stream
+    EE_FORCE_INLINE int32_t GetStreamIndex( TVector<uint16_t> const& streamBoneIndices, int32_t boneIdx )
+    {
+        auto iter = eastl::lower_bound( streamBoneIndices.begin(), streamBoneIndices.end(), (uint16_t) boneIdx );
+        EE_ASSERT( iter != streamBoneIndices.end() && *iter == boneIdx );
+        return (int32_t) ( iter - streamBoneIndices.begin() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Load 4 interleaved uint16 triplets [a,b,c] and deinterleave them into 3 registers of 4 x int32
+    EE_FORCE_INLINE void LoadTriplets( uint16_t const* pData, __m128i& outA, __m128i& outB, __m128i& outC )
+    {
+        static __m128i const shuffleA0 = _mm_setr_epi8( 0, 1, -1, -1, 6, 7, -1, -1, 12, 13, -1, -1, -1, -1, -1, -1 );
+        static __m128i const shuffleA1 = _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 3, -1, -1 );
+        static __m128i const shuffleB0 = _mm_setr_epi8( 2, 3, -1, -1, 8, 9, -1, -1, 14, 15, -1, -1, -1, -1, -1, -1 );
+        static __m128i const shuffleB1 = _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, 5, -1, -1 );
+        static __m128i const shuffleC0 = _mm_setr_epi8( 4, 5, -1, -1, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1 );
+        static __m128i const shuffleC1 = _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, -1, -1, 6, 7, -1, -1 );
+
+        // 12 x uint16 = 24 bytes, so we load 16 bytes and then the remaining 8 bytes
+        __m128i const v0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( pData ) );
+        __m128i const v1 = _mm_loadl_epi64( reinterpret_cast<__m128i const*>( pData + 8 ) );
+
+        outA = _mm_or_si128( _mm_shuffle_epi8( v0, shuffleA0 ), _mm_shuffle_epi8( v1, shuffleA1 ) );
+        outB = _mm_or_si128( _mm_shuffle_epi8( v0, shuffleB0 ), _mm_shuffle_epi8( v1, shuffleB1 ) );
+        outC = _mm_or_si128( _mm_shuffle_epi8( v0, shuffleC0 ), _mm_shuffle_epi8( v1, shuffleC1 ) );
+    }
+
+    // Decode 4 rotations - see Quantization::EncodedQuaternion for the encoding
+    EE_FORCE_INLINE QuaternionX4 DecodeRotations( uint16_t const* pData )
+    {
+        static constexpr float const s_valueRangeMin = -Math::OneDivSqrtTwo;
+        static constexpr float const s_valueRangeLength = Math::OneDivSqrtTwo - s_valueRangeMin;
+
+        __m128i a, b, c;
+        LoadTriplets( pData, a, b, c );
+
+        // Get the index of the largest component
+        __m128i const largestValueIndex = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( a, 14 ), _mm_set1_epi32( 0x0002 ) ), _mm_srli_epi32( b, 15 ) );
+
+        // Decode the three smallest components
+        __m128i const mask15Bit = _mm_set1_epi32( 0x7FFF );
+        __m128 const vRangeMultiplier15Bit = _mm_set1_ps( s_valueRangeLength / float( 0x7FFF ) );
+        __m128 const vValueRangeMin = _mm_set1_ps( s_valueRangeMin );
+
+        __m128 const va = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( a, mask15Bit ) ), vRangeMultiplier15Bit ), vValueRangeMin );
+        __m128 const vb = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( b, mask15Bit ) ), vRangeMultiplier15Bit ), vValueRangeMin );
+        __m128 const vc = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( c ), vRangeMultiplier15Bit ), vValueRangeMin );
+
+        // Reconstruct the largest component
+        __m128 sum = _mm_mul_ps( va, va );
+        sum = _mm_add_ps( sum, _mm_mul_ps( vb, vb ) );
+        sum = _mm_add_ps( sum, _mm_mul_ps( vc, vc ) );
+        __m128 const vLargest = _mm_sqrt_ps( _mm_max_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), sum ), _mm_setzero_ps() ) );
+
+        // Insert the largest component at the correct position
+        __m128 const isLargest0 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 0 ) ) );
+        __m128 const isLargest1 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 1 ) ) );
+        __m128 const isLargest2 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 2 ) ) );
+        __m128 const isLargest3 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 3 ) ) );
+
+        QuaternionX4 result;
+        result.m_x = _mm_blendv_ps( va, vLargest, isLargest0 );
+        result.m_y = _mm_blendv_ps( _mm_blendv_ps( vb, vLargest, isLargest1 ), va, isLargest0 );
+        result.m_z = _mm_blendv_ps( _mm_blendv_ps( vc, vLargest, isLargest2 ), vb, _mm_or_ps( isLargest0, isLargest1 ) );
+        result.m_w = _mm_blendv_ps( vc, vLargest, isLargest3 );
+        return result;
+    }
+
+    // Decode 4 translations, the ranges are stored as [startX, lengthX, startY, lengthY, startZ, lengthZ]
+    EE_FORCE_INLINE Float3X4 DecodeTranslations( uint16_t const* pData, Float4 const* pRanges )
+    {
+        __m128 const vNormalizeMultiplier = _mm_set1_ps( 1.0f / float( 0xFFFF ) );
+
+        __m128i a, b, c;
+        LoadTriplets( pData, a, b, c );
+
+        Float3X4 result;
+        result.m_x = _mm_add_ps( _mm_mul_ps( _mm_mul_ps( _mm_cvtepi32_ps( a ), vNormalizeMultiplier ), _mm_loadu_ps( &pRanges[1].m_x ) ), _mm_loadu_ps( &pRanges[0].m_x ) );
+        result.m_y = _mm_add_ps( _mm_mul_ps( _mm_mul_ps( _mm_cvtepi32_ps( b ), vNormalizeMultiplier ), _mm_loadu_ps( &pRanges[3].m_x ) ), _mm_loadu_ps( &pRanges[2].m_x ) );
+        result.m_z = _mm_add_ps( _mm_mul_ps( _mm_mul_ps( _mm_cvtepi32_ps( c ), vNormalizeMultiplier ), _mm_loadu_ps( &pRanges[5].m_x ) ), _mm_loadu_ps( &pRanges[4].m_x ) );
+        return result;
+    }
+
+    // Decode 4 scales, the ranges are stored as [start, length]
+    EE_FORCE_INLINE __m128 DecodeScales( uint16_t const* pData, Float4 const* pRanges )
+    {
+        __m128 const vNormalizeMultiplier = _mm_set1_ps( 1.0f / float( 0xFFFF ) );
+        __m128i const encoded = _mm_unpacklo_epi16( _mm_loadl_epi64( reinterpret_cast<__m128i const*>( pData ) ), _mm_setzero_si128() );
+        return _mm_add_ps( _mm_mul_ps( _mm_mul_ps( _mm_cvtepi32_ps( encoded ), vNormalizeMultiplier ), _mm_loadu_ps( &pRanges[1].m_x ) ), _mm_loadu_ps( &pRanges[0].m_x ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE __m128 Lerp( __m128 from, __m128 to, __m128 t )
+    {
+        return _mm_add_ps( _mm_mul_ps( _mm_sub_ps( to, from ), t ), from );
+    }
+
+    // 4-wide version of Quaternion::SLerp, each lane is a separate quaternion
+    EE_FORCE_INLINE QuaternionX4 SLerp( QuaternionX4 const& from, QuaternionX4 const& to, __m128 t )
+    {
+        static __m128 const oneMinusEpsilon = _mm_set1_ps( 1.0f - 0.00001f );
+        __m128 const one = _mm_set1_ps( 1.0f );
+
+        __m128 cosOmega = _mm_mul_ps( from.m_x, to.m_x );
+        cosOmega = _mm_add_ps( cosOmega, _mm_mul_ps( from.m_y, to.m_y ) );
+        cosOmega = _mm_add_ps( cosOmega, _mm_mul_ps( from.m_z, to.m_z ) );
+        cosOmega = _mm_add_ps( cosOmega, _mm_mul_ps( from.m_w, to.m_w ) );
+
+        // Ensure we take the shortest path
+        __m128 const sign = _mm_blendv_ps( one, _mm_set1_ps( -1.0f ), _mm_cmplt_ps( cosOmega, _mm_setzero_ps() ) );
+        cosOmega = _mm_mul_ps( cosOmega, sign );
+
+        __m128 const sinOmega = _mm_sqrt_ps( _mm_sub_ps( one, _mm_mul_ps( cosOmega, cosOmega ) ) );
+        __m128 const omega = Vector::ATan2( sinOmega, cosOmega );
+
+        // Fall back to a linear interpolation when the rotations are nearly identical
+        __m128 const oneMinusT = _mm_sub_ps( one, t );
+        __m128 const useSLerp = _mm_cmplt_ps( cosOmega, oneMinusEpsilon );
+        __m128 s0 = _mm_div_ps( Vector::Sin( _mm_mul_ps( oneMinusT, omega ) ), sinOmega );
+        __m128 s1 = _mm_div_ps( Vector::Sin( _mm_mul_ps( t, omega ) ), sinOmega );
+        s0 = _mm_blendv_ps( oneMinusT, s0, useSLerp );
+        s1 = _mm_mul_ps( _mm_blendv_ps( t, s1, useSLerp ), sign );
+
+        QuaternionX4 result;
+        result.m_x = _mm_add_ps( _mm_mul_ps( from.m_x, s0 ), _mm_mul_ps( to.m_x, s1 ) );
+        result.m_y = _mm_add_ps( _mm_mul_ps( from.m_y, s0 ), _mm_mul_ps( to.m_y, s1 ) );
+        result.m_z = _mm_add_ps( _mm_mul_ps( from.m_z, s0 ), _mm_mul_ps( to.m_z, s1 ) );
+        result.m_w = _mm_add_ps( _mm_mul_ps( from.m_w, s0 ), _mm_mul_ps( to.m_w, s1 ) );
+        return result;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "Base/Encoding/Quantization.h"
+#include "Base/Math/Quaternion.h"
+#include "Base/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Keyframe Reduced Animation Clip Encoding
+//-------------------------------------------------------------------------
+// A keyframe reduced clip only stores the keys needed to stay within an error bound, each track channel (rotation/translation/scale) has its own set of keys
+// All key values are bit-packed using a per-channel bit width:
+//  * Rotations: 2 bits for the largest component index followed by the three smallest components
+//  * Translations: 3 components, quantized within the track's translation ranges
+//  * Scales: 1 component, quantized within the track's scale range
+// The encoding functions are only used by the compiler but live next to the decoding functions so that they are kept in sync
+
+namespace EE::Animation::KeyframeReduction
+{
+    enum ChannelType : int32_t
+    {
+        Rotation = 0,
+        Translation,
+        Scale,
+    };
+
+    constexpr int32_t const g_numChannelsPerTrack = 3;
+    constexpr uint32_t const g_minBitsPerComponent = 4;
+    constexpr uint32_t const g_maxBitsPerComponent = 16;
+    constexpr uint32_t const g_numRotationIndexBits = 2;
+
+    // The packed key data is padded with this many bytes so that any key component can be read with a single unaligned 64bit load
+    constexpr size_t const g_numKeyDataPaddingBytes = 8;
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE ChannelType GetChannelType( int32_t channelIdx ) { return ChannelType( channelIdx % g_numChannelsPerTrack ); }
+
+    EE_FORCE_INLINE uint32_t GetNumComponents( ChannelType channelType ) { return ( channelType == Scale ) ? 1 : 3; }
+
+    EE_FORCE_INLINE uint32_t GetKeySizeInBits( ChannelType channelType, uint32_t numBitsPerComponent )
+    {
+        uint32_t const numValueBits = GetNumComponents( channelType ) * numBitsPerComponent;
+        return ( channelType == Rotation ) ? numValueBits + g_numRotationIndexBits : numValueBits;
+    }
+
+    EE_FORCE_INLINE uint32_t GetMaxQuantizedValue( uint32_t numBits ) { return ( 1u << numBits ) - 1; }
+
+    //-------------------------------------------------------------------------
+    // Quantization
+    //-------------------------------------------------------------------------
+
+    inline uint32_t EncodeFloat( float value, float rangeStart, float rangeLength, uint32_t numBits )
+    {
+        EE_ASSERT( numBits >= g_minBitsPerComponent && numBits <= g_maxBitsPerComponent );
+        float const normalizedValue = ( rangeLength > 0.0f ) ? Math::Clamp( ( value - rangeStart ) / rangeLength, 0.0f, 1.0f ) : 0.0f;
+        return uint32_t( normalizedValue * GetMaxQuantizedValue( numBits ) + 0.5f );
+    }
+
+    EE_FORCE_INLINE float DecodeFloat( uint32_t encodedValue, float rangeStart, float rangeLength, uint32_t numBits )
+    {
+        return ( float( encodedValue ) / GetMaxQuantizedValue( numBits ) ) * rangeLength + rangeStart;
+    }
+
+    // Encode a rotation using the smallest three components, the remaining components are returned in order (skipping the largest)
+    inline void EncodeRotation( Quaternion const& rotation, uint32_t numBits, uint32_t& outLargestComponentIdx, uint32_t outValues[3] )
+    {
+        EE_ASSERT( rotation.IsNormalized() );
+
+        Float4 const values = rotation.ToFloat4();
+
+        outLargestComponentIdx = 0;
+        for ( uint32_t i = 1; i < 4; i++ )
+        {
+            if ( Math::Abs( values[i] ) > Math::Abs( values[outLargestComponentIdx] ) )
+            {
+                outLargestComponentIdx = i;
+            }
+        }
+
+        // Ensure the largest component is positive so we can reconstruct it
+        float const signMultiplier = ( values[outLargestComponentIdx] < 0 ) ? -1.0f : 1.0f;
+
+        uint32_t componentIdx = 0;
+        for ( uint32_t i = 0; i < 4; i++ )
+        {
+            if ( i != outLargestComponentIdx )
+            {
+                outValues[componentIdx++] = EncodeFloat( values[i] * signMultiplier, -Math::OneDivSqrtTwo, 2 * Math::OneDivSqrtTwo, numBits );
+            }
+        }
+    }
+
+    inline Quaternion DecodeRotation( uint32_t largestComponentIdx, uint32_t const values[3], uint32_t numBits )
+    {
+        EE_ASSERT( largestComponentIdx < 4 );
+
+        Float4 decodedValues;
+        float sumOfSquares = 0.0f;
+        uint32_t componentIdx = 0;
+        for ( uint32_t i = 0; i < 4; i++ )
+        {
+            if ( i != largestComponentIdx )
+            {
+                decodedValues[i] = DecodeFloat( values[componentIdx++], -Math::OneDivSqrtTwo, 2 * Math::OneDivSqrtTwo, numBits );
+                sumOfSquares += decodedValues[i] * decodedValues[i];
+            }
+        }
+
+        decodedValues[largestComponentIdx] = Math::Sqrt( Math::Max( 0.0f, 1.0f - sumOfSquares ) );
+        return Quaternion( decodedValues ).GetNormalized();
+    }
+
+    //-------------------------------------------------------------------------
+    // Bit Packing
+    //-------------------------------------------------------------------------
+
+    inline void WriteBits( TVector<uint8_t>& data, uint64_t& bitOffset, uint32_t value, uint32_t numBits )
+    {
+        EE_ASSERT( numBits <= 32 && ( numBits == 32 || value < ( 1ull << numBits ) ) );
+
+        size_t const requiredSize = size_t( ( bitOffset + numBits + 7 ) / 8 );
+        if ( data.size() < requiredSize )
+        {
+            data.resize( requiredSize, 0 );
+        }
+
+        for ( uint32_t i = 0; i < numBits; i++ )
+        {
+            if ( value & ( 1u << i ) )
+            {
+                uint64_t const bitIdx = bitOffset + i;
+                data[size_t( bitIdx >> 3 )] |= uint8_t( 1u << ( bitIdx & 7 ) );
+            }
+        }
+
+        bitOffset += numBits;
+    }
+
+    // Requires the data to be padded (see 'g_numKeyDataPaddingBytes')
+    EE_FORCE_INLINE uint32_t ReadBits( uint8_t const* pData, uint64_t bitOffset, uint32_t numBits )
+    {
+        EE_ASSERT( numBits <= 32 );
+
+        uint64_t value;
+        memcpy( &value, pData + ( bitOffset >> 3 ), sizeof( uint64_t ) );
+        value >>= ( bitOffset & 7 );
+        return uint32_t( value & ( ( 1ull << numBits ) - 1 ) );
+    }
+
+    //-------------------------------------------------------------------------
+    // Keys
+    //-------------------------------------------------------------------------
+
+    inline void WriteRotationKey( TVector<uint8_t>& data, uint64_t& bitOffset, Quaternion const& rotation, uint32_t numBits )
+    {
+        uint32_t largestComponentIdx = 0;
+        uint32_t values[3];
+        EncodeRotation( rotation, numBits, largestComponentIdx, values );
+
+        WriteBits( data, bitOffset, largestComponentIdx, g_numRotationIndexBits );
+        for ( uint32_t i = 0; i < 3; i++ )
+        {
+            WriteBits( data, bitOffset, values[i], numBits );
+        }
+    }
+
+    inline void WriteTranslationKey( TVector<uint8_t>& data, uint64_t& bitOffset, Vector const& translation, uint32_t numBits, Quantization::FloatRange const& rangeX, Quantization::FloatRange const& rangeY, Quantization::FloatRange const& rangeZ )
+    {
+        WriteBits( data, bitOffset, EncodeFloat( translation.GetX(), rangeX.m_rangeStart, rangeX.m_rangeLength, numBits ), numBits );
+        WriteBits( data, bitOffset, EncodeFloat( translation.GetY(), rangeY.m_rangeStart, rangeY.m_rangeLength, numBits ), numBits );
+        WriteBits( data, bitOffset, EncodeFloat( translation.GetZ(), rangeZ.m_rangeStart, rangeZ.m_rangeLength, numBits ), numBits );
+    }
+
+    inline void WriteScaleKey( TVector<uint8_t>& data, uint64_t& bitOffset, float scale, uint32_t numBits, Quantization::FloatRange const& range )
+    {
+        WriteBits( data, bitOffset, EncodeFloat( scale, range.m_rangeStart, range.m_rangeLength, numBits ), numBits );
+    }
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE Quaternion ReadRotationKey( uint8_t const* pData, uint64_t bitOffset, uint32_t numBits )
+    {
+        uint32_t const largestComponentIdx = ReadBits( pData, bitOffset, g_numRotationIndexBits );
+        bitOffset += g_numRotationIndexBits;
+
+        uint32_t values[3];
+        for ( uint32_t i = 0; i < 3; i++ )
+        {
+            values[i] = ReadBits( pData, bitOffset, numBits );
+            bitOffset += numBits;
+        }
+
+        return DecodeRotation( largestComponentIdx, values, numBits );
+    }
+
+    EE_FORCE_INLINE Vector ReadTranslationKey( uint8_t const* pData, uint64_t bitOffset, uint32_t numBits, Quantization::FloatRange const& rangeX, Quantization::FloatRange const& rangeY, Quantization::FloatRange const& rangeZ )
+    {
+        float const x = DecodeFloat( ReadBits( pData, bitOffset, numBits ), rangeX.m_rangeStart, rangeX.m_rangeLength, numBits );
+        float const y = DecodeFloat( ReadBits( pData, bitOffset + numBits, numBits ), rangeY.m_rangeStart, rangeY.m_rangeLength, numBits );
+        float const z = DecodeFloat( ReadBits( pData, bitOffset + 2 * numBits, numBits ), rangeZ.m_rangeStart, rangeZ.m_rangeLength, numBits );
+        return Vector( x, y, z );
+    }
+
+    EE_FORCE_INLINE float ReadScaleKey( uint8_t const* pData, uint64_t bitOffset, uint32_t numBits, Quantization::FloatRange const& range )
+    {
+        return DecodeFloat( ReadBits( pData, bitOffset, numBits ), range.m_rangeStart, range.m_rangeLength, numBits );
+    }
+}
\ No newline at end of file
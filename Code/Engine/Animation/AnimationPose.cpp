@@ -1,4 +1,5 @@
 #include "AnimationPose.h"
+#include "AnimationTransformBlock.h"
 #include "Base/Drawing/DebugDrawing.h"
 
 //-------------------------------------------------------------------------
@@ -184,14 +185,7 @@ namespace EE::Animation
         int32_t const numTotalBones = m_pSkeleton->GetNumBones( Skeleton::LOD::High );
         int32_t const numRelevantBones = m_pSkeleton->GetNumBones( lod );
         m_modelSpaceTransforms.resize( numTotalBones );
-
-        m_modelSpaceTransforms[0] = m_parentSpaceTransforms[0];
-        for ( int32_t boneIdx = 1; boneIdx < numRelevantBones; boneIdx++ )
-        {
-            int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
-            EE_ASSERT( parentIdx < boneIdx );
-            m_modelSpaceTransforms[boneIdx] = m_parentSpaceTransforms[boneIdx] * m_modelSpaceTransforms[parentIdx];
-        }
+        Animation::CalculateModelSpaceTransforms( m_pSkeleton->GetParentBoneIndices().data(), numRelevantBones, TransformArrayAccessor( m_parentSpaceTransforms.data() ), m_modelSpaceTransforms.data() );
     }
 
     Transform Pose::GetModelSpaceTransform( int32_t boneIdx ) const
@@ -0,0 +1,281 @@
+#pragma once
+
+#include "Base/Math/Transform.h"
+
+//-------------------------------------------------------------------------
+// Transform Block
+//-------------------------------------------------------------------------
+// Four bone transforms held in structure-of-arrays form (one register per component)
+// All the operations below are the lane-wise equivalents of the scalar quaternion/transform operations and
+// produce the same results, this allows the pose kernels to process four bones per instruction
+
+namespace EE::Animation
+{
+    struct TransformBlock
+    {
+        constexpr static int32_t const s_numBones = 4;
+
+    public:
+
+        EE_FORCE_INLINE void Load( Transform const& t0, Transform const& t1, Transform const& t2, Transform const& t3 )
+        {
+            __m128 r0 = t0.GetRotation(), r1 = t1.GetRotation(), r2 = t2.GetRotation(), r3 = t3.GetRotation();
+            _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+            m_rotationX = r0; m_rotationY = r1; m_rotationZ = r2; m_rotationW = r3;
+
+            __m128 ts0 = t0.GetTranslationAndScale(), ts1 = t1.GetTranslationAndScale(), ts2 = t2.GetTranslationAndScale(), ts3 = t3.GetTranslationAndScale();
+            _MM_TRANSPOSE4_PS( ts0, ts1, ts2, ts3 );
+            m_translationX = ts0; m_translationY = ts1; m_translationZ = ts2; m_scale = ts3;
+        }
+
+        // Load four consecutive transforms
+        EE_FORCE_INLINE void Load( Transform const* pTransforms ) { Load( pTransforms[0], pTransforms[1], pTransforms[2], pTransforms[3] ); }
+
+        // Store four consecutive transforms
+        EE_FORCE_INLINE void Store( Transform* pTransforms ) const
+        {
+            __m128 r0 = m_rotationX, r1 = m_rotationY, r2 = m_rotationZ, r3 = m_rotationW;
+            _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+            __m128 ts0 = m_translationX, ts1 = m_translationY, ts2 = m_translationZ, ts3 = m_scale;
+            _MM_TRANSPOSE4_PS( ts0, ts1, ts2, ts3 );
+
+            Transform::DirectlySetRotation( pTransforms[0], Quaternion( Vector( r0 ) ) );
+            Transform::DirectlySetRotation( pTransforms[1], Quaternion( Vector( r1 ) ) );
+            Transform::DirectlySetRotation( pTransforms[2], Quaternion( Vector( r2 ) ) );
+            Transform::DirectlySetRotation( pTransforms[3], Quaternion( Vector( r3 ) ) );
+            Transform::DirectlySetTranslationScale( pTransforms[0], Vector( ts0 ) );
+            Transform::DirectlySetTranslationScale( pTransforms[1], Vector( ts1 ) );
+            Transform::DirectlySetTranslationScale( pTransforms[2], Vector( ts2 ) );
+            Transform::DirectlySetTranslationScale( pTransforms[3], Vector( ts3 ) );
+        }
+
+        EE_FORCE_INLINE bool HasNegativeScale() const { return _mm_movemask_ps( _mm_cmplt_ps( m_scale, Vector::Zero ) ) != 0; }
+
+        // Lane-wise operations
+        //-------------------------------------------------------------------------
+
+        // Per-lane select, lanes with a non-zero control value are taken from 'b'
+        EE_FORCE_INLINE static void Select( TransformBlock const& a, TransformBlock const& b, Vector const& control, TransformBlock& result )
+        {
+            result.m_rotationX = Vector::Select( a.m_rotationX, b.m_rotationX, control );
+            result.m_rotationY = Vector::Select( a.m_rotationY, b.m_rotationY, control );
+            result.m_rotationZ = Vector::Select( a.m_rotationZ, b.m_rotationZ, control );
+            result.m_rotationW = Vector::Select( a.m_rotationW, b.m_rotationW, control );
+            result.m_translationX = Vector::Select( a.m_translationX, b.m_translationX, control );
+            result.m_translationY = Vector::Select( a.m_translationY, b.m_translationY, control );
+            result.m_translationZ = Vector::Select( a.m_translationZ, b.m_translationZ, control );
+            result.m_scale = Vector::Select( a.m_scale, b.m_scale, control );
+        }
+
+        EE_FORCE_INLINE static Vector DotRotations( TransformBlock const& a, TransformBlock const& b )
+        {
+            Vector dot = a.m_rotationX * b.m_rotationX;
+            dot = Vector::MultiplyAdd( a.m_rotationY, b.m_rotationY, dot );
+            dot = Vector::MultiplyAdd( a.m_rotationZ, b.m_rotationZ, dot );
+            dot = Vector::MultiplyAdd( a.m_rotationW, b.m_rotationW, dot );
+            return dot;
+        }
+
+        EE_FORCE_INLINE static void NormalizeRotations( TransformBlock& block )
+        {
+            Vector const invLength = DotRotations( block, block ).GetReciprocalSqrt();
+            block.m_rotationX *= invLength;
+            block.m_rotationY *= invLength;
+            block.m_rotationZ *= invLength;
+            block.m_rotationW *= invLength;
+        }
+
+        // Equivalent to 'Quaternion * Quaternion' i.e. apply 'a' and then 'b'
+        EE_FORCE_INLINE static void MultiplyRotations( TransformBlock const& a, TransformBlock const& b, TransformBlock& result )
+        {
+            Vector const x = b.m_rotationW * a.m_rotationX + b.m_rotationX * a.m_rotationW + b.m_rotationY * a.m_rotationZ - b.m_rotationZ * a.m_rotationY;
+            Vector const y = b.m_rotationW * a.m_rotationY - b.m_rotationX * a.m_rotationZ + b.m_rotationY * a.m_rotationW + b.m_rotationZ * a.m_rotationX;
+            Vector const z = b.m_rotationW * a.m_rotationZ + b.m_rotationX * a.m_rotationY - b.m_rotationY * a.m_rotationX + b.m_rotationZ * a.m_rotationW;
+            Vector const w = b.m_rotationW * a.m_rotationW - b.m_rotationX * a.m_rotationX - b.m_rotationY * a.m_rotationY - b.m_rotationZ * a.m_rotationZ;
+            result.m_rotationX = x;
+            result.m_rotationY = y;
+            result.m_rotationZ = z;
+            result.m_rotationW = w;
+        }
+
+        // Lane-wise 'Quaternion::FastSLerp'
+        EE_FORCE_INLINE static void FastSLerpRotations( TransformBlock const& from, TransformBlock const& to, Vector const& t, TransformBlock& result )
+        {
+            static Vector const a0( 1.0904f ), a1( -3.2452f ), a2( 3.55645f ), a3( -1.43519f );
+            static Vector const b0( 0.848013f ), b1( -1.06021f ), b2( 0.215638f );
+
+            Vector const dot = DotRotations( from, to );
+            Vector const d = dot.GetAbs();
+            Vector const A = Vector::MultiplyAdd( d, Vector::MultiplyAdd( d, Vector::MultiplyAdd( d, a3, a2 ), a1 ), a0 );
+            Vector const B = Vector::MultiplyAdd( d, Vector::MultiplyAdd( d, b2, b1 ), b0 );
+            Vector const tMinusHalf = t - Vector::Half;
+            Vector const k = Vector::MultiplyAdd( A, tMinusHalf * tMinusHalf, B );
+            Vector const ot = Vector::MultiplyAdd( t * tMinusHalf * ( t - Vector::One ), k, t );
+
+            Vector const qt0 = Vector::One - ot;
+            Vector const qt1 = Vector::Select( ot.GetNegated(), ot, dot.GreaterThan( Vector::Zero ) );
+
+            result.m_rotationX = Vector::MultiplyAdd( to.m_rotationX, qt1, from.m_rotationX * qt0 );
+            result.m_rotationY = Vector::MultiplyAdd( to.m_rotationY, qt1, from.m_rotationY * qt0 );
+            result.m_rotationZ = Vector::MultiplyAdd( to.m_rotationZ, qt1, from.m_rotationZ * qt0 );
+            result.m_rotationW = Vector::MultiplyAdd( to.m_rotationW, qt1, from.m_rotationW * qt0 );
+            NormalizeRotations( result );
+        }
+
+        // Lane-wise 'Quaternion::SLerp'
+        EE_FORCE_INLINE static void SLerpRotations( TransformBlock const& from, TransformBlock const& to, Vector const& t, TransformBlock& result )
+        {
+            static Vector const oneMinusEpsilon( 1.0f - 0.00001f );
+
+            Vector cosOmega = DotRotations( from, to );
+            Vector const sign = Vector::Select( Vector::One, Vector::NegativeOne, cosOmega.LessThan( Vector::Zero ) );
+            cosOmega *= sign;
+
+            Vector const sinOmega = ( Vector::One - cosOmega * cosOmega ).GetSqrt();
+            Vector const omega = Vector::ATan2( sinOmega, cosOmega );
+
+            // Nearly identical rotations fall back to a linear interpolation
+            Vector const useSLerp = cosOmega.LessThan( oneMinusEpsilon );
+            Vector const oneMinusT = Vector::One - t;
+            Vector const s0 = Vector::Select( oneMinusT, Vector::Sin( oneMinusT * omega ) / sinOmega, useSLerp );
+            Vector const s1 = Vector::Select( t, Vector::Sin( t * omega ) / sinOmega, useSLerp ) * sign;
+
+            result.m_rotationX = Vector::MultiplyAdd( to.m_rotationX, s1, from.m_rotationX * s0 );
+            result.m_rotationY = Vector::MultiplyAdd( to.m_rotationY, s1, from.m_rotationY * s0 );
+            result.m_rotationZ = Vector::MultiplyAdd( to.m_rotationZ, s1, from.m_rotationZ * s0 );
+            result.m_rotationW = Vector::MultiplyAdd( to.m_rotationW, s1, from.m_rotationW * s0 );
+        }
+
+        // Lane-wise 'Vector::Lerp' of the translation and scale
+        EE_FORCE_INLINE static void LerpTranslationScale( TransformBlock const& from, TransformBlock const& to, Vector const& t, TransformBlock& result )
+        {
+            result.m_translationX = Vector::MultiplyAdd( to.m_translationX - from.m_translationX, t, from.m_translationX );
+            result.m_translationY = Vector::MultiplyAdd( to.m_translationY - from.m_translationY, t, from.m_translationY );
+            result.m_translationZ = Vector::MultiplyAdd( to.m_translationZ - from.m_translationZ, t, from.m_translationZ );
+            result.m_scale = Vector::MultiplyAdd( to.m_scale - from.m_scale, t, from.m_scale );
+        }
+
+        // Lane-wise 'Vector::MultiplyAdd' of the translation and scale i.e. result = base + ( additive * t )
+        EE_FORCE_INLINE static void MultiplyAddTranslationScale( TransformBlock const& base, TransformBlock const& additive, Vector const& t, TransformBlock& result )
+        {
+            result.m_translationX = Vector::MultiplyAdd( additive.m_translationX, t, base.m_translationX );
+            result.m_translationY = Vector::MultiplyAdd( additive.m_translationY, t, base.m_translationY );
+            result.m_translationZ = Vector::MultiplyAdd( additive.m_translationZ, t, base.m_translationZ );
+            result.m_scale = Vector::MultiplyAdd( additive.m_scale, t, base.m_scale );
+        }
+
+        // Lane-wise 'Transform * Transform' (i.e. local * parent), only valid when neither block contains a negative scale
+        EE_FORCE_INLINE static void Multiply( TransformBlock const& local, TransformBlock const& parent, TransformBlock& result )
+        {
+            EE_ASSERT( !local.HasNegativeScale() && !parent.HasNegativeScale() );
+
+            // Rotate the scaled local translation by the parent rotation: v' = v + w * t + cross( q, t ) where t = 2 * cross( q, v )
+            Vector const vx = local.m_translationX * parent.m_scale;
+            Vector const vy = local.m_translationY * parent.m_scale;
+            Vector const vz = local.m_translationZ * parent.m_scale;
+
+            Vector const tx = ( parent.m_rotationY * vz - parent.m_rotationZ * vy ) * 2.0f;
+            Vector const ty = ( parent.m_rotationZ * vx - parent.m_rotationX * vz ) * 2.0f;
+            Vector const tz = ( parent.m_rotationX * vy - parent.m_rotationY * vx ) * 2.0f;
+
+            Vector const translationX = vx + parent.m_rotationW * tx + ( parent.m_rotationY * tz - parent.m_rotationZ * ty ) + parent.m_translationX;
+            Vector const translationY = vy + parent.m_rotationW * ty + ( parent.m_rotationZ * tx - parent.m_rotationX * tz ) + parent.m_translationY;
+            Vector const translationZ = vz + parent.m_rotationW * tz + ( parent.m_rotationX * ty - parent.m_rotationY * tx ) + parent.m_translationZ;
+
+            result.m_scale = local.m_scale * parent.m_scale;
+            result.m_translationX = translationX;
+            result.m_translationY = translationY;
+            result.m_translationZ = translationZ;
+
+            MultiplyRotations( local, parent, result );
+            NormalizeRotations( result );
+        }
+
+    public:
+
+        Vector      m_rotationX;
+        Vector      m_rotationY;
+        Vector      m_rotationZ;
+        Vector      m_rotationW;
+        Vector      m_translationX;
+        Vector      m_translationY;
+        Vector      m_translationZ;
+        Vector      m_scale;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Accessor for a contiguous array of transforms
+    struct TransformArrayAccessor
+    {
+        explicit TransformArrayAccessor( Transform const* pTransforms ) : m_pTransforms( pTransforms ) { EE_ASSERT( pTransforms != nullptr ); }
+
+        EE_FORCE_INLINE Transform const& GetTransform( int32_t boneIdx ) const { return m_pTransforms[boneIdx]; }
+        EE_FORCE_INLINE void LoadBlock( int32_t firstBoneIdx, TransformBlock& block ) const { block.Load( &m_pTransforms[firstBoneIdx] ); }
+
+    public:
+
+        Transform const*    m_pTransforms = nullptr;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Convert parent-space transforms to model-space
+    // Blocks of four bones whose parents are all outside of the block are converted together, blocks with internal dependencies (or negative scales) are converted per bone
+    // The local transform accessor needs to provide: 'Transform GetTransform( int32_t boneIdx )' and 'void LoadBlock( int32_t firstBoneIdx, TransformBlock& block )'
+    template<typename LocalTransformAccessor>
+    void CalculateModelSpaceTransforms( int32_t const* pParentIndices, int32_t numBones, LocalTransformAccessor const& localTransforms, Transform* pModelSpaceTransforms )
+    {
+        EE_ASSERT( pParentIndices != nullptr && pModelSpaceTransforms != nullptr );
+
+        if ( numBones <= 0 )
+        {
+            return;
+        }
+
+        pModelSpaceTransforms[0] = localTransforms.GetTransform( 0 );
+
+        // The first block contains the root so it always starts with the per-bone path
+        int32_t boneIdx = 1;
+        for ( ; boneIdx < numBones && boneIdx < TransformBlock::s_numBones; boneIdx++ )
+        {
+            pModelSpaceTransforms[boneIdx] = localTransforms.GetTransform( boneIdx ) * pModelSpaceTransforms[pParentIndices[boneIdx]];
+        }
+
+        //-------------------------------------------------------------------------
+
+        TransformBlock local, parent, result;
+        for ( ; boneIdx + TransformBlock::s_numBones <= numBones; boneIdx += TransformBlock::s_numBones )
+        {
+            int32_t const* pBlockParentIndices = &pParentIndices[boneIdx];
+            bool const isIndependentBlock = pBlockParentIndices[0] < boneIdx && pBlockParentIndices[1] < boneIdx && pBlockParentIndices[2] < boneIdx && pBlockParentIndices[3] < boneIdx;
+
+            if ( isIndependentBlock )
+            {
+                localTransforms.LoadBlock( boneIdx, local );
+                parent.Load( pModelSpaceTransforms[pBlockParentIndices[0]], pModelSpaceTransforms[pBlockParentIndices[1]], pModelSpaceTransforms[pBlockParentIndices[2]], pModelSpaceTransforms[pBlockParentIndices[3]] );
+
+                if ( !local.HasNegativeScale() && !parent.HasNegativeScale() )
+                {
+                    TransformBlock::Multiply( local, parent, result );
+                    result.Store( &pModelSpaceTransforms[boneIdx] );
+                    continue;
+                }
+            }
+
+            for ( int32_t i = 0; i < TransformBlock::s_numBones; i++ )
+            {
+                EE_ASSERT( pBlockParentIndices[i] < boneIdx + i );
+                pModelSpaceTransforms[boneIdx + i] = localTransforms.GetTransform( boneIdx + i ) * pModelSpaceTransforms[pBlockParentIndices[i]];
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( ; boneIdx < numBones; boneIdx++ )
+        {
+            pModelSpaceTransforms[boneIdx] = localTransforms.GetTransform( boneIdx ) * pModelSpaceTransforms[pParentIndices[boneIdx]];
+        }
+    }
+}
\ No newline at end of file
@@ -74,6 +74,7 @@ namespace EE::Animation
             EE::Delete( pSecondaryPose );
         }
         m_secondaryPoses.clear();
+        m_keyCursor.Reset();
 
         m_previousAnimTime = -1.0f;
         EntityComponent::Shutdown();
@@ -137,7 +138,7 @@ namespace EE::Animation
             // Sample primary pose
             //-------------------------------------------------------------------------
 
-            m_pAnimation->GetPose( m_animTime, m_pPose, m_skeletonLOD );
+            m_pAnimation->GetPose( m_animTime, m_pPose, m_skeletonLOD, true, &m_keyCursor );
 
             // No point displaying a pile of bones, so display an additive on top of the reference pose
             if ( m_pPose->IsAdditivePose() )
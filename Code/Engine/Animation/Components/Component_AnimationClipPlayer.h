@@ -127,6 +127,7 @@ namespace EE::Animation
         Percentage                              m_animTime = Percentage( 0.0f );
         Transform                               m_rootMotionDelta = Transform::Identity;
         Pose*                                   m_pPose = nullptr;
+        KeyframeReducedCursor                   m_keyCursor;
         TInlineVector<Pose*, 1>                 m_secondaryPoses;
     };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "Engine/Entity/EntityLog.h"
 #include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationBlender.h"
 #include "Engine/UpdateContext.h"
 #include "Engine/Physics/PhysicsWorld.h"
 
@@ -27,15 +28,34 @@ namespace EE::Animation
         {
             m_pGraphInstance->SetSecondarySkeletons( m_secondarySkeletons );
         }
+
+        m_pGraphInstance->SetPoseSampleCache( m_pPoseSampleCache );
+
+        ResetUpdateRateLODState();
     }
 
     void GraphComponent::Shutdown()
     {
         m_secondarySkeletons.clear();
+        EE::Delete( m_pInterpolatedPose );
         EE::Delete( m_pGraphInstance );
+        ResetUpdateRateLODState();
         EntityComponent::Shutdown();
     }
 
+    void GraphComponent::ResetUpdateRateLODState()
+    {
+        m_rootMotionDelta = Transform::Identity;
+        m_evaluatedRootMotionDelta = Transform::Identity;
+        m_extrapolatedRootMotion = Transform::Identity;
+        m_evaluationDeltaTime = 0.0f;
+        m_skippedDeltaTime = 0.0f;
+        m_numSkippedFrames = 0;
+        m_numEvaluations = 0;
+        m_wasLastEvaluationAtReducedRate = false;
+        m_wasEvaluatedThisFrame = false;
+    }
+
     //-------------------------------------------------------------------------
 
     void GraphComponent::SetGraphDefinition( ResourceID graphResourceID )
@@ -82,6 +102,16 @@ namespace EE::Animation
         return m_pGraphInstance->GetPrimaryPose();
     }
 
+    void GraphComponent::SetPoseSampleCache( PoseSampleCache* pSampleCache )
+    {
+        m_pPoseSampleCache = pSampleCache;
+
+        if ( m_pGraphInstance != nullptr )
+        {
+            m_pGraphInstance->SetPoseSampleCache( pSampleCache );
+        }
+    }
+
     TInlineVector<Pose const*, 1> GraphComponent::GetSecondaryPoses() const
     {
         return m_pGraphInstance->GetSecondaryPoses();
@@ -99,24 +129,104 @@ namespace EE::Animation
             m_graphStateResetRequested = false;
         }
 
-        GraphPoseNodeResult const result = m_pGraphInstance->EvaluateGraph( deltaTime, characterWorldTransform, pPhysicsWorld, nullptr );
-        m_rootMotionDelta = result.m_rootMotionDelta;
+        // Include any time that was skipped due to a reduced update rate
+        Seconds const evaluationDeltaTime = deltaTime + m_skippedDeltaTime;
+        GraphPoseNodeResult const result = m_pGraphInstance->EvaluateGraph( evaluationDeltaTime, characterWorldTransform, pPhysicsWorld, nullptr );
+        m_evaluatedRootMotionDelta = result.m_rootMotionDelta;
+
+        // Remove the root motion that we already extrapolated over the skipped frames, so that the total applied motion matches the evaluated motion
+        if ( m_numSkippedFrames > 0 )
+        {
+            m_rootMotionDelta = m_evaluatedRootMotionDelta * m_extrapolatedRootMotion.GetInverse();
+        }
+        else
+        {
+            m_rootMotionDelta = m_evaluatedRootMotionDelta;
+        }
+
+        m_wasLastEvaluationAtReducedRate = m_updateInterval > 1;
+        m_evaluationDeltaTime = evaluationDeltaTime;
+        m_skippedDeltaTime = 0.0f;
+        m_extrapolatedRootMotion = Transform::Identity;
+        m_numSkippedFrames = 0;
+        m_numEvaluations = Math::Min( m_numEvaluations + 1, 2u );
+        m_wasEvaluatedThisFrame = true;
 
         #if EE_DEVELOPMENT_TOOLS
         m_pGraphInstance->OutputLog();
         #endif
     }
 
-    void GraphComponent::ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform )
+    void GraphComponent::ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform, PoseBufferArena* pArena )
     {
         EE_ASSERT( HasGraph() );
-        m_pGraphInstance->ExecutePrePhysicsPoseTasks( characterWorldTransform );
+        m_pGraphInstance->ExecutePrePhysicsPoseTasks( characterWorldTransform, pArena );
     }
 
-    void GraphComponent::ExecutePostPhysicsTasks()
+    void GraphComponent::ExecutePostPhysicsTasks( PoseBufferArena* pArena )
     {
         EE_ASSERT( HasGraph() );
-        m_pGraphInstance->ExecutePostPhysicsPoseTasks();
+        m_pGraphInstance->ExecutePostPhysicsPoseTasks( pArena );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void GraphComponent::SkipGraphEvaluation( Seconds deltaTime )
+    {
+        EE_ASSERT( HasGraph() && !m_requiresManualUpdate );
+
+        // Extrapolate this frame's root motion from the last evaluated delta
+        if ( m_evaluationDeltaTime > 0.0f )
+        {
+            float const t = Math::Clamp( deltaTime.ToFloat() / m_evaluationDeltaTime.ToFloat(), 0.0f, 1.0f );
+            m_rootMotionDelta = Transform::SLerp( Transform::Identity, m_evaluatedRootMotionDelta, t );
+        }
+        else
+        {
+            m_rootMotionDelta = Transform::Identity;
+        }
+
+        m_extrapolatedRootMotion = m_rootMotionDelta * m_extrapolatedRootMotion;
+        m_skippedDeltaTime += deltaTime;
+        m_numSkippedFrames++;
+        m_wasEvaluatedThisFrame = false;
+    }
+
+    Pose const* GraphComponent::GetPresentationPose()
+    {
+        EE_ASSERT( HasGraphInstance() );
+
+        Pose const* pCurrentPose = m_pGraphInstance->GetPrimaryPose();
+
+        // Full-rate graphs (and graphs with fewer than two evaluated poses) present the evaluated pose directly
+        // Secondary poses are not interpolated, so we dont interpolate the primary pose either to keep them in sync
+        if ( !m_wasLastEvaluationAtReducedRate || m_numEvaluations < 2 || m_evaluationDeltaTime <= 0.0f || m_pGraphInstance->HasSecondaryPoses() )
+        {
+            return pCurrentPose;
+        }
+
+        float const t = Math::Clamp( m_skippedDeltaTime.ToFloat() / m_evaluationDeltaTime.ToFloat(), 0.0f, 1.0f );
+        if ( t == 1.0f )
+        {
+            return pCurrentPose;
+        }
+
+        Pose const* pPreviousPose = m_pGraphInstance->GetPrimaryPoseForPreviousUpdate();
+        if ( !pPreviousPose->IsPoseSet() || pPreviousPose->GetSkeleton() != pCurrentPose->GetSkeleton() )
+        {
+            return pCurrentPose;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( m_pInterpolatedPose == nullptr )
+        {
+            m_pInterpolatedPose = EE::New<Pose>( pCurrentPose->GetSkeleton() );
+        }
+
+        Blender::ParentSpaceBlend( m_skeletonLOD, pPreviousPose, pCurrentPose, t, nullptr, m_pInterpolatedPose );
+        m_pInterpolatedPose->CalculateModelSpaceTransforms( m_skeletonLOD );
+        return m_pInterpolatedPose;
     }
 
     //-------------------------------------------------------------------------
@@ -66,6 +66,12 @@ namespace EE::Animation
         // Get the primary pose from the graph
         Pose const* GetPrimaryPose() const;
 
+        // Set the (optional) sample cache shared with the other graphs in this world
+        void SetPoseSampleCache( PoseSampleCache* pSampleCache );
+
+        // Get an ID that changes whenever the graph generates a new pose
+        EE_FORCE_INLINE uint32_t GetPoseUpdateID() const { return m_pGraphInstance->GetFinalPoseUpdateID(); }
+
         // Do we have any secondary poses
         EE_FORCE_INLINE bool HasSecondaryPoses() const { return m_pGraphInstance->HasSecondaryPoses(); }
 
@@ -85,10 +91,37 @@ namespace EE::Animation
         void EvaluateGraph( Seconds deltaTime, Transform const& characterWorldTransform, Physics::PhysicsWorld* pPhysicsWorld );
 
         // This function will execute all pre-physics tasks - it assumes that the character has already been moved in the physics world, so expects the final transform for this frame
-        void ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform );
+        // An optional pose buffer arena can be supplied when executing the tasks on a worker thread, it must belong to that thread
+        void ExecutePrePhysicsTasks( Seconds deltaTime, Transform const& characterWorldTransform, PoseBufferArena* pArena = nullptr );
 
         // The function will execute the post-physics tasks (if any)
-        void ExecutePostPhysicsTasks();
+        void ExecutePostPhysicsTasks( PoseBufferArena* pArena = nullptr );
+
+        // Update-rate LOD
+        //-------------------------------------------------------------------------
+        // Distant characters can be evaluated at a reduced rate, on the skipped frames the root motion is extrapolated from the last evaluation
+        // and the presented pose is interpolated between the last two evaluated poses (i.e. the pose lags by one update interval)
+
+        // Set the update interval (in frames) and whether we should evaluate the graph this frame - this is driven by the animation world system
+        inline void SetUpdateRateLOD( int32_t updateInterval, bool shouldEvaluateGraph ) { EE_ASSERT( updateInterval >= 1 ); m_updateInterval = updateInterval; m_shouldEvaluateGraph = shouldEvaluateGraph; }
+
+        // Get the number of frames between graph evaluations (1 means every frame)
+        inline int32_t GetUpdateInterval() const { return m_updateInterval; }
+
+        // Should the graph be evaluated this frame? If not, call 'SkipGraphEvaluation' instead of evaluating the graph and executing the tasks
+        // Note: we always evaluate graphs that have never been evaluated or that have a pending state reset
+        inline bool ShouldEvaluateGraph() const { return m_shouldEvaluateGraph || m_requiresManualUpdate || m_numEvaluations == 0 || m_graphStateResetRequested; }
+
+        // Skip the graph evaluation for this frame - the root motion delta will be extrapolated from the last evaluation
+        // The skipped time is accumulated and included in the next evaluation
+        void SkipGraphEvaluation( Seconds deltaTime );
+
+        // Was the graph evaluated this frame (i.e. are there post-physics tasks to execute)?
+        // Note: use this rather than 'ShouldEvaluateGraph' after the evaluation, since the evaluation clears the conditions that force an evaluation
+        inline bool WasGraphEvaluatedThisFrame() const { return m_wasEvaluatedThisFrame; }
+
+        // Get the primary pose to present this frame, for reduced-rate graphs this is interpolated between the last two evaluated poses
+        Pose const* GetPresentationPose();
 
         // Control Parameters
         //-------------------------------------------------------------------------
@@ -154,6 +187,11 @@ namespace EE::Animation
         virtual void Initialize() override;
         virtual void Shutdown() override;
 
+    private:
+
+        // Clear all update-rate LOD state, needs to be called whenever the graph instance is (re)created
+        void ResetUpdateRateLODState();
+
     private:
 
         EE_REFLECT();
@@ -162,9 +200,23 @@ namespace EE::Animation
         GraphInstance*                                          m_pGraphInstance = nullptr;
         SecondarySkeletonList                                   m_secondarySkeletons;
         SampledEventsBuffer                                     m_sampledEventsBuffer;
+        PoseSampleCache*                                        m_pPoseSampleCache = nullptr;
         Transform                                               m_rootMotionDelta = Transform::Identity;
         Skeleton::LOD                                           m_skeletonLOD = Skeleton::LOD::High;
 
+        // Update-rate LOD
+        Pose*                                                   m_pInterpolatedPose = nullptr;                         // Lazily created the first time we need to interpolate
+        Transform                                               m_evaluatedRootMotionDelta = Transform::Identity;      // The root motion delta produced by the last evaluation
+        Transform                                               m_extrapolatedRootMotion = Transform::Identity;        // The total root motion applied over the skipped frames since the last evaluation
+        Seconds                                                 m_evaluationDeltaTime = 0.0f;                          // The time step used for the last evaluation
+        Seconds                                                 m_skippedDeltaTime = 0.0f;                             // The time skipped since the last evaluation
+        int32_t                                                 m_updateInterval = 1;
+        int32_t                                                 m_numSkippedFrames = 0;
+        uint32_t                                                m_numEvaluations = 0;
+        bool                                                    m_shouldEvaluateGraph = true;
+        bool                                                    m_wasLastEvaluationAtReducedRate = false;
+        bool                                                    m_wasEvaluatedThisFrame = false;
+
         #if EE_DEVELOPMENT_TOOLS
         TVector<SourcePath>                                     m_debugNodeFilterList;
         #endif
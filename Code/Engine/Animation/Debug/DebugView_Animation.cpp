@@ -953,6 +953,60 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        if ( ImGui::BeginMenu( "Pose Task Scheduling" ) )
+        {
+            bool isParallelExecutionEnabled = m_pAnimationWorldSystem->IsParallelPoseTaskExecutionEnabled();
+            if ( ImGui::Checkbox( "Parallel Pose Task Execution", &isParallelExecutionEnabled ) )
+            {
+                m_pAnimationWorldSystem->SetParallelPoseTaskExecutionEnabled( isParallelExecutionEnabled );
+            }
+
+            ImGui::Text( "Deferred Updates: %d", m_pAnimationWorldSystem->GetNumDeferredUpdatesForLastFrame() );
+            ImGui::Text( "Arena Pose Buffers: %d", m_pAnimationWorldSystem->GetNumAllocatedArenaPoseBuffers() );
+
+            ImGui::SeparatorText( "Pose Sample Cache" );
+
+            bool isSampleCacheEnabled = m_pAnimationWorldSystem->IsPoseSampleCacheEnabled();
+            if ( ImGui::Checkbox( "Share Sampled Poses", &isSampleCacheEnabled ) )
+            {
+                m_pAnimationWorldSystem->SetPoseSampleCacheEnabled( isSampleCacheEnabled );
+            }
+
+            PoseSampleCache::Stats const& sampleCacheStats = m_pAnimationWorldSystem->GetPoseSampleCacheStatsForLastFrame();
+            ImGui::Text( "Hit Rate: %.1f%% (%d / %d)", sampleCacheStats.GetHitRate() * 100.0f, sampleCacheStats.m_numHits, sampleCacheStats.m_numLookups );
+            ImGui::Text( "Cached Poses: %d (%d shared)", sampleCacheStats.m_numEntries, sampleCacheStats.m_numSharedEntries );
+            ImGui::Text( "Allocated Poses: %d", sampleCacheStats.m_numAllocatedPoses );
+            ImGui::EndMenu();
+        }
+
+        if ( ImGui::BeginMenu( "Update Rate LOD" ) )
+        {
+            AnimationWorldSystem::UpdateRateLODSettings settings = m_pAnimationWorldSystem->GetUpdateRateLODSettings();
+
+            bool settingsChanged = false;
+            settingsChanged |= ImGui::Checkbox( "Enabled", &settings.m_isEnabled );
+            settingsChanged |= ImGui::DragFloat( "Full Rate Distance", &settings.m_fullRateDistance, 0.5f, 0.0f, 1000.0f, "%.1fm" );
+            settingsChanged |= ImGui::DragFloat( "Distance Per Interval Step", &settings.m_distancePerIntervalStep, 0.5f, 0.1f, 1000.0f, "%.1fm" );
+            settingsChanged |= ImGui::SliderInt( "Max Update Interval", &settings.m_maxUpdateInterval, 1, 16 );
+            settingsChanged |= ImGui::SliderInt( "Offscreen Update Interval", &settings.m_offscreenUpdateInterval, 1, 16 );
+            settingsChanged |= ImGui::DragInt( "Max Full Rate Graphs", &settings.m_maxFullRateGraphs, 1.0f, 0, 1000 );
+
+            if ( settingsChanged )
+            {
+                m_pAnimationWorldSystem->SetUpdateRateLODSettings( settings );
+            }
+
+            ImGui::SeparatorText( "Stats" );
+            ImGui::Text( "Full Rate Graphs: %d", m_pAnimationWorldSystem->GetNumFullRateGraphs() );
+            ImGui::Text( "Reduced Rate Graphs: %d", m_pAnimationWorldSystem->GetNumReducedRateGraphs() );
+            ImGui::Text( "Scheduled Evaluations: %d", m_pAnimationWorldSystem->GetNumScheduledGraphEvaluations() );
+            ImGui::EndMenu();
+        }
+
+        ImGui::Separator();
+
+        //-------------------------------------------------------------------------
+
         InlineString componentName;
         for ( GraphComponent* pGraphComponent : m_pAnimationWorldSystem->m_graphComponents )
         {
@@ -3,6 +3,7 @@
 #include "Nodes/Animation_RuntimeGraphNode_ReferencedGraph.h"
 #include "Nodes/Animation_RuntimeGraphNode_Layers.h"
 #include "Nodes/Animation_RuntimeGraphNode_ExternalPose.h"
+#include "Engine/Physics/PhysicsWorld.h"
 #include "Base/Profiling.h"
 #include "Base/Time/Timers.h"
 
@@ -904,7 +905,7 @@ namespace EE::Animation
         return result;
     }
 
-    void GraphInstance::ExecutePrePhysicsPoseTasks( Transform const& endWorldTransform )
+    void GraphInstance::ExecutePrePhysicsPoseTasks( Transform const& endWorldTransform, PoseBufferArena* pArena )
     {
         EE_PROFILE_SCOPE_ANIMATION( "Graph Instance: Pre-Physics Tasks" );
 
@@ -912,13 +913,20 @@ namespace EE::Animation
         m_graphContext.m_pRootMotionDebugger->EndCharacterUpdate( endWorldTransform );
         #endif
 
-        m_graphContext.m_pTaskSystem->UpdatePrePhysics( m_graphContext.m_deltaTime, endWorldTransform, endWorldTransform.GetInverse() );
+        m_graphContext.m_pTaskSystem->UpdatePrePhysics( m_graphContext.m_deltaTime, endWorldTransform, endWorldTransform.GetInverse(), pArena );
     }
 
-    void GraphInstance::ExecutePostPhysicsPoseTasks()
+    void GraphInstance::ExecutePostPhysicsPoseTasks( PoseBufferArena* pArena )
     {
         EE_PROFILE_SCOPE_ANIMATION( "Graph Instance: Post-Physics Tasks" );
-        m_graphContext.m_pTaskSystem->UpdatePostPhysics();
+
+        // This is the join point for an asynchronous physics simulation, the post-physics tasks read the simulated ragdoll poses
+        if ( m_graphContext.m_pPhysicsWorld != nullptr && m_graphContext.m_pTaskSystem->HasPhysicsDependency() )
+        {
+            m_graphContext.m_pPhysicsWorld->WaitForSimulation();
+        }
+
+        m_graphContext.m_pTaskSystem->UpdatePostPhysics( pArena );
 
         #if EE_DEVELOPMENT_TOOLS
         RecordTasks();
@@ -978,6 +986,13 @@ namespace EE::Animation
         m_pRecording->m_graphID = m_pGraphDefinition->GetResourceID();
         m_pRecording->m_variationID = m_pGraphDefinition->m_variationID;
 
+        // Streamed recordings need the parameter types to be able to encode the parameter values
+        m_pRecording->m_parameterTypes.clear();
+        for ( int16_t i = 0; i < GetNumControlParameters(); i++ )
+        {
+            m_pRecording->m_parameterTypes.emplace_back( GetControlParameterType( i ) );
+        }
+
         //-------------------------------------------------------------------------
 
         m_pRecording->m_timeStepRecordingCount = GraphRecording::s_fullStateRecordingInterval;
@@ -93,6 +93,9 @@ namespace EE::Animation
         // Get the final primary pose from the task system
         inline Pose const* GetPrimaryPoseForPreviousUpdate() { EE_ASSERT( m_isStandaloneGraphInstance ); return m_graphContext.m_pTaskSystem->GetPrimaryPoseForPreviousUpdate(); }
 
+        // Get an ID that changes whenever a new final pose is generated
+        inline uint32_t GetFinalPoseUpdateID() const { EE_ASSERT( m_isStandaloneGraphInstance ); return m_graphContext.m_pTaskSystem->GetFinalPoseUpdateID(); }
+
         // Set the list of secondary skeletons we should try to animate
         void SetSecondarySkeletons( SecondarySkeletonList const& secondarySkeletons );
 
@@ -132,6 +135,9 @@ namespace EE::Animation
         // Are we allowed to sample float channel data?
         EE_FORCE_INLINE bool IsFloatChannelSamplingAllowed() const { EE_ASSERT( m_isStandaloneGraphInstance ); return m_graphContext.m_pTaskSystem->IsFloatChannelSamplingAllowed(); }
 
+        // Set the (optional) sample cache shared with other graph instances in the same world
+        EE_FORCE_INLINE void SetPoseSampleCache( PoseSampleCache* pSampleCache ) { EE_ASSERT( m_isStandaloneGraphInstance ); m_graphContext.m_pTaskSystem->SetPoseSampleCache( pSampleCache ); }
+
         // Task System
         //-------------------------------------------------------------------------
 
@@ -182,10 +188,11 @@ namespace EE::Animation
         GraphPoseNodeResult EvaluateReferencedGraph( GraphContext const& parentContext, SyncTrackTimeRange const* pUpdateRange );
 
         // Execute any pre-physics pose tasks (assumes the character is at its final position for this frame)
-        void ExecutePrePhysicsPoseTasks( Transform const& endWorldTransform );
+        // The optional arena is used for transient pose buffers and must belong to the executing thread
+        void ExecutePrePhysicsPoseTasks( Transform const& endWorldTransform, PoseBufferArena* pArena = nullptr );
 
         // Execute any post-physics pose tasks
-        void ExecutePostPhysicsPoseTasks();
+        void ExecutePostPhysicsPoseTasks( PoseBufferArena* pArena = nullptr );
 
         #if EE_DEVELOPMENT_TOOLS
         // Get the time it took for the last graph update to execute
@@ -1,4 +1,5 @@
 #include "Animation_RuntimeGraph_Recording.h"
+#include "Animation_RuntimeGraph_RecordingStream.h"
 #include "Animation_RuntimeGraph_Instance.h"
 #include "Engine/Animation/AnimationClip.h"
 #include "Nodes/Animation_RuntimeGraphNode_ReferencedGraph.h"
@@ -25,15 +26,70 @@ namespace EE::Animation
         m_initializedNodeIndices.clear();
         m_inputArchive.Reset();
         m_outputArchive.Reset();
+        m_streamedData.clear();
     }
 
     void RecordedGraphState::PrepareForReading()
     {
-        m_inputArchive.ReadFromData( m_outputArchive.GetBinaryData(), m_outputArchive.GetBinaryDataSize() );
+        if ( !m_streamedData.empty() )
+        {
+            m_inputArchive.ReadFromBlob( m_streamedData );
+        }
+        else
+        {
+            m_inputArchive.ReadFromData( m_outputArchive.GetBinaryData(), m_outputArchive.GetBinaryDataSize() );
+        }
 
         for ( RecordedReferencedGraphData* pReferencedGraphData : m_referencedGraphData )
         {
-            pReferencedGraphData->m_graphState.m_inputArchive.ReadFromData( pReferencedGraphData->m_graphState.m_outputArchive.GetBinaryData(), pReferencedGraphData->m_graphState.m_outputArchive.GetBinaryDataSize() );
+            pReferencedGraphData->m_graphState.PrepareForReading();
+        }
+    }
+
+    void RecordedGraphState::WriteToArchive( Serialization::BinaryOutputArchive& archive )
+    {
+        Blob recordedData;
+        if ( !m_streamedData.empty() )
+        {
+            recordedData = m_streamedData;
+        }
+        else
+        {
+            size_t const recordedDataSize = m_outputArchive.GetBinaryDataSize();
+            recordedData.resize( recordedDataSize );
+            if ( recordedDataSize > 0 )
+            {
+                memcpy( recordedData.data(), m_outputArchive.GetBinaryData(), recordedDataSize );
+            }
+        }
+
+        archive << m_graphResourceID << m_variationID << m_initializedNodeIndices << m_isStandaloneGraph << recordedData;
+
+        uint32_t const numReferencedGraphs = (uint32_t) m_referencedGraphData.size();
+        archive << numReferencedGraphs;
+
+        for ( RecordedReferencedGraphData* pReferencedGraphData : m_referencedGraphData )
+        {
+            archive << pReferencedGraphData->m_referencedGraphNodeIdx;
+            pReferencedGraphData->m_graphState.WriteToArchive( archive );
+        }
+    }
+
+    void RecordedGraphState::ReadFromArchive( Serialization::BinaryInputArchive& archive )
+    {
+        Reset();
+
+        archive << m_graphResourceID << m_variationID << m_initializedNodeIndices << m_isStandaloneGraph << m_streamedData;
+
+        uint32_t numReferencedGraphs = 0;
+        archive << numReferencedGraphs;
+
+        for ( uint32_t i = 0; i < numReferencedGraphs; i++ )
+        {
+            RecordedReferencedGraphData* pReferencedGraphData = EE::New<RecordedReferencedGraphData>();
+            archive << pReferencedGraphData->m_referencedGraphNodeIdx;
+            pReferencedGraphData->m_graphState.ReadFromArchive( archive );
+            m_referencedGraphData.emplace_back( pReferencedGraphData );
         }
     }
 
@@ -139,6 +195,11 @@ namespace EE::Animation
 
     void GraphRecording::Reset()
     {
+        if ( m_pStreamWriter != nullptr )
+        {
+            StopStreaming();
+        }
+
         m_graphID.Clear();
         m_variationID = StringID();
 
@@ -156,6 +217,48 @@ namespace EE::Animation
         }
 
         m_recordedGraphStates.clear();
+        m_parameterTypes.clear();
+    }
+
+    RecordedGraphUpdateData* GraphRecording::CreateUpdateData()
+    {
+        // Once a new update is started, all the previously created updates are complete and can be handed off to the stream
+        if ( m_pStreamWriter != nullptr && !m_recordedUpdateData.empty() )
+        {
+            m_pStreamWriter->WriteRecordedUpdates( *this );
+        }
+
+        auto pUpdateData = EE::New<RecordedGraphUpdateData>();
+        m_recordedUpdateData.emplace_back( pUpdateData );
+        return pUpdateData;
+    }
+
+    bool GraphRecording::StartStreaming( FileSystem::Path const& filePath, size_t memoryBudget )
+    {
+        EE_ASSERT( m_pStreamWriter == nullptr );
+        EE_ASSERT( m_recordedUpdateData.empty() ); // Streaming needs to be started before anything is recorded
+
+        m_pStreamWriter = EE::New<GraphRecordingStreamWriter>();
+        if ( !m_pStreamWriter->Open( filePath, memoryBudget ) )
+        {
+            EE::Delete( m_pStreamWriter );
+            return false;
+        }
+
+        return true;
+    }
+
+    void GraphRecording::StopStreaming()
+    {
+        EE_ASSERT( m_pStreamWriter != nullptr );
+
+        if ( !m_recordedUpdateData.empty() )
+        {
+            m_pStreamWriter->WriteRecordedUpdates( *this );
+        }
+
+        m_pStreamWriter->Close();
+        EE::Delete( m_pStreamWriter );
     }
 
     bool GraphRecording::HasRecordedDataForGraph( ResourceID const& graphResourceID ) const
@@ -251,14 +354,29 @@ namespace EE::Animation
 
     void GraphRecordingPlayer::StartPlayback( GraphInstance *pPlaybackGraphInstance, TInlineVector<GraphDefinition const*, 2> const& externalGraphDefs, TInlineVector<AnimationClip const*, 2> const& externalClips, GraphRecording *pRecording )
     {
-        EE_ASSERT( pPlaybackGraphInstance != nullptr );
         EE_ASSERT( pRecording != nullptr && pRecording->HasRecordedData() );
         EE_ASSERT( pRecording->m_graphID == pRecording->m_graphID );
+        EE_ASSERT( m_pRecording == nullptr && m_pStreamReader == nullptr );
+
+        m_pRecording = pRecording;
+        StartPlaybackInternal( pPlaybackGraphInstance, externalGraphDefs, externalClips );
+    }
+
+    void GraphRecordingPlayer::StartPlayback( GraphInstance *pPlaybackGraphInstance, TInlineVector<GraphDefinition const*, 2> const& externalGraphDefs, TInlineVector<AnimationClip const*, 2> const& externalClips, GraphRecordingStreamReader *pStreamReader )
+    {
+        EE_ASSERT( pStreamReader != nullptr && pStreamReader->IsOpen() && pStreamReader->GetNumRecordedUpdates() > 0 );
+        EE_ASSERT( m_pRecording == nullptr && m_pStreamReader == nullptr );
+
+        m_pStreamReader = pStreamReader;
+        StartPlaybackInternal( pPlaybackGraphInstance, externalGraphDefs, externalClips );
+    }
+
+    void GraphRecordingPlayer::StartPlaybackInternal( GraphInstance *pPlaybackGraphInstance, TInlineVector<GraphDefinition const*, 2> const& externalGraphDefs, TInlineVector<AnimationClip const*, 2> const& externalClips )
+    {
+        EE_ASSERT( pPlaybackGraphInstance != nullptr );
         EE_ASSERT( m_pPlaybackGraphInstance == nullptr );
-        EE_ASSERT( m_pRecording == nullptr );
 
         m_pPlaybackGraphInstance = pPlaybackGraphInstance;
-        m_pRecording = pRecording;
         m_currentViewedUpdateIdx = InvalidIndex;
         m_taskListTopologySize = m_taskListDataSize = 0;
         m_characterTransform = Transform::Identity;
@@ -271,7 +389,7 @@ namespace EE::Animation
     void GraphRecordingPlayer::StopPlayback()
     {
         EE_ASSERT( m_pPlaybackGraphInstance != nullptr );
-        EE_ASSERT( m_pRecording != nullptr );
+        EE_ASSERT( m_pRecording != nullptr || m_pStreamReader != nullptr );
 
         m_pPlaybackGraphInstance->DisconnectAllExternalGraphs();
         m_pPlaybackGraphInstance->ClearAllExternalPoses();
@@ -279,6 +397,7 @@ namespace EE::Animation
         m_pPlaybackGraphInstance = nullptr;
 
         m_pRecording = nullptr;
+        m_pStreamReader = nullptr;
         m_currentViewedUpdateIdx = InvalidIndex;
         m_taskListTopologySize = m_taskListDataSize = 0;
         m_characterTransform = Transform::Identity;
@@ -286,35 +405,60 @@ namespace EE::Animation
         DestroyCreatedExternalGraphInstances();
     }
 
+    int32_t GraphRecordingPlayer::GetNumRecordedUpdates() const
+    {
+        return ( m_pStreamReader != nullptr ) ? m_pStreamReader->GetNumRecordedUpdates() : m_pRecording->GetNumRecordedUpdates();
+    }
+
+    RecordedGraphUpdateData const* GraphRecordingPlayer::GetRecordedUpdate( int32_t recordedUpdateIdx ) const
+    {
+        if ( m_pStreamReader != nullptr )
+        {
+            return m_pStreamReader->GetRecordedUpdate( recordedUpdateIdx );
+        }
+
+        return m_pRecording->m_recordedUpdateData[recordedUpdateIdx];
+    }
+
+    TVector<RecordedGraphState*> const& GraphRecordingPlayer::GetRecordedGraphStates( int32_t recordedUpdateIdx ) const
+    {
+        if ( m_pStreamReader != nullptr )
+        {
+            return m_pStreamReader->GetRecordedGraphStates( recordedUpdateIdx );
+        }
+
+        return m_pRecording->m_recordedGraphStates;
+    }
+
     Seconds GraphRecordingPlayer::GetDeltaTime() const
     {
-        EE_ASSERT( IsPlaybackActive() && m_pRecording->HasRecordedData() );
-        EE_ASSERT( m_currentViewedUpdateIdx >= 0 && m_currentViewedUpdateIdx < m_pRecording->GetNumRecordedUpdates() );
+        EE_ASSERT( IsPlaybackActive() );
+        EE_ASSERT( m_currentViewedUpdateIdx >= 0 && m_currentViewedUpdateIdx < GetNumRecordedUpdates() );
 
-        return m_pRecording->m_recordedUpdateData[m_currentViewedUpdateIdx]->m_deltaTime;
+        return GetRecordedUpdate( m_currentViewedUpdateIdx )->m_deltaTime;
     }
 
     int32_t GraphRecordingPlayer::GetGraphUpdateID() const
     {
-        EE_ASSERT( IsPlaybackActive() && m_pRecording->HasRecordedData() );
-        EE_ASSERT( m_currentViewedUpdateIdx >= 0 && m_currentViewedUpdateIdx < m_pRecording->GetNumRecordedUpdates() );
-        return m_pRecording->m_recordedUpdateData[m_currentViewedUpdateIdx]->m_updateID;
+        EE_ASSERT( IsPlaybackActive() );
+        EE_ASSERT( m_currentViewedUpdateIdx >= 0 && m_currentViewedUpdateIdx < GetNumRecordedUpdates() );
+        return GetRecordedUpdate( m_currentViewedUpdateIdx )->m_updateID;
     }
 
     RecordedUpdateType GraphRecordingPlayer::GetUpdateType() const
     {
-        EE_ASSERT( IsPlaybackActive() && m_pRecording->HasRecordedData() );
-        EE_ASSERT( m_currentViewedUpdateIdx >= 0 && m_currentViewedUpdateIdx < m_pRecording->GetNumRecordedUpdates() );
+        EE_ASSERT( IsPlaybackActive() );
+        EE_ASSERT( m_currentViewedUpdateIdx >= 0 && m_currentViewedUpdateIdx < GetNumRecordedUpdates() );
 
-        return m_pRecording->m_recordedUpdateData[m_currentViewedUpdateIdx]->m_updateType;
+        return GetRecordedUpdate( m_currentViewedUpdateIdx )->m_updateType;
     }
 
     GraphTimeInfo const &GraphRecordingPlayer::GetTimingInfo() const
     {
-        EE_ASSERT( IsPlaybackActive() && m_pRecording->HasRecordedData() );
-        EE_ASSERT( m_currentViewedUpdateIdx >= 0 && m_currentViewedUpdateIdx < m_pRecording->GetNumRecordedUpdates() );
+        EE_ASSERT( IsPlaybackActive() );
+        EE_ASSERT( m_currentViewedUpdateIdx >= 0 && m_currentViewedUpdateIdx < GetNumRecordedUpdates() );
 
-        return m_pRecording->m_recordedUpdateData[m_currentViewedUpdateIdx]->m_timingInfo;
+        return GetRecordedUpdate( m_currentViewedUpdateIdx )->m_timingInfo;
     }
 
     void GraphRecordingPlayer::DestroyCreatedExternalGraphInstances()
@@ -343,10 +487,10 @@ namespace EE::Animation
 
     GraphRecordingPlayer::Result GraphRecordingPlayer::GoToRecordedUpdate( int32_t targetRecordedUpdateIdx )
     {
-        EE_ASSERT( IsPlaybackActive() && m_pRecording->HasRecordedData() );
-        EE_ASSERT( targetRecordedUpdateIdx >= 0 && targetRecordedUpdateIdx < m_pRecording->GetNumRecordedUpdates() );
+        EE_ASSERT( IsPlaybackActive() );
+        EE_ASSERT( targetRecordedUpdateIdx >= 0 && targetRecordedUpdateIdx < GetNumRecordedUpdates() );
 
-        if ( !m_pRecording->IsValidRecordedUpdateIndex( targetRecordedUpdateIdx ) )
+        if ( targetRecordedUpdateIdx < 0 || targetRecordedUpdateIdx >= GetNumRecordedUpdates() )
         {
             return Result::Failure;
         }
@@ -388,7 +532,7 @@ namespace EE::Animation
             hasExternalGraphStateChanged = true;
         };
 
-        auto ConnectGraphToNode = [this, &hasExternalGraphStateChanged] ( RecordedExternalGraphData const *pExternalGraphData, GraphDefinition::ExternalGraphSlot const &eg )
+        auto ConnectGraphToNode = [this, &hasExternalGraphStateChanged] ( RecordedExternalGraphData const *pExternalGraphData, GraphDefinition::ExternalGraphSlot const &eg, TVector<RecordedGraphState*> const& recordedGraphStates )
         {
             int32_t const definitionIdx = VectorFindIndex( m_externalGraphDefinitions, pExternalGraphData->m_graphResourceID, [] ( GraphDefinition const* pDef, ResourceID const& resID ) { return pDef->GetResourceID() == resID; } );
             if ( definitionIdx == InvalidIndex )
@@ -396,7 +540,7 @@ namespace EE::Animation
                 return false;
             }
 
-            auto pGraphState = m_pRecording->m_recordedGraphStates[pExternalGraphData->m_updateData.m_recordedGraphStateIdx];
+            auto pGraphState = recordedGraphStates[pExternalGraphData->m_updateData.m_recordedGraphStateIdx];
             pGraphState->PrepareForReading();
 
             GraphInstance *pExternalInstance = new GraphInstance( m_externalGraphDefinitions[definitionIdx] );
@@ -422,11 +566,17 @@ namespace EE::Animation
         {
             startUpdateIdx = m_currentViewedUpdateIdx + 1;
         }
-        else // Find the first full state recording from the end index
+        else // Find the first full state recording from the end index - resets also record the full state so we can start from those as well
         {
             for ( int32_t i = targetRecordedUpdateIdx - 1; i >= 0; i-- )
             {
-                if ( m_pRecording->m_recordedUpdateData[i]->m_updateType == RecordedUpdateType::FullState )
+                RecordedGraphUpdateData const* pUpdateData = GetRecordedUpdate( i );
+                if ( pUpdateData == nullptr )
+                {
+                    return Result::Failure;
+                }
+
+                if ( pUpdateData->m_updateType == RecordedUpdateType::FullState || pUpdateData->m_updateType == RecordedUpdateType::Reset )
                 {
                     startUpdateIdx = i;
                     break;
@@ -439,12 +589,18 @@ namespace EE::Animation
 
         for ( auto i = startUpdateIdx; i <= targetRecordedUpdateIdx; i++ )
         {
-            RecordedGraphUpdateData const *pUpdateData = m_pRecording->m_recordedUpdateData[i];
+            RecordedGraphUpdateData const *pUpdateData = GetRecordedUpdate( i );
+            if ( pUpdateData == nullptr )
+            {
+                return Result::Failure;
+            }
+
+            TVector<RecordedGraphState*> const& recordedGraphStates = GetRecordedGraphStates( i );
 
             // Restore the main graph state
             //-------------------------------------------------------------------------
 
-            if ( !m_pPlaybackGraphInstance->SetToRecordedState( *pUpdateData, m_pRecording->m_recordedGraphStates ) )
+            if ( !m_pPlaybackGraphInstance->SetToRecordedState( *pUpdateData, recordedGraphStates ) )
             {
                 return Result::Failure;
             }
@@ -494,7 +650,7 @@ namespace EE::Animation
                     // We have external data but no connected graph, so connect a graph
                     else if ( pRecordedExternalGraphData != nullptr && !isExternalSlotFilled )
                     {
-                        if ( !ConnectGraphToNode( pRecordedExternalGraphData, eg ) )
+                        if ( !ConnectGraphToNode( pRecordedExternalGraphData, eg, recordedGraphStates ) )
                         {
                             return Result::Failure;
                         }
@@ -508,14 +664,14 @@ namespace EE::Animation
                         {
                             DisconnectGraphFromNode( eg );
 
-                            if ( !ConnectGraphToNode( pRecordedExternalGraphData, eg ) )
+                            if ( !ConnectGraphToNode( pRecordedExternalGraphData, eg, recordedGraphStates ) )
                             {
                                 return Result::Failure;
                             }
                         }
                         else // Just restore the graph state here
                         {
-                            auto pGraphState = m_pRecording->m_recordedGraphStates[pRecordedExternalGraphData->m_updateData.m_recordedGraphStateIdx];
+                            auto pGraphState = recordedGraphStates[pRecordedExternalGraphData->m_updateData.m_recordedGraphStateIdx];
                             pGraphState->PrepareForReading();
 
                             for ( size_t e = 0; e < m_externalGraphInstances.size(); e++ )
@@ -584,7 +740,12 @@ namespace EE::Animation
                 #if EE_DEVELOPMENT_TOOLS
                 if ( i != targetRecordedUpdateIdx )
                 {
-                    RecordedGraphUpdateData const *pNextFrameData = m_pRecording->m_recordedUpdateData[i + 1];
+                    RecordedGraphUpdateData const *pNextFrameData = GetRecordedUpdate( i + 1 );
+                    if ( pNextFrameData == nullptr )
+                    {
+                        return Result::Failure;
+                    }
+
                     m_pPlaybackGraphInstance->EndRootMotionDebuggerUpdate( pNextFrameData->m_characterWorldTransform );
                 }
                 #endif
@@ -596,9 +757,13 @@ namespace EE::Animation
 
             if ( i > ( targetRecordedUpdateIdx - 2 ) )
             {
-                int32_t const nextFrameIdx = ( i < m_pRecording->GetNumRecordedUpdates() - 1 ) ? i + 1 : i;
-                RecordedGraphUpdateData const *pCurrentUpdateData = m_pRecording->m_recordedUpdateData[i];
-                RecordedGraphUpdateData const *pNextUpdateData = m_pRecording->m_recordedUpdateData[nextFrameIdx];
+                int32_t const nextFrameIdx = ( i < GetNumRecordedUpdates() - 1 ) ? i + 1 : i;
+                RecordedGraphUpdateData const *pCurrentUpdateData = pUpdateData;
+                RecordedGraphUpdateData const *pNextUpdateData = GetRecordedUpdate( nextFrameIdx );
+                if ( pNextUpdateData == nullptr )
+                {
+                    return Result::Failure;
+                }
 
                 // Do we need to evaluate the the pose tasks for this client
                 if ( m_pPlaybackGraphInstance->DoesTaskSystemNeedUpdate() )
@@ -616,8 +781,13 @@ namespace EE::Animation
         // Set character world Transform
         //-------------------------------------------------------------------------
 
-        int32_t const nextFrameIdx = ( targetRecordedUpdateIdx < m_pRecording->GetNumRecordedUpdates() - 1 ) ? targetRecordedUpdateIdx + 1 : targetRecordedUpdateIdx;
-        RecordedGraphUpdateData const *pNextUpdateData = m_pRecording->m_recordedUpdateData[nextFrameIdx];
+        int32_t const nextFrameIdx = ( targetRecordedUpdateIdx < GetNumRecordedUpdates() - 1 ) ? targetRecordedUpdateIdx + 1 : targetRecordedUpdateIdx;
+        RecordedGraphUpdateData const *pNextUpdateData = GetRecordedUpdate( nextFrameIdx );
+        if ( pNextUpdateData == nullptr )
+        {
+            return Result::Failure;
+        }
+
         m_characterTransform = pNextUpdateData->m_characterWorldTransform;
 
         m_currentViewedUpdateIdx = targetRecordedUpdateIdx;
@@ -632,7 +802,13 @@ namespace EE::Animation
         if ( recordedUpdateIdx != InvalidIndex )
         {
             // Resolve skeleton resource IDs to actual data
-            for ( ResourceID const& skeletonResourceID : m_pRecording->m_recordedUpdateData[recordedUpdateIdx]->m_secondarySkeletons )
+            RecordedGraphUpdateData const* pUpdateData = GetRecordedUpdate( recordedUpdateIdx );
+            if ( pUpdateData == nullptr )
+            {
+                return skeletons;
+            }
+
+            for ( ResourceID const& skeletonResourceID : pUpdateData->m_secondarySkeletons )
             {
                 for ( auto pSkeleton : m_skeletons )
                 {
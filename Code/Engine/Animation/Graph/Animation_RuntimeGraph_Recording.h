@@ -1,11 +1,13 @@
 #pragma once
 #include "Engine/_Module/API.h"
 #include "Animation_RuntimeGraph_Context.h"
+#include "Animation_RuntimeGraph_ValueTypes.h"
 #include "Engine/Animation/AnimationTarget.h"
 #include "Engine/Animation/AnimationSyncTrack.h"
 #include "Base/Time/Time.h"
 #include "Base/Serialization/BinarySerialization.h"
 #include "Base/Resource/ResourceID.h"
+#include "Base/FileSystem/FileSystemPath.h"
 #include "Animation_RuntimeGraph_TimingInfo.h"
 
 //-------------------------------------------------------------------------
@@ -15,6 +17,8 @@ namespace EE::Animation
     class GraphNode;
     class GraphDefinition;
     class AnimationClip;
+    class GraphRecordingStreamWriter;
+    class GraphRecordingStreamReader;
 
     //-------------------------------------------------------------------------
     // Recorded Full Graph State
@@ -39,6 +43,12 @@ namespace EE::Animation
         // Get a unique list of the various graphs recorded
         void GetAllRecordedGraphResourceIDs( TVector<ResourceID>& outGraphIDs ) const;
 
+        // Write the complete recorded state (including all referenced graphs) to an archive - used when streaming recordings to disk
+        void WriteToArchive( Serialization::BinaryOutputArchive& archive );
+
+        // Read back a state written by 'WriteToArchive', the state is ready to be restored once 'PrepareForReading' is called
+        void ReadFromArchive( Serialization::BinaryInputArchive& archive );
+
         // Referenced graphs
         //-------------------------------------------------------------------------
 
@@ -90,6 +100,7 @@ namespace EE::Animation
 
         Serialization::BinaryOutputArchive                  m_outputArchive;
         mutable Serialization::BinaryInputArchive           m_inputArchive;
+        Blob                                                m_streamedData; // The recorded data when read back from a stream
     };
 
     struct RecordedReferencedGraphData
@@ -119,7 +130,8 @@ namespace EE::Animation
     {
         union ParameterData
         {
-            ParameterData() {}
+            // Zero the storage so that the unused bytes of smaller values are deterministic, this allows streamed recordings to compare values bytewise
+            ParameterData() { memset( this, 0, sizeof( ParameterData ) ); }
 
             bool                                            m_bool;
             StringID                                        m_ID;
@@ -220,6 +232,16 @@ namespace EE::Animation
         TInlineVector<ResourceID, 2> GetAllRecordedExternalClipResourceIDs() const;
         TInlineVector<ResourceID, 2> GetAllRecordedSkeletonResourceIDs() const;
 
+        // Streaming
+        //-------------------------------------------------------------------------
+        // When streaming, each completed update is delta-encoded and written to disk in the background and then released from memory
+        // The recording will not contain any updates once streaming is stopped, use a 'GraphRecordingStreamReader' to play back the file
+
+        bool StartStreaming( FileSystem::Path const& filePath, size_t memoryBudget );
+        void StopStreaming();
+        inline bool IsStreaming() const { return m_pStreamWriter != nullptr; }
+        inline GraphRecordingStreamWriter const* GetStreamWriter() const { return m_pStreamWriter; }
+
     private:
 
         GraphRecording( GraphRecording const & ) = delete;
@@ -227,12 +249,7 @@ namespace EE::Animation
         GraphRecording &operator=( GraphRecording const & ) = delete;
         GraphRecording &operator=( GraphRecording && ) = delete;
 
-        RecordedGraphUpdateData *CreateUpdateData()
-        {
-            auto pUpdateData = EE::New<RecordedGraphUpdateData>();
-            m_recordedUpdateData.emplace_back( pUpdateData );
-            return pUpdateData;
-        }
+        RecordedGraphUpdateData *CreateUpdateData();
 
     public:
 
@@ -240,7 +257,12 @@ namespace EE::Animation
         StringID                                            m_variationID;
         TVector<RecordedGraphUpdateData*>                   m_recordedUpdateData;
         TVector<RecordedGraphState*>                        m_recordedGraphStates;
+        TVector<GraphValueType>                             m_parameterTypes;
         int32_t                                             m_timeStepRecordingCount = 0;
+
+    private:
+
+        GraphRecordingStreamWriter*                         m_pStreamWriter = nullptr;
     };
 
     //-------------------------------------------------------------------------
@@ -271,8 +293,12 @@ namespace EE::Animation
         ~GraphRecordingPlayer();
 
         void StartPlayback( GraphInstance *pPlaybackGraphInstance, TInlineVector<GraphDefinition const*, 2> const& externalGraphDefs, TInlineVector<AnimationClip const*, 2> const& externalClips, GraphRecording *pRecording );
+
+        // Play back a recording that was streamed to disk, updates are loaded from the file as needed so seeking only decodes the nearest full state chunk
+        void StartPlayback( GraphInstance *pPlaybackGraphInstance, TInlineVector<GraphDefinition const*, 2> const& externalGraphDefs, TInlineVector<AnimationClip const*, 2> const& externalClips, GraphRecordingStreamReader *pStreamReader );
+
         void StopPlayback();
-        bool IsPlaybackActive() const { return m_pPlaybackGraphInstance != nullptr && m_pRecording != nullptr; }
+        bool IsPlaybackActive() const { return m_pPlaybackGraphInstance != nullptr && ( m_pRecording != nullptr || m_pStreamReader != nullptr ); }
 
         // Run the recording to the specified update index
         Result GoToRecordedUpdate( int32_t targetRecordedUpdateIdx );
@@ -281,7 +307,7 @@ namespace EE::Animation
         int32_t GetCurrentUpdateIndex() const { return m_currentViewedUpdateIdx; }
 
         // Get the currently viewed update index
-        int32_t GetNumRecordedUpdates() const { return m_pRecording->GetNumRecordedUpdates(); }
+        int32_t GetNumRecordedUpdates() const;
 
         // Get the update type for the currently viewed index
         RecordedUpdateType GetUpdateType() const;
@@ -309,6 +335,12 @@ namespace EE::Animation
 
     private:
 
+        void StartPlaybackInternal( GraphInstance *pPlaybackGraphInstance, TInlineVector<GraphDefinition const*, 2> const& externalGraphDefs, TInlineVector<AnimationClip const*, 2> const& externalClips );
+
+        // Access the recorded data from either the in-memory recording or the stream
+        RecordedGraphUpdateData const* GetRecordedUpdate( int32_t recordedUpdateIdx ) const;
+        TVector<RecordedGraphState*> const& GetRecordedGraphStates( int32_t recordedUpdateIdx ) const;
+
         void DestroyCreatedExternalGraphInstances();
 
         AnimationClip const* TryGetExternalClip( ResourceID const& ID ) const;
@@ -317,6 +349,7 @@ namespace EE::Animation
 
         GraphInstance                                       *m_pPlaybackGraphInstance = nullptr;
         GraphRecording                                      *m_pRecording = nullptr;
+        GraphRecordingStreamReader                          *m_pStreamReader = nullptr;
         int32_t                                             m_currentViewedUpdateIdx = InvalidIndex;
         size_t                                              m_taskListTopologySize = 0;
         size_t                                              m_taskListDataSize = 0;
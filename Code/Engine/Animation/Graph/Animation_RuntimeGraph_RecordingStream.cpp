@@ -0,0 +1,1469 @@
+#include "Animation_RuntimeGraph_RecordingStream.h"
+#include "Base/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    constexpr static uint32_t const g_fileMagic = 0x52474545; // 'EEGR'
+    constexpr static uint32_t const g_chunkMagic = 0x4B484345; // 'ECHK'
+    constexpr static uint32_t const g_fileVersion = 1;
+    constexpr static size_t const g_fileHeaderSize = sizeof( uint32_t ) * 3;
+    constexpr static size_t const g_chunkHeaderSize = sizeof( uint32_t ) * 4;
+
+    // Worst case number of bits for a single control parameter, this is a bone target with offsets
+    constexpr static uint32_t const g_maxBitsPerParameter = 1 + 4 + 64 + 7 * 32;
+
+    // Bits reserved for everything except the control parameters in the update header, this is enough for the max number of external graphs
+    constexpr static uint32_t const g_maxFixedHeaderBits = 8192;
+
+    // Number of consecutive unchanged bytes needed to split a changed run, short gaps are cheaper to include in the run
+    constexpr static size_t const g_minUnchangedBytesToSplitRun = 4;
+
+    //-------------------------------------------------------------------------
+
+    struct GraphRecordingChunk
+    {
+        Serialization::BinaryOutputArchive                  m_archive;
+        int32_t                                             m_firstUpdateIdx = 0;
+        int32_t                                             m_numUpdates = 0;
+    };
+
+    enum class BlobDeltaMode : uint8_t
+    {
+        Unchanged = 0,
+        ChangedRuns,
+        Full
+    };
+
+    //-------------------------------------------------------------------------
+    // Blob Deltas
+    //-------------------------------------------------------------------------
+    // Blobs are encoded as a list of changed runs: [num unchanged bytes to skip][num changed bytes][changed bytes], all counts are varints
+
+    static void AppendVarUInt( Blob& outData, uint32_t value )
+    {
+        while ( value >= 0x80 )
+        {
+            outData.emplace_back( uint8_t( value | 0x80 ) );
+            value >>= 7;
+        }
+
+        outData.emplace_back( uint8_t( value ) );
+    }
+
+    static bool ReadVarUInt( Blob const& data, size_t& readPos, uint32_t& outValue )
+    {
+        outValue = 0;
+
+        for ( uint32_t shift = 0; shift < 32; shift += 7 )
+        {
+            if ( readPos >= data.size() )
+            {
+                return false;
+            }
+
+            uint8_t const byte = data[readPos++];
+            outValue |= uint32_t( byte & 0x7F ) << shift;
+            if ( ( byte & 0x80 ) == 0 )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static void AppendUInt32( Blob& outData, uint32_t value )
+    {
+        size_t const offset = outData.size();
+        outData.resize( offset + sizeof( uint32_t ) );
+        memcpy( outData.data() + offset, &value, sizeof( uint32_t ) );
+    }
+
+    static uint32_t ReadUInt32( uint8_t const* pData )
+    {
+        uint32_t value;
+        memcpy( &value, pData, sizeof( uint32_t ) );
+        return value;
+    }
+
+    static BlobDeltaMode EncodeBlobDelta( Blob const* pPreviousData, Blob const& data, Blob& outEncodedData )
+    {
+        outEncodedData.clear();
+
+        if ( pPreviousData != nullptr && *pPreviousData == data )
+        {
+            return BlobDeltaMode::Unchanged;
+        }
+
+        if ( pPreviousData == nullptr || pPreviousData->size() != data.size() )
+        {
+            outEncodedData = data;
+            return BlobDeltaMode::Full;
+        }
+
+        //-------------------------------------------------------------------------
+
+        Blob const& previousData = *pPreviousData;
+        size_t const dataSize = data.size();
+        size_t lastRunEnd = 0;
+        size_t pos = 0;
+
+        while ( pos < dataSize )
+        {
+            if ( data[pos] == previousData[pos] )
+            {
+                pos++;
+                continue;
+            }
+
+            // Extend the run until we find enough unchanged bytes to make splitting it worthwhile
+            size_t const runStart = pos;
+            size_t runEnd = pos;
+            size_t numUnchangedBytes = 0;
+            while ( pos < dataSize && numUnchangedBytes < g_minUnchangedBytesToSplitRun )
+            {
+                if ( data[pos] == previousData[pos] )
+                {
+                    numUnchangedBytes++;
+                }
+                else
+                {
+                    numUnchangedBytes = 0;
+                    runEnd = pos + 1;
+                }
+                pos++;
+            }
+
+            AppendVarUInt( outEncodedData, uint32_t( runStart - lastRunEnd ) );
+            AppendVarUInt( outEncodedData, uint32_t( runEnd - runStart ) );
+            outEncodedData.insert( outEncodedData.end(), data.begin() + runStart, data.begin() + runEnd );
+            lastRunEnd = runEnd;
+            pos = runEnd;
+        }
+
+        // If most of the data changed, it is cheaper to just write it out
+        if ( outEncodedData.size() >= dataSize )
+        {
+            outEncodedData = data;
+            return BlobDeltaMode::Full;
+        }
+
+        return BlobDeltaMode::ChangedRuns;
+    }
+
+    static bool DecodeBlobDelta( BlobDeltaMode mode, Blob const* pPreviousData, Blob const& encodedData, Blob& outData )
+    {
+        switch ( mode )
+        {
+            case BlobDeltaMode::Unchanged:
+            {
+                if ( pPreviousData == nullptr )
+                {
+                    return false;
+                }
+
+                outData = *pPreviousData;
+            }
+            break;
+
+            case BlobDeltaMode::ChangedRuns:
+            {
+                if ( pPreviousData == nullptr )
+                {
+                    return false;
+                }
+
+                outData = *pPreviousData;
+
+                size_t readPos = 0;
+                size_t writePos = 0;
+                while ( readPos < encodedData.size() )
+                {
+                    uint32_t numBytesToSkip = 0, numChangedBytes = 0;
+                    if ( !ReadVarUInt( encodedData, readPos, numBytesToSkip ) || !ReadVarUInt( encodedData, readPos, numChangedBytes ) )
+                    {
+                        return false;
+                    }
+
+                    writePos += numBytesToSkip;
+                    if ( ( writePos + numChangedBytes ) > outData.size() || ( readPos + numChangedBytes ) > encodedData.size() )
+                    {
+                        return false;
+                    }
+
+                    memcpy( outData.data() + writePos, encodedData.data() + readPos, numChangedBytes );
+                    writePos += numChangedBytes;
+                    readPos += numChangedBytes;
+                }
+            }
+            break;
+
+            case BlobDeltaMode::Full:
+            {
+                outData = encodedData;
+            }
+            break;
+
+            default:
+            {
+                return false;
+            }
+            break;
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Bit Packing
+    //-------------------------------------------------------------------------
+
+    static void WriteUInt64( GraphRecordingFrameArchive& archive, uint64_t value )
+    {
+        archive.WriteUInt( value & 0xFFFFFFFF, 32 );
+        archive.WriteUInt( value >> 32, 32 );
+    }
+
+    static uint64_t ReadUInt64( GraphRecordingFrameArchive& archive )
+    {
+        uint64_t const low = archive.ReadUInt( 32 );
+        uint64_t const high = archive.ReadUInt( 32 );
+        return low | ( high << 32 );
+    }
+
+    static void WriteQuaternion( GraphRecordingFrameArchive& archive, Quaternion const& q )
+    {
+        Float4 const values = q.ToFloat4();
+        archive.WriteFloat( values.m_x );
+        archive.WriteFloat( values.m_y );
+        archive.WriteFloat( values.m_z );
+        archive.WriteFloat( values.m_w );
+    }
+
+    static Quaternion ReadQuaternion( GraphRecordingFrameArchive& archive )
+    {
+        float const x = archive.ReadFloat();
+        float const y = archive.ReadFloat();
+        float const z = archive.ReadFloat();
+        float const w = archive.ReadFloat();
+        return Quaternion( x, y, z, w );
+    }
+
+    static void WriteFloat3( GraphRecordingFrameArchive& archive, Float3 const& v )
+    {
+        archive.WriteFloat( v.m_x );
+        archive.WriteFloat( v.m_y );
+        archive.WriteFloat( v.m_z );
+    }
+
+    static Float3 ReadFloat3( GraphRecordingFrameArchive& archive )
+    {
+        float const x = archive.ReadFloat();
+        float const y = archive.ReadFloat();
+        float const z = archive.ReadFloat();
+        return Float3( x, y, z );
+    }
+
+    static void WriteTransform( GraphRecordingFrameArchive& archive, Transform const& transform )
+    {
+        WriteQuaternion( archive, transform.GetRotation() );
+        WriteFloat3( archive, transform.GetTranslation().ToFloat3() );
+        archive.WriteFloat( transform.GetScale() );
+    }
+
+    static Transform ReadTransform( GraphRecordingFrameArchive& archive )
+    {
+        Quaternion const rotation = ReadQuaternion( archive );
+        Float3 const translation = ReadFloat3( archive );
+        float const scale = archive.ReadFloat();
+        return Transform( rotation, Vector( translation ), scale );
+    }
+
+    static bool AreEqual( SyncTrackTimeRange const& a, SyncTrackTimeRange const& b )
+    {
+        return a.m_startTime.m_eventIdx == b.m_startTime.m_eventIdx && a.m_startTime.m_percentageThrough.ToFloat() == b.m_startTime.m_percentageThrough.ToFloat() &&
+               a.m_endTime.m_eventIdx == b.m_endTime.m_eventIdx && a.m_endTime.m_percentageThrough.ToFloat() == b.m_endTime.m_percentageThrough.ToFloat();
+    }
+
+    static void WriteSyncTrackTimeRange( GraphRecordingFrameArchive& archive, SyncTrackTimeRange const& range )
+    {
+        archive.WriteUInt( (uint32_t) range.m_startTime.m_eventIdx, 32 );
+        archive.WriteFloat( range.m_startTime.m_percentageThrough.ToFloat() );
+        archive.WriteUInt( (uint32_t) range.m_endTime.m_eventIdx, 32 );
+        archive.WriteFloat( range.m_endTime.m_percentageThrough.ToFloat() );
+    }
+
+    static SyncTrackTimeRange ReadSyncTrackTimeRange( GraphRecordingFrameArchive& archive )
+    {
+        SyncTrackTimeRange range;
+        range.m_startTime.m_eventIdx = (int32_t) archive.ReadUInt( 32 );
+        range.m_startTime.m_percentageThrough = Percentage( archive.ReadFloat() );
+        range.m_endTime.m_eventIdx = (int32_t) archive.ReadUInt( 32 );
+        range.m_endTime.m_percentageThrough = Percentage( archive.ReadFloat() );
+        return range;
+    }
+
+    //-------------------------------------------------------------------------
+    // Control Parameters
+    //-------------------------------------------------------------------------
+
+    static bool AreEqual( Target const& a, Target const& b )
+    {
+        if ( a.IsTargetSet() != b.IsTargetSet() )
+        {
+            return false;
+        }
+
+        if ( !a.IsTargetSet() )
+        {
+            return true;
+        }
+
+        if ( a.IsBoneTarget() != b.IsBoneTarget() )
+        {
+            return false;
+        }
+
+        if ( !a.IsBoneTarget() )
+        {
+            return a.GetTransform() == b.GetTransform();
+        }
+
+        if ( a.GetBoneID() != b.GetBoneID() || a.HasOffsets() != b.HasOffsets() || a.IsUsingBoneSpaceOffsets() != b.IsUsingBoneSpaceOffsets() )
+        {
+            return false;
+        }
+
+        if ( a.HasOffsets() )
+        {
+            return Transform( a.GetRotationOffset(), a.GetTranslationOffset() ) == Transform( b.GetRotationOffset(), b.GetTranslationOffset() );
+        }
+
+        return true;
+    }
+
+    static bool AreEqual( GraphValueType valueType, RecordedGraphUpdateData::ParameterData const& a, RecordedGraphUpdateData::ParameterData const& b )
+    {
+        switch ( valueType )
+        {
+            case GraphValueType::Bool: return a.m_bool == b.m_bool;
+            case GraphValueType::ID: return a.m_ID == b.m_ID;
+            case GraphValueType::Float: return a.m_float == b.m_float;
+            case GraphValueType::Vector: return a.m_vector == b.m_vector;
+            case GraphValueType::Target: return AreEqual( a.m_target, b.m_target );
+
+            default:
+            EE_UNREACHABLE_CODE();
+            break;
+        }
+
+        return false;
+    }
+
+    static void WriteParameter( GraphRecordingFrameArchive& archive, GraphValueType valueType, RecordedGraphUpdateData::ParameterData const& parameterData )
+    {
+        switch ( valueType )
+        {
+            case GraphValueType::Bool:
+            {
+                archive.WriteBool( parameterData.m_bool );
+            }
+            break;
+
+            case GraphValueType::ID:
+            {
+                WriteUInt64( archive, parameterData.m_ID.ToUint() );
+            }
+            break;
+
+            case GraphValueType::Float:
+            {
+                archive.WriteFloat( parameterData.m_float );
+            }
+            break;
+
+            case GraphValueType::Vector:
+            {
+                WriteFloat3( archive, parameterData.m_vector );
+            }
+            break;
+
+            case GraphValueType::Target:
+            {
+                Target const& target = parameterData.m_target;
+                archive.WriteBool( target.IsTargetSet() );
+                if ( target.IsTargetSet() )
+                {
+                    archive.WriteBool( target.IsBoneTarget() );
+                    if ( target.IsBoneTarget() )
+                    {
+                        WriteUInt64( archive, target.GetBoneID().ToUint() );
+                        archive.WriteBool( target.HasOffsets() );
+                        archive.WriteBool( target.IsUsingBoneSpaceOffsets() );
+                        if ( target.HasOffsets() )
+                        {
+                            WriteQuaternion( archive, target.GetRotationOffset() );
+                            WriteFloat3( archive, target.GetTranslationOffset().ToFloat3() );
+                        }
+                    }
+                    else // Targets ignore scale
+                    {
+                        WriteQuaternion( archive, target.GetTransform().GetRotation() );
+                        WriteFloat3( archive, target.GetTransform().GetTranslation().ToFloat3() );
+                    }
+                }
+            }
+            break;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            break;
+        }
+    }
+
+    static void ReadParameter( GraphRecordingFrameArchive& archive, GraphValueType valueType, RecordedGraphUpdateData::ParameterData& outParameterData )
+    {
+        switch ( valueType )
+        {
+            case GraphValueType::Bool:
+            {
+                outParameterData.m_bool = archive.ReadBool();
+            }
+            break;
+
+            case GraphValueType::ID:
+            {
+                outParameterData.m_ID = StringID( ReadUInt64( archive ) );
+            }
+            break;
+
+            case GraphValueType::Float:
+            {
+                outParameterData.m_float = archive.ReadFloat();
+            }
+            break;
+
+            case GraphValueType::Vector:
+            {
+                outParameterData.m_vector = ReadFloat3( archive );
+            }
+            break;
+
+            case GraphValueType::Target:
+            {
+                Target target;
+                if ( archive.ReadBool() )
+                {
+                    if ( archive.ReadBool() )
+                    {
+                        target = Target( StringID( ReadUInt64( archive ) ) );
+                        bool const hasOffsets = archive.ReadBool();
+                        bool const isUsingBoneSpaceOffsets = archive.ReadBool();
+                        if ( hasOffsets )
+                        {
+                            Quaternion const rotationOffset = ReadQuaternion( archive );
+                            Vector const translationOffset( ReadFloat3( archive ) );
+                            target.SetOffsets( rotationOffset, translationOffset, isUsingBoneSpaceOffsets );
+                        }
+                    }
+                    else
+                    {
+                        Quaternion const rotation = ReadQuaternion( archive );
+                        Vector const translation( ReadFloat3( archive ) );
+                        target = Target( rotation, translation );
+                    }
+                }
+                outParameterData.m_target = target;
+            }
+            break;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            break;
+        }
+    }
+
+    // External graph parameters are encoded bytewise since we dont store their types, this relies on the parameter data being zero initialized
+    static void GetParameterDataAsBlob( TVector<RecordedGraphUpdateData::ParameterData> const& parameterData, Blob& outData )
+    {
+        outData.resize( parameterData.size() * sizeof( RecordedGraphUpdateData::ParameterData ) );
+        if ( !parameterData.empty() )
+        {
+            memcpy( outData.data(), parameterData.data(), outData.size() );
+        }
+    }
+
+    static bool SetParameterDataFromBlob( Blob const& data, TVector<RecordedGraphUpdateData::ParameterData>& outParameterData )
+    {
+        if ( ( data.size() % sizeof( RecordedGraphUpdateData::ParameterData ) ) != 0 )
+        {
+            return false;
+        }
+
+        outParameterData.resize( data.size() / sizeof( RecordedGraphUpdateData::ParameterData ) );
+        if ( !data.empty() )
+        {
+            memcpy( outParameterData.data(), data.data(), data.size() );
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Update Encoding
+    //-------------------------------------------------------------------------
+
+    static void WriteTimingInfo( Serialization::BinaryOutputArchive& archive, GraphTimeInfo const& timingInfo )
+    {
+        Serialization::BitArchive timingArchive;
+        timingInfo.Serialize( timingArchive );
+
+        Blob timingData;
+        timingArchive.GetWrittenData( timingData );
+        archive << timingData;
+    }
+
+    static void ReadTimingInfo( Serialization::BinaryInputArchive& archive, GraphTimeInfo& outTimingInfo )
+    {
+        Blob timingData;
+        archive << timingData;
+
+        Serialization::BitArchive timingArchive( timingData );
+        outTimingInfo.Reset();
+        outTimingInfo.Deserialize( timingArchive );
+    }
+
+    static bool EncodeUpdate( GraphRecordingFrameArchive& frameArchive, TVector<GraphValueType> const& parameterTypes, RecordedGraphUpdateData const* pPrevious, RecordedGraphUpdateData const& update, TVector<RecordedGraphState*> const& graphStates, Serialization::BinaryOutputArchive& archive )
+    {
+        size_t const numParameters = update.m_parameterData.size();
+        if ( numParameters != 0 && numParameters != parameterTypes.size() )
+        {
+            return false;
+        }
+
+        if ( update.m_externalGraphData.size() > UINT8_MAX || update.m_externalPoseData.size() > UINT8_MAX )
+        {
+            return false;
+        }
+
+        frameArchive.ResetForWriting();
+
+        // Update info
+        //-------------------------------------------------------------------------
+
+        frameArchive.WriteUInt( (uint8_t) update.m_updateType, 3 );
+
+        bool const isNextUpdateID = ( pPrevious != nullptr ) && ( update.m_updateID == pPrevious->m_updateID + 1 );
+        frameArchive.WriteBool( isNextUpdateID );
+        if ( !isNextUpdateID )
+        {
+            frameArchive.WriteUInt( (uint32_t) update.m_updateID, 32 );
+        }
+
+        bool const isSameDeltaTime = ( pPrevious != nullptr ) && ( update.m_deltaTime == pPrevious->m_deltaTime );
+        frameArchive.WriteBool( isSameDeltaTime );
+        if ( !isSameDeltaTime )
+        {
+            frameArchive.WriteFloat( update.m_deltaTime.ToFloat() );
+        }
+
+        bool const isSameTransform = ( pPrevious != nullptr ) && ( update.m_characterWorldTransform == pPrevious->m_characterWorldTransform );
+        frameArchive.WriteBool( isSameTransform );
+        if ( !isSameTransform )
+        {
+            WriteTransform( frameArchive, update.m_characterWorldTransform );
+        }
+
+        bool const isSameUpdateRange = ( pPrevious != nullptr ) && AreEqual( update.m_updateRange, pPrevious->m_updateRange );
+        frameArchive.WriteBool( isSameUpdateRange );
+        if ( !isSameUpdateRange )
+        {
+            WriteSyncTrackTimeRange( frameArchive, update.m_updateRange );
+        }
+
+        // Control parameters - only write the changed values
+        //-------------------------------------------------------------------------
+
+        frameArchive.WriteUInt( (uint32_t) numParameters, 16 );
+
+        bool const isParameterDelta = ( pPrevious != nullptr ) && ( pPrevious->m_parameterData.size() == numParameters );
+        for ( size_t i = 0; i < numParameters; i++ )
+        {
+            if ( isParameterDelta )
+            {
+                bool const hasChanged = !AreEqual( parameterTypes[i], update.m_parameterData[i], pPrevious->m_parameterData[i] );
+                frameArchive.WriteBool( hasChanged );
+                if ( !hasChanged )
+                {
+                    continue;
+                }
+            }
+
+            WriteParameter( frameArchive, parameterTypes[i], update.m_parameterData[i] );
+        }
+
+        // Task lists
+        //-------------------------------------------------------------------------
+
+        Blob encodedTopologyData, encodedTaskData;
+        BlobDeltaMode const topologyMode = EncodeBlobDelta( ( pPrevious != nullptr ) ? &pPrevious->m_serializedTopologyData : nullptr, update.m_serializedTopologyData, encodedTopologyData );
+        BlobDeltaMode const taskDataMode = EncodeBlobDelta( ( pPrevious != nullptr ) ? &pPrevious->m_serializedTaskData : nullptr, update.m_serializedTaskData, encodedTaskData );
+        frameArchive.WriteUInt( (uint8_t) topologyMode, 2 );
+        frameArchive.WriteUInt( (uint8_t) taskDataMode, 2 );
+
+        // Secondary skeletons
+        //-------------------------------------------------------------------------
+
+        bool const haveSecondarySkeletonsChanged = ( pPrevious == nullptr ) || ( update.m_secondarySkeletons != pPrevious->m_secondarySkeletons );
+        frameArchive.WriteBool( haveSecondarySkeletonsChanged );
+
+        // External data and graph states
+        //-------------------------------------------------------------------------
+
+        TInlineVector<RecordedGraphState*, 4> statesToWrite;
+
+        bool const hasGraphState = update.m_recordedGraphStateIdx != InvalidIndex;
+        frameArchive.WriteBool( hasGraphState );
+        if ( hasGraphState )
+        {
+            statesToWrite.emplace_back( graphStates[update.m_recordedGraphStateIdx] );
+        }
+
+        TInlineVector<Blob, 2> encodedExternalParameterData;
+        frameArchive.WriteUInt( (uint32_t) update.m_externalGraphData.size(), 8 );
+        for ( RecordedExternalGraphData const* pExternalGraphData : update.m_externalGraphData )
+        {
+            RecordedGraphUpdateData const& externalUpdate = pExternalGraphData->m_updateData;
+
+            frameArchive.WriteUInt( (uint16_t) pExternalGraphData->m_externalGraphNodeIdx, 16 );
+            frameArchive.WriteUInt( (uint8_t) externalUpdate.m_updateType, 3 );
+
+            bool const hasExternalGraphState = externalUpdate.m_recordedGraphStateIdx != InvalidIndex;
+            frameArchive.WriteBool( hasExternalGraphState );
+            if ( hasExternalGraphState )
+            {
+                statesToWrite.emplace_back( graphStates[externalUpdate.m_recordedGraphStateIdx] );
+            }
+
+            Blob previousParameterData, parameterData;
+            RecordedExternalGraphData const* pPreviousExternalGraphData = ( pPrevious != nullptr ) ? pPrevious->TryGetExternalGraphData( pExternalGraphData->m_externalGraphNodeIdx ) : nullptr;
+            if ( pPreviousExternalGraphData != nullptr )
+            {
+                GetParameterDataAsBlob( pPreviousExternalGraphData->m_updateData.m_parameterData, previousParameterData );
+            }
+            GetParameterDataAsBlob( externalUpdate.m_parameterData, parameterData );
+
+            BlobDeltaMode const parameterMode = EncodeBlobDelta( ( pPreviousExternalGraphData != nullptr ) ? &previousParameterData : nullptr, parameterData, encodedExternalParameterData.emplace_back() );
+            frameArchive.WriteUInt( (uint8_t) parameterMode, 2 );
+        }
+
+        frameArchive.WriteUInt( (uint32_t) update.m_externalPoseData.size(), 8 );
+
+        // Write the update
+        //-------------------------------------------------------------------------
+
+        EE_ASSERT( frameArchive.GetNumBitsProcessed() < g_graphRecordingFrameArchiveNumBits );
+
+        Blob headerData;
+        frameArchive.GetWrittenData( headerData );
+        archive << headerData;
+
+        if ( topologyMode != BlobDeltaMode::Unchanged )
+        {
+            archive << encodedTopologyData;
+        }
+
+        if ( taskDataMode != BlobDeltaMode::Unchanged )
+        {
+            archive << encodedTaskData;
+        }
+
+        WriteTimingInfo( archive, update.m_timingInfo );
+
+        if ( haveSecondarySkeletonsChanged )
+        {
+            archive << update.m_secondarySkeletons;
+        }
+
+        for ( size_t i = 0; i < update.m_externalGraphData.size(); i++ )
+        {
+            RecordedExternalGraphData const* pExternalGraphData = update.m_externalGraphData[i];
+            RecordedGraphUpdateData const& externalUpdate = pExternalGraphData->m_updateData;
+
+            float const deltaTime = externalUpdate.m_deltaTime.ToFloat();
+            int32_t const rangeEventIndices[2] = { externalUpdate.m_updateRange.m_startTime.m_eventIdx, externalUpdate.m_updateRange.m_endTime.m_eventIdx };
+            float const rangePercentages[2] = { externalUpdate.m_updateRange.m_startTime.m_percentageThrough.ToFloat(), externalUpdate.m_updateRange.m_endTime.m_percentageThrough.ToFloat() };
+
+            archive << pExternalGraphData->m_graphResourceID << deltaTime << externalUpdate.m_characterWorldTransform << rangeEventIndices << rangePercentages;
+            WriteTimingInfo( archive, externalUpdate.m_timingInfo );
+
+            if ( !encodedExternalParameterData[i].empty() )
+            {
+                archive << encodedExternalParameterData[i];
+            }
+        }
+
+        for ( RecordedExternalPoseData const* pExternalPoseData : update.m_externalPoseData )
+        {
+            float const values[5] = { pExternalPoseData->m_startTime0.ToFloat(), pExternalPoseData->m_endTime0.ToFloat(), pExternalPoseData->m_startTime1.ToFloat(), pExternalPoseData->m_endTime1.ToFloat(), pExternalPoseData->m_blendWeight };
+            archive << pExternalPoseData->m_externalPoseNodeIdx << pExternalPoseData->m_slotID << pExternalPoseData->m_clipResourceID0 << pExternalPoseData->m_clipResourceID1 << values;
+        }
+
+        for ( RecordedGraphState* pGraphState : statesToWrite )
+        {
+            pGraphState->WriteToArchive( archive );
+        }
+
+        return true;
+    }
+
+    static bool DecodeUpdate( GraphRecordingFrameArchive& frameArchive, TVector<GraphValueType> const& parameterTypes, RecordedGraphUpdateData const* pPrevious, Serialization::BinaryInputArchive& archive, RecordedGraphUpdateData& outUpdate, TVector<RecordedGraphState*>& outGraphStates )
+    {
+        Blob headerData;
+        archive << headerData;
+        if ( headerData.size() >= ( g_graphRecordingFrameArchiveNumBits / 8 ) )
+        {
+            return false;
+        }
+
+        frameArchive.ResetForReading( headerData );
+
+        // Update info
+        //-------------------------------------------------------------------------
+
+        outUpdate.m_updateType = (RecordedUpdateType) frameArchive.ReadUInt( 3 );
+
+        bool const isNextUpdateID = frameArchive.ReadBool();
+        if ( isNextUpdateID && pPrevious == nullptr )
+        {
+            return false;
+        }
+        outUpdate.m_updateID = isNextUpdateID ? pPrevious->m_updateID + 1 : (int32_t) frameArchive.ReadUInt( 32 );
+
+        bool const isSameDeltaTime = frameArchive.ReadBool();
+        if ( isSameDeltaTime && pPrevious == nullptr )
+        {
+            return false;
+        }
+        outUpdate.m_deltaTime = isSameDeltaTime ? pPrevious->m_deltaTime : Seconds( frameArchive.ReadFloat() );
+
+        bool const isSameTransform = frameArchive.ReadBool();
+        if ( isSameTransform && pPrevious == nullptr )
+        {
+            return false;
+        }
+        outUpdate.m_characterWorldTransform = isSameTransform ? pPrevious->m_characterWorldTransform : ReadTransform( frameArchive );
+
+        bool const isSameUpdateRange = frameArchive.ReadBool();
+        if ( isSameUpdateRange && pPrevious == nullptr )
+        {
+            return false;
+        }
+        outUpdate.m_updateRange = isSameUpdateRange ? pPrevious->m_updateRange : ReadSyncTrackTimeRange( frameArchive );
+
+        // Control parameters
+        //-------------------------------------------------------------------------
+
+        size_t const numParameters = (size_t) frameArchive.ReadUInt( 16 );
+        if ( numParameters != 0 && numParameters != parameterTypes.size() )
+        {
+            return false;
+        }
+
+        outUpdate.m_parameterData.resize( numParameters );
+
+        bool const isParameterDelta = ( pPrevious != nullptr ) && ( pPrevious->m_parameterData.size() == numParameters );
+        for ( size_t i = 0; i < numParameters; i++ )
+        {
+            if ( isParameterDelta && !frameArchive.ReadBool() )
+            {
+                outUpdate.m_parameterData[i] = pPrevious->m_parameterData[i];
+                continue;
+            }
+
+            ReadParameter( frameArchive, parameterTypes[i], outUpdate.m_parameterData[i] );
+        }
+
+        // Task lists
+        //-------------------------------------------------------------------------
+
+        BlobDeltaMode const topologyMode = (BlobDeltaMode) frameArchive.ReadUInt( 2 );
+        BlobDeltaMode const taskDataMode = (BlobDeltaMode) frameArchive.ReadUInt( 2 );
+        bool const haveSecondarySkeletonsChanged = frameArchive.ReadBool();
+        bool const hasGraphState = frameArchive.ReadBool();
+
+        // External data
+        //-------------------------------------------------------------------------
+
+        struct ExternalGraphHeader
+        {
+            int16_t                                         m_nodeIdx = InvalidIndex;
+            RecordedUpdateType                              m_updateType = RecordedUpdateType::Unknown;
+            bool                                            m_hasGraphState = false;
+            BlobDeltaMode                                   m_parameterMode = BlobDeltaMode::Unchanged;
+        };
+
+        TInlineVector<ExternalGraphHeader, 2> externalGraphHeaders;
+        uint32_t const numExternalGraphs = (uint32_t) frameArchive.ReadUInt( 8 );
+        for ( uint32_t i = 0; i < numExternalGraphs; i++ )
+        {
+            ExternalGraphHeader& externalGraphHeader = externalGraphHeaders.emplace_back();
+            externalGraphHeader.m_nodeIdx = (int16_t) frameArchive.ReadUInt( 16 );
+            externalGraphHeader.m_updateType = (RecordedUpdateType) frameArchive.ReadUInt( 3 );
+            externalGraphHeader.m_hasGraphState = frameArchive.ReadBool();
+            externalGraphHeader.m_parameterMode = (BlobDeltaMode) frameArchive.ReadUInt( 2 );
+        }
+
+        uint32_t const numExternalPoses = (uint32_t) frameArchive.ReadUInt( 8 );
+
+        // Read the update
+        //-------------------------------------------------------------------------
+
+        Blob encodedData;
+        if ( topologyMode != BlobDeltaMode::Unchanged )
+        {
+            archive << encodedData;
+        }
+
+        if ( !DecodeBlobDelta( topologyMode, ( pPrevious != nullptr ) ? &pPrevious->m_serializedTopologyData : nullptr, encodedData, outUpdate.m_serializedTopologyData ) )
+        {
+            return false;
+        }
+
+        encodedData.clear();
+        if ( taskDataMode != BlobDeltaMode::Unchanged )
+        {
+            archive << encodedData;
+        }
+
+        if ( !DecodeBlobDelta( taskDataMode, ( pPrevious != nullptr ) ? &pPrevious->m_serializedTaskData : nullptr, encodedData, outUpdate.m_serializedTaskData ) )
+        {
+            return false;
+        }
+
+        ReadTimingInfo( archive, outUpdate.m_timingInfo );
+
+        if ( haveSecondarySkeletonsChanged )
+        {
+            archive << outUpdate.m_secondarySkeletons;
+        }
+        else if ( pPrevious != nullptr )
+        {
+            outUpdate.m_secondarySkeletons = pPrevious->m_secondarySkeletons;
+        }
+        else
+        {
+            return false;
+        }
+
+        // Graph states are written after all the update data, so assign their indices in the same order they were written
+        int32_t nextGraphStateIdx = (int32_t) outGraphStates.size();
+        outUpdate.m_recordedGraphStateIdx = hasGraphState ? nextGraphStateIdx++ : InvalidIndex;
+
+        for ( ExternalGraphHeader const& externalGraphHeader : externalGraphHeaders )
+        {
+            RecordedExternalGraphData* pExternalGraphData = outUpdate.CreateExternalGraphData();
+            RecordedGraphUpdateData& externalUpdate = pExternalGraphData->m_updateData;
+            pExternalGraphData->m_externalGraphNodeIdx = externalGraphHeader.m_nodeIdx;
+            externalUpdate.m_updateType = externalGraphHeader.m_updateType;
+            externalUpdate.m_recordedGraphStateIdx = externalGraphHeader.m_hasGraphState ? nextGraphStateIdx++ : InvalidIndex;
+
+            float deltaTime = 0.0f;
+            int32_t rangeEventIndices[2] = { 0, 0 };
+            float rangePercentages[2] = { 0.0f, 0.0f };
+            archive << pExternalGraphData->m_graphResourceID << deltaTime << externalUpdate.m_characterWorldTransform << rangeEventIndices << rangePercentages;
+            externalUpdate.m_deltaTime = deltaTime;
+            externalUpdate.m_updateRange = SyncTrackTimeRange( SyncTrackTime( rangeEventIndices[0], rangePercentages[0] ), SyncTrackTime( rangeEventIndices[1], rangePercentages[1] ) );
+            ReadTimingInfo( archive, externalUpdate.m_timingInfo );
+
+            Blob previousParameterData;
+            RecordedExternalGraphData const* pPreviousExternalGraphData = ( pPrevious != nullptr ) ? pPrevious->TryGetExternalGraphData( externalGraphHeader.m_nodeIdx ) : nullptr;
+            if ( pPreviousExternalGraphData != nullptr )
+            {
+                GetParameterDataAsBlob( pPreviousExternalGraphData->m_updateData.m_parameterData, previousParameterData );
+            }
+
+            encodedData.clear();
+            if ( externalGraphHeader.m_parameterMode != BlobDeltaMode::Unchanged )
+            {
+                archive << encodedData;
+            }
+
+            Blob parameterData;
+            if ( !DecodeBlobDelta( externalGraphHeader.m_parameterMode, ( pPreviousExternalGraphData != nullptr ) ? &previousParameterData : nullptr, encodedData, parameterData ) )
+            {
+                return false;
+            }
+
+            if ( !SetParameterDataFromBlob( parameterData, externalUpdate.m_parameterData ) )
+            {
+                return false;
+            }
+        }
+
+        for ( uint32_t i = 0; i < numExternalPoses; i++ )
+        {
+            RecordedExternalPoseData* pExternalPoseData = outUpdate.CreateExternalPoseData();
+
+            float values[5] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+            archive << pExternalPoseData->m_externalPoseNodeIdx << pExternalPoseData->m_slotID << pExternalPoseData->m_clipResourceID0 << pExternalPoseData->m_clipResourceID1 << values;
+            pExternalPoseData->m_startTime0 = Percentage( values[0] );
+            pExternalPoseData->m_endTime0 = Percentage( values[1] );
+            pExternalPoseData->m_startTime1 = Percentage( values[2] );
+            pExternalPoseData->m_endTime1 = Percentage( values[3] );
+            pExternalPoseData->m_blendWeight = values[4];
+        }
+
+        while ( (int32_t) outGraphStates.size() < nextGraphStateIdx )
+        {
+            RecordedGraphState* pGraphState = outGraphStates.emplace_back( EE::New<RecordedGraphState>() );
+            pGraphState->ReadFromArchive( archive );
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Writer
+    //-------------------------------------------------------------------------
+
+    GraphRecordingStreamWriter::GraphRecordingStreamWriter() = default;
+
+    GraphRecordingStreamWriter::~GraphRecordingStreamWriter()
+    {
+        EE_ASSERT( !IsOpen() );
+        EE_ASSERT( m_pCurrentChunk == nullptr && m_pPreviousUpdate == nullptr && m_pFrameArchive == nullptr );
+    }
+
+    bool GraphRecordingStreamWriter::Open( FileSystem::Path const& filePath, size_t memoryBudget )
+    {
+        EE_ASSERT( !IsOpen() );
+        EE_ASSERT( filePath.IsFilePath() );
+
+        m_pFile = EE::New<FileSystem::OutputFileStream>( filePath );
+        if ( !m_pFile->IsValid() )
+        {
+            EE_LOG_ERROR( LogCategory::Animation, "Graph Recording", "Failed to open '%s' for streaming", filePath.c_str() );
+            EE::Delete( m_pFile );
+            return false;
+        }
+
+        m_filePath = filePath;
+        m_memoryBudget = memoryBudget;
+        m_hasWrittenHeader = false;
+        m_hasEncodingError = false;
+        m_parameterTypes.clear();
+        m_numWrittenUpdates = 0;
+        m_numPendingBytes = 0;
+        m_numBytesWritten = 0;
+        m_numWriterStalls = 0;
+        m_shouldExit = false;
+
+        m_pCurrentChunk = EE::New<GraphRecordingChunk>();
+        m_pFrameArchive = EE::New<GraphRecordingFrameArchive>();
+        m_writerThread = Threading::Thread( [this] () { WriterThreadFunction(); } );
+
+        return true;
+    }
+
+    void GraphRecordingStreamWriter::Close()
+    {
+        if ( !IsOpen() )
+        {
+            return;
+        }
+
+        if ( !m_hasEncodingError && m_pCurrentChunk->m_numUpdates > 0 )
+        {
+            SubmitCurrentChunk();
+        }
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_shouldExit = true;
+        }
+        m_chunkSubmittedCondition.notify_one();
+        m_writerThread.join();
+        m_pFile->Close();
+        EE::Delete( m_pFile );
+
+        EE_LOG_MESSAGE( LogCategory::Animation, "Graph Recording", "Streamed %d updates (%.2f MB) to '%s'", m_numWrittenUpdates, float( m_numBytesWritten ) / ( 1024 * 1024 ), m_filePath.c_str() );
+
+        //-------------------------------------------------------------------------
+
+        EE::Delete( m_pCurrentChunk );
+        EE::Delete( m_pPreviousUpdate );
+        EE::Delete( m_pFrameArchive );
+        m_pendingChunks.clear();
+    }
+
+    void GraphRecordingStreamWriter::WriteRecordedUpdates( GraphRecording& recording )
+    {
+        EE_ASSERT( IsOpen() );
+
+        if ( !m_hasWrittenHeader && !m_hasEncodingError )
+        {
+            m_hasEncodingError = !WriteHeader( recording );
+        }
+
+        // Encode updates - chunks always start at a full state so that each chunk can be decoded by itself
+        //-------------------------------------------------------------------------
+
+        for ( RecordedGraphUpdateData* pUpdateData : recording.m_recordedUpdateData )
+        {
+            if ( !m_hasEncodingError )
+            {
+                bool const isFullStateUpdate = pUpdateData->m_updateType == RecordedUpdateType::FullState || pUpdateData->m_updateType == RecordedUpdateType::Reset;
+                if ( isFullStateUpdate && m_pCurrentChunk->m_numUpdates > 0 )
+                {
+                    SubmitCurrentChunk();
+                }
+
+                if ( m_pCurrentChunk->m_numUpdates == 0 )
+                {
+                    m_pCurrentChunk->m_firstUpdateIdx = m_numWrittenUpdates;
+                    EE::Delete( m_pPreviousUpdate );
+                }
+
+                if ( EncodeUpdate( *m_pFrameArchive, m_parameterTypes, m_pPreviousUpdate, *pUpdateData, recording.m_recordedGraphStates, m_pCurrentChunk->m_archive ) )
+                {
+                    m_pCurrentChunk->m_numUpdates++;
+                    m_numWrittenUpdates++;
+                }
+                else
+                {
+                    EE_LOG_ERROR( LogCategory::Animation, "Graph Recording", "Failed to encode graph update %d, streaming to '%s' stopped", m_numWrittenUpdates, m_filePath.c_str() );
+                    m_hasEncodingError = true;
+                }
+            }
+
+            // Keep the last update around since the next update is encoded relative to it
+            EE::Delete( m_pPreviousUpdate );
+            m_pPreviousUpdate = pUpdateData;
+        }
+
+        recording.m_recordedUpdateData.clear();
+
+        // All graph states are referenced by the updates we just encoded
+        //-------------------------------------------------------------------------
+
+        for ( RecordedGraphState* pGraphState : recording.m_recordedGraphStates )
+        {
+            EE::Delete( pGraphState );
+        }
+        recording.m_recordedGraphStates.clear();
+    }
+
+    bool GraphRecordingStreamWriter::WriteHeader( GraphRecording const& recording )
+    {
+        EE_ASSERT( !m_hasWrittenHeader );
+
+        m_parameterTypes = recording.m_parameterTypes;
+
+        uint32_t const maxRequiredHeaderBits = g_maxFixedHeaderBits + (uint32_t) m_parameterTypes.size() * g_maxBitsPerParameter;
+        if ( maxRequiredHeaderBits >= g_graphRecordingFrameArchiveNumBits )
+        {
+            EE_LOG_ERROR( LogCategory::Animation, "Graph Recording", "Graph '%s' has too many control parameters (%d) to be streamed", recording.m_graphID.c_str(), (int32_t) m_parameterTypes.size() );
+            return false;
+        }
+
+        //-------------------------------------------------------------------------
+
+        TVector<uint8_t> parameterTypes;
+        for ( GraphValueType valueType : m_parameterTypes )
+        {
+            parameterTypes.emplace_back( (uint8_t) valueType );
+        }
+
+        Serialization::BinaryOutputArchive headerArchive;
+        headerArchive << recording.m_graphID << recording.m_variationID << parameterTypes;
+
+        Blob headerData;
+        headerArchive.GetAsBinaryBlob( headerData );
+
+        Blob fileHeader;
+        AppendUInt32( fileHeader, g_fileMagic );
+        AppendUInt32( fileHeader, g_fileVersion );
+        AppendUInt32( fileHeader, (uint32_t) headerData.size() );
+        fileHeader.insert( fileHeader.end(), headerData.begin(), headerData.end() );
+        SubmitData( fileHeader );
+
+        m_hasWrittenHeader = true;
+        return true;
+    }
+
+    void GraphRecordingStreamWriter::SubmitCurrentChunk()
+    {
+        EE_ASSERT( m_pCurrentChunk->m_numUpdates > 0 );
+
+        Blob chunkPayload;
+        m_pCurrentChunk->m_archive.GetAsBinaryBlob( chunkPayload );
+        m_pCurrentChunk->m_archive.Reset();
+
+        Blob chunkData;
+        chunkData.reserve( g_chunkHeaderSize + chunkPayload.size() );
+        AppendUInt32( chunkData, g_chunkMagic );
+        AppendUInt32( chunkData, (uint32_t) m_pCurrentChunk->m_firstUpdateIdx );
+        AppendUInt32( chunkData, (uint32_t) m_pCurrentChunk->m_numUpdates );
+        AppendUInt32( chunkData, (uint32_t) chunkPayload.size() );
+        chunkData.insert( chunkData.end(), chunkPayload.begin(), chunkPayload.end() );
+        SubmitData( chunkData );
+
+        m_pCurrentChunk->m_numUpdates = 0;
+    }
+
+    void GraphRecordingStreamWriter::SubmitData( Blob& data )
+    {
+        size_t const dataSize = data.size();
+
+        {
+            Threading::Lock lock( m_mutex );
+
+            // Block until the writer has caught up, we always allow at least one pending chunk so a chunk larger than the budget can still be written
+            auto CanSubmit = [this, dataSize] () { return m_numPendingBytes == 0 || ( m_numPendingBytes + dataSize ) <= m_memoryBudget; };
+            if ( !CanSubmit() )
+            {
+                m_numWriterStalls++;
+                m_chunkWrittenCondition.wait( lock, CanSubmit );
+            }
+
+            m_numPendingBytes += dataSize;
+            m_pendingChunks.emplace_back( eastl::move( data ) );
+        }
+
+        m_chunkSubmittedCondition.notify_one();
+    }
+
+    void GraphRecordingStreamWriter::WriterThreadFunction()
+    {
+        Threading::SetCurrentThreadName( "Graph Recording Writer" );
+
+        while ( true )
+        {
+            Blob data;
+
+            {
+                Threading::Lock lock( m_mutex );
+                m_chunkSubmittedCondition.wait( lock, [this] () { return m_shouldExit || !m_pendingChunks.empty(); } );
+
+                // Only exit once everything has been written
+                if ( m_pendingChunks.empty() )
+                {
+                    break;
+                }
+
+                data = eastl::move( m_pendingChunks.front() );
+                m_pendingChunks.erase( m_pendingChunks.begin() );
+            }
+
+            // Flush each chunk so that the capture is usable even if the process dies
+            m_pFile->Write( data.data(), data.size() );
+            m_pFile->GetStream().flush();
+            m_numBytesWritten += data.size();
+
+            {
+                Threading::ScopeLock lock( m_mutex );
+                m_numPendingBytes -= data.size();
+            }
+
+            m_chunkWrittenCondition.notify_all();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Reader
+    //-------------------------------------------------------------------------
+
+    GraphRecordingStreamReader::GraphRecordingStreamReader()
+    {
+        m_pFrameArchive = EE::New<GraphRecordingFrameArchive>();
+    }
+
+    GraphRecordingStreamReader::~GraphRecordingStreamReader()
+    {
+        Close();
+        EE::Delete( m_pFrameArchive );
+    }
+
+    bool GraphRecordingStreamReader::Open( FileSystem::Path const& filePath )
+    {
+        EE_ASSERT( !IsOpen() );
+        EE_ASSERT( filePath.IsFilePath() );
+
+        m_pFile = EE::New<FileSystem::InputFileStream>( filePath );
+        if ( !m_pFile->IsValid() )
+        {
+            EE_LOG_ERROR( LogCategory::Animation, "Graph Recording", "Failed to open streamed recording '%s'", filePath.c_str() );
+            EE::Delete( m_pFile );
+            return false;
+        }
+
+        std::ifstream& file = m_pFile->GetStream();
+        file.seekg( 0, std::ios::end );
+        uint64_t const fileSize = (uint64_t) file.tellg();
+        file.seekg( 0, std::ios::beg );
+
+        // Header
+        //-------------------------------------------------------------------------
+
+        uint8_t fileHeader[g_fileHeaderSize];
+        if ( fileSize < g_fileHeaderSize || !file.read( (char*) fileHeader, g_fileHeaderSize ) || ReadUInt32( fileHeader ) != g_fileMagic || ReadUInt32( fileHeader + 4 ) != g_fileVersion )
+        {
+            EE_LOG_ERROR( LogCategory::Animation, "Graph Recording", "'%s' is not a valid streamed recording", filePath.c_str() );
+            Close();
+            return false;
+        }
+
+        uint32_t const headerDataSize = ReadUInt32( fileHeader + 8 );
+        m_chunkData.resize( headerDataSize );
+        if ( ( g_fileHeaderSize + headerDataSize ) > fileSize || !file.read( (char*) m_chunkData.data(), headerDataSize ) )
+        {
+            EE_LOG_ERROR( LogCategory::Animation, "Graph Recording", "'%s' is not a valid streamed recording", filePath.c_str() );
+            Close();
+            return false;
+        }
+
+        TVector<uint8_t> parameterTypes;
+        Serialization::BinaryInputArchive headerArchive;
+        headerArchive.ReadFromBlob( m_chunkData );
+        headerArchive << m_graphID << m_variationID << parameterTypes;
+
+        for ( uint8_t valueType : parameterTypes )
+        {
+            m_parameterTypes.emplace_back( (GraphValueType) valueType );
+        }
+
+        // Build the chunk index - a truncated chunk at the end of the file (i.e. the recording session crashed) is ignored
+        //-------------------------------------------------------------------------
+
+        uint64_t offset = g_fileHeaderSize + headerDataSize;
+        while ( ( offset + g_chunkHeaderSize ) <= fileSize )
+        {
+            uint8_t chunkHeader[g_chunkHeaderSize];
+            file.seekg( offset, std::ios::beg );
+            if ( !file.read( (char*) chunkHeader, g_chunkHeaderSize ) )
+            {
+                break;
+            }
+
+            ChunkInfo chunkInfo;
+            chunkInfo.m_fileOffset = offset + g_chunkHeaderSize;
+            chunkInfo.m_firstUpdateIdx = (int32_t) ReadUInt32( chunkHeader + 4 );
+            chunkInfo.m_numUpdates = (int32_t) ReadUInt32( chunkHeader + 8 );
+            chunkInfo.m_dataSize = ReadUInt32( chunkHeader + 12 );
+
+            bool const isValidChunk = ReadUInt32( chunkHeader ) == g_chunkMagic && chunkInfo.m_firstUpdateIdx == m_numRecordedUpdates && chunkInfo.m_numUpdates > 0;
+            if ( !isValidChunk || ( chunkInfo.m_fileOffset + chunkInfo.m_dataSize ) > fileSize )
+            {
+                break;
+            }
+
+            m_chunks.emplace_back( chunkInfo );
+            m_numRecordedUpdates += chunkInfo.m_numUpdates;
+            offset = chunkInfo.m_fileOffset + chunkInfo.m_dataSize;
+        }
+
+        file.clear();
+
+        if ( m_chunks.empty() )
+        {
+            EE_LOG_WARNING( LogCategory::Animation, "Graph Recording", "Streamed recording '%s' contains no complete chunks", filePath.c_str() );
+            Close();
+            return false;
+        }
+
+        return true;
+    }
+
+    void GraphRecordingStreamReader::Close()
+    {
+        for ( ResidentChunk& residentChunk : m_residentChunks )
+        {
+            ReleaseChunk( residentChunk );
+        }
+
+        if ( m_pFile != nullptr )
+        {
+            m_pFile->Close();
+            EE::Delete( m_pFile );
+        }
+
+        m_graphID.Clear();
+        m_variationID.Clear();
+        m_parameterTypes.clear();
+        m_chunks.clear();
+        m_chunkData.clear();
+        m_numRecordedUpdates = 0;
+        m_usageCounter = 0;
+    }
+
+    RecordedGraphUpdateData const* GraphRecordingStreamReader::GetRecordedUpdate( int32_t updateIdx )
+    {
+        EE_ASSERT( IsValidRecordedUpdateIndex( updateIdx ) );
+
+        int32_t const chunkIdx = FindChunkIndex( updateIdx );
+        ResidentChunk* pChunk = GetResidentChunk( chunkIdx );
+        if ( pChunk == nullptr )
+        {
+            return nullptr;
+        }
+
+        return pChunk->m_updates[updateIdx - m_chunks[chunkIdx].m_firstUpdateIdx];
+    }
+
+    TVector<RecordedGraphState*> const& GraphRecordingStreamReader::GetRecordedGraphStates( int32_t updateIdx )
+    {
+        EE_ASSERT( IsValidRecordedUpdateIndex( updateIdx ) );
+
+        ResidentChunk* pChunk = GetResidentChunk( FindChunkIndex( updateIdx ) );
+        if ( pChunk == nullptr )
+        {
+            static TVector<RecordedGraphState*> const s_noGraphStates;
+            return s_noGraphStates;
+        }
+
+        return pChunk->m_graphStates;
+    }
+
+    TInlineVector<ResourceID, 4> GraphRecordingStreamReader::GetAllRecordedResourceIDs()
+    {
+        EE_ASSERT( IsOpen() );
+
+        TInlineVector<ResourceID, 4> resourceIDs;
+        VectorEmplaceBackUnique( resourceIDs, m_graphID );
+
+        int32_t const numChunks = (int32_t) m_chunks.size();
+        for ( int32_t chunkIdx = 0; chunkIdx < numChunks; chunkIdx++ )
+        {
+            ResidentChunk const* pChunk = GetResidentChunk( chunkIdx );
+            if ( pChunk == nullptr )
+            {
+                continue;
+            }
+
+            for ( RecordedGraphState const* pRecordedGraphState : pChunk->m_graphStates )
+            {
+                VectorEmplaceBackUnique( resourceIDs, pRecordedGraphState->m_graphResourceID );
+            }
+
+            for ( RecordedGraphUpdateData const* pRecordedUpdateData : pChunk->m_updates )
+            {
+                for ( RecordedExternalPoseData const* pRecordedPoseData : pRecordedUpdateData->m_externalPoseData )
+                {
+                    if ( pRecordedPoseData->m_clipResourceID0.IsValid() )
+                    {
+                        VectorEmplaceBackUnique( resourceIDs, pRecordedPoseData->m_clipResourceID0 );
+                    }
+
+                    if ( pRecordedPoseData->m_clipResourceID1.IsValid() )
+                    {
+                        VectorEmplaceBackUnique( resourceIDs, pRecordedPoseData->m_clipResourceID1 );
+                    }
+                }
+
+                for ( ResourceID const& skeletonID : pRecordedUpdateData->m_secondarySkeletons )
+                {
+                    VectorEmplaceBackUnique( resourceIDs, skeletonID );
+                }
+            }
+        }
+
+        return resourceIDs;
+    }
+
+    int32_t GraphRecordingStreamReader::FindChunkIndex( int32_t updateIdx ) const
+    {
+        auto iter = eastl::upper_bound( m_chunks.begin(), m_chunks.end(), updateIdx, [] ( int32_t idx, ChunkInfo const& chunkInfo ) { return idx < chunkInfo.m_firstUpdateIdx; } );
+        EE_ASSERT( iter != m_chunks.begin() );
+        return int32_t( iter - m_chunks.begin() ) - 1;
+    }
+
+    GraphRecordingStreamReader::ResidentChunk* GraphRecordingStreamReader::GetResidentChunk( int32_t chunkIdx )
+    {
+        m_usageCounter++;
+
+        ResidentChunk* pLeastRecentlyUsedChunk = &m_residentChunks[0];
+        for ( ResidentChunk& residentChunk : m_residentChunks )
+        {
+            if ( residentChunk.m_chunkIdx == chunkIdx )
+            {
+                residentChunk.m_lastUsedCounter = m_usageCounter;
+                return &residentChunk;
+            }
+
+            if ( residentChunk.m_lastUsedCounter < pLeastRecentlyUsedChunk->m_lastUsedCounter )
+            {
+                pLeastRecentlyUsedChunk = &residentChunk;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        ReleaseChunk( *pLeastRecentlyUsedChunk );
+
+        if ( !LoadChunk( chunkIdx, *pLeastRecentlyUsedChunk ) )
+        {
+            ReleaseChunk( *pLeastRecentlyUsedChunk );
+            return nullptr;
+        }
+
+        pLeastRecentlyUsedChunk->m_chunkIdx = chunkIdx;
+        pLeastRecentlyUsedChunk->m_lastUsedCounter = m_usageCounter;
+        return pLeastRecentlyUsedChunk;
+    }
+
+    bool GraphRecordingStreamReader::LoadChunk( int32_t chunkIdx, ResidentChunk& outChunk )
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        ChunkInfo const& chunkInfo = m_chunks[chunkIdx];
+
+        m_chunkData.resize( chunkInfo.m_dataSize );
+        std::ifstream& file = m_pFile->GetStream();
+        file.clear();
+        file.seekg( chunkInfo.m_fileOffset, std::ios::beg );
+        if ( !file.read( (char*) m_chunkData.data(), chunkInfo.m_dataSize ) )
+        {
+            EE_LOG_ERROR( LogCategory::Animation, "Graph Recording", "Failed to read recording chunk %d", chunkIdx );
+            return false;
+        }
+
+        Serialization::BinaryInputArchive archive;
+        archive.ReadFromBlob( m_chunkData );
+
+        RecordedGraphUpdateData const* pPreviousUpdate = nullptr;
+        for ( int32_t i = 0; i < chunkInfo.m_numUpdates; i++ )
+        {
+            RecordedGraphUpdateData* pUpdate = outChunk.m_updates.emplace_back( EE::New<RecordedGraphUpdateData>() );
+            if ( !DecodeUpdate( *m_pFrameArchive, m_parameterTypes, pPreviousUpdate, archive, *pUpdate, outChunk.m_graphStates ) )
+            {
+                EE_LOG_ERROR( LogCategory::Animation, "Graph Recording", "Failed to decode recorded update %d", chunkInfo.m_firstUpdateIdx + i );
+                return false;
+            }
+
+            pPreviousUpdate = pUpdate;
+        }
+
+        return true;
+    }
+
+    void GraphRecordingStreamReader::ReleaseChunk( ResidentChunk& chunk )
+    {
+        for ( RecordedGraphUpdateData* pUpdate : chunk.m_updates )
+        {
+            EE::Delete( pUpdate );
+        }
+        chunk.m_updates.clear();
+
+        for ( RecordedGraphState* pGraphState : chunk.m_graphStates )
+        {
+            EE::Delete( pGraphState );
+        }
+        chunk.m_graphStates.clear();
+
+        chunk.m_chunkIdx = InvalidIndex;
+        chunk.m_lastUsedCounter = 0;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+#include "Animation_RuntimeGraph_Recording.h"
+#include "Base/FileSystem/FileStreams.h"
+#include "Base/Threading/Threading.h"
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Streamed Graph Recordings
+//-------------------------------------------------------------------------
+// Long captures cannot be kept in memory, so a graph recording can instead be streamed to disk
+//
+// File Layout:
+//  * File header: magic, version and the recording header (graph ID, variation ID, control parameter types)
+//  * A sequence of self-contained chunks, each chunk starts with a full state (or reset) update so can be decoded without any prior data
+//
+// Within a chunk, each update is delta-encoded against the previous update in that chunk:
+//  * Update info, transforms, sync ranges and control parameters are bit-packed and only written when changed
+//  * Task list topology/data are either skipped (unchanged), written as a list of changed byte runs (same size), or written in full
+//  * Recorded graph states are written in full, they are only present in full state updates
+//
+// There is no index at the end of the file, the chunk headers are scanned on load, so a capture from a crashed session is still readable
+
+namespace EE::Animation
+{
+    struct GraphRecordingChunk;
+
+    // Bit archive used for the per-update delta encoding, sized for the control parameters of very large graphs
+    constexpr static uint32_t const g_graphRecordingFrameArchiveNumBits = 1 << 17;
+    using GraphRecordingFrameArchive = Serialization::TBitArchive<g_graphRecordingFrameArchiveNumBits>;
+
+    //-------------------------------------------------------------------------
+    // Stream Writer
+    //-------------------------------------------------------------------------
+    // Encodes the recorded updates and hands off completed chunks to a background thread that writes them to disk
+    // The amount of encoded data waiting to be written is bounded, if the writer falls behind the recording thread will block
+
+    class EE_ENGINE_API GraphRecordingStreamWriter
+    {
+    public:
+
+        constexpr static size_t const s_defaultMemoryBudget = 32 * 1024 * 1024;
+
+    public:
+
+        GraphRecordingStreamWriter();
+        GraphRecordingStreamWriter( GraphRecordingStreamWriter const& ) = delete;
+        ~GraphRecordingStreamWriter();
+
+        GraphRecordingStreamWriter& operator=( GraphRecordingStreamWriter const& ) = delete;
+
+        // Open the output file and start the writer thread
+        bool Open( FileSystem::Path const& filePath, size_t memoryBudget = s_defaultMemoryBudget );
+
+        // Flush the current chunk, wait for all pending data to be written and close the file
+        void Close();
+
+        inline bool IsOpen() const { return m_pFile != nullptr; }
+
+        // Encode all updates in the supplied recording and remove them from it
+        // Only call this once all the updates in the recording are complete (i.e. no more data will be recorded into them)
+        void WriteRecordedUpdates( GraphRecording& recording );
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        inline int32_t GetNumWrittenUpdates() const { return m_numWrittenUpdates; }
+        inline size_t GetNumBytesWritten() const { return m_numBytesWritten; }
+        inline int32_t GetNumWriterStalls() const { return m_numWriterStalls; }
+
+    private:
+
+        bool WriteHeader( GraphRecording const& recording );
+        void SubmitCurrentChunk();
+        void SubmitData( Blob& data );
+        void WriterThreadFunction();
+
+    private:
+
+        FileSystem::OutputFileStream*                       m_pFile = nullptr;
+        FileSystem::Path                                    m_filePath;
+        size_t                                              m_memoryBudget = s_defaultMemoryBudget;
+        bool                                                m_hasWrittenHeader = false;
+        bool                                                m_hasEncodingError = false;
+        TVector<GraphValueType>                             m_parameterTypes;
+
+        // Encoding - only touched by the recording thread
+        GraphRecordingChunk*                                m_pCurrentChunk = nullptr;
+        RecordedGraphUpdateData*                            m_pPreviousUpdate = nullptr;
+        GraphRecordingFrameArchive*                         m_pFrameArchive = nullptr;
+        int32_t                                             m_numWrittenUpdates = 0;
+
+        // Writer thread
+        Threading::Thread                                   m_writerThread;
+        Threading::Mutex                                    m_mutex;
+        Threading::ConditionVariable                        m_chunkSubmittedCondition;
+        Threading::ConditionVariable                        m_chunkWrittenCondition;
+        TVector<Blob>                                       m_pendingChunks;
+        size_t                                              m_numPendingBytes = 0;
+        bool                                                m_shouldExit = false;
+        std::atomic<size_t>                                 m_numBytesWritten = 0;
+        std::atomic<int32_t>                                m_numWriterStalls = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Stream Reader
+    //-------------------------------------------------------------------------
+    // Provides random access to a streamed recording, chunks are decoded on demand and a small number are kept resident
+
+    class EE_ENGINE_API GraphRecordingStreamReader
+    {
+        constexpr static int32_t const s_maxResidentChunks = 3;
+
+        struct ChunkInfo
+        {
+            uint64_t                                        m_fileOffset = 0;
+            uint32_t                                        m_dataSize = 0;
+            int32_t                                         m_firstUpdateIdx = 0;
+            int32_t                                         m_numUpdates = 0;
+        };
+
+        struct ResidentChunk
+        {
+            int32_t                                         m_chunkIdx = InvalidIndex;
+            uint64_t                                        m_lastUsedCounter = 0;
+            TVector<RecordedGraphUpdateData*>               m_updates;
+            TVector<RecordedGraphState*>                    m_graphStates;
+        };
+
+    public:
+
+        GraphRecordingStreamReader();
+        GraphRecordingStreamReader( GraphRecordingStreamReader const& ) = delete;
+        ~GraphRecordingStreamReader();
+
+        GraphRecordingStreamReader& operator=( GraphRecordingStreamReader const& ) = delete;
+
+        // Open a streamed recording - reads the header and builds the chunk index
+        bool Open( FileSystem::Path const& filePath );
+        void Close();
+
+        inline bool IsOpen() const { return m_pFile != nullptr; }
+
+        inline ResourceID const& GetRecordedGraphID() const { return m_graphID; }
+        inline StringID GetRecordedGraphVariationID() const { return m_variationID; }
+        inline int32_t GetNumRecordedUpdates() const { return m_numRecordedUpdates; }
+        inline bool IsValidRecordedUpdateIndex( int32_t updateIdx ) const { return updateIdx >= 0 && updateIdx < m_numRecordedUpdates; }
+
+        // Get the data for a recorded update, this will load the chunk containing the update if needed
+        // Returns nullptr on failure, the returned data is valid until more than 's_maxResidentChunks' other chunks have been accessed
+        RecordedGraphUpdateData const* GetRecordedUpdate( int32_t updateIdx );
+
+        // Get the graph states referenced by a recorded update (i.e. what 'm_recordedGraphStateIdx' indexes into)
+        TVector<RecordedGraphState*> const& GetRecordedGraphStates( int32_t updateIdx );
+
+        // Get all the graphs, external clips and secondary skeletons referenced by the recording
+        // Note: this decodes every chunk in the file, so only call this once when starting to review the recording
+        TInlineVector<ResourceID, 4> GetAllRecordedResourceIDs();
+
+    private:
+
+        int32_t FindChunkIndex( int32_t updateIdx ) const;
+        ResidentChunk* GetResidentChunk( int32_t chunkIdx );
+        bool LoadChunk( int32_t chunkIdx, ResidentChunk& outChunk );
+        void ReleaseChunk( ResidentChunk& chunk );
+
+    private:
+
+        FileSystem::InputFileStream*                        m_pFile = nullptr;
+        ResourceID                                          m_graphID;
+        StringID                                            m_variationID;
+        TVector<GraphValueType>                             m_parameterTypes;
+        TVector<ChunkInfo>                                  m_chunks;
+        int32_t                                             m_numRecordedUpdates = 0;
+        ResidentChunk                                       m_residentChunks[s_maxResidentChunks];
+        uint64_t                                            m_usageCounter = 0;
+        Blob                                                m_chunkData;
+        GraphRecordingFrameArchive*                         m_pFrameArchive = nullptr;
+    };
+}
\ No newline at end of file
@@ -164,6 +164,7 @@ namespace EE::Animation
         }
 
         m_currentTime = m_previousTime = 0.0f;
+        m_keyCursor.Reset();
         AnimationClipReferenceNode::ShutdownInternal( context );
     }
 
@@ -408,7 +409,7 @@ namespace EE::Animation
             sampleTime = m_pAnimation->GetPercentageThrough( frameIndex );
         }
 
-        result.m_taskIdx = context.GetTaskSystem()->RegisterTask<SampleTask>( GetNodePath( context ), m_pAnimation, sampleTime );
+        result.m_taskIdx = context.GetTaskSystem()->RegisterTask<SampleTask>( GetNodePath( context ), m_pAnimation, sampleTime, &m_keyCursor );
 
         //-------------------------------------------------------------------------
 
@@ -75,6 +75,7 @@ namespace EE::Animation
         BoolValueNode*                                  m_pPlayInReverseValueNode = nullptr;
         BoolValueNode*                                  m_pResetTimeValueNode = nullptr;
         SyncTrack*                                      m_pSyncTrack = nullptr;
+        KeyframeReducedCursor                           m_keyCursor;
         bool                                            m_shouldPlayInReverse = false;
         bool                                            m_shouldSampleRootMotion = true;
         bool                                            m_isFirstUpdate = true;
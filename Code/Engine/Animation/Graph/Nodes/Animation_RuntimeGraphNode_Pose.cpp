@@ -102,6 +102,7 @@ namespace EE::Animation
             m_pPoseTimeValue->Shutdown( context );
         }
 
+        m_keyCursor.Reset();
         PoseNode::ShutdownInternal( context );
     }
 
@@ -151,7 +152,7 @@ namespace EE::Animation
             m_previousTime = m_currentTime;
         }
 
-        result.m_taskIdx = context.GetTaskSystem()->RegisterTask<SampleTask>( GetNodePath( context ), m_pAnimation, Percentage( m_currentTime ) );
+        result.m_taskIdx = context.GetTaskSystem()->RegisterTask<SampleTask>( GetNodePath( context ), m_pAnimation, Percentage( m_currentTime ), &m_keyCursor );
         return result;
     }
 }
\ No newline at end of file
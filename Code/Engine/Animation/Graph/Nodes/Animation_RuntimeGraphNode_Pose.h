@@ -81,5 +81,6 @@ namespace EE::Animation
 
         FloatValueNode*                         m_pPoseTimeValue = nullptr;
         AnimationClip const*                    m_pAnimation = nullptr;
+        KeyframeReducedCursor                   m_keyCursor;
     };
 }
\ No newline at end of file
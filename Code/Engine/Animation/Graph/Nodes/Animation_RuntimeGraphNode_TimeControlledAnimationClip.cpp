@@ -81,6 +81,7 @@ namespace EE::Animation
         m_pTimeValueNode->Shutdown( context );
 
         m_currentTime = m_previousTime = 0.0f;
+        m_keyCursor.Reset();
         PoseNode::ShutdownInternal( context );
     }
 
@@ -302,7 +303,7 @@ namespace EE::Animation
             sampleTime = m_pAnimation->GetPercentageThrough( frameIndex );
         }
 
-        result.m_taskIdx = context.GetTaskSystem()->RegisterTask<SampleTask>( GetNodePath( context ), m_pAnimation, sampleTime );
+        result.m_taskIdx = context.GetTaskSystem()->RegisterTask<SampleTask>( GetNodePath( context ), m_pAnimation, sampleTime, &m_keyCursor );
 
         //-------------------------------------------------------------------------
 
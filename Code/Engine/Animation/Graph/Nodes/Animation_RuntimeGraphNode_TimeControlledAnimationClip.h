@@ -51,6 +51,7 @@ namespace EE::Animation
         AnimationClip const*                            m_pAnimation = nullptr;
         FloatValueNode*                                 m_pTimeValueNode = nullptr;
         BoolValueNode*                                  m_pPlayInReverseValueNode = nullptr;
+        KeyframeReducedCursor                           m_keyCursor;
         bool                                            m_shouldPlayInReverse = false;
         bool                                            m_isFirstUpdate = true;
         bool                                            m_hasLooped = false;
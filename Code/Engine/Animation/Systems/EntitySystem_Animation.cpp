@@ -1,4 +1,5 @@
 #include "EntitySystem_Animation.h"
+#include "WorldSystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationClipPlayer.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "Engine/Render/Components/Component_SkeletalMesh.h"
@@ -12,10 +13,27 @@
 
 namespace EE::Animation
 {
+    // Do any of the components in this entity's hierarchy have children in other entities
+    static bool HasExternalSpatialChildren( SpatialEntityComponent const* pComponent )
+    {
+        for ( SpatialEntityComponent const* pChild : pComponent->GetSpatialChildren() )
+        {
+            if ( pChild->GetEntityID() != pComponent->GetEntityID() || HasExternalSpatialChildren( pChild ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+
     AnimationSystem::~AnimationSystem()
     {
         EE_ASSERT( m_animGraphs.empty() && m_animPlayers.empty() && m_meshComponents.empty() );
         EE_ASSERT( m_pRootComponent == nullptr );
+        EE_ASSERT( !m_isPoseTaskExecutionDeferred );
     }
 
     //-------------------------------------------------------------------------
@@ -100,17 +118,10 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
-        if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
+        // If the pose tasks were deferred, the world system is responsible for the rest of the post-physics update
+        if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics && !m_isPoseTaskExecutionDeferred )
         {
-            for ( auto pMeshComponent : m_meshComponents )
-            {
-                if ( !pMeshComponent->HasMeshResourceSet() )
-                {
-                    continue;
-                }
-
-                pMeshComponent->FinalizePose();
-            }
+            FinalizeMeshPoses();
         }
     }
 
@@ -170,6 +181,11 @@ namespace EE::Animation
         {
             auto pPhysicsWorldSystem = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>();
 
+            // Check whether we can move the pose task execution to the world system
+            AnimationWorldSystem* pAnimationWorldSystem = ctx.GetWorldSystem<AnimationWorldSystem>();
+            bool const shouldDeferPoseTasks = pAnimationWorldSystem != nullptr && pAnimationWorldSystem->IsParallelPoseTaskExecutionEnabled() && CanDeferPoseTaskExecution();
+            EE_ASSERT( m_deferredGraphUpdates.empty() );
+
             //-------------------------------------------------------------------------
 
             for ( auto pAnimComponent : m_animGraphs )
@@ -181,6 +197,21 @@ namespace EE::Animation
 
                 if ( !pAnimComponent->RequiresManualUpdate() )
                 {
+                    // Reduced-rate graphs reuse their last evaluated poses on skipped frames, we only need to apply the extrapolated root motion
+                    if ( !pAnimComponent->ShouldEvaluateGraph() )
+                    {
+                        pAnimComponent->SkipGraphEvaluation( ctx.GetDeltaTime() );
+
+                        if ( m_pRootComponent != nullptr && pAnimComponent->ShouldApplyRootMotionToEntity() )
+                        {
+                            Transform worldTransform = m_pRootComponent->GetWorldTransform();
+                            worldTransform = pAnimComponent->GetRootMotionDelta() * worldTransform;
+                            m_pRootComponent->SetWorldTransform( worldTransform );
+                        }
+
+                        continue;
+                    }
+
                     // Evaluate the graph nodes and calculate the root motion delta
                     pAnimComponent->EvaluateGraph( ctx.GetDeltaTime(), characterWorldTransform, pPhysicsWorldSystem->GetPhysicsWorld() );
 
@@ -198,48 +229,87 @@ namespace EE::Animation
                     }
 
                     // Calculate pose tasks
-                    pAnimComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), adjustedCharacterTransform );
+                    if ( shouldDeferPoseTasks )
+                    {
+                        m_deferredGraphUpdates.emplace_back( pAnimComponent, ctx.GetDeltaTime(), adjustedCharacterTransform );
+                    }
+                    else
+                    {
+                        pAnimComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), adjustedCharacterTransform );
+                    }
+                }
+            }
+
+            // Schedule the deferred tasks, if we fail to schedule them just execute them now
+            if ( !m_deferredGraphUpdates.empty() )
+            {
+                m_isPoseTaskExecutionDeferred = pAnimationWorldSystem->TryDeferPoseTaskExecution( this );
+                if ( !m_isPoseTaskExecutionDeferred )
+                {
+                    ExecuteDeferredPrePhysicsTasks( nullptr );
                 }
             }
         }
         else if ( updateStage == UpdateStage::PostPhysics )
         {
-            for ( auto pAnimComponent : m_animGraphs )
+            if ( !m_isPoseTaskExecutionDeferred )
             {
-                if ( !pAnimComponent->HasGraph() )
-                {
-                    continue;
-                }
+                UpdateAnimGraphsPostPhysics( nullptr );
+            }
+        }
+    }
 
-                // Calculate the final pose tasks
-                if ( !pAnimComponent->RequiresManualUpdate() )
-                {
-                    pAnimComponent->ExecutePostPhysicsTasks();
-                }
+    void AnimationSystem::UpdateAnimGraphsPostPhysics( PoseBufferArena* pArena )
+    {
+        for ( auto pAnimComponent : m_animGraphs )
+        {
+            if ( !pAnimComponent->HasGraph() )
+            {
+                continue;
+            }
 
-                // Set PrimaryPose
-                //-------------------------------------------------------------------------
-                // Note:    for components requiring manual update, the users need to ensure the manual update occurs before this update
-                //          This update is already set to the lowest priority so in general users wont need to do anything
+            // Calculate the final pose tasks (skipped frames have no tasks to execute)
+            // We need to use the pre-physics decision here, as evaluating the graph clears any forced evaluation (i.e. first evaluation or state reset)
+            if ( !pAnimComponent->RequiresManualUpdate() && pAnimComponent->WasGraphEvaluatedThisFrame() )
+            {
+                pAnimComponent->ExecutePostPhysicsTasks( pArena );
+            }
 
-                auto const* pPrimaryPose = pAnimComponent->GetPrimaryPose();
-                EE_ASSERT( pPrimaryPose->HasModelSpaceTransforms() );
-                TransferAnimationPoseToMesh( pPrimaryPose );
+            // Set PrimaryPose
+            //-------------------------------------------------------------------------
+            // Note:    for components requiring manual update, the users need to ensure the manual update occurs before this update
+            //          This update is already set to the lowest priority so in general users wont need to do anything
 
-                // Transfer secondary poses
-                //-------------------------------------------------------------------------
+            auto const* pPrimaryPose = pAnimComponent->GetPresentationPose();
+            EE_ASSERT( pPrimaryPose->HasModelSpaceTransforms() );
+            TransferAnimationPoseToMesh( pPrimaryPose );
 
-                if ( pAnimComponent->HasSecondaryPoses() )
+            // Transfer secondary poses
+            //-------------------------------------------------------------------------
+
+            if ( pAnimComponent->HasSecondaryPoses() )
+            {
+                for ( auto pSecondaryPose : pAnimComponent->GetSecondaryPoses() )
                 {
-                    for ( auto pSecondaryPose : pAnimComponent->GetSecondaryPoses() )
-                    {
-                        TransferAnimationPoseToMesh( pSecondaryPose );
-                    }
+                    TransferAnimationPoseToMesh( pSecondaryPose );
                 }
             }
         }
     }
 
+    void AnimationSystem::FinalizeMeshPoses()
+    {
+        for ( auto pMeshComponent : m_meshComponents )
+        {
+            if ( !pMeshComponent->HasMeshResourceSet() )
+            {
+                continue;
+            }
+
+            pMeshComponent->FinalizePose();
+        }
+    }
+
     void AnimationSystem::TransferAnimationPoseToMesh( Pose const * pPose )
     {
         for ( auto pMeshComponent : m_meshComponents )
@@ -257,4 +327,42 @@ namespace EE::Animation
             pMeshComponent->SetPose( pPose );
         }
     }
+
+    //-------------------------------------------------------------------------
+
+    bool AnimationSystem::CanDeferPoseTaskExecution() const
+    {
+        // Attached entities read our sockets as part of their own update, so we need to have our final pose before they are updated
+        if ( m_pRootComponent != nullptr )
+        {
+            if ( m_pRootComponent->HasSpatialParent() || HasExternalSpatialChildren( m_pRootComponent ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void AnimationSystem::ExecuteDeferredPrePhysicsTasks( PoseBufferArena* pArena )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Animation System: Deferred Pre-Physics Tasks" );
+
+        for ( DeferredGraphUpdate const& deferredUpdate : m_deferredGraphUpdates )
+        {
+            deferredUpdate.m_pComponent->ExecutePrePhysicsTasks( deferredUpdate.m_deltaTime, deferredUpdate.m_characterWorldTransform, pArena );
+        }
+
+        m_deferredGraphUpdates.clear();
+    }
+
+    void AnimationSystem::ExecuteDeferredPostPhysicsUpdate( PoseBufferArena* pArena )
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Animation System: Deferred Post-Physics Update" );
+        EE_ASSERT( m_isPoseTaskExecutionDeferred );
+
+        UpdateAnimGraphsPostPhysics( pArena );
+        FinalizeMeshPoses();
+        m_isPoseTaskExecutionDeferred = false;
+    }
 }
\ No newline at end of file
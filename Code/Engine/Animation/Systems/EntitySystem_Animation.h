@@ -2,12 +2,13 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntitySystem.h"
+#include "Base/Math/Transform.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
-    class Transform;
     class SpatialEntityComponent;
 }
 
@@ -22,14 +23,31 @@ namespace EE::Animation
 {
     class GraphComponent;
     class AnimationClipPlayerComponent;
+    class AnimationWorldSystem;
+    class PoseBufferArena;
     class Pose;
 
     //-------------------------------------------------------------------------
 
     class EE_ENGINE_API AnimationSystem : public EntitySystem
     {
+        friend class AnimationWorldSystem;
+
         EE_ENTITY_SYSTEM( AnimationSystem, RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Low ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Low ) );
 
+        struct DeferredGraphUpdate
+        {
+            DeferredGraphUpdate( GraphComponent* pComponent, Seconds deltaTime, Transform const& characterWorldTransform )
+                : m_pComponent( pComponent )
+                , m_deltaTime( deltaTime )
+                , m_characterWorldTransform( characterWorldTransform )
+            {}
+
+            GraphComponent*                             m_pComponent = nullptr;
+            Seconds                                     m_deltaTime;
+            Transform                                   m_characterWorldTransform;
+        };
+
     public:
 
         virtual ~AnimationSystem();
@@ -42,14 +60,25 @@ namespace EE::Animation
 
         void UpdateAnimPlayers( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
         void UpdateAnimGraphs( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
+        void UpdateAnimGraphsPostPhysics( PoseBufferArena* pArena );
+        void FinalizeMeshPoses();
 
         void TransferAnimationPoseToMesh( Pose const * pPose );
 
+        // Can the pose task execution for this entity be moved out of the entity update
+        bool CanDeferPoseTaskExecution() const;
+
+        // Deferred pose task execution - called by the world system on a worker thread
+        void ExecuteDeferredPrePhysicsTasks( PoseBufferArena* pArena );
+        void ExecuteDeferredPostPhysicsUpdate( PoseBufferArena* pArena );
+
     private:
 
         TVector<AnimationClipPlayerComponent*>          m_animPlayers;
         TVector<GraphComponent*>                        m_animGraphs;
         TVector<Render::SkeletalMeshComponent*>         m_meshComponents;
         SpatialEntityComponent*                         m_pRootComponent = nullptr;
+        TInlineVector<DeferredGraphUpdate, 1>           m_deferredGraphUpdates;
+        bool                                            m_isPoseTaskExecutionDeferred = false;
     };
 }
\ No newline at end of file
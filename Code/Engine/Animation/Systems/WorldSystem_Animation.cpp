@@ -1,15 +1,42 @@
 #include "WorldSystem_Animation.h"
+#include "EntitySystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Engine/Entity/Entity.h"
+#include "Engine/Viewport/Viewport.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Systems.h"
+#include "Base/Profiling.h"
+#include <EASTL/sort.h>
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    void AnimationWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<EE::TaskSystem>();
+
+        // One arena per thread that can execute our jobs (all workers + main thread)
+        uint32_t const numThreads = ( m_pTaskSystem != nullptr ) ? m_pTaskSystem->GetNumWorkers() + 1 : 1;
+        for ( uint32_t i = 0; i < numThreads; i++ )
+        {
+            m_poseBufferArenas.emplace_back( EE::New<PoseBufferArena>() );
+        }
+    }
+
     void AnimationWorldSystem::ShutdownSystem()
     {
         EE_ASSERT( m_graphComponents.empty() );
+        EE_ASSERT( m_updateRateLODRecords.empty() );
+        EE_ASSERT( m_numDeferredUpdates == 0 );
+
+        for ( PoseBufferArena*& pArena : m_poseBufferArenas )
+        {
+            EE::Delete( pArena );
+        }
+        m_poseBufferArenas.clear();
     }
 
     void AnimationWorldSystem::RegisterComponent( Entity* pEntity, EntityComponent* pComponent )
@@ -17,6 +44,14 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<GraphComponent>( pComponent ) )
         {
             m_graphComponents.Add( pGraphComponent );
+            pGraphComponent->SetPoseSampleCache( &m_poseSampleCache );
+
+            // Each entity can only defer its update once per frame so we never need more slots than we have graph components
+            // Registration never occurs during the entity update, so it is safe to resize here
+            m_deferredUpdates.resize( m_graphComponents.size() );
+
+            // Graphs on non-spatial entities have no significance and are always evaluated at the full rate
+            m_updateRateLODRecords.Emplace( pGraphComponent->GetID(), pGraphComponent, pGraphComponent->GetID(), pEntity->GetRootSpatialComponent() );
         }
     }
 
@@ -25,11 +60,276 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<GraphComponent>( pComponent ) )
         {
             m_graphComponents.Remove( pGraphComponent->GetID() );
+            m_updateRateLODRecords.Remove( pGraphComponent->GetID() );
+            pGraphComponent->SetUpdateRateLOD( 1, true );
+            pGraphComponent->SetPoseSampleCache( nullptr );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool AnimationWorldSystem::TryDeferPoseTaskExecution( AnimationSystem* pAnimationSystem )
+    {
+        EE_ASSERT( pAnimationSystem != nullptr );
+
+        int32_t const slotIdx = m_numDeferredUpdates.fetch_add( 1 );
+        if ( slotIdx >= (int32_t) m_deferredUpdates.size() )
+        {
+            // Out of slots (i.e. components not yet registered with the world), the caller will execute the tasks inline
+            m_numDeferredUpdates.fetch_sub( 1 );
+            return false;
+        }
+
+        m_deferredUpdates[slotIdx] = pAnimationSystem;
+        return true;
+    }
+
+    void AnimationWorldSystem::ExecuteDeferredPoseTasks( UpdateStage updateStage )
+    {
+        struct DeferredPoseTaskJob final : public ITaskSet
+        {
+            DeferredPoseTaskJob( TVector<AnimationSystem*> const& deferredUpdates, int32_t numDeferredUpdates, TVector<PoseBufferArena*> const& arenas, UpdateStage updateStage )
+                : m_deferredUpdates( deferredUpdates )
+                , m_arenas( arenas )
+                , m_updateStage( updateStage )
+            {
+                m_SetSize = (uint32_t) numDeferredUpdates;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_ASSERT( threadnum < m_arenas.size() );
+                PoseBufferArena* pArena = m_arenas[threadnum];
+
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    if ( m_updateStage == UpdateStage::PrePhysics )
+                    {
+                        m_deferredUpdates[i]->ExecuteDeferredPrePhysicsTasks( pArena );
+                    }
+                    else
+                    {
+                        m_deferredUpdates[i]->ExecuteDeferredPostPhysicsUpdate( pArena );
+                    }
+                }
+            }
+
+        private:
+
+            TVector<AnimationSystem*> const&                m_deferredUpdates;
+            TVector<PoseBufferArena*> const&                m_arenas;
+            UpdateStage                                     m_updateStage;
+        };
+
+        //-------------------------------------------------------------------------
+
+        int32_t const numDeferredUpdates = m_numDeferredUpdates;
+        EE_ASSERT( numDeferredUpdates <= (int32_t) m_deferredUpdates.size() );
+
+        // All borrowed buffers from the previous frame have been returned, so the arenas can be reused
+        if ( updateStage == UpdateStage::PrePhysics )
+        {
+            for ( PoseBufferArena* pArena : m_poseBufferArenas )
+            {
+                pArena->Reset();
+            }
+        }
+
+        if ( numDeferredUpdates > 0 )
+        {
+            DeferredPoseTaskJob job( m_deferredUpdates, numDeferredUpdates, m_poseBufferArenas, updateStage );
+            if ( m_pTaskSystem != nullptr )
+            {
+                m_pTaskSystem->ScheduleTask( &job );
+                m_pTaskSystem->WaitForTask( &job );
+            }
+            else
+            {
+                job.ExecuteRange( { 0u, (uint32_t) numDeferredUpdates }, 0 );
+            }
+        }
+
+        // The post-physics update completes all deferred work for this frame
+        if ( updateStage == UpdateStage::PostPhysics )
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            m_numDeferredUpdatesForLastFrame = numDeferredUpdates;
+            #endif
+
+            m_numDeferredUpdates = 0;
         }
     }
 
+    #if EE_DEVELOPMENT_TOOLS
+    int32_t AnimationWorldSystem::GetNumAllocatedArenaPoseBuffers() const
+    {
+        int32_t numBuffers = 0;
+        for ( PoseBufferArena const* pArena : m_poseBufferArenas )
+        {
+            numBuffers += pArena->GetNumAllocatedBuffers();
+        }
+        return numBuffers;
+    }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::UpdateGraphUpdateRates( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_FUNCTION_ANIMATION();
+
+        UpdateRateLODSettings const& settings = m_updateRateLODSettings;
+        TInlineVector<Viewport*, 3> const& viewports = ctx.GetViewports();
+        m_updateRateLODFrameIdx++;
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_numFullRateGraphs = 0;
+        m_numReducedRateGraphs = 0;
+        m_numScheduledGraphEvaluations = 0;
+        #endif
+
+        // Without any viewports we have no way to determine significance, so everything is evaluated at the full rate
+        if ( !settings.m_isEnabled || viewports.empty() )
+        {
+            for ( UpdateRateLODRecord& record : m_updateRateLODRecords )
+            {
+                record.m_updateInterval = 1;
+                record.m_pGraphComponent->SetUpdateRateLOD( 1, true );
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_numFullRateGraphs = m_updateRateLODRecords.size();
+            m_numScheduledGraphEvaluations = m_updateRateLODRecords.size();
+            #endif
+            return;
+        }
+
+        // Calculate the desired update interval for each graph
+        //-------------------------------------------------------------------------
+
+        int32_t const maxUpdateInterval = Math::Max( settings.m_maxUpdateInterval, 1 );
+        int32_t const offscreenUpdateInterval = Math::Clamp( settings.m_offscreenUpdateInterval, 1, maxUpdateInterval );
+        float const distancePerIntervalStep = Math::Max( settings.m_distancePerIntervalStep, 0.01f );
+
+        m_fullRateCandidates.clear();
+        for ( int32_t i = 0; i < m_updateRateLODRecords.size(); i++ )
+        {
+            UpdateRateLODRecord& record = m_updateRateLODRecords[i];
+            record.m_updateInterval = 1;
+            record.m_distance = 0.0f;
+
+            GraphComponent const* pGraphComponent = record.m_pGraphComponent;
+            if ( record.m_pSpatialComponent == nullptr || !pGraphComponent->HasGraphInstance() || pGraphComponent->RequiresManualUpdate() )
+            {
+                continue;
+            }
+
+            //-------------------------------------------------------------------------
+
+            AABB const bounds( record.m_pSpatialComponent->GetWorldBounds() );
+            Vector const position = record.m_pSpatialComponent->GetPosition();
+
+            bool isVisible = false;
+            float distance = FLT_MAX;
+            for ( Viewport const* pViewport : viewports )
+            {
+                distance = Math::Min( distance, position.GetDistance3( pViewport->GetViewPosition() ) );
+                isVisible = isVisible || pViewport->GetViewVolume().Contains( bounds );
+            }
+
+            record.m_distance = distance;
+
+            if ( isVisible )
+            {
+                float const distanceBeyondFullRate = Math::Max( distance - settings.m_fullRateDistance, 0.0f );
+                int32_t const numIntervalSteps = (int32_t) Math::Ceiling( distanceBeyondFullRate / distancePerIntervalStep );
+                record.m_updateInterval = Math::Min( 1 + numIntervalSteps, maxUpdateInterval );
+            }
+            else
+            {
+                record.m_updateInterval = offscreenUpdateInterval;
+            }
+
+            if ( record.m_updateInterval == 1 )
+            {
+                m_fullRateCandidates.emplace_back( i );
+            }
+        }
+
+        // Enforce the full-rate budget, the least significant (i.e. furthest) graphs are demoted
+        //-------------------------------------------------------------------------
+
+        int32_t const maxFullRateGraphs = Math::Max( settings.m_maxFullRateGraphs, 0 );
+        if ( (int32_t) m_fullRateCandidates.size() > maxFullRateGraphs && maxUpdateInterval > 1 )
+        {
+            auto comparator = [this] ( int32_t a, int32_t b )
+            {
+                return m_updateRateLODRecords[a].m_distance < m_updateRateLODRecords[b].m_distance;
+            };
+
+            eastl::nth_element( m_fullRateCandidates.begin(), m_fullRateCandidates.begin() + maxFullRateGraphs, m_fullRateCandidates.end(), comparator );
+
+            for ( int32_t i = maxFullRateGraphs; i < (int32_t) m_fullRateCandidates.size(); i++ )
+            {
+                m_updateRateLODRecords[m_fullRateCandidates[i]].m_updateInterval = 2;
+            }
+        }
+
+        // Schedule the evaluations for the next frame
+        //-------------------------------------------------------------------------
+
+        for ( UpdateRateLODRecord& record : m_updateRateLODRecords )
+        {
+            bool const shouldEvaluateGraph = ( ( m_updateRateLODFrameIdx + record.m_updatePhase ) % (uint32_t) record.m_updateInterval ) == 0;
+            record.m_pGraphComponent->SetUpdateRateLOD( record.m_updateInterval, shouldEvaluateGraph );
+
+            #if EE_DEVELOPMENT_TOOLS
+            if ( record.m_updateInterval == 1 )
+            {
+                m_numFullRateGraphs++;
+            }
+            else
+            {
+                m_numReducedRateGraphs++;
+            }
+
+            if ( shouldEvaluateGraph )
+            {
+                m_numScheduledGraphEvaluations++;
+            }
+            #endif
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        UpdateStage const updateStage = ctx.GetUpdateStage();
+        if ( updateStage == UpdateStage::PrePhysics )
+        {
+            EE_PROFILE_SCOPE_ANIMATION( "Animation World System: Pre-Physics Pose Tasks" );
+            ExecuteDeferredPoseTasks( updateStage );
+            return;
+        }
+        else if ( updateStage == UpdateStage::PostPhysics )
+        {
+            EE_PROFILE_SCOPE_ANIMATION( "Animation World System: Post-Physics Pose Tasks" );
+            ExecuteDeferredPoseTasks( updateStage );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( updateStage == UpdateStage::FrameEnd )
+        {
+            // All pose tasks for this frame have completed, so the sampled poses are no longer needed
+            m_poseSampleCache.Reset();
+            UpdateGraphUpdateRates( ctx );
+        }
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         DebugDrawContext drawingCtx = ctx.GetDebugDrawContext();
         for ( auto pComponent : m_graphComponents )
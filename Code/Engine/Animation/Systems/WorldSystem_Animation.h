@@ -2,15 +2,40 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Animation/TaskSystem/Animation_PoseSampleCache.h"
 #include "Base/Types/IDVector.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class TaskSystem;
+    class SpatialEntityComponent;
+}
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
     class GraphComponent;
+    class AnimationSystem;
+    class PoseBufferArena;
 
     //-------------------------------------------------------------------------
+    // Animation World System
+    //-------------------------------------------------------------------------
+    // Besides tracking all graph components, this system is responsible for executing the pose tasks for all characters
+    //
+    // The per-entity animation systems evaluate their graphs (and apply root motion) as part of the regular entity update and then
+    // defer the execution of the pose tasks to this system. Once all entities have been updated, we execute all the deferred pose tasks
+    // as a single wide job, so that the expensive part of the animation update is not bound by the entity update granularity.
+    // Each worker thread has its own pose buffer arena so the transient pose buffers are shared between all characters on that thread.
+    // All characters also share a per-frame pose sample cache, so identical clip samples are only decoded once per frame.
+    //
+    // This system also drives the update-rate LOD: at the end of each frame we rank all graphs by their significance (distance to the
+    // closest viewport and visibility) and assign each an update interval. Reduced-rate graphs are only evaluated every Nth frame, with
+    // the evaluation frames staggered across instances so that the cost is spread evenly over the interval.
 
     class EE_ENGINE_API AnimationWorldSystem : public EntityWorldSystem
     {
@@ -18,21 +43,109 @@ namespace EE::Animation
 
     public:
 
-        EE_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ), RequiresUpdate( UpdateStage::Paused ) );
+        EE_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::FrameEnd ), RequiresUpdate( UpdateStage::Paused ) );
+
+    public:
+
+        // Per-world budget for the update-rate LOD
+        struct UpdateRateLODSettings
+        {
+            bool                                        m_isEnabled = true;
+            float                                       m_fullRateDistance = 15.0f;                 // Visible characters closer than this are evaluated every frame (budget permitting)
+            float                                       m_distancePerIntervalStep = 15.0f;          // Every step of this distance beyond the full-rate distance adds a frame to the update interval
+            int32_t                                     m_maxUpdateInterval = 4;                    // The maximum number of frames between evaluations for visible characters
+            int32_t                                     m_offscreenUpdateInterval = 4;              // The number of frames between evaluations for characters not in any viewport
+            int32_t                                     m_maxFullRateGraphs = 32;                   // Only the most significant graphs are evaluated every frame, the rest are demoted
+        };
+
+    private:
+
+        struct UpdateRateLODRecord
+        {
+            UpdateRateLODRecord( GraphComponent* pGraphComponent, ComponentID const& componentID, SpatialEntityComponent const* pSpatialComponent )
+                : m_pGraphComponent( pGraphComponent )
+                , m_pSpatialComponent( pSpatialComponent )
+                , m_componentID( componentID )
+                , m_updatePhase( (uint32_t) componentID.m_value )
+            {}
+
+            inline ComponentID const& GetID() const { return m_componentID; }
+
+            GraphComponent*                             m_pGraphComponent = nullptr;
+            SpatialEntityComponent const*               m_pSpatialComponent = nullptr;
+            ComponentID                                 m_componentID;
+            float                                       m_distance = 0.0f;                          // Distance to the closest viewport
+            int32_t                                     m_updateInterval = 1;
+            uint32_t                                    m_updatePhase = 0;                          // Staggers the evaluation frames across graphs with the same interval
+        };
+
+    public:
 
         #if EE_DEVELOPMENT_TOOLS
         inline TVector<GraphComponent*> const& GetRegisteredGraphComponents() const { return m_graphComponents.GetVector(); }
         #endif
 
+        // Enable/disable the deferred parallel execution of pose tasks (when disabled all tasks are executed inline in the entity update)
+        inline void SetParallelPoseTaskExecutionEnabled( bool isEnabled ) { m_isParallelPoseTaskExecutionEnabled = isEnabled; }
+        inline bool IsParallelPoseTaskExecutionEnabled() const { return m_isParallelPoseTaskExecutionEnabled; }
+
+        // Try to defer the pose task execution for the specified animation system - threadsafe
+        // Returns false if the request could not be deferred, in which case the caller needs to execute the tasks itself
+        bool TryDeferPoseTaskExecution( AnimationSystem* pAnimationSystem );
+
+        // Enable/disable the sharing of sampled clip poses between all the characters in this world
+        inline void SetPoseSampleCacheEnabled( bool isEnabled ) { m_poseSampleCache.SetEnabled( isEnabled ); }
+        inline bool IsPoseSampleCacheEnabled() const { return m_poseSampleCache.IsEnabled(); }
+
+        // Update-rate LOD
+        inline void SetUpdateRateLODSettings( UpdateRateLODSettings const& settings ) { m_updateRateLODSettings = settings; }
+        inline UpdateRateLODSettings const& GetUpdateRateLODSettings() const { return m_updateRateLODSettings; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline int32_t GetNumDeferredUpdatesForLastFrame() const { return m_numDeferredUpdatesForLastFrame; }
+        int32_t GetNumAllocatedArenaPoseBuffers() const;
+
+        inline int32_t GetNumFullRateGraphs() const { return m_numFullRateGraphs; }
+        inline int32_t GetNumReducedRateGraphs() const { return m_numReducedRateGraphs; }
+        inline int32_t GetNumScheduledGraphEvaluations() const { return m_numScheduledGraphEvaluations; }
+
+        inline PoseSampleCache::Stats const& GetPoseSampleCacheStatsForLastFrame() const { return m_poseSampleCache.GetStatsForLastFrame(); }
+        #endif
+
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        void ExecuteDeferredPoseTasks( UpdateStage updateStage );
+
+        // Rank all graphs by significance and set their update rates for the next frame
+        void UpdateGraphUpdateRates( EntityWorldUpdateContext const& ctx );
+
     private:
 
         TIDVector<ComponentID, GraphComponent*>          m_graphComponents;
+
+        EE::TaskSystem*                                 m_pTaskSystem = nullptr;
+        TVector<PoseBufferArena*>                       m_poseBufferArenas;                         // One per thread (all workers + main thread)
+        TVector<AnimationSystem*>                       m_deferredUpdates;                          // Pre-sized, only the first 'm_numDeferredUpdates' entries are valid
+        std::atomic<int32_t>                            m_numDeferredUpdates = 0;
+        bool                                            m_isParallelPoseTaskExecutionEnabled = true;
+        PoseSampleCache                                 m_poseSampleCache;                          // Shared by all graphs in this world, reset at the end of each frame
+
+        UpdateRateLODSettings                           m_updateRateLODSettings;
+        TIDVector<ComponentID, UpdateRateLODRecord>     m_updateRateLODRecords;
+        TVector<int32_t>                                m_fullRateCandidates;                       // Scratch space for the full-rate budget
+        uint32_t                                        m_updateRateLODFrameIdx = 0;
+
+        #if EE_DEVELOPMENT_TOOLS
+        int32_t                                         m_numDeferredUpdatesForLastFrame = 0;
+        int32_t                                         m_numFullRateGraphs = 0;
+        int32_t                                         m_numReducedRateGraphs = 0;
+        int32_t                                         m_numScheduledGraphEvaluations = 0;
+        #endif
     };
 } 
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "Animation_PoseSampleCache.h"
+#include "Engine/Animation/AnimationClip.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    uint32_t PoseSampleCache::Key::GetHash() const
+    {
+        float const percentageThrough = m_frameTime.GetPercentageThrough().ToFloat();
+        uint32_t percentageThroughBits;
+        memcpy( &percentageThroughBits, &percentageThrough, sizeof( float ) );
+
+        uint64_t hash = (uint64_t) m_pClip;
+        hash ^= (uint64_t) m_frameTime.GetFrameIndex() + 0x9e3779b97f4a7c15ull + ( hash << 6 ) + ( hash >> 2 );
+        hash ^= (uint64_t) percentageThroughBits + 0x9e3779b97f4a7c15ull + ( hash << 6 ) + ( hash >> 2 );
+        hash ^= (uint64_t) ( ( (uint8_t) m_skeletonLOD << 1 ) | ( m_sampleFloatChannels ? 1 : 0 ) ) + 0x9e3779b97f4a7c15ull + ( hash << 6 ) + ( hash >> 2 );
+        return uint32_t( hash ^ ( hash >> 32 ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    PoseSampleCache::PoseSampleCache()
+    {
+        m_pShards = EE::NewArray<Shard>( s_numShards );
+    }
+
+    PoseSampleCache::~PoseSampleCache()
+    {
+        for ( uint32_t shardIdx = 0; shardIdx < s_numShards; shardIdx++ )
+        {
+            Shard& shard = m_pShards[shardIdx];
+
+            for ( Entry* pEntry : shard.m_entries )
+            {
+                EE::Delete( pEntry );
+            }
+
+            for ( Entry* pEntry : shard.m_freeEntries )
+            {
+                EE::Delete( pEntry );
+            }
+        }
+
+        EE::DeleteArray( m_pShards );
+    }
+
+    bool PoseSampleCache::TryGetPose( AnimationClip const* pClip, FrameTime const& frameTime, Skeleton::LOD skeletonLOD, bool sampleFloatChannels, Pose* pOutPose )
+    {
+        EE_ASSERT( pClip != nullptr && pOutPose != nullptr );
+        EE_ASSERT( pOutPose->GetSkeleton() == pClip->GetSkeleton() );
+
+        if ( !m_isEnabled )
+        {
+            return false;
+        }
+
+        Key const key = { pClip, frameTime, skeletonLOD, sampleFloatChannels };
+        Shard& shard = m_pShards[key.GetHash() % s_numShards];
+
+        #if EE_DEVELOPMENT_TOOLS
+        shard.m_numLookups.fetch_add( 1, std::memory_order_relaxed );
+        #endif
+
+        Threading::ScopeLockRead lock( shard.m_mutex );
+        for ( Entry* pEntry : shard.m_entries )
+        {
+            if ( pEntry->m_key == key )
+            {
+                pOutPose->CopyFrom( pEntry->m_pose );
+                pEntry->m_numReferences.fetch_add( 1, std::memory_order_relaxed );
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void PoseSampleCache::AddPose( AnimationClip const* pClip, FrameTime const& frameTime, Skeleton::LOD skeletonLOD, bool sampleFloatChannels, Pose const* pPose )
+    {
+        EE_ASSERT( pClip != nullptr && pPose != nullptr );
+        EE_ASSERT( pPose->GetSkeleton() == pClip->GetSkeleton() );
+
+        if ( !m_isEnabled )
+        {
+            return;
+        }
+
+        Key const key = { pClip, frameTime, skeletonLOD, sampleFloatChannels };
+        Shard& shard = m_pShards[key.GetHash() % s_numShards];
+
+        Threading::ScopeLockWrite lock( shard.m_mutex );
+
+        if ( (int32_t) shard.m_entries.size() >= s_maxEntriesPerShard )
+        {
+            return;
+        }
+
+        for ( Entry* pEntry : shard.m_entries )
+        {
+            if ( pEntry->m_key == key )
+            {
+                return;
+            }
+        }
+
+        // Reuse a released entry for the same skeleton if we have one, so we dont reallocate the pose storage every frame
+        Entry* pNewEntry = nullptr;
+        for ( int32_t i = 0; i < (int32_t) shard.m_freeEntries.size(); i++ )
+        {
+            if ( shard.m_freeEntries[i]->m_pose.GetSkeleton() == pPose->GetSkeleton() )
+            {
+                pNewEntry = shard.m_freeEntries[i];
+                shard.m_freeEntries.erase_unsorted( shard.m_freeEntries.begin() + i );
+                break;
+            }
+        }
+
+        if ( pNewEntry == nullptr )
+        {
+            pNewEntry = EE::New<Entry>( pPose->GetSkeleton() );
+        }
+
+        pNewEntry->m_key = key;
+        pNewEntry->m_pose.CopyFrom( pPose );
+        pNewEntry->m_numReferences = 0;
+        shard.m_entries.emplace_back( pNewEntry );
+    }
+
+    void PoseSampleCache::Reset()
+    {
+        #if EE_DEVELOPMENT_TOOLS
+        m_statsForLastFrame = Stats();
+        #endif
+
+        for ( uint32_t shardIdx = 0; shardIdx < s_numShards; shardIdx++ )
+        {
+            Shard& shard = m_pShards[shardIdx];
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_statsForLastFrame.m_numLookups += shard.m_numLookups;
+            m_statsForLastFrame.m_numEntries += (int32_t) shard.m_entries.size();
+            for ( Entry* pEntry : shard.m_entries )
+            {
+                int32_t const numReferences = pEntry->m_numReferences;
+                m_statsForLastFrame.m_numHits += numReferences;
+                m_statsForLastFrame.m_numSharedEntries += ( numReferences > 0 ) ? 1 : 0;
+            }
+            m_statsForLastFrame.m_numAllocatedPoses += (int32_t) ( shard.m_entries.size() + shard.m_freeEntries.size() );
+            shard.m_numLookups = 0;
+            #endif
+
+            // Keep the released entries for reuse, the free list is bounded since it can fill up with entries for skeletons that are no longer sampled
+            for ( Entry* pEntry : shard.m_entries )
+            {
+                if ( (int32_t) shard.m_freeEntries.size() < s_maxEntriesPerShard )
+                {
+                    shard.m_freeEntries.emplace_back( pEntry );
+                }
+                else
+                {
+                    EE::Delete( pEntry );
+                }
+            }
+
+            shard.m_entries.clear();
+        }
+    }
+}
\ No newline at end of file
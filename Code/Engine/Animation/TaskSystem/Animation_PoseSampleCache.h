@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationFrameTime.h"
+#include "Base/Threading/Threading.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    class AnimationClip;
+
+    //-------------------------------------------------------------------------
+    // Pose Sample Cache
+    //-------------------------------------------------------------------------
+    // Per-frame cache of sampled clip poses shared by all the task systems in a world
+    // Characters playing the same clip at the same frame time (i.e. crowds) only decode the clip once, all other sample tasks copy the cached pose
+    // Entries are keyed on (clip, frame time, LOD, float channel sampling) and only live until the cache is reset, which is expected once per frame
+    // Sample tasks are executed concurrently, so the cache is split into shards with a read/write lock each
+
+    class EE_ENGINE_API PoseSampleCache
+    {
+        constexpr static uint32_t const s_numShards = 16;
+        constexpr static int32_t const s_maxEntriesPerShard = 32;
+
+        struct Key
+        {
+            inline bool operator==( Key const& rhs ) const
+            {
+                return m_pClip == rhs.m_pClip && m_frameTime == rhs.m_frameTime && m_skeletonLOD == rhs.m_skeletonLOD && m_sampleFloatChannels == rhs.m_sampleFloatChannels;
+            }
+
+            uint32_t GetHash() const;
+
+        public:
+
+            AnimationClip const*                m_pClip = nullptr;
+            FrameTime                           m_frameTime;
+            Skeleton::LOD                       m_skeletonLOD = Skeleton::LOD::High;
+            bool                                m_sampleFloatChannels = true;
+        };
+
+        struct Entry
+        {
+            Entry( Skeleton const* pSkeleton ) : m_pose( pSkeleton, Pose::Init::None ) {}
+
+            Key                                 m_key;
+            Pose                                m_pose;
+            std::atomic<int32_t>                m_numReferences = 0;                // The number of sample tasks that shared this entry (excluding the one that added it)
+        };
+
+        // Each shard is cache line aligned so that the locks of different shards never share a line
+        struct alignas( 64 ) Shard
+        {
+            Threading::ReadWriteMutex           m_mutex;
+            TVector<Entry*>                     m_entries;
+            TVector<Entry*>                     m_freeEntries;                      // Entries released by the last reset, reused for matching skeletons
+
+            #if EE_DEVELOPMENT_TOOLS
+            std::atomic<int32_t>                m_numLookups = 0;
+            #endif
+        };
+
+    public:
+
+        struct Stats
+        {
+            inline float GetHitRate() const { return ( m_numLookups > 0 ) ? float( m_numHits ) / m_numLookups : 0.0f; }
+
+        public:
+
+            int32_t                             m_numLookups = 0;
+            int32_t                             m_numHits = 0;
+            int32_t                             m_numEntries = 0;
+            int32_t                             m_numSharedEntries = 0;             // Entries that were used by more than one sample task
+            int32_t                             m_numAllocatedPoses = 0;
+        };
+
+    public:
+
+        PoseSampleCache();
+        PoseSampleCache( PoseSampleCache const& ) = delete;
+        ~PoseSampleCache();
+
+        PoseSampleCache& operator=( PoseSampleCache const& rhs ) = delete;
+
+        // Enable/disable the cache, when disabled all lookups miss and nothing is added
+        inline void SetEnabled( bool isEnabled ) { m_isEnabled = isEnabled; }
+        inline bool IsEnabled() const { return m_isEnabled; }
+
+        // Try to copy a previously sampled pose into the output pose - threadsafe
+        // Returns false if nothing was cached for this sample, in which case the caller should sample the clip and call 'AddPose'
+        bool TryGetPose( AnimationClip const* pClip, FrameTime const& frameTime, Skeleton::LOD skeletonLOD, bool sampleFloatChannels, Pose* pOutPose );
+
+        // Add a sampled pose to the cache - threadsafe
+        // Does nothing if the sample is already cached (i.e. another thread got there first) or the cache is full
+        void AddPose( AnimationClip const* pClip, FrameTime const& frameTime, Skeleton::LOD skeletonLOD, bool sampleFloatChannels, Pose const* pPose );
+
+        // Clear all entries - this is not threadsafe and needs to be called once no more sample tasks are executing
+        void Reset();
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Get the cache stats for the last frame (i.e. calculated on the last reset)
+        inline Stats const& GetStatsForLastFrame() const { return m_statsForLastFrame; }
+        #endif
+
+    private:
+
+        Shard*                                  m_pShards = nullptr;
+        bool                                    m_isEnabled = true;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Stats                                   m_statsForLastFrame;
+        #endif
+    };
+}
\ No newline at end of file
@@ -12,6 +12,7 @@ namespace EE::Animation
 {
     class PoseTask;
     class BoneMaskPool;
+    class PoseSampleCache;
     class TaskSerializer;
 
     //-------------------------------------------------------------------------
@@ -60,6 +61,7 @@ namespace EE::Animation
         TInlineVector<PoseTask*, 2>     m_dependencies = { nullptr, nullptr };
         PoseBufferPool&                 m_posePool;
         BoneMaskPool&                   m_boneMaskPool;
+        PoseSampleCache*                m_pSampleCache = nullptr;       // Optional cache of sampled poses shared with other task systems
         float                           m_deltaTime = 0;
         TaskUpdateStage                 m_updateStage = TaskUpdateStage::Any;
         int8_t                          m_currentTaskIdx = InvalidIndex;
@@ -95,6 +95,79 @@ namespace EE::Animation
         m_shouldBeReset = false;
     }
 
+    //-------------------------------------------------------------------------
+    // Pose Buffer Arena
+    //-------------------------------------------------------------------------
+
+    PoseBufferArena::~PoseBufferArena()
+    {
+        for ( BufferSet& bufferSet : m_bufferSets )
+        {
+            EE_ASSERT( bufferSet.m_numUsedBuffers == 0 );
+            for ( PoseBuffer* pBuffer : bufferSet.m_buffers )
+            {
+                EE::Delete( pBuffer );
+            }
+        }
+    }
+
+    PoseBuffer* PoseBufferArena::AcquirePoseBuffer( Skeleton const* pPrimarySkeleton, SecondarySkeletonList const& secondarySkeletons )
+    {
+        EE_ASSERT( pPrimarySkeleton != nullptr );
+
+        // Find the set for this skeleton setup
+        //-------------------------------------------------------------------------
+
+        BufferSet* pBufferSet = nullptr;
+        for ( BufferSet& bufferSet : m_bufferSets )
+        {
+            if ( bufferSet.m_pPrimarySkeleton == pPrimarySkeleton && bufferSet.m_secondarySkeletons == secondarySkeletons )
+            {
+                pBufferSet = &bufferSet;
+                break;
+            }
+        }
+
+        if ( pBufferSet == nullptr )
+        {
+            pBufferSet = &m_bufferSets.emplace_back();
+            pBufferSet->m_pPrimarySkeleton = pPrimarySkeleton;
+            pBufferSet->m_secondarySkeletons = secondarySkeletons;
+        }
+
+        // Get a buffer
+        //-------------------------------------------------------------------------
+
+        if ( pBufferSet->m_numUsedBuffers == pBufferSet->m_buffers.size() )
+        {
+            pBufferSet->m_buffers.emplace_back( EE::New<PoseBuffer>( pPrimarySkeleton, secondarySkeletons ) );
+        }
+
+        PoseBuffer* pBuffer = pBufferSet->m_buffers[pBufferSet->m_numUsedBuffers];
+        pBufferSet->m_numUsedBuffers++;
+
+        pBuffer->Release();
+        return pBuffer;
+    }
+
+    void PoseBufferArena::Reset()
+    {
+        for ( BufferSet& bufferSet : m_bufferSets )
+        {
+            bufferSet.m_numUsedBuffers = 0;
+        }
+    }
+
+    int32_t PoseBufferArena::GetNumAllocatedBuffers() const
+    {
+        int32_t numBuffers = 0;
+        for ( BufferSet const& bufferSet : m_bufferSets )
+        {
+            numBuffers += (int32_t) bufferSet.m_buffers.size();
+        }
+        return numBuffers;
+    }
+
     //-------------------------------------------------------------------------
     // Pose Buffer Pool
     //-------------------------------------------------------------------------
@@ -108,9 +181,9 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        // Transient buffers are created lazily since they might be borrowed from an arena instead
         for ( auto i = 0; i < s_numInitialBuffers; i++ )
         {
-            m_poseBuffers.emplace_back( PoseBuffer( m_pPrimarySkeleton, m_secondarySkeletons ) );
             m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pPrimarySkeleton, m_secondarySkeletons ) );
 
             #if EE_DEVELOPMENT_TOOLS
@@ -123,14 +196,22 @@ namespace EE::Animation
     PoseBufferPool::~PoseBufferPool()
     {
         Reset();
+        ReleaseArenaPoseBuffers();
+
+        for ( PoseBuffer* pPoseBuffer : m_ownedPoseBuffers )
+        {
+            EE::Delete( pPoseBuffer );
+        }
+        m_ownedPoseBuffers.clear();
+        m_poseBuffers.clear();
     }
 
     void PoseBufferPool::Reset()
     {
         // Reset all buffers
-        for ( auto& poseBuffer : m_poseBuffers )
+        for ( PoseBuffer* pPoseBuffer : m_poseBuffers )
         {
-            poseBuffer.Release();
+            pPoseBuffer->Release();
         }
 
         m_firstFreeBuffer = 0;
@@ -176,9 +257,11 @@ namespace EE::Animation
 
         m_secondarySkeletons = secondarySkeletons;
 
-        for ( PoseBuffer& poseBuffer : m_poseBuffers )
+        // Borrowed buffers never outlive a single update so only the owned buffers need to be updated
+        EE_ASSERT( m_poseBuffers.size() == m_ownedPoseBuffers.size() );
+        for ( PoseBuffer* pPoseBuffer : m_ownedPoseBuffers )
         {
-            poseBuffer.UpdateSecondarySkeletonList( m_secondarySkeletons );
+            pPoseBuffer->UpdateSecondarySkeletonList( m_secondarySkeletons );
         }
 
         #if EE_DEVELOPMENT_TOOLS
@@ -211,22 +294,33 @@ namespace EE::Animation
     {
         if ( m_firstFreeBuffer == m_poseBuffers.size() )
         {
-            for ( auto i = 0; i < s_bufferGrowAmount; i++ )
+            if ( m_pArena != nullptr )
             {
-                m_poseBuffers.emplace_back( PoseBuffer( m_pPrimarySkeleton, m_secondarySkeletons ) );
+                m_poseBuffers.emplace_back( m_pArena->AcquirePoseBuffer( m_pPrimarySkeleton, m_secondarySkeletons ) );
+            }
+            else
+            {
+                EE_ASSERT( m_poseBuffers.size() == m_ownedPoseBuffers.size() );
+                int32_t const numBuffersToCreate = m_ownedPoseBuffers.empty() ? s_numInitialBuffers : s_bufferGrowAmount;
+                for ( auto i = 0; i < numBuffersToCreate; i++ )
+                {
+                    PoseBuffer* pNewBuffer = EE::New<PoseBuffer>( m_pPrimarySkeleton, m_secondarySkeletons );
+                    m_ownedPoseBuffers.emplace_back( pNewBuffer );
+                    m_poseBuffers.emplace_back( pNewBuffer );
+                }
             }
             EE_ASSERT( m_poseBuffers.size() < INT8_MAX );
         }
 
         int8_t const freeBufferIdx = m_firstFreeBuffer;
-        EE_ASSERT( !m_poseBuffers[freeBufferIdx].m_isUsed );
-        m_poseBuffers[freeBufferIdx].m_isUsed = true;
+        EE_ASSERT( !m_poseBuffers[freeBufferIdx]->m_isUsed );
+        m_poseBuffers[freeBufferIdx]->m_isUsed = true;
 
         // Update free index
         int8_t const numPoseBuffers = (int8_t) m_poseBuffers.size();
         for ( ; m_firstFreeBuffer < numPoseBuffers; m_firstFreeBuffer++ )
         {
-            if ( !m_poseBuffers[m_firstFreeBuffer].m_isUsed )
+            if ( !m_poseBuffers[m_firstFreeBuffer]->m_isUsed )
             {
                 break;
             }
@@ -237,11 +331,25 @@ namespace EE::Animation
 
     void PoseBufferPool::ReleasePoseBuffer( int8_t bufferIdx )
     {
-        EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-        m_poseBuffers[bufferIdx].m_isUsed = false;
+        EE_ASSERT( m_poseBuffers[bufferIdx]->m_isUsed );
+        m_poseBuffers[bufferIdx]->m_isUsed = false;
         m_firstFreeBuffer = Math::Min( bufferIdx, m_firstFreeBuffer );
     }
 
+    void PoseBufferPool::ReleaseArenaPoseBuffers()
+    {
+        // Borrowed buffers are always after the owned ones, since the arena is never changed mid-update
+        int32_t const numOwnedBuffers = (int32_t) m_ownedPoseBuffers.size();
+        if ( m_poseBuffers.size() == numOwnedBuffers )
+        {
+            return;
+        }
+
+        // We dont need to release the borrowed buffers, the arena will do that when handing them out again
+        m_poseBuffers.resize( numOwnedBuffers );
+        m_firstFreeBuffer = Math::Min( m_firstFreeBuffer, (int8_t) numOwnedBuffers );
+    }
+
     //-------------------------------------------------------------------------
 
     bool PoseBufferPool::IsValidCachedPose( CachedPoseID cachedPoseID ) const
@@ -422,8 +530,8 @@ namespace EE::Animation
             EE_ASSERT( m_debugPoseBuffers.size() < INT8_MAX );
         }
 
-        EE_ASSERT( m_poseBuffers[poseBufferIdx].m_isUsed );
-        m_debugPoseBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx] );
+        EE_ASSERT( m_poseBuffers[poseBufferIdx]->m_isUsed );
+        m_debugPoseBuffers[m_firstFreeDebugBuffer].CopyFrom( *m_poseBuffers[poseBufferIdx] );
         m_debugBufferTaskIdxMapping[m_firstFreeDebugBuffer] = taskIdx;
         m_firstFreeDebugBuffer++;
     }
@@ -14,6 +14,7 @@ namespace EE::Animation
     struct EE_ENGINE_API PoseBuffer
     {
         friend class PoseBufferPool;
+        friend class PoseBufferArena;
         friend class TaskSystem;
 
     public:
@@ -108,10 +109,50 @@ namespace EE::Animation
         bool                                m_shouldBeReset = false;
     };
 
+    //-------------------------------------------------------------------------
+    // Pose Buffer Arena
+    //-------------------------------------------------------------------------
+    // Transient pose buffer storage shared by all the task systems executed on a given thread
+    // Buffers handed out remain valid until the arena is reset, this is expected to happen once per frame once all the borrowing pools have released them
+    // The arena itself is not thread-safe, so one arena is needed per worker thread
+
+    class EE_ENGINE_API PoseBufferArena
+    {
+        struct BufferSet
+        {
+            Skeleton const*                 m_pPrimarySkeleton = nullptr;
+            SecondarySkeletonList           m_secondarySkeletons;
+            TVector<PoseBuffer*>            m_buffers;
+            int32_t                         m_numUsedBuffers = 0;
+        };
+
+    public:
+
+        PoseBufferArena() = default;
+        PoseBufferArena( PoseBufferArena const& ) = delete;
+        ~PoseBufferArena();
+
+        PoseBufferArena& operator=( PoseBufferArena const& rhs ) = delete;
+
+        // Get a buffer for the specified skeleton setup, the returned buffer is released and has an unset pose
+        PoseBuffer* AcquirePoseBuffer( Skeleton const* pPrimarySkeleton, SecondarySkeletonList const& secondarySkeletons );
+
+        // Make all the buffers available again
+        void Reset();
+
+        // Get the total number of buffers allocated by this arena
+        int32_t GetNumAllocatedBuffers() const;
+
+    private:
+
+        TInlineVector<BufferSet, 4>         m_bufferSets;
+    };
+
     //-------------------------------------------------------------------------
     // Pose Buffer Pool
     //-------------------------------------------------------------------------
-    // TODO: Store all poses in a contiguous block of memory and profile if this is in fact faster or not
+    // Transient buffers are either owned by the pool or borrowed from an arena (if one is set)
+    // Borrowed buffers are only valid for a single update and are returned via 'ReleaseArenaPoseBuffers'
 
     class EE_ENGINE_API PoseBufferPool
     {
@@ -155,10 +196,19 @@ namespace EE::Animation
 
         inline PoseBuffer* GetBuffer( int8_t bufferIdx )
         {
-            EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-            return &m_poseBuffers[bufferIdx];
+            EE_ASSERT( m_poseBuffers[bufferIdx]->m_isUsed );
+            return m_poseBuffers[bufferIdx];
         }
 
+        // Arena
+        //-------------------------------------------------------------------------
+
+        // Set the arena to use for any additional pose buffers needed, set to null to go back to allocating owned buffers
+        inline void SetPoseBufferArena( PoseBufferArena* pArena ) { m_pArena = pArena; }
+
+        // Drop all buffers borrowed from the arena, needs to be called at the end of each update that used an arena
+        void ReleaseArenaPoseBuffers();
+
         // Cached Poses
         //-------------------------------------------------------------------------
 
@@ -196,7 +246,9 @@ namespace EE::Animation
 
     private:
 
-        TInlineVector<PoseBuffer, 10>               m_poseBuffers;
+        TInlineVector<PoseBuffer*, 10>              m_poseBuffers;                  // All available transient buffers (owned and borrowed)
+        TInlineVector<PoseBuffer*, 10>              m_ownedPoseBuffers;
+        PoseBufferArena*                            m_pArena = nullptr;
         TInlineVector<CachedPoseBuffer, 10>         m_cachedBuffers;
         int8_t                                      m_firstFreeCachedBuffer = 0;
         int8_t                                      m_firstFreeBuffer = 0;
@@ -86,6 +86,7 @@ namespace EE::Animation
     {
         Reset();
         eastl::swap( m_pFinalPoseBuffer, m_pPreviousFinalPoseBuffer );
+        m_finalPoseUpdateID++;
         m_executionTime = 0.0f;
     }
 
@@ -175,7 +176,7 @@ namespace EE::Animation
         return true;
     }
 
-    void TaskSystem::UpdatePrePhysics( float deltaTime, Transform const& worldTransform, Transform const& worldTransformInverse )
+    void TaskSystem::UpdatePrePhysics( float deltaTime, Transform const& worldTransform, Transform const& worldTransformInverse, PoseBufferArena* pArena )
     {
         EE_PROFILE_SCOPE_ANIMATION( "Anim Pre-Physics Tasks" );
 
@@ -189,6 +190,7 @@ namespace EE::Animation
         m_taskContext.m_worldTransform = worldTransform;
         m_taskContext.m_worldTransformInverse = worldTransformInverse;
         m_taskContext.m_updateStage = TaskUpdateStage::PrePhysics;
+        m_posePool.SetPoseBufferArena( pArena );
 
         m_prePhysicsTaskIndices.clear();
         m_hasCodependentPhysicsTasks = false;
@@ -250,7 +252,7 @@ namespace EE::Animation
         }
     }
 
-    void TaskSystem::UpdatePostPhysics()
+    void TaskSystem::UpdatePostPhysics( PoseBufferArena* pArena )
     {
         EE_PROFILE_SCOPE_ANIMATION( "Anim Post-Physics Tasks" );
 
@@ -259,9 +261,14 @@ namespace EE::Animation
         // If we detected co-dependent tasks in the pre-physics update, there's nothing to do here
         if ( m_hasCodependentPhysicsTasks )
         {
+            m_posePool.ReleaseArenaPoseBuffers();
+            m_posePool.SetPoseBufferArena( nullptr );
             return;
         }
 
+        // The post-physics update may run on a different thread than the pre-physics one
+        m_posePool.SetPoseBufferArena( pArena );
+
         #if EE_DEVELOPMENT_TOOLS
         Timer<PlatformClock> timer;
         timer.Start();
@@ -310,6 +317,10 @@ namespace EE::Animation
             m_pFinalPoseBuffer->Release( Pose::Init::ReferencePose, true );
         }
 
+        // Arena buffers are only valid for this update
+        m_posePool.ReleaseArenaPoseBuffers();
+        m_posePool.SetPoseBufferArena( nullptr );
+
         #if EE_DEVELOPMENT_TOOLS
         m_executionTime += timer.GetElapsedTimeMicroseconds();
         #endif
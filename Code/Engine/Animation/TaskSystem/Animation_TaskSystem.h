@@ -66,6 +66,9 @@ namespace EE::Animation
         // Get the final primary pose generated by the task system for the previous update
         Pose const* GetPrimaryPoseForPreviousUpdate() const { return &m_pPreviousFinalPoseBuffer->m_poses[0]; }
 
+        // Get an ID that changes whenever a new final pose is generated, allows users of the final pose to skip work when the pose hasn't been updated
+        uint32_t GetFinalPoseUpdateID() const { return m_finalPoseUpdateID; }
+
         // Get the final primary pose generated by the task system
         TInlineVector<Pose const*, 1> GetSecondaryPoses() const;
 
@@ -78,6 +81,9 @@ namespace EE::Animation
         // Are we allowed to sample float channel data?
         EE_FORCE_INLINE bool IsFloatChannelSamplingAllowed() const { return m_taskContext.m_sampleFloatChannels; }
 
+        // Set the (optional) sample cache shared with other task systems in the same world
+        EE_FORCE_INLINE void SetPoseSampleCache( PoseSampleCache* pSampleCache ) { m_taskContext.m_pSampleCache = pSampleCache; }
+
         // Skeleton(s)
         //-------------------------------------------------------------------------
 
@@ -109,10 +115,12 @@ namespace EE::Animation
         inline bool HasPhysicsDependency() const { return m_hasPhysicsDependency; }
 
         // Run all pre-physics tasks
-        void UpdatePrePhysics( float deltaTime, Transform const& worldTransform, Transform const& worldTransformInverse );
+        // An optional arena can be supplied for the transient pose buffers, this needs to be the arena for the executing thread
+        void UpdatePrePhysics( float deltaTime, Transform const& worldTransform, Transform const& worldTransformInverse, PoseBufferArena* pArena = nullptr );
 
         // Run all post-physics tasks and fill out the final pose buffer
-        void UpdatePostPhysics();
+        // Any buffers borrowed from arenas are returned once this completes
+        void UpdatePostPhysics( PoseBufferArena* pArena = nullptr );
 
         #if EE_DEVELOPMENT_TOOLS
         // Get the time it took for the last update to execute
@@ -220,6 +228,7 @@ namespace EE::Animation
         PoseBuffer*                             m_pFinalPoseBuffer = nullptr;
         PoseBuffer*                             m_pPreviousFinalPoseBuffer = nullptr;
         Microseconds                            m_executionTime = 0.0f;
+        uint32_t                                m_finalPoseUpdateID = 0;
 
         //-------------------------------------------------------------------------
 
@@ -1,15 +1,17 @@
 #include "Animation_Task_Sample.h"
 #include "Engine/Animation/TaskSystem/Animation_TaskSerializer.h"
+#include "Engine/Animation/TaskSystem/Animation_PoseSampleCache.h"
 #include "Base/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
-    SampleTask::SampleTask( AnimationClip const* pAnimation, Percentage time )
+    SampleTask::SampleTask( AnimationClip const* pAnimation, Percentage time, KeyframeReducedCursor* pCursor )
         : PoseTask()
         , m_pAnimation( pAnimation )
         , m_time( time )
+        , m_pCursor( pCursor )
     {
         EE_ASSERT( m_pAnimation != nullptr );
         EE_ASSERT( Math::IsFinite( time.ToFloat() ) );
@@ -27,7 +29,20 @@ namespace EE::Animation
         // Sample primary pose
         //-------------------------------------------------------------------------
 
-        m_pAnimation->GetPose( m_time, pResultBuffer->GetPrimaryPose(), context.m_skeletonLOD, context.m_sampleFloatChannels );
+        // Other characters might have already sampled this exact pose this frame, so check the shared cache before decoding the clip
+        if ( context.m_pSampleCache != nullptr )
+        {
+            FrameTime const frameTime = m_pAnimation->GetFrameTime( m_time );
+            if ( !context.m_pSampleCache->TryGetPose( m_pAnimation, frameTime, context.m_skeletonLOD, context.m_sampleFloatChannels, pResultBuffer->GetPrimaryPose() ) )
+            {
+                m_pAnimation->GetPose( frameTime, pResultBuffer->GetPrimaryPose(), context.m_skeletonLOD, context.m_sampleFloatChannels, m_pCursor );
+                context.m_pSampleCache->AddPose( m_pAnimation, frameTime, context.m_skeletonLOD, context.m_sampleFloatChannels, pResultBuffer->GetPrimaryPose() );
+            }
+        }
+        else
+        {
+            m_pAnimation->GetPose( m_time, pResultBuffer->GetPrimaryPose(), context.m_skeletonLOD, context.m_sampleFloatChannels, m_pCursor );
+        }
 
         // Sample secondary poses
         //-------------------------------------------------------------------------
@@ -59,6 +74,7 @@ namespace EE::Animation
     {
         m_pAnimation = serializer.ReadResourcePtr<AnimationClip>();
         m_time = serializer.ReadNormalizedFloat16Bit();
+        m_pCursor = nullptr;
     }
 
     #if EE_DEVELOPMENT_TOOLS
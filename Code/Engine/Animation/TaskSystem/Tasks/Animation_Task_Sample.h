@@ -13,7 +13,8 @@ namespace EE::Animation
 
     public:
 
-        SampleTask( AnimationClip const* pAnimation, Percentage time );
+        // The cursor is owned by the sampling node and is only used for keyframe reduced clips (see 'KeyframeReducedCursor')
+        SampleTask( AnimationClip const* pAnimation, Percentage time, KeyframeReducedCursor* pCursor = nullptr );
         virtual void Execute( TaskContext const& context ) override;
 
         virtual void Serialize( TaskSerializer& serializer ) const override;
@@ -34,5 +35,6 @@ namespace EE::Animation
 
         AnimationClip const*    m_pAnimation;
         Percentage              m_time;
+        KeyframeReducedCursor*  m_pCursor = nullptr; // Not serialized, deserialized tasks always search for their keys
     };
 }
\ No newline at end of file
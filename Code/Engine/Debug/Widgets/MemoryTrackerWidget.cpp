@@ -458,11 +458,12 @@ namespace EE
         // CPU table
         //-------------------------------------------------------------------------
 
-        if ( ImGui::BeginTable( "CpuMemoryAllocators", 3, ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchSame, ImVec2( 0, 0 ) ) )
+        if ( ImGui::BeginTable( "CpuMemoryAllocators", 4, ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchSame, ImVec2( 0, 0 ) ) )
         {
             ImGui::TableSetupColumn( "Allocator" );
             ImGui::TableSetupColumn( "Bytes" );
             ImGui::TableSetupColumn( "Allocs" );
+            ImGui::TableSetupColumn( "Frame Peak" );
 
             ImGui::TableHeadersRow();
 
@@ -471,6 +472,7 @@ namespace EE
 
             uint64_t numVisibleBytesTotal = 0;
             uint64_t numVisibleAllocsTotal = 0;
+            uint64_t numVisibleFramePeakTotal = 0;
 
             size_t idx = 0;
             for ( size_t groupIndex = 0; groupIndex < m_groups.size(); groupIndex++ )
@@ -484,6 +486,7 @@ namespace EE
                         continue;
                     numVisibleBytesTotal += entry.m_pMemoryAllocator->GetNumBytes();
                     numVisibleAllocsTotal += entry.m_pMemoryAllocator->GetNumAllocations();
+                    numVisibleFramePeakTotal += entry.m_pMemoryAllocator->GetFrameBytesHighWaterMark();
                 }
             }
 
@@ -499,6 +502,8 @@ namespace EE
             }
             ImGui::TableNextColumn();
             ImGui::Text( "%llu", numVisibleAllocsTotal );
+            ImGui::TableNextColumn();
+            DrawFormattedBytes( numVisibleFramePeakTotal );
 
             // Pass 2: render
             //-------------------------------------------------------------------------
@@ -577,6 +582,27 @@ namespace EE
                         int64_t const delta = int64_t( numAllocs ) - int64_t( entry.m_numAllocationsSnapshot );
                         DrawDeltaCountBadge( true, delta );
                     }
+
+                    // Frame Peak
+                    //-------------------------------------------------------------------------
+                    // The high-water mark of the per-frame (transient) frame arena allocations for this allocator
+
+                    ImGui::TableNextColumn();
+                    uint64_t const framePeakBytes = entry.m_pMemoryAllocator->GetFrameBytesHighWaterMark();
+                    if ( framePeakBytes > 0 )
+                    {
+                        DrawFormattedBytes( framePeakBytes );
+                        ImGui::SameLine( 0, 0 );
+                        ImGui::TextDisabled( " (Last: " );
+                        ImGui::SameLine( 0, 0 );
+                        DrawFormattedBytes( entry.m_pMemoryAllocator->GetNumFrameBytesLastFrame() );
+                        ImGui::SameLine( 0, 0 );
+                        ImGui::TextDisabled( ")" );
+                    }
+                    else
+                    {
+                        ImGui::TextUnformatted( "-" );
+                    }
                 }
 
                 if ( inTreeNode )
@@ -1,21 +1,24 @@
 #include "Engine.h"
 #include "Engine/Render/RenderViewport.h"
 #include "Base/Profiling.h"
+#include "Base/Memory/FrameArena.h"
 #include "Base/Time/Timers.h"
 #include "Base/FileSystem/FileSystemUtils.h"
 #include "Base/Logging/SystemLog.h"
 #include "Base/Utils/CommandLineParser.h"
 #include "Base/Resource/Settings/Settings_Resource.h"
 #include "Base/Resource/ResourceProvider.h"
+#include <cinttypes>
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
-    Engine::Engine( TFunction<bool( EE::String const& error )>&& errorHandler )
+    Engine::Engine( TFunction<bool( EE::String const& error )>&& errorHandler, Mode mode )
         : m_fatalErrorHandler( errorHandler )
+        , m_mode( mode )
     {
-        m_modules.emplace_back( EE::New<BaseModule>() );
+        m_modules.emplace_back( EE::New<BaseModule>( mode == Mode::Headless ) );
         m_modules.emplace_back( EE::New<EngineModule>() );
     }
 
@@ -35,12 +38,95 @@ namespace EE
 
         m_pResourceSystem->Update( true );
 
-        m_pRenderSystem->StartResourceUpdates( true );
-        m_pRenderSystem->SubmitResourceUpdates( true );
+        if ( m_pRenderSystem != nullptr )
+        {
+            m_pRenderSystem->StartResourceUpdates( true );
+            m_pRenderSystem->SubmitResourceUpdates( true );
+
+            m_pRenderSystem->StartAsyncResourceUpdates( true );
+            m_pRenderSystem->SubmitAsyncResourceUpdates( true );
+        }
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    bool Engine::HotReloadResources()
+    {
+        EE_ASSERT( m_pResourceSystem->RequiresHotReloading() );
+
+        bool succeeded = true;
+
+        TInlineVector<ResourceID, 20> const resourcesToReload = m_pResourceSystem->GetResourcesToBeReloaded();
+        TInlineVector<Resource::ResourceRequesterID, 20> const usersToReload = m_pResourceSystem->GetUsersToBeReloaded();
+
+        // Unload module resources
+        for ( auto pModule : m_modules )
+        {
+            pModule->HotReload_UnloadResources( *m_pResourceSystem, resourcesToReload );
+        }
+
+        // Unload game and tool resources
+        if ( m_pToolsUI != nullptr )
+        {
+            m_pToolsUI->HotReload_UnloadResources( usersToReload, resourcesToReload );
+        }
+
+        if ( !usersToReload.empty() )
+        {
+            m_pEntityWorldManager->HotReload_UnloadEntities( usersToReload );
+        }
+
+        // Ensure that all resource requests (both load/unload are completed before continuing with the hot-reload)
+        m_pResourceSystem->ClearHotReloadRequests();
+        while ( m_pResourceSystem->IsBusy() )
+        {
+            UpdateResourceLoadingRequests_Blocking();
+        }
+
+        // Reload game and tool resources
+        if ( m_pToolsUI != nullptr )
+        {
+            m_pToolsUI->HotReload_ReloadResources( usersToReload, resourcesToReload );
+        }
+
+        if ( !usersToReload.empty() )
+        {
+            m_pEntityWorldManager->HotReload_ReloadEntities( usersToReload );
+        }
+
+        // Reload module resources
+        bool shouldWaitForModuleResourceLoad = false;
+        for ( auto pModule : m_modules )
+        {
+            pModule->HotReload_ReloadResources( *m_pResourceSystem, resourcesToReload );
+            if ( pModule->GetModuleResourceLoadingState() == Module::LoadingState::Busy )
+            {
+                shouldWaitForModuleResourceLoad = true;
+            }
+        }
+
+        // Wait for module resources to fully load back in
+        if ( shouldWaitForModuleResourceLoad )
+        {
+            while ( m_pResourceSystem->IsBusy() )
+            {
+                UpdateResourceLoadingRequests_Blocking();
+            }
 
-        m_pRenderSystem->StartAsyncResourceUpdates( true );
-        m_pRenderSystem->SubmitAsyncResourceUpdates( true );
+            for ( auto pModule : m_modules )
+            {
+                Module::LoadingState const state = pModule->GetModuleResourceLoadingState();
+                EE_ASSERT( state != Module::LoadingState::Busy );
+                if ( state == Module::LoadingState::Failed )
+                {
+                    EE_LOG_FATAL_ERROR( LogCategory::Resource, "Hot-Reload", "Failed to hot-reload module resources! Check log for details!" );
+                    succeeded = false;
+                }
+            }
+        }
+
+        return succeeded;
     }
+    #endif
 
     bool Engine::Initialize( int32_t argc, char** argv, Int2 const& windowDimensions )
     {
@@ -53,6 +139,8 @@ namespace EE
 
         CommandLineParser cl;
         cl.AddOptionalStringArg( "map", "The startup map." );
+        cl.AddOptionalFloatArg( "tickrate", "The fixed simulation tick rate (Hz), only used when running headless", s_defaultHeadlessTickRate );
+        cl.AddOptionalIntArg( "workers", "The number of task system worker threads, only used when running headless", s_defaultHeadlessNumWorkers );
 
         #if EE_DEVELOPMENT_TOOLS
         cl.AddOptionalBoolArg( "packaged", "Should we use packaged data instead of the networked resource server", false );
@@ -63,6 +151,23 @@ namespace EE
             return m_fatalErrorHandler( "Invalid command line arguments!" );
         }
 
+        m_tickRate = cl.GetFloatArg( "tickrate" );
+        if ( m_tickRate <= 0.0f )
+        {
+            return m_fatalErrorHandler( "Invalid tick rate!" );
+        }
+
+        if ( IsHeadless() )
+        {
+            int64_t const numWorkers = cl.GetIntArg( "workers" );
+            if ( numWorkers < 0 || numWorkers > 256 )
+            {
+                return m_fatalErrorHandler( "Invalid number of workers!" );
+            }
+
+            pBaseModule->GetTaskSystem()->SetNumWorkers( (int32_t) numWorkers );
+        }
+
         //-------------------------------------------------------------------------
         // Register all known types
         //-------------------------------------------------------------------------
@@ -119,12 +224,17 @@ namespace EE
         m_pResourceProvider = pBaseModule->GetResourceProvider();
 
         m_pEntityWorldManager = pEngineModule->GetEntityWorldManager();
-        EE_DEVELOPMENT_TOOLS_ONLY( m_pImguiSystem = pBaseModule->GetImguiSystem() );
-        EE_DEVELOPMENT_TOOLS_ONLY( m_pImguiRenderer = pEngineModule->GetImguiRenderer() );
 
-        m_pRenderSystem = m_pSystemRegistry->GetSystem<Render::RenderSystem>();
-        m_pRenderWindow = pEngineModule->GetRenderWindow();
-        m_pForwardShadingRenderer = pEngineModule->GetForwardShadingRenderer();
+        // There is no rendering or UI when running headless, so all those systems are left unset
+        if ( !IsHeadless() )
+        {
+            EE_DEVELOPMENT_TOOLS_ONLY( m_pImguiSystem = pBaseModule->GetImguiSystem() );
+            EE_DEVELOPMENT_TOOLS_ONLY( m_pImguiRenderer = pEngineModule->GetImguiRenderer() );
+
+            m_pRenderSystem = m_pSystemRegistry->GetSystem<Render::RenderSystem>();
+            m_pRenderWindow = pEngineModule->GetRenderWindow();
+            m_pForwardShadingRenderer = pEngineModule->GetForwardShadingRenderer();
+        }
 
         // Setup update context
         m_updateContext.m_pSystemRegistry = m_pSystemRegistry;
@@ -181,17 +291,19 @@ namespace EE
 
         // Create tools UI
         #if EE_DEVELOPMENT_TOOLS
-        m_pRenderSystem->StartResourceUpdates( true );
-
-        CreateToolsUI();
-        EE_ASSERT( m_pToolsUI != nullptr );
-        m_pToolsUI->Initialize( m_updateContext, m_pImguiRenderer->GetImageCache() );
+        if ( !IsHeadless() )
+        {
+            m_pRenderSystem->StartResourceUpdates( true );
 
-        m_pRenderSystem->SubmitResourceUpdates( true );
+            CreateToolsUI();
+            EE_ASSERT( m_pToolsUI != nullptr );
+            m_pToolsUI->Initialize( m_updateContext, m_pImguiRenderer->GetImageCache() );
 
-        m_pRenderSystem->StartAsyncResourceUpdates( true );
-        m_pRenderSystem->SubmitAsyncResourceUpdates( true );
+            m_pRenderSystem->SubmitResourceUpdates( true );
 
+            m_pRenderSystem->StartAsyncResourceUpdates( true );
+            m_pRenderSystem->SubmitAsyncResourceUpdates( true );
+        }
         #endif
 
         // Set startup map if provided
@@ -209,7 +321,18 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
-        ResizeMainWindow( windowDimensions );
+        if ( IsHeadless() )
+        {
+            m_updateContext.m_deltaTime = Seconds( 1.0f / m_tickRate );
+            m_nextTickTime = PlatformClock::GetTime();
+            m_lastPacingReportTime = m_nextTickTime;
+            EE_LOG_MESSAGE( LogCategory::System, "Engine", "Running headless at %.2f Hz", m_tickRate );
+        }
+        else
+        {
+            ResizeMainWindow( windowDimensions );
+        }
+
         PostInitialize();
 
         return true;
@@ -232,7 +355,10 @@ namespace EE
 
         m_pRenderWindow = nullptr;
 
-        m_pRenderSystem->WaitAllQueuesIdle();
+        if ( m_pRenderSystem != nullptr )
+        {
+            m_pRenderSystem->WaitAllQueuesIdle();
+        }
 
         if ( m_initializationStageReached == Stage::FullyInitialized )
         {
@@ -249,9 +375,12 @@ namespace EE
         {
             // Destroy development tools
             #if EE_DEVELOPMENT_TOOLS
-            EE_ASSERT( m_pToolsUI != nullptr );
-            m_pToolsUI->Shutdown( m_updateContext );
-            EE::Delete( m_pToolsUI );
+            if ( !IsHeadless() )
+            {
+                EE_ASSERT( m_pToolsUI != nullptr );
+                m_pToolsUI->Shutdown( m_updateContext );
+                EE::Delete( m_pToolsUI );
+            }
             #endif
 
             // Wait for resource/object systems to complete all resource unloading
@@ -357,6 +486,11 @@ namespace EE
     {
         EE_ASSERT( m_initializationStageReached == Stage::FullyInitialized );
 
+        if ( IsHeadless() )
+        {
+            return UpdateHeadless();
+        }
+
         // Check for fatal errors
         //-------------------------------------------------------------------------
 
@@ -414,68 +548,7 @@ namespace EE
                 #if EE_DEVELOPMENT_TOOLS
                 if ( m_pResourceSystem->RequiresHotReloading() )
                 {
-                    TInlineVector<ResourceID, 20> const resourcesToReload = m_pResourceSystem->GetResourcesToBeReloaded();
-                    TInlineVector<Resource::ResourceRequesterID, 20> const usersToReload = m_pResourceSystem->GetUsersToBeReloaded();
-
-                    // Unload module resources
-                    for ( auto pModule : m_modules )
-                    {
-                        pModule->HotReload_UnloadResources( *m_pResourceSystem, resourcesToReload );
-                    }
-
-                    // Unload game and tool resources
-                    m_pToolsUI->HotReload_UnloadResources( usersToReload, resourcesToReload );
-
-                    if ( !usersToReload.empty() )
-                    {
-                        m_pEntityWorldManager->HotReload_UnloadEntities( usersToReload );
-                    }
-
-                    // Ensure that all resource requests (both load/unload are completed before continuing with the hot-reload)
-                    m_pResourceSystem->ClearHotReloadRequests();
-                    while ( m_pResourceSystem->IsBusy() )
-                    {
-                        UpdateResourceLoadingRequests_Blocking();
-                    }
-
-                    // Reload game and tool resources
-                    m_pToolsUI->HotReload_ReloadResources( usersToReload, resourcesToReload );
-
-                    if ( !usersToReload.empty() )
-                    {
-                        m_pEntityWorldManager->HotReload_ReloadEntities( usersToReload );
-                    }
-
-                    // Reload module resources
-                    bool shouldWaitForModuleResourceLoad = false;
-                    for ( auto pModule : m_modules )
-                    {
-                        pModule->HotReload_ReloadResources( *m_pResourceSystem, resourcesToReload );
-                        if ( pModule->GetModuleResourceLoadingState() == Module::LoadingState::Busy )
-                        {
-                            shouldWaitForModuleResourceLoad = true;
-                        }
-                    }
-
-                    // Wait for module resources to fully load back in
-                    if ( shouldWaitForModuleResourceLoad )
-                    {
-                        while ( m_pResourceSystem->IsBusy() )
-                        {
-                            UpdateResourceLoadingRequests_Blocking();
-                        }
-
-                        for ( auto pModule : m_modules )
-                        {
-                            Module::LoadingState const state = pModule->GetModuleResourceLoadingState();
-                            EE_ASSERT( state != Module::LoadingState::Busy );
-                            if ( state == Module::LoadingState::Failed )
-                            {
-                                EE_LOG_FATAL_ERROR( LogCategory::Resource, "Hot-Reload", "Failed to hot-reload module resources! Check log for details!" );
-                                runEngineUpdate = false;
-                            }
-                        }
-                    }
+                    runEngineUpdate = HotReloadResources();
                 }
                 #endif
             }
@@ -716,6 +789,9 @@ namespace EE
             }
         }
 
+        // Release all transient frame allocations, nothing allocated from the frame arena may be used past this point
+        Memory::FrameArena::Reset();
+
         // Update Time
         //-------------------------------------------------------------------------
 
@@ -748,8 +824,206 @@ namespace EE
         return true;
     }
 
+    //-------------------------------------------------------------------------
+
+    void Engine::WaitForNextTick()
+    {
+        uint64_t currentTime = PlatformClock::GetTime();
+        if ( currentTime >= m_nextTickTime )
+        {
+            return;
+        }
+
+        EE_PROFILE_SCOPE_ENTITY( "Wait For Next Tick" );
+
+        // OS sleep granularity is coarse, so only sleep while we are comfortably ahead and yield for the remainder
+        constexpr static uint64_t const s_minSleepTime = 2000000; // 2ms
+
+        uint64_t const waitStartTime = currentTime;
+        while ( currentTime < m_nextTickTime )
+        {
+            uint64_t const remainingTime = m_nextTickTime - currentTime;
+            if ( remainingTime > s_minSleepTime )
+            {
+                Threading::Sleep( Nanoseconds( remainingTime - ( s_minSleepTime / 2 ) ).ToMilliseconds() );
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+
+            currentTime = PlatformClock::GetTime();
+        }
+
+        Milliseconds const idleTime = Nanoseconds( currentTime - waitStartTime ).ToMilliseconds();
+        m_framePacingStats.m_totalIdleTime += idleTime;
+        m_framePacingStatsSinceLastReport.m_totalIdleTime += idleTime;
+    }
+
+    bool Engine::UpdateHeadless()
+    {
+        EE_ASSERT( IsHeadless() );
+
+        // Check for fatal errors
+        //-------------------------------------------------------------------------
+
+        if ( SystemLog::HasFatalErrorOccurred() )
+        {
+            return m_fatalErrorHandler( SystemLog::GetFatalError().m_message.c_str() );
+        }
+
+        // Frame Pacing
+        //-------------------------------------------------------------------------
+        // Ticks are scheduled at fixed intervals, when we fall behind we run the late ticks back to back to catch up.
+        // If we fall too far behind, the excess ticks are dropped instead, otherwise a slow tick would cause an ever increasing backlog.
+
+        constexpr static uint64_t const s_maxCatchUpTicks = 4;
+        constexpr static uint64_t const s_pacingReportInterval = 10000000000; // 10s
+
+        uint64_t const tickInterval = uint64_t( 1000000000.0 / m_tickRate );
+        Milliseconds const fixedDeltaTime( 1000.0f / m_tickRate );
+
+        WaitForNextTick();
+
+        uint64_t const tickStartTime = PlatformClock::GetTime();
+        uint64_t const numTicksBehind = ( tickStartTime - m_nextTickTime ) / tickInterval;
+        if ( numTicksBehind > s_maxCatchUpTicks )
+        {
+            uint64_t const numSkippedTicks = numTicksBehind - s_maxCatchUpTicks;
+            m_nextTickTime += numSkippedTicks * tickInterval;
+            m_framePacingStats.m_numSkippedTicks += numSkippedTicks;
+            m_framePacingStatsSinceLastReport.m_numSkippedTicks += numSkippedTicks;
+        }
+
+        Milliseconds const lateness = Nanoseconds( tickStartTime - m_nextTickTime ).ToMilliseconds();
+        bool const isLateTick = ( tickStartTime - m_nextTickTime ) > tickInterval;
+
+        // Simulation Update
+        //-------------------------------------------------------------------------
+
+        Profiling::StartFrame();
+
+        Milliseconds tickTime = 0;
+        {
+            ScopedTimer<PlatformClock> tickTimer( tickTime );
+
+            // Resource System Update
+            //-------------------------------------------------------------------------
+
+            bool runEngineUpdate = true;
+
+            {
+                EE_PROFILE_SCOPE_RESOURCE( "Resource System" );
+
+                if ( !m_pResourceProvider->IsReady() )
+                {
+                    while ( m_pResourceProvider->IsConnecting() )
+                    {
+                        m_pResourceProvider->Update();
+                        Threading::Sleep( 1 );
+                    }
+
+                    if ( !m_pResourceProvider->IsReady() )
+                    {
+                        return m_fatalErrorHandler( "Resource provider connection failed - See log for details" );
+                    }
+                }
+
+                m_pResourceSystem->Update();
+
+                #if EE_DEVELOPMENT_TOOLS
+                if ( m_pResourceSystem->RequiresHotReloading() )
+                {
+                    runEngineUpdate = HotReloadResources();
+                }
+                #endif
+            }
+
+            // World Update
+            //-------------------------------------------------------------------------
+            // Same stage order as the default update, but without input, debug drawing, tools or rendering
+
+            if ( runEngineUpdate )
+            {
+                EE_PROFILE_SCOPE_ENTITY( "Headless World Update" );
+
+                m_updateContext.m_stage = UpdateStage::FrameStart;
+                m_pEntityWorldManager->StartFrame();
+                m_pEntityWorldManager->UpdateLoading();
+                m_pEntityWorldManager->UpdateWorlds( m_updateContext );
+
+                constexpr static UpdateStage const s_stages[] =
+                {
+                    UpdateStage::GameSetup,
+                    UpdateStage::GamePrePhysics,
+                    UpdateStage::PrePhysics,
+                    UpdateStage::Physics,
+                    UpdateStage::PostPhysics,
+                    UpdateStage::GamePostPhysics,
+                    UpdateStage::Paused,
+                    UpdateStage::FrameEnd
+                };
+
+                for ( UpdateStage const stage : s_stages )
+                {
+                    m_updateContext.m_stage = stage;
+                    m_pEntityWorldManager->UpdateWorlds( m_updateContext );
+                }
+
+                m_pEntityWorldManager->EndFrame();
+            }
+        }
+
+        // Release all transient frame allocations, this is done per tick since each tick is a full engine frame
+        Memory::FrameArena::Reset();
+
+        // Update Time
+        //-------------------------------------------------------------------------
+        // The simulation always advances by the fixed delta, regardless of how long the tick took
+
+        m_nextTickTime += tickInterval;
+        m_updateContext.UpdateDeltaTime( fixedDeltaTime );
+        Profiling::EndFrame();
+        EngineClock::Update( fixedDeltaTime );
+
+        // Frame Pacing Stats
+        //-------------------------------------------------------------------------
+
+        for ( FramePacingStats* pStats : { &m_framePacingStats, &m_framePacingStatsSinceLastReport } )
+        {
+            pStats->m_numTicks++;
+            pStats->m_numLateTicks += isLateTick ? 1 : 0;
+            pStats->m_totalTickTime += tickTime;
+            pStats->m_maxTickTime = Math::Max( pStats->m_maxTickTime, tickTime );
+            pStats->m_totalLateness += lateness;
+            pStats->m_maxLateness = Math::Max( pStats->m_maxLateness, lateness );
+        }
+
+        uint64_t const currentTime = PlatformClock::GetTime();
+        if ( ( currentTime - m_lastPacingReportTime ) >= s_pacingReportInterval )
+        {
+            FramePacingStats const& stats = m_framePacingStatsSinceLastReport;
+            float const tickBudget = fixedDeltaTime.ToFloat();
+            EE_LOG_MESSAGE( LogCategory::System, "Frame Pacing", "Ticks: %" PRIu64 ", Avg: %.2fms, Max: %.2fms (Budget: %.2fms), Late: %" PRIu64 ", Skipped: %" PRIu64 ", Avg Lateness: %.2fms, Max Lateness: %.2fms, Idle: %.1f%%",
+                stats.m_numTicks, stats.GetAverageTickTime().ToFloat(), stats.m_maxTickTime.ToFloat(), tickBudget, stats.m_numLateTicks, stats.m_numSkippedTicks,
+                stats.GetAverageLateness().ToFloat(), stats.m_maxLateness.ToFloat(), 100.0f * stats.m_totalIdleTime.ToFloat() / Nanoseconds( currentTime - m_lastPacingReportTime ).ToMilliseconds().ToFloat() );
+
+            m_framePacingStatsSinceLastReport = FramePacingStats();
+            m_lastPacingReportTime = currentTime;
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
     void Engine::ResizeMainWindow( Int2 newMainWindowDimensions )
     {
+        if ( m_pRenderWindow == nullptr )
+        {
+            return;
+        }
+
         Float2 const newWindowDimensions = Float2( newMainWindowDimensions );
         if ( m_pRenderWindow->GetSwapchainSize() != newMainWindowDimensions )
         {
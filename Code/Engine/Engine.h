@@ -31,13 +31,51 @@ namespace EE
 
     public:
 
-        Engine( TFunction<bool( EE::String const& error )>&& errorHandler );
+        enum class Mode : uint8_t
+        {
+            Default,
+
+            // Simulation only (e.g. dedicated servers): no render device, window, render world or tools UI
+            // The worlds are updated on a fixed timestep at the requested tick rate
+            Headless,
+        };
+
+        // Frame pacing stats for the fixed timestep update used when running headless
+        struct FramePacingStats
+        {
+            inline Milliseconds GetAverageTickTime() const { return ( m_numTicks > 0 ) ? Milliseconds( m_totalTickTime / m_numTicks ) : Milliseconds( 0.0f ); }
+            inline Milliseconds GetAverageLateness() const { return ( m_numTicks > 0 ) ? Milliseconds( m_totalLateness / m_numTicks ) : Milliseconds( 0.0f ); }
+
+            uint64_t                                    m_numTicks = 0;
+            uint64_t                                    m_numLateTicks = 0;         // Ticks that started more than a full tick interval after their scheduled time
+            uint64_t                                    m_numSkippedTicks = 0;      // Ticks that were dropped since we fell too far behind to catch up
+            Milliseconds                                m_totalTickTime = 0.0f;
+            Milliseconds                                m_maxTickTime = 0.0f;
+            Milliseconds                                m_totalLateness = 0.0f;
+            Milliseconds                                m_maxLateness = 0.0f;
+            Milliseconds                                m_totalIdleTime = 0.0f;     // Time spent waiting for the next scheduled tick
+        };
+
+        constexpr static float const s_defaultHeadlessTickRate = 30.0f;
+
+        // Headless instances are expected to share a machine with many other instances, so they dont get a worker per core
+        constexpr static int32_t const s_defaultHeadlessNumWorkers = 1;
+
+    public:
+
+        Engine( TFunction<bool( EE::String const& error )>&& errorHandler, Mode mode = Mode::Default );
         virtual ~Engine();
 
-        bool Initialize( int32_t argc, char** argv, Int2 const& windowDimensions );
+        bool Initialize( int32_t argc, char** argv, Int2 const& windowDimensions = Int2::Zero );
         bool Shutdown();
         bool Update();
 
+        inline bool IsHeadless() const { return m_mode == Mode::Headless; }
+
+        // The fixed tick rate (in Hz) used when running headless
+        inline float GetTickRate() const { return m_tickRate; }
+        inline FramePacingStats const& GetFramePacingStats() const { return m_framePacingStats; }
+
         // Needed for window processor access
         Input::InputSystem* GetInputSystem() { return m_pInputSystem; }
 
@@ -76,6 +114,15 @@ namespace EE
         // This is a blocking call to update the resource and render system to process all pending load/unloads requests
         void UpdateResourceLoadingRequests_Blocking();
 
+        // Unload and reload all resources flagged for hot-reload, returns false if the module resources failed to reload
+        #if EE_DEVELOPMENT_TOOLS
+        bool HotReloadResources();
+        #endif
+
+        // Fixed timestep simulation update with no rendering or UI
+        bool UpdateHeadless();
+        void WaitForNextTick();
+
     protected:
 
         TFunction<bool( EE::String const& error )>      m_fatalErrorHandler;
@@ -114,6 +161,16 @@ namespace EE
         //-------------------------------------------------------------------------
 
         Stage                                           m_initializationStageReached = Stage::Uninitialized;
+        Mode                                            m_mode = Mode::Default;
         bool                                            m_exitRequested = false;
+
+        // Headless frame pacing
+        //-------------------------------------------------------------------------
+
+        float                                           m_tickRate = s_defaultHeadlessTickRate;
+        uint64_t                                        m_nextTickTime = 0;             // Platform clock time (ns) at which the next tick is scheduled
+        uint64_t                                        m_lastPacingReportTime = 0;
+        FramePacingStats                                m_framePacingStats;
+        FramePacingStats                                m_framePacingStatsSinceLastReport;
     };
 }
\ No newline at end of file
@@ -101,6 +101,49 @@ namespace EE
         {
             m_windows[1].m_isOpen = true;
         }
+
+        if ( ImGui::BeginMenu( "Update Stage Costs" ) )
+        {
+            DrawUpdateStageStats();
+            ImGui::EndMenu();
+        }
+    }
+
+    void EntityDebugView::DrawUpdateStageStats()
+    {
+        static char const* const stageNames[(int8_t) UpdateStage::NumStages] = { "Frame Start", "Game Setup", "Game Pre-Physics", "Pre-Physics", "Physics", "Post-Physics", "Game Post-Physics", "Frame End", "Paused" };
+
+        if ( ImGui::BeginTable( "StageStats", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+        {
+            ImGui::TableSetupColumn( "Stage" );
+            ImGui::TableSetupColumn( "Entities (ms)" );
+            ImGui::TableSetupColumn( "World Systems (ms)" );
+            ImGui::TableSetupColumn( "Num Entities" );
+            ImGui::TableSetupColumn( "Num Levels" );
+            ImGui::TableSetupColumn( "Largest Level" );
+            ImGui::TableHeadersRow();
+
+            for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+            {
+                EntityWorld::UpdateStageStats const& stats = m_pWorld->GetUpdateStageStats( (UpdateStage) i );
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted( stageNames[i] );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", stats.m_entityUpdateTime.ToFloat() );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", stats.m_worldSystemUpdateTime.ToFloat() );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", stats.m_numEntitiesUpdated );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", stats.m_numDependencyLevels );
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", stats.m_largestDependencyLevel );
+            }
+
+            ImGui::EndTable();
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -45,6 +45,7 @@ namespace EE
 
         void DrawWorldBrowser( EntityWorldUpdateContext const& context );
         void DrawMapLoader( EntityWorldUpdateContext const& context );
+        void DrawUpdateStageStats();
 
         void DrawComponentEntry( EntityComponent const* pComponent );
         void DrawSpatialComponentTree( SpatialEntityComponent const* pComponent );
@@ -12,6 +12,7 @@
 namespace EE
 {
     TEvent<Entity*> Entity::s_entityInternalStateUpdatedEvent;
+    std::atomic<uint32_t> Entity::s_spatialHierarchyVersion = 0;
 
     //-------------------------------------------------------------------------
 
@@ -655,6 +656,8 @@ namespace EE
             pParentEntity->m_attachedEntities.emplace_back( this );
         }
 
+        s_spatialHierarchyVersion.fetch_add( 1, std::memory_order_release );
+
         //-------------------------------------------------------------------------
 
         // If we need to keep our current world position intact, calculate the required local transform offset to do so
@@ -696,6 +699,8 @@ namespace EE
         // Clear attachment data
         m_parentAttachmentSocketID = StringID();
         m_pParentSpatialEntity = nullptr;
+
+        s_spatialHierarchyVersion.fetch_add( 1, std::memory_order_release );
     }
 
     void Entity::CreateSpatialAttachment()
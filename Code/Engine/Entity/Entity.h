@@ -5,6 +5,7 @@
 #include "Engine/UpdateStage.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Types/Event.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 // Entity
@@ -92,6 +93,9 @@ namespace EE
         // Event that's fired whenever a component/system is added or removed
         static TEvent<Entity*>                  s_entityInternalStateUpdatedEvent;
 
+        // Incremented whenever any entity spatial attachment is created or destroyed
+        static std::atomic<uint32_t>            s_spatialHierarchyVersion;
+
         // Registration state
         enum class UpdateRegistrationStatus : uint8_t
         {
@@ -119,6 +123,9 @@ namespace EE
         // Event that's fired whenever an entities internal state changes and it requires an state update
         static TEventHandle<Entity*> OnEntityInternalStateUpdated() { return s_entityInternalStateUpdatedEvent; }
 
+        // Get the current version of the entity attachment hierarchy, any parent/child change between entities will change this value
+        static uint32_t GetSpatialHierarchyVersion() { return s_spatialHierarchyVersion.load( std::memory_order_acquire ); }
+
     public:
 
         Entity() = default;
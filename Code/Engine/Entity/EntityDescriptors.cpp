@@ -26,7 +26,7 @@ namespace EE::EntityModel
         #endif
     }
 
-    EntityComponent* ComponentDescriptor::CreateComponent( TypeSystem::TypeRegistry const& typeRegistry ) const
+    EntityComponent* ComponentDescriptor::CreateComponent( TypeSystem::TypeRegistry const& typeRegistry, TypeSystem::TypeInstantiationProgram const* pProgram ) const
     {
         TypeSystem::TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( m_typeID );
         if ( pTypeInfo == nullptr )
@@ -34,7 +34,7 @@ namespace EE::EntityModel
             return nullptr;
         }
 
-        auto pEntityComponent = CreateType<EntityComponent>( typeRegistry );
+        auto pEntityComponent = CreateType<EntityComponent>( typeRegistry, pTypeInfo, pProgram );
         EE_ASSERT( pEntityComponent != nullptr );
         pEntityComponent->m_name = m_name;
 
@@ -100,7 +100,7 @@ namespace EE::EntityModel
         return InvalidIndex;
     }
 
-    Entity* EntityDescriptor::CreateEntity( TypeSystem::TypeRegistry const& typeRegistry ) const
+    Entity* EntityDescriptor::CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, TypeSystem::TypeInstantiationProgram const* pComponentPrograms ) const
     {
         EE_ASSERT( IsValid() );
 
@@ -126,9 +126,11 @@ namespace EE::EntityModel
         // Component descriptors are sorted during compilation, spatial components are first, followed by regular components
 
         bool componentCreationFailed = false;
-        for ( EntityModel::ComponentDescriptor const& componentDesc : m_components )
+        int32_t const numComponents = (int32_t) m_components.size();
+        for ( int32_t i = 0; i < numComponents; i++ )
         {
-            auto pEntityComponent = componentDesc.CreateComponent( typeRegistry );
+            EntityModel::ComponentDescriptor const& componentDesc = m_components[i];
+            auto pEntityComponent = componentDesc.CreateComponent( typeRegistry, ( pComponentPrograms != nullptr ) ? &pComponentPrograms[i] : nullptr );
             if ( pEntityComponent != nullptr )
             {
                 // Set IDs and add to component lists
@@ -283,19 +285,19 @@ namespace EE::EntityModel
         {
             for ( auto i = 0; i < numEntitiesToCreate; i++ )
             {
-                createdEntities[i] = m_entityDescriptors[i].CreateEntity( typeRegistry );
+                createdEntities[i] = m_entityDescriptors[i].CreateEntity( typeRegistry, GetComponentPrograms( i ) );
             }
         }
         else // Go wide and create all entities in parallel
         {
             struct EntityCreationTask : public ITaskSet
             {
-                EntityCreationTask( TypeSystem::TypeRegistry const& typeRegistry, TVector<EntityDescriptor> const& descriptors, TVector<Entity*>& createdEntities )
+                EntityCreationTask( TypeSystem::TypeRegistry const& typeRegistry, EntityCollection const& collection, TVector<Entity*>& createdEntities )
                     : m_typeRegistry( typeRegistry )
-                    , m_descriptors( descriptors )
+                    , m_collection( collection )
                     , m_createdEntities( createdEntities )
                 {
-                    m_SetSize = (uint32_t) descriptors.size();
+                    m_SetSize = (uint32_t) collection.m_entityDescriptors.size();
                     m_MinRange = 10;
                 }
 
@@ -304,21 +306,21 @@ namespace EE::EntityModel
                     EE_PROFILE_SCOPE_ENTITY( "Entity Creation Task" );
                     for ( uint64_t i = range.start; i < range.end; ++i )
                     {
-                        m_createdEntities[i] = m_descriptors[i].CreateEntity( m_typeRegistry );
+                        m_createdEntities[i] = m_collection.m_entityDescriptors[i].CreateEntity( m_typeRegistry, m_collection.GetComponentPrograms( (int32_t) i ) );
                     }
                 }
 
             private:
 
                 TypeSystem::TypeRegistry const&                     m_typeRegistry;
-                TVector<EntityDescriptor> const&                    m_descriptors;
+                EntityCollection const&                             m_collection;
                 TVector<Entity*>&                                   m_createdEntities;
             };
 
             //-------------------------------------------------------------------------
 
             // Create all entities in parallel
-            EntityCreationTask updateTask( typeRegistry, m_entityDescriptors, createdEntities );
+            EntityCreationTask updateTask( typeRegistry, *this, createdEntities );
             pTaskSystem->ScheduleTask( &updateTask );
             pTaskSystem->WaitForTask( &updateTask );
         }
@@ -367,6 +369,60 @@ namespace EE::EntityModel
         return createdEntities;
     }
 
+    void EntityCollection::PrepareInstantiationPrograms( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        m_componentProgramOffsets.clear();
+
+        if ( m_componentPrograms.empty() )
+        {
+            return;
+        }
+
+        // Calculate the program offsets for each entity
+        //-------------------------------------------------------------------------
+
+        int32_t const numEntities = (int32_t) m_entityDescriptors.size();
+        m_componentProgramOffsets.reserve( numEntities );
+
+        int32_t numComponents = 0;
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            m_componentProgramOffsets.emplace_back( numComponents );
+            numComponents += (int32_t) m_entityDescriptors[i].m_components.size();
+        }
+
+        if ( numComponents != (int32_t) m_componentPrograms.size() )
+        {
+            EE_LOG_WARNING( LogCategory::Entity, "Entity Collection", "Component instantiation program count mismatch, programs will not be used!" );
+            ClearInstantiationPrograms();
+            return;
+        }
+
+        // Validate programs against the runtime type layouts
+        //-------------------------------------------------------------------------
+        // Any program for a type whose layout has changed (i.e. different build configuration) will fall back to regular type descriptor restoration
+
+        THashMap<TypeSystem::TypeID, uint64_t> layoutHashes;
+
+        int32_t programIdx = 0;
+        for ( EntityDescriptor const& entityDesc : m_entityDescriptors )
+        {
+            for ( ComponentDescriptor const& componentDesc : entityDesc.m_components )
+            {
+                auto foundIter = layoutHashes.find( componentDesc.m_typeID );
+                if ( foundIter == layoutHashes.end() )
+                {
+                    TypeSystem::TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( componentDesc.m_typeID );
+                    uint64_t const layoutHash = ( pTypeInfo != nullptr ) ? TypeSystem::TypeInstantiationProgram::CalculateLayoutHash( typeRegistry, pTypeInfo ) : 0;
+                    foundIter = layoutHashes.insert( TPair<TypeSystem::TypeID, uint64_t>( componentDesc.m_typeID, layoutHash ) ).first;
+                }
+
+                m_componentPrograms[programIdx].Validate( foundIter->second );
+                programIdx++;
+            }
+        }
+    }
+
     void EntityCollection::RebuildLookupMap()
     {
         m_entityLookupMap.clear();
@@ -386,6 +442,7 @@ namespace EE::EntityModel
         m_entityDescriptors.clear();
         m_entityLookupMap.clear();
         m_entitySpatialAttachmentInfo.clear();
+        ClearInstantiationPrograms();
     }
 
     void EntityCollection::SetCollectionData( TVector<EntityDescriptor>&& entityDescriptors )
@@ -395,6 +452,7 @@ namespace EE::EntityModel
 
         m_entityDescriptors.swap( entityDescriptors );
         int32_t const numEntities = (int32_t) m_entityDescriptors.size();
+        ClearInstantiationPrograms();
 
         // Generate spatial hierarchy depths
         //-------------------------------------------------------------------------
@@ -474,5 +532,23 @@ namespace EE::EntityModel
             }
         }
     }
+
+    void EntityCollection::CompileInstantiationPrograms( TypeSystem::TypeRegistry const& typeRegistry )
+    {
+        ClearInstantiationPrograms();
+
+        for ( EntityDescriptor const& entityDesc : m_entityDescriptors )
+        {
+            for ( ComponentDescriptor const& componentDesc : entityDesc.m_components )
+            {
+                // Failed programs are left invalid, the component will use the regular type descriptor path
+                TypeSystem::TypeInstantiationProgram& program = m_componentPrograms.emplace_back();
+                if ( !TypeSystem::TypeInstantiationProgram::Compile( typeRegistry, componentDesc, program ) )
+                {
+                    program = TypeSystem::TypeInstantiationProgram();
+                }
+            }
+        }
+    }
     #endif
 }
\ No newline at end of file
@@ -38,7 +38,8 @@ namespace EE::EntityModel
         inline bool IsRootComponent() const { EE_ASSERT( m_isSpatialComponent ); return !m_spatialParentName.IsValid(); }
         inline bool HasSpatialParent() const { EE_ASSERT( m_isSpatialComponent ); return m_spatialParentName.IsValid(); }
 
-        EntityComponent* CreateComponent( TypeSystem::TypeRegistry const& typeRegistry ) const;
+        // Create the component, if a validated instantiation program is supplied, it will be used to set the component's properties
+        EntityComponent* CreateComponent( TypeSystem::TypeRegistry const& typeRegistry, TypeSystem::TypeInstantiationProgram const* pProgram = nullptr ) const;
 
     public:
 
@@ -91,7 +92,8 @@ namespace EE::EntityModel
             return ( componentIdx != InvalidIndex ) ? &m_components[componentIdx] : nullptr;
         }
 
-        Entity* CreateEntity( TypeSystem::TypeRegistry const& typeRegistry ) const;
+        // Create the entity, the optional component programs array needs to have an entry per component (in the same order as the component descriptors)
+        Entity* CreateEntity( TypeSystem::TypeRegistry const& typeRegistry, TypeSystem::TypeInstantiationProgram const* pComponentPrograms = nullptr ) const;
 
         #if EE_DEVELOPMENT_TOOLS
         void ClearAllSerializedIDs();
@@ -125,8 +127,8 @@ namespace EE::EntityModel
 {
     class EE_ENGINE_API EntityCollection : public Resource::IResource
     {
-        EE_RESOURCE( "ec", "Entity Collection", Colors::GreenYellow, 11, false );
-        EE_SERIALIZE( m_entityDescriptors, m_entityLookupMap, m_entitySpatialAttachmentInfo );
+        EE_RESOURCE( "ec", "Entity Collection", Colors::GreenYellow, 12, false );
+        EE_SERIALIZE( m_entityDescriptors, m_entityLookupMap, m_entitySpatialAttachmentInfo, m_componentPrograms );
 
         friend class EntityCollectionLoader;
 
@@ -164,6 +166,9 @@ namespace EE::EntityModel
 
         TVector<Entity*> CreateEntities( TypeSystem::TypeRegistry const& typeRegistry, TaskSystem* pTaskSystem = nullptr ) const;
 
+        // Validate the compiled component instantiation programs against the runtime type layouts, needs to be called once after loading
+        void PrepareInstantiationPrograms( TypeSystem::TypeRegistry const& typeRegistry );
+
         // Entity Access
         //-------------------------------------------------------------------------
 
@@ -249,18 +254,35 @@ namespace EE::EntityModel
         void Clear();
         void SetCollectionData( TVector<EntityDescriptor>&& entityDescriptors );
         void GetAllReferencedResources( TVector<ResourceID>& outReferencedResources ) const;
-        inline TVector<EntityDescriptor>& GetMutableEntityDescriptors() { return m_entityDescriptors; }
+        inline TVector<EntityDescriptor>& GetMutableEntityDescriptors() { ClearInstantiationPrograms(); return m_entityDescriptors; }
+
+        // Compile the component instantiation programs, needs to be called after all modifications to the collection (i.e. just before serializing)
+        void CompileInstantiationPrograms( TypeSystem::TypeRegistry const& typeRegistry );
         #endif
 
     protected:
 
         void RebuildLookupMap();
 
+        inline void ClearInstantiationPrograms()
+        {
+            m_componentPrograms.clear();
+            m_componentProgramOffsets.clear();
+        }
+
+        // Get the component programs for a given entity, returns nullptr if there are no programs for this collection
+        inline TypeSystem::TypeInstantiationProgram const* GetComponentPrograms( int32_t entityIdx ) const
+        {
+            return m_componentProgramOffsets.empty() ? nullptr : m_componentPrograms.data() + m_componentProgramOffsets[entityIdx];
+        }
+
     protected:
 
         TVector<EntityDescriptor>                       m_entityDescriptors;
         THashMap<StringID, int32_t>                     m_entityLookupMap;
         TVector<SpatialAttachmentInfo>                  m_entitySpatialAttachmentInfo;
+        TVector<TypeSystem::TypeInstantiationProgram>   m_componentPrograms; // Optional, one per component (flattened in entity and then component order)
+        TVector<int32_t>                                m_componentProgramOffsets; // Not serialized, the index of the first component program for each entity
     };
 }
 
@@ -279,7 +301,7 @@ namespace EE::EntityModel
 
     class EE_ENGINE_API EntityMapDescriptor final : public EntityCollection
     {
-        EE_RESOURCE( "map", "Map", Colors::SpringGreen, 8, false );
+        EE_RESOURCE( "map", "Map", Colors::SpringGreen, 9, false );
         EE_SERIALIZE( EE_SERIALIZE_BASE( EntityCollection ) );
 
         friend class EntityCollectionCompiler;
@@ -47,6 +47,14 @@ namespace EE::EntityModel
         void SetComponentTypeMapPtr( EntityComponentTypeMap* pMap ) { m_pComponentTypeMap = pMap; }
         #endif
 
+        // Returns whether the entity update list was modified since the last call, and clears the flag
+        inline bool ConsumeEntityUpdateListModification()
+        {
+            bool const wasModified = m_wasEntityUpdateListModified;
+            m_wasEntityUpdateListModified = false;
+            return wasModified;
+        }
+
         inline bool IsValid() const
         {
             #if EE_DEVELOPMENT_TOOLS
@@ -73,6 +81,7 @@ namespace EE::EntityModel
 
         TVector<EntityWorldSystem*> const&                          m_worldSystems;
         TVector<Entity*>&                                           m_entityUpdateList;
+        bool                                                        m_wasEntityUpdateListModified = false;
 
         #if EE_DEVELOPMENT_TOOLS
         EntityComponentTypeMap*                                     m_pComponentTypeMap = nullptr;
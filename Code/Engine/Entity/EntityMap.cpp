@@ -637,6 +637,7 @@ namespace EE::EntityModel
             {
                 EE_ASSERT( pEntity != nullptr && pEntity->m_updateRegistrationStatus == Entity::UpdateRegistrationStatus::QueuedForUnregister );
                 initializationContext.m_entityUpdateList.erase_first_unsorted( pEntity );
+                initializationContext.m_wasEntityUpdateListModified = true;
                 pEntity->m_updateRegistrationStatus = Entity::UpdateRegistrationStatus::Unregistered;
             }
 
@@ -649,6 +650,7 @@ namespace EE::EntityModel
                 EE_ASSERT( pEntity->m_updateRegistrationStatus == Entity::UpdateRegistrationStatus::QueuedForRegister );
                 EE_ASSERT( !pEntity->HasSpatialParent() ); // Attached entities are not allowed to be directly updated
                 initializationContext.m_entityUpdateList.push_back( pEntity );
+                initializationContext.m_wasEntityUpdateListModified = true;
                 pEntity->m_updateRegistrationStatus = Entity::UpdateRegistrationStatus::Registered;
             }
         }
@@ -5,6 +5,7 @@
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "Base/Resource/ResourceSystem.h"
 #include "Base/Profiling.h"
+#include "Base/Time/Timers.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include <eastl/sort.h>
 
@@ -49,8 +50,8 @@ namespace EE
         m_pTaskSystem = systemsRegistry.GetSystem<TaskSystem>();
         EE_ASSERT( m_pTaskSystem != nullptr );
 
-        m_pRenderSystem = systemsRegistry.GetSystem<Render::RenderSystem>();
-        EE_ASSERT( m_pRenderSystem != nullptr );
+        // The render system is optional, there is none when running headless
+        m_pRenderSystem = systemsRegistry.TryGetSystem<Render::RenderSystem>();
 
         // Set up Contexts
         //-------------------------------------------------------------------------
@@ -273,6 +274,67 @@ namespace EE
         }
     }
 
+    void EntityWorld::BuildEntityUpdateLevels()
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Build Entity Update Levels" );
+
+        // Level 0 - all unattached entities
+        //-------------------------------------------------------------------------
+        // Entities can be attached after they were registered for updates, these will be picked up from their parents
+
+        if ( m_entityUpdateLevels.empty() )
+        {
+            m_entityUpdateLevels.emplace_back();
+        }
+
+        TVector<Entity*>& rootLevel = m_entityUpdateLevels[0];
+        rootLevel.clear();
+
+        for ( Entity* pEntity : m_entityUpdateList )
+        {
+            if ( !pEntity->HasSpatialParent() )
+            {
+                rootLevel.emplace_back( pEntity );
+            }
+        }
+
+        // Attached Entities
+        //-------------------------------------------------------------------------
+        // Each subsequent level contains the entities directly attached to the entities in the previous level
+
+        m_numEntityUpdateLevels = 1;
+        while ( true )
+        {
+            if ( m_numEntityUpdateLevels == m_entityUpdateLevels.size() )
+            {
+                m_entityUpdateLevels.emplace_back();
+            }
+
+            TVector<Entity*> const& parentLevel = m_entityUpdateLevels[m_numEntityUpdateLevels - 1];
+            TVector<Entity*>& childLevel = m_entityUpdateLevels[m_numEntityUpdateLevels];
+            childLevel.clear();
+
+            for ( Entity* pEntity : parentLevel )
+            {
+                for ( Entity* pAttachedEntity : pEntity->GetAttachedEntities() )
+                {
+                    childLevel.emplace_back( pAttachedEntity );
+                }
+            }
+
+            if ( childLevel.empty() )
+            {
+                break;
+            }
+
+            m_numEntityUpdateLevels++;
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_areEntityUpdateLevelsDirty = false;
+    }
+
     void EntityWorld::Update( UpdateContext const& context )
     {
         EE_ASSERT( Threading::IsMainThread() );
@@ -287,41 +349,12 @@ namespace EE
                 m_SetSize = (uint32_t) updateList.size();
             }
 
-            // Only used for spatial dependency chain updates
-            inline void RecursiveEntityUpdate( Entity* pEntity )
-            {
-                pEntity->UpdateSystems( m_context );
-
-                for ( auto pAttachedEntity : pEntity->GetAttachedEntities() )
-                {
-                    RecursiveEntityUpdate( pAttachedEntity );
-                }
-            }
-
             virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
             {
                 for ( uint64_t i = range.start; i < range.end; ++i )
                 {
-                    auto pEntity = m_updateList[i];
-
-                    // Ignore any entities with spatial parents, these will be updated by their parents
-                    if ( pEntity->HasSpatialParent() )
-                    {
-                        continue;
-                    }
-
-                    //-------------------------------------------------------------------------
-
-                    if ( pEntity->HasAttachedEntities() )
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity Chain" );
-                        RecursiveEntityUpdate( pEntity );
-                    }
-                    else // Direct entity update
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
-                        pEntity->UpdateSystems( m_context );
-                    }
+                    EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
+                    m_updateList[i]->UpdateSystems( m_context );
                 }
             }
 
@@ -352,21 +385,74 @@ namespace EE
 
         EntityWorldUpdateContext entityWorldUpdateContext( context, this );
 
+        #if EE_DEVELOPMENT_TOOLS
+        UpdateStageStats& stageStats = m_updateStageStats[(int8_t) updateStage];
+        stageStats = UpdateStageStats();
+        #endif
+
         // Update entities
         //-------------------------------------------------------------------------
+        // Attachment chains are updated level by level, parents always get updated before their attached entities
+        // All entities within a level are independent of each other so each level is executed as its own parallel task
 
-        EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList );
-        m_pTaskSystem->ScheduleTask( &entityUpdateTask );
-        m_pTaskSystem->WaitForTask( &entityUpdateTask );
+        {
+            #if EE_DEVELOPMENT_TOOLS
+            ScopedTimer<PlatformClock> timer( stageStats.m_entityUpdateTime );
+            #endif
 
-        // Force execution on main thread for debugging purposes
-        //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
+            // Only rebuild the levels if the update list or the attachment hierarchy has changed
+            uint32_t const hierarchyVersion = Entity::GetSpatialHierarchyVersion();
+            if ( m_initializationContext.ConsumeEntityUpdateListModification() || hierarchyVersion != m_entityUpdateLevelsHierarchyVersion )
+            {
+                m_areEntityUpdateLevelsDirty = true;
+            }
+
+            if ( m_areEntityUpdateLevelsDirty )
+            {
+                m_entityUpdateLevelsHierarchyVersion = hierarchyVersion;
+                BuildEntityUpdateLevels();
+            }
+
+            for ( int32_t levelIdx = 0; levelIdx < m_numEntityUpdateLevels; levelIdx++ )
+            {
+                TVector<Entity*>& updateLevel = m_entityUpdateLevels[levelIdx];
+
+                #if EE_DEVELOPMENT_TOOLS
+                stageStats.m_numEntitiesUpdated += (int32_t) updateLevel.size();
+                stageStats.m_largestDependencyLevel = Math::Max( stageStats.m_largestDependencyLevel, (int32_t) updateLevel.size() );
+                #endif
+
+                // Dont bother scheduling a task for a single entity
+                EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, updateLevel );
+                if ( updateLevel.size() == 1 )
+                {
+                    entityUpdateTask.ExecuteRange( { 0u, 1u }, 0 );
+                }
+                else
+                {
+                    m_pTaskSystem->ScheduleTask( &entityUpdateTask );
+                    m_pTaskSystem->WaitForTask( &entityUpdateTask );
+                }
+
+                // Force execution on main thread for debugging purposes
+                //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) updateLevel.size() }, 0 );
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            stageStats.m_numDependencyLevels = m_numEntityUpdateLevels;
+            #endif
+        }
 
         // Update systems
         //-------------------------------------------------------------------------
 
         {
             EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
+
+            #if EE_DEVELOPMENT_TOOLS
+            ScopedTimer<PlatformClock> timer( stageStats.m_worldSystemUpdateTime );
+            #endif
+
             for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
             {
                 EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
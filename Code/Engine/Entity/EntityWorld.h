@@ -29,6 +29,19 @@ namespace EE
         friend class EntityDebugView;
         friend class EntityWorldUpdateContext;
 
+    public:
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct UpdateStageStats
+        {
+            Milliseconds                                                        m_entityUpdateTime = 0.0f;
+            Milliseconds                                                        m_worldSystemUpdateTime = 0.0f;
+            int32_t                                                             m_numEntitiesUpdated = 0;
+            int32_t                                                             m_numDependencyLevels = 0;
+            int32_t                                                             m_largestDependencyLevel = 0;
+        };
+        #endif
+
     public:
 
         EntityWorld( EntityWorldType worldType = EntityWorldType::Game );
@@ -322,6 +335,9 @@ namespace EE
 
         inline DebugDrawSystem* GetDebugDrawSystem() { return &m_debugDrawSystem; }
         inline void ResetDebugDrawingSystem() { m_debugDrawSystem.Reset(); }
+
+        // Get the cost of the last update for a given stage
+        inline UpdateStageStats const& GetUpdateStageStats( UpdateStage stage ) const { return m_updateStageStats[(int8_t) stage]; }
         #endif
 
         //-------------------------------------------------------------------------
@@ -336,6 +352,11 @@ namespace EE
         void HotReload_ReloadEntities( TInlineVector<Resource::ResourceRequesterID, 20> const& usersToReload );
         #endif
 
+    private:
+
+        // Split the update list into levels based on the spatial attachment hierarchy, each level only depends on the previous level
+        void BuildEntityUpdateLevels();
+
     private:
 
         EntityWorldID                                                           m_worldID = EntityWorldID::Generate();
@@ -358,6 +379,10 @@ namespace EE
 
         // Entities
         TVector<Entity*>                                                        m_entityUpdateList;
+        TVector<TVector<Entity*>>                                               m_entityUpdateLevels;                       // Level 0 contains all unattached entities, level N contains the entities attached to level N-1
+        int32_t                                                                 m_numEntityUpdateLevels = 0;
+        uint32_t                                                                m_entityUpdateLevelsHierarchyVersion = 0;
+        bool                                                                    m_areEntityUpdateLevelsDirty = true;
         TVector<EntityWorldSystem*>                                             m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
 
         // Time Scaling + Pause
@@ -370,6 +395,7 @@ namespace EE
         EntityModel::EntityComponentTypeMap                                     m_componentTypeLookup;
         DebugDrawSystem                                                         m_debugDrawSystem;
         String                                                                  m_debugName;
+        UpdateStageStats                                                        m_updateStageStats[(int8_t) UpdateStage::NumStages];
         #endif
     };
 }
\ No newline at end of file
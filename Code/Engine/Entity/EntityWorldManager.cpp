@@ -4,6 +4,8 @@
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Engine/UpdateContext.h"
 #include "Base/Systems.h"
+#include "Engine/Render/RenderSystem.h"
+#include "Engine/Render/Systems/WorldSystem_Render.h"
 
 //-------------------------------------------------------------------------
 
@@ -24,6 +26,18 @@ namespace EE
         EE_ASSERT( pTypeRegistry != nullptr );
         m_worldSystemTypeInfos = pTypeRegistry->GetAllDerivedLeafTypes( EntityWorldSystem::GetStaticTypeID(), false, false, true );
 
+        // When running headless there is no render system, so there is nothing for the render world system to do
+        if ( systemsRegistry.TryGetSystem<Render::RenderSystem>() == nullptr )
+        {
+            for ( int32_t i = (int32_t) m_worldSystemTypeInfos.size() - 1; i >= 0; i-- )
+            {
+                if ( m_worldSystemTypeInfos[i]->m_ID == Render::RenderWorldSystem::GetStaticTypeID() )
+                {
+                    m_worldSystemTypeInfos.erase( m_worldSystemTypeInfos.begin() + i );
+                }
+            }
+        }
+
         // Create a game world
         //-------------------------------------------------------------------------
 
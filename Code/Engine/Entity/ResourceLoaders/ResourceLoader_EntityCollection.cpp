@@ -37,6 +37,11 @@ namespace EE::EntityModel
             pCollectionDesc = pEC;
         }
 
+        if ( pCollectionDesc != nullptr )
+        {
+            pCollectionDesc->PrepareInstantiationPrograms( *m_pTypeRegistry );
+        }
+
         // Set loaded resource
         pResourceRecord->SetResourceData( pCollectionDesc );
         return Resource::LoadResult::Complete;
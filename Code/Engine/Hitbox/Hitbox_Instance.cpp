@@ -2,6 +2,7 @@
 #include "Engine/Animation/AnimationPose.h"
 #include "Engine/Entity/EntitySpatialComponent.h"
 #include "Base/Drawing/DebugDrawing.h"
+#include "Base/Threading/TaskSystem.h"
 
 #include "EASTL/sort.h"
 
@@ -87,9 +88,139 @@ namespace EE
     // Update
     //-------------------------------------------------------------------------
 
+    int32_t Hitbox::UpdateBatch( TaskSystem* pTaskSystem, Seconds deltaTime, TVector<UpdateRequest> const& requests )
+    {
+        int32_t const numRequests = (int32_t) requests.size();
+        if ( pTaskSystem == nullptr || numRequests < s_minRequestsForParallelUpdate )
+        {
+            int32_t numSkipped = 0;
+            for ( UpdateRequest const& request : requests )
+            {
+                if ( !request.m_pHitbox->Update( deltaTime, request ) )
+                {
+                    numSkipped++;
+                }
+            }
+
+            return numSkipped;
+        }
+
+        //-------------------------------------------------------------------------
+
+        std::atomic<int32_t> numSkipped = 0;
+
+        AsyncTask updateTask( numRequests, [&requests, &numSkipped, deltaTime] ( TaskSetPartition range, uint32_t threadnum )
+        {
+            int32_t numSkippedInRange = 0;
+            for ( uint32_t i = range.start; i < range.end; i++ )
+            {
+                if ( !requests[i].m_pHitbox->Update( deltaTime, requests[i] ) )
+                {
+                    numSkippedInRange++;
+                }
+            }
+
+            numSkipped += numSkippedInRange;
+        } );
+
+        pTaskSystem->ScheduleTask( &updateTask );
+        pTaskSystem->WaitForTask( &updateTask );
+
+        return numSkipped;
+    }
+
+    bool Hitbox::Update( Seconds deltaTime, UpdateRequest const& request )
+    {
+        EE_ASSERT( request.m_pHitbox == this );
+        EE_ASSERT( request.m_pPose != nullptr || request.m_pSpatialComponent != nullptr );
+
+        if ( request.m_pPose == nullptr )
+        {
+            Update( deltaTime, request.m_pSpatialComponent );
+            return true;
+        }
+
+        // Skip the update if nothing changed, the shapes are no longer moving so clear their velocities
+        //-------------------------------------------------------------------------
+
+        if ( m_isLastPoseUpdateIDValid && m_lastPoseUpdateID == request.m_poseUpdateID && m_lastPoseWorldTransform == request.m_poseWorldTransform )
+        {
+            for ( auto pShape : m_shapes )
+            {
+                pShape->m_velocity = Vector::Zero;
+                pShape->m_speed = 0.0f;
+            }
+
+            return false;
+        }
+
+        m_lastPoseUpdateID = request.m_poseUpdateID;
+        m_lastPoseWorldTransform = request.m_poseWorldTransform;
+        m_isLastPoseUpdateIDValid = true;
+
+        // Read the socket transforms from the pose, fallback to the spatial component sockets for non-bone sockets
+        //-------------------------------------------------------------------------
+
+        EE_ASSERT( request.m_pPose->IsPoseSet() && request.m_pPose->HasModelSpaceTransforms() );
+        ResolveShapeBoneIndices( request.m_pPose->GetSkeleton() );
+
+        int32_t const numShapes = GetNumShapes();
+        for ( int32_t i = 0; i < numShapes; i++ )
+        {
+            bool wasSocketFound = false;
+
+            int32_t const boneIdx = m_shapeBoneIndices[i];
+            if ( boneIdx != InvalidIndex )
+            {
+                m_shapes[i]->m_socketTransform = request.m_pPose->GetModelSpaceTransform( boneIdx ) * request.m_poseWorldTransform;
+                wasSocketFound = true;
+            }
+            else if ( request.m_pSpatialComponent != nullptr )
+            {
+                wasSocketFound = request.m_pSpatialComponent->TryGetAttachmentSocketTransform( m_pDefinition->m_shapes[i].m_socketID, m_shapes[i]->m_socketTransform );
+            }
+
+            if ( wasSocketFound )
+            {
+                m_shapes[i]->m_wasValidLastUpdate = m_shapes[i]->m_isValid;
+                m_shapes[i]->m_isValid = true;
+            }
+            else
+            {
+                m_shapes[i]->m_isValid = false;
+                m_shapes[i]->m_wasValidLastUpdate = false;
+            }
+        }
+
+        UpdateShapesAndBounds( deltaTime );
+        return true;
+    }
+
+    void Hitbox::ResolveShapeBoneIndices( Animation::Skeleton const* pSkeleton )
+    {
+        EE_ASSERT( pSkeleton != nullptr );
+
+        if ( m_pResolvedSkeleton == pSkeleton )
+        {
+            return;
+        }
+
+        int32_t const numShapes = GetNumShapes();
+        m_shapeBoneIndices.resize( numShapes );
+        for ( int32_t i = 0; i < numShapes; i++ )
+        {
+            m_shapeBoneIndices[i] = pSkeleton->GetBoneIndex( m_pDefinition->m_shapes[i].m_socketID );
+        }
+
+        m_pResolvedSkeleton = pSkeleton;
+    }
+
+    //-------------------------------------------------------------------------
+
     void Hitbox::Update( Seconds deltaTime, SpatialEntityComponent const* pComponent )
     {
         EE_ASSERT( pComponent != nullptr && pComponent->IsInitialized() );
+        m_isLastPoseUpdateIDValid = false;
 
         int32_t const numShapes = GetNumShapes();
         for ( int32_t i = 0; i < numShapes; i++ )
@@ -115,14 +246,16 @@ namespace EE
     {
         EE_ASSERT( pPose != nullptr && pPose->IsPoseSet() );
         EE_ASSERT( pPose->HasModelSpaceTransforms() );
+        m_isLastPoseUpdateIDValid = false;
 
         //-------------------------------------------------------------------------
 
+        ResolveShapeBoneIndices( pPose->GetSkeleton() );
+
         int32_t const numShapes = GetNumShapes();
         for ( int32_t i = 0; i < numShapes; i++ )
         {
-            auto pSkeleton = pPose->GetSkeleton();
-            int32_t const boneIndex = pSkeleton->GetBoneIndex( m_pDefinition->m_shapes[i].m_socketID );
+            int32_t const boneIndex = m_shapeBoneIndices[i];
             if ( boneIndex != InvalidIndex )
             {
                 m_shapes[i]->m_wasValidLastUpdate = m_shapes[i]->m_isValid;
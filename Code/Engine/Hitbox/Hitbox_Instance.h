@@ -9,13 +9,17 @@
 //-------------------------------------------------------------------------
 // An AABB that defines the bounds for hit-detection for an object
 // Contains a set of internal shapes for more fine grained detection
+//
+// Hitboxes can be updated individually or as a batch, batch updates run as a single parallel job and will skip
+// hitboxes whose pose and world transform have not changed since their last update
 
 namespace EE
 {
     class DebugDrawContext;
     class SpatialEntityComponent;
+    class TaskSystem;
     namespace Render { class SkeletalMesh; }
-    namespace Animation { class Pose; }
+    namespace Animation { class Pose; class Skeleton; }
 
     //-------------------------------------------------------------------------
 
@@ -104,6 +108,31 @@ namespace EE
             float                   m_radius = 0.0f;
         };
 
+        //-------------------------------------------------------------------------
+
+        // A request to update a single hitbox as part of a batch
+        struct UpdateRequest
+        {
+            Hitbox*                             m_pHitbox = nullptr;
+
+            // Used to resolve sockets that are not bones in the pose, or for all shapes if no pose is supplied
+            SpatialEntityComponent const*       m_pSpatialComponent = nullptr;
+
+            // Optional final pose to read the bone transforms from, this needs to have its model-space transforms calculated
+            Animation::Pose const*              m_pPose = nullptr;
+            Transform                           m_poseWorldTransform;
+
+            // The update ID for the pose, if the ID and the world transform haven't changed since the last update, the update is skipped
+            uint32_t                            m_poseUpdateID = 0;
+        };
+
+        // Below this number of requests, batch updates are run on the calling thread
+        constexpr static int32_t const s_minRequestsForParallelUpdate = 4;
+
+        // Update a set of hitboxes as a single parallel job, each hitbox can only be present once in the list
+        // Returns the number of hitboxes that were skipped since their pose was unchanged
+        static int32_t UpdateBatch( TaskSystem* pTaskSystem, Seconds deltaTime, TVector<UpdateRequest> const& requests );
+
     public:
 
         Hitbox( HitboxDefinition const* pDefinition );
@@ -160,6 +189,12 @@ namespace EE
 
     private:
 
+        // Update for a batch request, returns false if the update was skipped
+        bool Update( Seconds deltaTime, UpdateRequest const& request );
+
+        // Cache the bone indices for all the shape sockets
+        void ResolveShapeBoneIndices( Animation::Skeleton const* pSkeleton );
+
         void UpdateShapesAndBounds( Seconds deltaTime );
 
     private:
@@ -171,5 +206,11 @@ namespace EE
         TInlineVector<Box*, 20>                         m_boxes;
         TInlineVector<Capsule*, 20>                     m_capsules;
         AABB                                            m_bounds;
+
+        Animation::Skeleton const*                      m_pResolvedSkeleton = nullptr;
+        TInlineVector<int32_t, 40>                      m_shapeBoneIndices;
+        Transform                                       m_lastPoseWorldTransform;
+        uint32_t                                        m_lastPoseUpdateID = 0;
+        bool                                            m_isLastPoseUpdateIDValid = false;
     };
 }
\ No newline at end of file
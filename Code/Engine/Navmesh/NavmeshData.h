@@ -15,6 +15,10 @@ namespace EE::Navmesh
 
         EE_SERIALIZE( m_graphImage );
 
+    public:
+
+        constexpr static bool const s_compressCompiledData = true;
+
     public:
 
         static ResourceID GetNavmeshResourceIDForMap( ResourceID const& mapResourceID );
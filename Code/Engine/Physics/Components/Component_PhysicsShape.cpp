@@ -93,6 +93,7 @@ namespace EE::Physics
         }
 
         m_kinematicTargetTransform = GetWorldTransform();
+        m_previousSimulatedTransform = m_simulatedTransform = GetWorldTransform();
 
         return IsPhysicsBodyCreated();
     }
@@ -132,6 +133,9 @@ namespace EE::Physics
         m_pPhysicsWorld->LockWrite();
         b3Body_SetTransform( m_physicsBodyID, ToBox3D( worldTransform.GetTranslation() ), ToBox3D( worldTransform.GetRotation() ) );
         m_pPhysicsWorld->UnlockWrite();
+
+        // Dont interpolate across a teleport
+        m_previousSimulatedTransform = m_simulatedTransform = worldTransform;
     }
 
     void PhysicsShapeComponent::MoveTo( Transform const& newWorldTransform )
@@ -156,6 +160,8 @@ namespace EE::Physics
             m_pPhysicsWorld->LockWrite();
             b3Body_SetTransform( m_physicsBodyID, ToBox3D( worldTransform.GetTranslation() ), ToBox3D( worldTransform.GetRotation() ) );
             m_pPhysicsWorld->UnlockWrite();
+
+            m_previousSimulatedTransform = m_simulatedTransform = worldTransform;
         }
     }
 
@@ -118,5 +118,9 @@ namespace EE::Physics
         TEntityWorldSystemSignal<PhysicsShapeComponent> m_rebuildBodySignal;
 
         Transform                                       m_kinematicTargetTransform;
+
+        // The body transforms after the last two fixed steps, used to interpolate the presented transform when simulating asynchronously
+        Transform                                       m_previousSimulatedTransform;
+        Transform                                       m_simulatedTransform;
     };
 }
\ No newline at end of file
@@ -46,6 +46,62 @@ namespace EE::Physics
         {
             m_windows[0].m_isOpen = true;
         }
+
+        bool isAsyncSimulationEnabled = m_pPhysicsWorldSystem->IsAsyncSimulationEnabled();
+        if ( ImGui::Checkbox( "Async Simulation", &isAsyncSimulationEnabled ) )
+        {
+            m_pPhysicsWorldSystem->SetAsyncSimulationEnabled( isAsyncSimulationEnabled );
+        }
+
+        if ( isAsyncSimulationEnabled )
+        {
+            PhysicsWorld::AsyncSimulationStats const& asyncStats = m_pPhysicsWorldSystem->GetPhysicsWorld()->GetAsyncSimulationStatsForLastFrame();
+            ImGui::Text( "Simulation: %.2fms", asyncStats.m_simulationTime.ToFloat() );
+            ImGui::Text( "Overlapped: %.2fms", asyncStats.m_overlappedTime.ToFloat() );
+            ImGui::Text( "Waited: %.2fms", asyncStats.m_waitTime.ToFloat() );
+        }
+
+        if ( ImGui::BeginMenu( "Ragdoll LOD" ) )
+        {
+            PhysicsWorld* pPhysicsWorld = m_pPhysicsWorldSystem->GetPhysicsWorld();
+            PhysicsWorld::RagdollLODSettings settings = pPhysicsWorld->GetRagdollLODSettings();
+
+            bool settingsChanged = false;
+            settingsChanged |= ImGui::Checkbox( "Enabled", &settings.m_isEnabled );
+            settingsChanged |= ImGui::DragFloat( "Full Rate Distance", &settings.m_fullRateDistance, 0.5f, 0.0f, 1000.0f, "%.1fm" );
+            settingsChanged |= ImGui::DragFloat( "Distance Per Interval Step", &settings.m_distancePerIntervalStep, 0.5f, 0.1f, 1000.0f, "%.1fm" );
+            settingsChanged |= ImGui::SliderInt( "Max Update Interval", &settings.m_maxUpdateInterval, 1, 16 );
+            settingsChanged |= ImGui::Checkbox( "Skip Offscreen Pose Following", &settings.m_skipOffscreenPoseFollowing );
+            settingsChanged |= ImGui::DragFloat( "Settled Linear Velocity", &settings.m_settledLinearVelocity, 0.01f, 0.0f, 10.0f, "%.2fm/s" );
+            settingsChanged |= ImGui::DragFloat( "Settled Angular Velocity", &settings.m_settledAngularVelocity, 0.01f, 0.0f, 10.0f, "%.2frad/s" );
+
+            float settleTimeBeforeSleep = settings.m_settleTimeBeforeSleep.ToFloat();
+            if ( ImGui::DragFloat( "Settle Time", &settleTimeBeforeSleep, 0.01f, 0.0f, 10.0f, "%.2fs" ) )
+            {
+                settings.m_settleTimeBeforeSleep = settleTimeBeforeSleep;
+                settingsChanged = true;
+            }
+
+            float reducedRateSettleTimeBeforeSleep = settings.m_reducedRateSettleTimeBeforeSleep.ToFloat();
+            if ( ImGui::DragFloat( "Reduced Rate Settle Time", &reducedRateSettleTimeBeforeSleep, 0.01f, 0.0f, 10.0f, "%.2fs" ) )
+            {
+                settings.m_reducedRateSettleTimeBeforeSleep = reducedRateSettleTimeBeforeSleep;
+                settingsChanged = true;
+            }
+
+            if ( settingsChanged )
+            {
+                pPhysicsWorld->SetRagdollLODSettings( settings );
+            }
+
+            PhysicsWorld::RagdollLODStats const& stats = pPhysicsWorld->GetRagdollLODStatsForLastFrame();
+            ImGui::SeparatorText( "Stats" );
+            ImGui::Text( "Full Rate Ragdolls: %d", stats.m_numFullRate );
+            ImGui::Text( "Reduced Rate Ragdolls: %d", stats.m_numReducedRate );
+            ImGui::Text( "Offscreen Ragdolls: %d", stats.m_numOffscreen );
+            ImGui::Text( "Sleeping Ragdolls: %d", stats.m_numSleeping );
+            ImGui::EndMenu();
+        }
     }
 
     void PhysicsDebugView::DrawMaterialDatabaseView( UpdateContext const& context )
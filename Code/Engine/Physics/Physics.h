@@ -210,8 +210,8 @@ namespace EE::Physics
 
     namespace Core
     {
-        void Initialize();
-        void Shutdown();
+        EE_ENGINE_API void Initialize();
+        EE_ENGINE_API void Shutdown();
 
         #if EE_DEVELOPMENT_TOOLS
         PointerID RegisterDebugShapeInstance( Render::DebugMeshRegistry* pDebugMeshRegistry, b3DebugShape const* pDebugShape );
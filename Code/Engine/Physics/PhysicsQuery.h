@@ -262,4 +262,127 @@ namespace EE::Physics
         Transform                                       m_transform;
         TInlineVector<Overlap, s_initialBufferSize>     m_overlaps;
     };
+
+    //-------------------------------------------------------------------------
+    // Deferred Queries
+    //-------------------------------------------------------------------------
+    // A handle to a query queued on the physics world, the query is resolved at the end of the next simulation
+
+    struct DeferredQueryHandle
+    {
+        inline bool IsValid() const { return m_queryIdx != InvalidIndex; }
+        inline void Clear() { m_resolveIdx = 0; m_queryIdx = InvalidIndex; }
+
+    public:
+
+        uint32_t                m_resolveIdx = 0; // The index of the resolve pass this query will be resolved in
+        int32_t                 m_queryIdx = InvalidIndex;
+    };
+
+    //-------------------------------------------------------------------------
+    // Batched Casts
+    //-------------------------------------------------------------------------
+    // A set of ray and sphere casts that are executed together under a single world lock and split across the task system workers
+    // The queries and results are stored as structure-of-arrays so that large batches (AI perception, audio occlusion, etc.) stay cache friendly
+    // Each query references a shared set of rules, so that thousands of queries with the same filter dont each carry their own ignore lists
+    // Note: batched casts only ever record the closest hit, the multiple hits setting of the rules is ignored
+
+    struct BatchCastQueries
+    {
+        inline int32_t GetNumQueries() const { return (int32_t) m_starts.size(); }
+
+        inline void Reserve( int32_t numQueries )
+        {
+            m_starts.reserve( numQueries );
+            m_ends.reserve( numQueries );
+            m_radii.reserve( numQueries );
+            m_ruleIndices.reserve( numQueries );
+        }
+
+        // Clear all queries, rules are kept so that they can be reused for the next batch
+        inline void ClearQueries()
+        {
+            m_starts.clear();
+            m_ends.clear();
+            m_radii.clear();
+            m_ruleIndices.clear();
+        }
+
+        inline void Clear()
+        {
+            ClearQueries();
+            m_rules.clear();
+        }
+
+        // Add a set of rules that queries can reference, returns the rule index
+        inline int32_t AddRules( QueryRules const& rules )
+        {
+            EE_ASSERT( m_rules.size() < UINT16_MAX );
+            m_rules.emplace_back( rules );
+            return (int32_t) m_rules.size() - 1;
+        }
+
+        inline int32_t AddRayCast( Vector const& start, Vector const& end, int32_t ruleIdx )
+        {
+            return AddQuery( 0.0f, start, end, ruleIdx );
+        }
+
+        inline int32_t AddSphereCast( float radius, Vector const& start, Vector const& end, int32_t ruleIdx )
+        {
+            EE_ASSERT( radius > 0.0f );
+            return AddQuery( radius, start, end, ruleIdx );
+        }
+
+    private:
+
+        inline int32_t AddQuery( float radius, Vector const& start, Vector const& end, int32_t ruleIdx )
+        {
+            EE_ASSERT( ruleIdx >= 0 && ruleIdx < (int32_t) m_rules.size() );
+            m_starts.emplace_back( start.ToFloat3() );
+            m_ends.emplace_back( end.ToFloat3() );
+            m_radii.emplace_back( radius );
+            m_ruleIndices.emplace_back( (uint16_t) ruleIdx );
+            return (int32_t) m_starts.size() - 1;
+        }
+
+    public:
+
+        TVector<Float3>         m_starts;
+        TVector<Float3>         m_ends;
+        TVector<float>          m_radii; // Zero for rays
+        TVector<uint16_t>       m_ruleIndices; // Index into the rules array
+        TVector<QueryRules>     m_rules;
+    };
+
+    //-------------------------------------------------------------------------
+
+    // The closest hit for each query in a batch, indexed by the query index
+    // The buffers are resized by the batch cast, so reusing the same results object between batches avoids any allocations
+    struct BatchCastResults
+    {
+        inline int32_t GetNumResults() const { return (int32_t) m_hasHit.size(); }
+
+        inline bool HasHit( int32_t queryIdx ) const { return m_hasHit[queryIdx] != 0; }
+
+        inline void Resize( int32_t numQueries )
+        {
+            m_hasHit.resize( numQueries );
+            m_distances.resize( numQueries );
+            m_contactPoints.resize( numQueries );
+            m_contactNormals.resize( numQueries );
+            m_bodyIDs.resize( numQueries );
+            m_shapeIDs.resize( numQueries );
+            m_materialIDs.resize( numQueries );
+        }
+
+    public:
+
+        TVector<uint8_t>        m_hasHit;
+        TVector<float>          m_distances; // The distance to the hit along the cast, zero if we started in collision
+        TVector<Float3>         m_contactPoints;
+        TVector<Float3>         m_contactNormals;
+        TVector<b3BodyId>       m_bodyIDs;
+        TVector<b3ShapeId>      m_shapeIDs;
+        TVector<uint64_t>       m_materialIDs;
+    };
 }
\ No newline at end of file
@@ -15,7 +15,7 @@ namespace EE::Physics
         , m_materialRegistry( *systemRegistry.GetSystem<MaterialRegistry>() )
         , m_isGameWorld( isGameWorld )
         #if EE_DEVELOPMENT_TOOLS
-        , m_debugMeshRegistry( *systemRegistry.GetSystem<Render::DebugMeshRegistry>() )
+        , m_pDebugMeshRegistry( systemRegistry.TryGetSystem<Render::DebugMeshRegistry>() )
         #endif
     {
         auto EnqueueTask = [] ( b3TaskCallback* pTask, void* pTaskContext, void* pUserContext, const char* taskName ) -> void*
@@ -62,9 +62,12 @@ namespace EE::Physics
         worldDef.enableContinuous = true;
 
         #if EE_DEVELOPMENT_TOOLS
-        worldDef.createDebugShape = RegisterDebugMesh;
-        worldDef.destroyDebugShape = UnregisterDebugMesh;
-        worldDef.userDebugShapeContext = (void*) &m_debugMeshRegistry;
+        if ( m_pDebugMeshRegistry != nullptr )
+        {
+            worldDef.createDebugShape = RegisterDebugMesh;
+            worldDef.destroyDebugShape = UnregisterDebugMesh;
+            worldDef.userDebugShapeContext = (void*) m_pDebugMeshRegistry;
+        }
         #endif
 
         m_worldID = b3CreateWorld( &worldDef );
@@ -78,6 +81,10 @@ namespace EE::Physics
         };
 
         b3World_SetCustomFilterCallback( m_worldID, CustomFilter, this );
+
+        //-------------------------------------------------------------------------
+
+        m_simulationTask.m_pWorld = this;
     }
 
     PhysicsWorld::~PhysicsWorld()
@@ -89,6 +96,9 @@ namespace EE::Physics
         }
         #endif
 
+        WaitForSimulation();
+        m_taskSystem.WaitForTask( &m_simulationTask );
+
         for ( auto& task : m_tasks )
         {
             m_taskSystem.WaitForTask( &task );
@@ -105,7 +115,9 @@ namespace EE::Physics
     {
         EE_PROFILE_FUNCTION_PHYSICS();
 
-        LockWrite();
+        // Dont use the public lock function, since it would wait on the in-flight simulation (i.e. us) when running asynchronously
+        m_mutex.LockWrite();
+        EE_DEVELOPMENT_TOOLS_ONLY( m_writeLockAcquired = true );
 
         // Adjust time-step
         //-------------------------------------------------------------------------
@@ -128,12 +140,23 @@ namespace EE::Physics
         {
             EE_PROFILE_SCOPE_PHYSICS( "Sim" );
 
+            m_numStepsInLastSimulation = 0;
             while ( m_accumulatedTime >= m_fixedTimeStep )
             {
-                b3World_Step( m_worldID, m_fixedTimeStep, 4 );
                 m_accumulatedTime -= m_fixedTimeStep;
+
+                // The interpolation needs the state between the last two steps, not the state at the start of the frame
+                if ( m_accumulatedTime < m_fixedTimeStep )
+                {
+                    CaptureInterpolationStartTransforms();
+                }
+
+                b3World_Step( m_worldID, m_fixedTimeStep, 4 );
                 m_usedTasks = 0;
+                m_numStepsInLastSimulation++;
             }
+
+            m_interpolationFactor = Math::Clamp( m_accumulatedTime.ToFloat() / m_fixedTimeStep.ToFloat(), 0.0f, 1.0f );
         }
 
         // Handle any sensor events
@@ -157,9 +180,75 @@ namespace EE::Physics
             }
         }
 
+        // Resolve deferred queries against the new world state
+        //-------------------------------------------------------------------------
+
+        ResolveDeferredQueries();
+
         UnlockWrite();
     }
 
+    void PhysicsWorld::BeginSimulate( Seconds deltaTime )
+    {
+        EE_ASSERT( !m_isSimulationInFlight );
+
+        // Ensure that the task has fully completed before we reuse it
+        m_taskSystem.WaitForTask( &m_simulationTask );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_simulationStartTime = PlatformClock::GetTime().ToU64();
+        m_simulationEndTime = m_simulationStartTime;
+        m_firstSimulationWaitTime = UINT64_MAX;
+        #endif
+
+        m_simulationTask.m_deltaTime = deltaTime;
+        m_isSimulationInFlight = true;
+        m_taskSystem.ScheduleTask( &m_simulationTask );
+    }
+
+    void PhysicsWorld::WaitForSimulation() const
+    {
+        if ( m_isSimulationInFlight )
+        {
+            EE_PROFILE_SCOPE_PHYSICS( "Wait For Simulation" );
+
+            #if EE_DEVELOPMENT_TOOLS
+            uint64_t noWaitTime = UINT64_MAX;
+            m_firstSimulationWaitTime.compare_exchange_strong( noWaitTime, PlatformClock::GetTime().ToU64() );
+            #endif
+
+            m_taskSystem.WaitForTask( &m_simulationTask );
+        }
+    }
+
+    void PhysicsWorld::CaptureInterpolationStartTransforms()
+    {
+        int32_t const numBodies = (int32_t) m_interpolatedBodyIDs.size();
+        m_interpolationStartTransforms.resize( numBodies );
+        for ( int32_t i = 0; i < numBodies; i++ )
+        {
+            if ( b3Body_IsValid( m_interpolatedBodyIDs[i] ) )
+            {
+                m_interpolationStartTransforms[i] = FromBox3D( b3Body_GetTransform( m_interpolatedBodyIDs[i] ) );
+            }
+        }
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void PhysicsWorld::UpdateAsyncSimulationStats()
+    {
+        EE_ASSERT( !m_isSimulationInFlight );
+
+        // If nobody waited before the simulation completed, the whole simulation was overlapped
+        uint64_t const endTime = m_simulationEndTime;
+        uint64_t const firstWaitTime = Math::Max( Math::Min( m_firstSimulationWaitTime.load(), endTime ), m_simulationStartTime );
+
+        m_asyncSimulationStats.m_simulationTime = Nanoseconds( endTime - m_simulationStartTime ).ToMilliseconds();
+        m_asyncSimulationStats.m_overlappedTime = Nanoseconds( firstWaitTime - m_simulationStartTime ).ToMilliseconds();
+        m_asyncSimulationStats.m_waitTime = Nanoseconds( endTime - firstWaitTime ).ToMilliseconds();
+    }
+    #endif
+
     PhysicsWorld::AsyncTask* PhysicsWorld::EnqueueAsyncTask( b3TaskCallback* pTask, void* pTaskContext )
     {
         if ( m_usedTasks < PhysicsWorld::s_maxAsyncTasks )
@@ -189,6 +278,7 @@ namespace EE::Physics
 
     void PhysicsWorld::LockRead() const
     {
+        WaitForSimulation();
         m_mutex.LockRead();
         EE_DEVELOPMENT_TOOLS_ONLY( ++m_readLockCount );
     }
@@ -201,6 +291,7 @@ namespace EE::Physics
 
     void PhysicsWorld::LockWrite()
     {
+        WaitForSimulation();
         m_mutex.LockWrite();
         EE_DEVELOPMENT_TOOLS_ONLY( m_writeLockAcquired = true );
     }
@@ -295,14 +386,16 @@ namespace EE::Physics
         return outQuery.HasHits();
     }
 
+    // Note: all cast proxies are relative to the cast origin (i.e. the start position), box3d offsets them by the origin itself
+
     bool PhysicsWorld::SphereCastInternal( float radius, Vector const& start, Vector const& end, Vector const& direction, float distance, CastQuery& outQuery )
     {
-        b3Vec3 origin = ToBox3D( start );
+        b3Vec3 const center = { 0.0f, 0.0f, 0.0f };
 
         b3ShapeProxy proxy = {};
         proxy.count = 1;
         proxy.radius = radius;
-        proxy.points = &origin;
+        proxy.points = &center;
 
         return CastInternal( proxy, Transform( Quaternion::Identity, start ), end, direction, distance, outQuery );
     }
@@ -322,8 +415,8 @@ namespace EE::Physics
 
         b3Vec3 const capsulePoints[2] =
         {
-            ToBox3D( start + capsuleEnds[0] ),
-            ToBox3D( start + capsuleEnds[1] )
+            ToBox3D( capsuleEnds[0] ),
+            ToBox3D( capsuleEnds[1] )
         };
 
         b3ShapeProxy proxy = {};
@@ -337,7 +430,7 @@ namespace EE::Physics
     bool PhysicsWorld::CylinderCastInternal( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, Vector const& direction, float distance, CastQuery& outQuery )
     {
         TInlineVector<b3Vec3, 32> hullPoints;
-        GetTransformedCylinderHullPoints( start, orientation, radius, cylinderPortionHalfHeight, hullPoints );
+        GetTransformedCylinderHullPoints( Vector::Zero, orientation, radius, cylinderPortionHalfHeight, hullPoints );
 
         b3ShapeProxy proxy = {};
         proxy.points = hullPoints.data();
@@ -348,7 +441,7 @@ namespace EE::Physics
 
     bool PhysicsWorld::BoxCastInternal( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, Vector const& direction, float distance, CastQuery& outQuery )
     {
-        b3BoxHull const box = b3MakeTransformedBoxHull( halfExtents.GetX(), halfExtents.GetY(), halfExtents.GetZ(), { ToBox3D( start ), ToBox3D( orientation ) } );
+        b3BoxHull const box = b3MakeTransformedBoxHull( halfExtents.GetX(), halfExtents.GetY(), halfExtents.GetZ(), { ToBox3D( Vector::Zero ), ToBox3D( orientation ) } );
 
         b3ShapeProxy proxy = {};
         proxy.points = box.boxPoints;
@@ -407,18 +500,45 @@ namespace EE::Physics
 
     bool PhysicsWorld::OverlapInternal( b3ShapeProxy& shapeProxy, Transform const& transform, OverlapQuery& outQuery )
     {
-        LockRead();
-
         outQuery.m_transform = transform;
         outQuery.m_overlaps.clear();
         b3World_OverlapShape( m_worldID, ToBox3D( transform.GetTranslation() ), &shapeProxy, ToBox3D( outQuery ), OverlapCallback, &outQuery );
+        return outQuery.HasOverlaps();
+    }
+
+    bool PhysicsWorld::SphereOverlap( float radius, Vector const& position, OverlapQuery& outQuery )
+    {
+        LockRead();
+        bool const result = SphereOverlapInternal( radius, position, outQuery );
+        UnlockRead();
+        return result;
+    }
 
+    bool PhysicsWorld::CapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
+    {
+        LockRead();
+        bool const result = CapsuleOverlapInternal( radius, cylinderPortionHalfHeight, orientation, position, outQuery );
         UnlockRead();
+        return result;
+    }
 
-        return outQuery.HasOverlaps();
+    bool PhysicsWorld::CylinderOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
+    {
+        LockRead();
+        bool const result = CylinderOverlapInternal( radius, cylinderPortionHalfHeight, orientation, position, outQuery );
+        UnlockRead();
+        return result;
     }
 
-    bool PhysicsWorld::SphereOverlap( float radius, Vector const& position, OverlapQuery& outQuery )
+    bool PhysicsWorld::BoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
+    {
+        LockRead();
+        bool const result = BoxOverlapInternal( halfExtents, orientation, position, outQuery );
+        UnlockRead();
+        return result;
+    }
+
+    bool PhysicsWorld::SphereOverlapInternal( float radius, Vector const& position, OverlapQuery& outQuery )
     {
         b3Vec3 origin = ToBox3D( position );
 
@@ -430,7 +550,7 @@ namespace EE::Physics
         return OverlapInternal( proxy, Transform( Quaternion::Identity, position ), outQuery );
     }
 
-    bool PhysicsWorld::CapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
+    bool PhysicsWorld::CapsuleOverlapInternal( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
     {
         Vector capsuleEnds[2] =
         {
@@ -457,7 +577,7 @@ namespace EE::Physics
         return OverlapInternal( proxy, Transform( orientation, position ), outQuery );
     }
 
-    bool PhysicsWorld::CylinderOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
+    bool PhysicsWorld::CylinderOverlapInternal( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
     {
         TInlineVector<b3Vec3, 32> hullPoints;
         GetTransformedCylinderHullPoints( position, orientation, radius, cylinderPortionHalfHeight, hullPoints );
@@ -469,7 +589,7 @@ namespace EE::Physics
         return OverlapInternal( proxy, Transform( orientation, position ), outQuery );
     }
 
-    bool PhysicsWorld::BoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
+    bool PhysicsWorld::BoxOverlapInternal( Vector halfExtents, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery )
     {
         b3BoxHull const box = b3MakeTransformedBoxHull( halfExtents.GetX(), halfExtents.GetY(), halfExtents.GetZ(), { ToBox3D( position ), ToBox3D( orientation ) } );
 
@@ -480,6 +600,514 @@ namespace EE::Physics
         return OverlapInternal( proxy, Transform( orientation, position ), outQuery );
     }
 
+    //-------------------------------------------------------------------------
+    // Deferred Queries
+    //-------------------------------------------------------------------------
+
+    DeferredQueryHandle PhysicsWorld::EnqueueDeferredQuery( DeferredQuery& query, QueryRules const& rules )
+    {
+        Threading::ScopeLock lock( m_deferredQueryMutex );
+
+        if ( query.IsCast() )
+        {
+            query.m_resultIdx = (int32_t) m_pendingQueries.m_castResults.size();
+            m_pendingQueries.m_castResults.emplace_back( rules );
+        }
+        else
+        {
+            query.m_resultIdx = (int32_t) m_pendingQueries.m_overlapResults.size();
+            m_pendingQueries.m_overlapResults.emplace_back( rules );
+        }
+
+        DeferredQueryHandle handle;
+        handle.m_resolveIdx = m_lastResolveIdx + 1;
+        handle.m_queryIdx = (int32_t) m_pendingQueries.m_queries.size();
+        m_pendingQueries.m_queries.emplace_back( query );
+        return handle;
+    }
+
+    DeferredQueryHandle PhysicsWorld::EnqueueRayCast( Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        DeferredQuery query;
+        query.m_type = DeferredQuery::Type::RayCast;
+        query.m_start = start;
+        query.m_end = end;
+        return EnqueueDeferredQuery( query, rules );
+    }
+
+    DeferredQueryHandle PhysicsWorld::EnqueueSphereCast( float radius, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        DeferredQuery query;
+        query.m_type = DeferredQuery::Type::SphereCast;
+        query.m_start = start;
+        query.m_end = end;
+        query.m_shapeParams = Vector( radius );
+        return EnqueueDeferredQuery( query, rules );
+    }
+
+    DeferredQueryHandle PhysicsWorld::EnqueueCapsuleCast( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        DeferredQuery query;
+        query.m_type = DeferredQuery::Type::CapsuleCast;
+        query.m_orientation = orientation;
+        query.m_start = start;
+        query.m_end = end;
+        query.m_shapeParams = Vector( radius, cylinderPortionHalfHeight, 0.0f );
+        return EnqueueDeferredQuery( query, rules );
+    }
+
+    DeferredQueryHandle PhysicsWorld::EnqueueBoxCast( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules )
+    {
+        DeferredQuery query;
+        query.m_type = DeferredQuery::Type::BoxCast;
+        query.m_orientation = orientation;
+        query.m_start = start;
+        query.m_end = end;
+        query.m_shapeParams = halfExtents;
+        return EnqueueDeferredQuery( query, rules );
+    }
+
+    DeferredQueryHandle PhysicsWorld::EnqueueSphereOverlap( float radius, Vector const& position, QueryRules const& rules )
+    {
+        DeferredQuery query;
+        query.m_type = DeferredQuery::Type::SphereOverlap;
+        query.m_start = position;
+        query.m_shapeParams = Vector( radius );
+        return EnqueueDeferredQuery( query, rules );
+    }
+
+    DeferredQueryHandle PhysicsWorld::EnqueueCapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+    {
+        DeferredQuery query;
+        query.m_type = DeferredQuery::Type::CapsuleOverlap;
+        query.m_orientation = orientation;
+        query.m_start = position;
+        query.m_shapeParams = Vector( radius, cylinderPortionHalfHeight, 0.0f );
+        return EnqueueDeferredQuery( query, rules );
+    }
+
+    DeferredQueryHandle PhysicsWorld::EnqueueBoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+    {
+        DeferredQuery query;
+        query.m_type = DeferredQuery::Type::BoxOverlap;
+        query.m_orientation = orientation;
+        query.m_start = position;
+        query.m_shapeParams = halfExtents;
+        return EnqueueDeferredQuery( query, rules );
+    }
+
+    CastQuery const* PhysicsWorld::GetDeferredCastResult( DeferredQueryHandle const& handle ) const
+    {
+        if ( !IsDeferredQueryResolved( handle ) )
+        {
+            return nullptr;
+        }
+
+        DeferredQuery const& query = m_resolvedQueries.m_queries[handle.m_queryIdx];
+        EE_ASSERT( query.IsCast() );
+        return &m_resolvedQueries.m_castResults[query.m_resultIdx];
+    }
+
+    OverlapQuery const* PhysicsWorld::GetDeferredOverlapResult( DeferredQueryHandle const& handle ) const
+    {
+        if ( !IsDeferredQueryResolved( handle ) )
+        {
+            return nullptr;
+        }
+
+        DeferredQuery const& query = m_resolvedQueries.m_queries[handle.m_queryIdx];
+        EE_ASSERT( !query.IsCast() );
+        return &m_resolvedQueries.m_overlapResults[query.m_resultIdx];
+    }
+
+    void PhysicsWorld::ResolvePendingDeferredQueries()
+    {
+        // Keep the previously resolved results alive if nothing new was queued
+        {
+            Threading::ScopeLock lock( m_deferredQueryMutex );
+            if ( m_pendingQueries.m_queries.empty() )
+            {
+                return;
+            }
+        }
+
+        LockWrite();
+        ResolveDeferredQueries();
+        UnlockWrite();
+    }
+
+    void PhysicsWorld::ResolveDeferredQueries()
+    {
+        EE_PROFILE_SCOPE_PHYSICS( "Deferred Queries" );
+        EE_DEVELOPMENT_TOOLS_ONLY( EE_ASSERT( m_writeLockAcquired ) );
+
+        // Take ownership of all the queued queries, any queries queued from now on will be resolved by the next simulation
+        {
+            Threading::ScopeLock lock( m_deferredQueryMutex );
+            m_resolvedQueries.Clear();
+            m_resolvedQueries.Swap( m_pendingQueries );
+            m_lastResolveIdx++;
+        }
+
+        //-------------------------------------------------------------------------
+
+        int32_t const numQueries = (int32_t) m_resolvedQueries.m_queries.size();
+        if ( numQueries < s_minDeferredQueriesToGoWide )
+        {
+            for ( int32_t i = 0; i < numQueries; i++ )
+            {
+                ExecuteDeferredQuery( i );
+            }
+        }
+        else // Go wide, the world is locked for writing by us so the queries are free to read from it in parallel
+        {
+            struct ResolveTask : public ITaskSet
+            {
+                ResolveTask( PhysicsWorld* pWorld, int32_t numQueries )
+                    : m_pWorld( pWorld )
+                {
+                    m_SetSize = (uint32_t) numQueries;
+                    m_MinRange = 8;
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    EE_PROFILE_SCOPE_PHYSICS( "Resolve Deferred Queries" );
+                    for ( uint32_t i = range.start; i < range.end; ++i )
+                    {
+                        m_pWorld->ExecuteDeferredQuery( (int32_t) i );
+                    }
+                }
+
+            private:
+
+                PhysicsWorld*                                       m_pWorld = nullptr;
+            };
+
+            ResolveTask resolveTask( this, numQueries );
+            m_taskSystem.ScheduleTask( &resolveTask );
+            m_taskSystem.WaitForTask( &resolveTask );
+        }
+    }
+
+    void PhysicsWorld::ExecuteDeferredQuery( int32_t queryIdx )
+    {
+        DeferredQuery const& query = m_resolvedQueries.m_queries[queryIdx];
+
+        if ( query.IsCast() )
+        {
+            CastQuery& castQuery = m_resolvedQueries.m_castResults[query.m_resultIdx];
+
+            Vector direction;
+            float distance;
+            ( query.m_end - query.m_start ).ToDirectionAndLength3( direction, distance );
+
+            switch ( query.m_type )
+            {
+                case DeferredQuery::Type::RayCast:
+                {
+                    RayCastInternal( query.m_start, query.m_end, direction, distance, castQuery );
+                }
+                break;
+
+                case DeferredQuery::Type::SphereCast:
+                {
+                    SphereCastInternal( query.m_shapeParams.GetX(), query.m_start, query.m_end, direction, distance, castQuery );
+                }
+                break;
+
+                case DeferredQuery::Type::CapsuleCast:
+                {
+                    CapsuleCastInternal( query.m_shapeParams.GetX(), query.m_shapeParams.GetY(), query.m_orientation, query.m_start, query.m_end, direction, distance, castQuery );
+                }
+                break;
+
+                case DeferredQuery::Type::BoxCast:
+                {
+                    BoxCastInternal( query.m_shapeParams, query.m_orientation, query.m_start, query.m_end, direction, distance, castQuery );
+                }
+                break;
+
+                default:
+                {
+                    EE_UNREACHABLE_CODE();
+                }
+                break;
+            }
+        }
+        else
+        {
+            OverlapQuery& overlapQuery = m_resolvedQueries.m_overlapResults[query.m_resultIdx];
+
+            switch ( query.m_type )
+            {
+                case DeferredQuery::Type::SphereOverlap:
+                {
+                    SphereOverlapInternal( query.m_shapeParams.GetX(), query.m_start, overlapQuery );
+                }
+                break;
+
+                case DeferredQuery::Type::CapsuleOverlap:
+                {
+                    CapsuleOverlapInternal( query.m_shapeParams.GetX(), query.m_shapeParams.GetY(), query.m_orientation, query.m_start, overlapQuery );
+                }
+                break;
+
+                case DeferredQuery::Type::BoxOverlap:
+                {
+                    BoxOverlapInternal( query.m_shapeParams, query.m_orientation, query.m_start, overlapQuery );
+                }
+                break;
+
+                default:
+                {
+                    EE_UNREACHABLE_CODE();
+                }
+                break;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Batched Queries
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        // Closest hit tracking for a single batched cast, lives on the stack so that batched casts never allocate
+        struct BatchCastContext
+        {
+            QueryRules const*                                   m_pRules = nullptr;
+            b3ShapeId                                           m_shapeID = {};
+            b3Vec3                                              m_point = {};
+            b3Vec3                                              m_normal = {};
+            uint64_t                                            m_materialID = 0;
+            float                                               m_fraction = 1.0f;
+            bool                                                m_hasHit = false;
+        };
+    }
+
+    static float BatchCastCallback( b3ShapeId shapeID, b3Vec3 point, b3Vec3 normal, float fraction, uint64_t userMaterialId, int32_t triangleIndex, int childIndex, void* pContext )
+    {
+        BatchCastContext* pCastContext = (BatchCastContext*) pContext;
+
+        // Handle ignore rules
+        UserData* pUserData = (UserData*) ( b3Shape_GetUserData( shapeID ) );
+        if ( pUserData != nullptr )
+        {
+            if ( pCastContext->m_pRules->IsEntityIgnored( pUserData->m_entityID ) )
+            {
+                return -1.0f;
+            }
+
+            if ( pCastContext->m_pRules->IsComponentIgnored( pUserData->m_componentID ) )
+            {
+                return -1.0f;
+            }
+        }
+
+        // Callbacks are not ordered, so we only overwrite the hit if it is closer
+        if ( !pCastContext->m_hasHit || fraction < pCastContext->m_fraction )
+        {
+            pCastContext->m_shapeID = shapeID;
+            pCastContext->m_point = point;
+            pCastContext->m_normal = normal;
+            pCastContext->m_materialID = userMaterialId;
+            pCastContext->m_fraction = fraction;
+            pCastContext->m_hasHit = true;
+        }
+
+        // Clip the cast to the current closest hit
+        return pCastContext->m_fraction;
+    }
+
+    void PhysicsWorld::BatchCast( BatchCastQueries const& queries, BatchCastResults& outResults )
+    {
+        EE_PROFILE_FUNCTION_PHYSICS();
+
+        int32_t const numQueries = queries.GetNumQueries();
+        EE_ASSERT( (int32_t) queries.m_ends.size() == numQueries && (int32_t) queries.m_radii.size() == numQueries && (int32_t) queries.m_ruleIndices.size() == numQueries );
+
+        outResults.Resize( numQueries );
+        if ( numQueries == 0 )
+        {
+            return;
+        }
+
+        // Convert the rules filters once for the whole batch
+        TInlineVector<b3QueryFilter, 8> filters;
+        filters.reserve( queries.m_rules.size() );
+        for ( QueryRules const& rules : queries.m_rules )
+        {
+            filters.emplace_back( ToBox3D( rules ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        LockRead();
+
+        if ( numQueries < s_minBatchCastsToGoWide )
+        {
+            ExecuteBatchCasts( queries, filters.data(), 0, numQueries, outResults );
+        }
+        else // Go wide, all workers share our read lock
+        {
+            struct BatchCastTask : public ITaskSet
+            {
+                BatchCastTask( PhysicsWorld const* pWorld, BatchCastQueries const& queries, b3QueryFilter const* pFilters, BatchCastResults& results )
+                    : m_pWorld( pWorld )
+                    , m_queries( queries )
+                    , m_pFilters( pFilters )
+                    , m_results( results )
+                {
+                    m_SetSize = (uint32_t) queries.GetNumQueries();
+                    m_MinRange = 32;
+                }
+
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    EE_PROFILE_SCOPE_PHYSICS( "Batch Cast" );
+                    m_pWorld->ExecuteBatchCasts( m_queries, m_pFilters, (int32_t) range.start, (int32_t) range.end, m_results );
+                }
+
+            private:
+
+                PhysicsWorld const*                                 m_pWorld = nullptr;
+                BatchCastQueries const&                             m_queries;
+                b3QueryFilter const*                                m_pFilters = nullptr;
+                BatchCastResults&                                   m_results;
+            };
+
+            BatchCastTask batchCastTask( this, queries, filters.data(), outResults );
+            m_taskSystem.ScheduleTask( &batchCastTask );
+            m_taskSystem.WaitForTask( &batchCastTask );
+        }
+
+        UnlockRead();
+    }
+
+    void PhysicsWorld::ExecuteBatchCasts( BatchCastQueries const& queries, b3QueryFilter const* pFilters, int32_t startIdx, int32_t endIdx, BatchCastResults& outResults ) const
+    {
+        for ( int32_t i = startIdx; i < endIdx; i++ )
+        {
+            uint16_t const ruleIdx = queries.m_ruleIndices[i];
+
+            BatchCastContext context;
+            context.m_pRules = &queries.m_rules[ruleIdx];
+
+            Float3 const& start = queries.m_starts[i];
+            Float3 const& end = queries.m_ends[i];
+            b3Vec3 const origin = ToBox3D( start );
+            b3Vec3 const translation = { end.m_x - start.m_x, end.m_y - start.m_y, end.m_z - start.m_z };
+
+            float const radius = queries.m_radii[i];
+            if ( radius > 0.0f )
+            {
+                // The proxy points are relative to the cast origin
+                b3Vec3 const center = { 0.0f, 0.0f, 0.0f };
+
+                b3ShapeProxy proxy = {};
+                proxy.count = 1;
+                proxy.radius = radius;
+                proxy.points = &center;
+
+                b3World_CastShape( m_worldID, origin, &proxy, translation, pFilters[ruleIdx], BatchCastCallback, &context );
+            }
+            else
+            {
+                b3World_CastRay( m_worldID, origin, translation, pFilters[ruleIdx], BatchCastCallback, &context );
+            }
+
+            // Write results
+            //-------------------------------------------------------------------------
+
+            outResults.m_hasHit[i] = context.m_hasHit ? 1 : 0;
+            if ( context.m_hasHit )
+            {
+                outResults.m_distances[i] = context.m_fraction * b3Length( translation );
+                outResults.m_contactPoints[i] = FromBox3D( context.m_point );
+                outResults.m_contactNormals[i] = FromBox3D( context.m_normal );
+                outResults.m_bodyIDs[i] = b3Shape_GetBody( context.m_shapeID );
+                outResults.m_shapeIDs[i] = context.m_shapeID;
+                outResults.m_materialIDs[i] = context.m_materialID;
+            }
+            else
+            {
+                outResults.m_distances[i] = 0.0f;
+                outResults.m_bodyIDs[i] = b3_nullBodyId;
+                outResults.m_shapeIDs[i] = b3_nullShapeId;
+                outResults.m_materialIDs[i] = 0;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Ragdoll LOD
+    //-------------------------------------------------------------------------
+
+    void PhysicsWorld::SetRagdollLODViews( TInlineVector<Viewport*, 3> const& viewports )
+    {
+        m_ragdollLODViewPositions.clear();
+        m_ragdollLODViewVolumes.clear();
+
+        for ( Viewport const* pViewport : viewports )
+        {
+            m_ragdollLODViewPositions.emplace_back( pViewport->GetViewPosition() );
+            m_ragdollLODViewVolumes.emplace_back( pViewport->GetViewVolume() );
+        }
+
+        // The views are set once per frame after all the ragdolls have been updated, so this is where we close off the stats for the frame
+        #if EE_DEVELOPMENT_TOOLS
+        m_ragdollLODStats.m_numFullRate = m_numFullRateRagdolls.exchange( 0 );
+        m_ragdollLODStats.m_numReducedRate = m_numReducedRateRagdolls.exchange( 0 );
+        m_ragdollLODStats.m_numOffscreen = m_numOffscreenRagdolls.exchange( 0 );
+        m_ragdollLODStats.m_numSleeping = m_numSleepingRagdolls.exchange( 0 );
+        #endif
+    }
+
+    bool PhysicsWorld::GetRagdollLODSignificance( AABB const& bounds, float& outDistance, bool& outIsVisible ) const
+    {
+        if ( !m_ragdollLODSettings.m_isEnabled || m_ragdollLODViewPositions.empty() )
+        {
+            return false;
+        }
+
+        outDistance = FLT_MAX;
+        outIsVisible = false;
+
+        Vector const position = bounds.GetCenter();
+        int32_t const numViews = (int32_t) m_ragdollLODViewPositions.size();
+        for ( int32_t i = 0; i < numViews; i++ )
+        {
+            outDistance = Math::Min( outDistance, position.GetDistance3( m_ragdollLODViewPositions[i] ) );
+            outIsVisible = outIsVisible || m_ragdollLODViewVolumes[i].Contains( bounds );
+        }
+
+        return true;
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void PhysicsWorld::RecordRagdollLOD( int32_t updateInterval, bool isVisible, bool isSleeping )
+    {
+        if ( isSleeping )
+        {
+            m_numSleepingRagdolls++;
+        }
+        else if ( !isVisible )
+        {
+            m_numOffscreenRagdolls++;
+        }
+        else if ( updateInterval > 1 )
+        {
+            m_numReducedRateRagdolls++;
+        }
+        else
+        {
+            m_numFullRateRagdolls++;
+        }
+    }
+    #endif
+
     //-------------------------------------------------------------------------
     // Debug
     //-------------------------------------------------------------------------
@@ -493,6 +1121,8 @@ namespace EE::Physics
             return;
         }
 
+        WaitForSimulation();
+
         //-------------------------------------------------------------------------
 
         auto DrawShapeCallback = [] ( void* pUserShape, b3Transform transform, b3HexColor color, void* pContext ) -> bool
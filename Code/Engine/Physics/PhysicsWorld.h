@@ -4,6 +4,7 @@
 #include "Engine/Physics/PhysicsQuery.h"
 #include "Base/Time/Time.h"
 #include "Base/Math/Transform.h"
+#include "Base/Math/ViewVolume.h"
 #include "Base/Threading/TaskSystem.h"
 #include "Base/Threading/Threading.h"
 #include "Base/Profiling.h"
@@ -50,9 +51,86 @@ namespace EE::Physics
             void*               m_pTaskContext = nullptr;
         };
 
+        // Runs the simulation for a frame when asynchronous simulation is enabled
+        class SimulationTask : public ITaskSet
+        {
+        public:
+
+            SimulationTask() = default;
+
+            virtual void ExecuteRange( enki::TaskSetPartition range, uint32_t threadIndex ) override
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Async Simulation" );
+                m_pWorld->Simulate( m_deltaTime );
+                EE_DEVELOPMENT_TOOLS_ONLY( m_pWorld->m_simulationEndTime = PlatformClock::GetTime().ToU64() );
+                m_pWorld->m_isSimulationInFlight = false;
+            }
+
+        public:
+
+            PhysicsWorld*       m_pWorld = nullptr;
+            Seconds             m_deltaTime = 0.0f;
+        };
+
         // The distance that the shape is pushed away from a detected collision after a sweep - currently set to 5mm as that is a relatively standard value
         static constexpr float const s_sweepSeperationDistance = 0.005f;
 
+        // Below this number of deferred queries, we resolve them on the simulating thread rather than going wide
+        static constexpr int32_t const s_minDeferredQueriesToGoWide = 16;
+
+        // Below this number of batched casts, we execute them on the calling thread rather than going wide
+        static constexpr int32_t const s_minBatchCastsToGoWide = 64;
+
+        //-------------------------------------------------------------------------
+
+        struct DeferredQuery
+        {
+            enum class Type : uint8_t
+            {
+                RayCast,
+                SphereCast,
+                CapsuleCast,
+                BoxCast,
+                SphereOverlap,
+                CapsuleOverlap,
+                BoxOverlap,
+            };
+
+            inline bool IsCast() const { return m_type <= Type::BoxCast; }
+
+        public:
+
+            Quaternion                                          m_orientation = Quaternion::Identity;
+            Vector                                              m_start = Vector::Zero; // Start position for casts, position for overlaps
+            Vector                                              m_end = Vector::Zero;
+            Vector                                              m_shapeParams = Vector::Zero; // Radius (and cylinder half height) for spheres/capsules, half-extents for boxes
+            int32_t                                             m_resultIdx = InvalidIndex; // Index into either the cast or overlap results
+            Type                                                m_type = Type::RayCast;
+        };
+
+        struct DeferredQueryBuffer
+        {
+            inline void Clear()
+            {
+                m_queries.clear();
+                m_castResults.clear();
+                m_overlapResults.clear();
+            }
+
+            inline void Swap( DeferredQueryBuffer& rhs )
+            {
+                m_queries.swap( rhs.m_queries );
+                m_castResults.swap( rhs.m_castResults );
+                m_overlapResults.swap( rhs.m_overlapResults );
+            }
+
+        public:
+
+            TVector<DeferredQuery>                              m_queries;
+            TVector<CastQuery>                                  m_castResults;
+            TVector<OverlapQuery>                               m_overlapResults;
+        };
+
     public:
 
         PhysicsWorld( SystemRegistry const& systemRegistry, bool isGameWorld );
@@ -68,11 +146,49 @@ namespace EE::Physics
         // Locks
         //-------------------------------------------------------------------------
 
+        // Note: acquiring either lock will first wait for any in-flight asynchronous simulation to complete
         void LockRead() const;
         void UnlockRead() const;
         void LockWrite();
         void UnlockWrite();
 
+        // Asynchronous Simulation
+        //-------------------------------------------------------------------------
+        // When the world is simulated asynchronously, the simulation is kicked off during the physics stage and runs alongside the rest of the frame
+        // Anything that needs the simulation results (i.e. post-physics pose tasks) needs to wait for the simulation to complete
+        // All world access goes through the locks, which implicitly wait, so an explicit wait is only needed to control where the frame blocks
+
+        // Is there an asynchronous simulation currently running
+        inline bool IsSimulationInFlight() const { return m_isSimulationInFlight; }
+
+        // Block until any in-flight simulation has completed, this is a no-op if there is nothing in-flight
+        void WaitForSimulation() const;
+
+        // The number of fixed steps that were performed by the last simulation, only valid when there is no simulation in-flight
+        inline int32_t GetNumStepsInLastSimulation() const { EE_ASSERT( !m_isSimulationInFlight ); return m_numStepsInLastSimulation; }
+
+        // How far we are between the last two fixed steps (0-1), used to interpolate simulated transforms for presentation, only valid when there is no simulation in-flight
+        inline float GetInterpolationFactor() const { EE_ASSERT( !m_isSimulationInFlight ); return m_interpolationFactor; }
+
+        // The bodies whose transforms are captured just before the last fixed step of each simulation, so that they can be interpolated between the last two steps
+        // Note: this can only be modified while there is no simulation in-flight
+        inline TVector<b3BodyId>& GetInterpolatedBodies() { EE_ASSERT( !m_isSimulationInFlight ); return m_interpolatedBodyIDs; }
+
+        // The transforms of the interpolated bodies before the last fixed step (in the same order as the interpolated bodies)
+        // Only valid when there is no simulation in-flight and the last simulation performed at least one step
+        inline TVector<Transform> const& GetInterpolationStartTransforms() const { EE_ASSERT( !m_isSimulationInFlight ); return m_interpolationStartTransforms; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct AsyncSimulationStats
+        {
+            Milliseconds                                        m_simulationTime = 0.0f;    // How long the simulation took
+            Milliseconds                                        m_overlappedTime = 0.0f;    // How much of the simulation ran before anyone needed its results
+            Milliseconds                                        m_waitTime = 0.0f;          // How long the first thread that needed the results was blocked for
+        };
+
+        inline AsyncSimulationStats const& GetAsyncSimulationStatsForLastFrame() const { return m_asyncSimulationStats; }
+        #endif
+
         // Queries
         //-------------------------------------------------------------------------
 
@@ -221,6 +337,80 @@ namespace EE::Physics
             return BoxOverlap( halfExtents, shapeTransform.GetRotation(), shapeTransform.GetTranslation(), outQuery );
         }
 
+        // Deferred Queries
+        //-------------------------------------------------------------------------
+        // Deferred queries are only queued (no world lock needed) and are resolved as a single batch at the end of the next simulation, while the world is already locked
+        // While the world is paused, there is no simulation so the pending queries are resolved by the paused update instead
+        // The results are available once the world has been simulated (i.e. the next frame for anything running before the physics stage), and remain valid until the following simulation
+        // Prefer these for any queries that can tolerate a frame of latency, so that gameplay code never stalls on the simulation lock
+        // Note: results can only be read from update stages that dont overlap the simulation
+
+        DeferredQueryHandle EnqueueRayCast( Vector const& start, Vector const& end, QueryRules const& rules );
+        DeferredQueryHandle EnqueueSphereCast( float radius, Vector const& start, Vector const& end, QueryRules const& rules );
+        DeferredQueryHandle EnqueueCapsuleCast( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+        DeferredQueryHandle EnqueueBoxCast( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, QueryRules const& rules );
+        DeferredQueryHandle EnqueueSphereOverlap( float radius, Vector const& position, QueryRules const& rules );
+        DeferredQueryHandle EnqueueCapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules );
+        DeferredQueryHandle EnqueueBoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, QueryRules const& rules );
+
+        // Has this query been resolved and is its result still available
+        inline bool IsDeferredQueryResolved( DeferredQueryHandle const& handle ) const { WaitForSimulation(); return handle.IsValid() && handle.m_resolveIdx == m_lastResolveIdx; }
+
+        // Get the result of a deferred cast, returns nullptr if the query has not been resolved yet or if the result has expired
+        CastQuery const* GetDeferredCastResult( DeferredQueryHandle const& handle ) const;
+
+        // Get the result of a deferred overlap, returns nullptr if the query has not been resolved yet or if the result has expired
+        OverlapQuery const* GetDeferredOverlapResult( DeferredQueryHandle const& handle ) const;
+
+        // Batched Queries
+        //-------------------------------------------------------------------------
+        // Execute a batch of casts under a single read lock, large batches are split across the task system workers
+        // Note: this blocks until all queries are complete, the results buffer is resized to the number of queries
+
+        void BatchCast( BatchCastQueries const& queries, BatchCastResults& outResults );
+
+        // Ragdoll LOD
+        //-------------------------------------------------------------------------
+        // Ragdolls determine their significance from the views registered with the world (i.e. the viewports from the last physics update)
+        // The views are only updated during the physics stage, so they are safe to read from any other stage without locking
+
+        struct RagdollLODSettings
+        {
+            bool                                                m_isEnabled = true;
+            float                                               m_fullRateDistance = 15.0f;                 // Visible ragdolls closer than this update their pose-following every frame
+            float                                               m_distancePerIntervalStep = 15.0f;          // Every step of this distance beyond the full-rate distance adds a frame between pose-following updates
+            int32_t                                             m_maxUpdateInterval = 4;                    // The maximum number of frames between pose-following updates for visible ragdolls
+            bool                                                m_skipOffscreenPoseFollowing = true;        // Ragdolls not in any view keep their last motor targets rather than following the pose
+            float                                               m_settledLinearVelocity = 0.15f;            // A simulated ragdoll is settled once all its bodies are below both of these velocities
+            float                                               m_settledAngularVelocity = 0.3f;
+            Seconds                                             m_settleTimeBeforeSleep = 0.5f;             // How long a visible full-rate ragdoll needs to remain settled before we put it to sleep
+            Seconds                                             m_reducedRateSettleTimeBeforeSleep = 0.2f;  // How long a distant or offscreen ragdoll needs to remain settled before we put it to sleep
+        };
+
+        inline void SetRagdollLODSettings( RagdollLODSettings const& settings ) { m_ragdollLODSettings = settings; }
+        inline RagdollLODSettings const& GetRagdollLODSettings() const { return m_ragdollLODSettings; }
+
+        // Set the views used to determine ragdoll significance, without any views all ragdolls are treated as fully significant
+        void SetRagdollLODViews( TInlineVector<Viewport*, 3> const& viewports );
+
+        // Get the distance to the closest view and whether the bounds are visible in any view, returns false if there are no views (or the LOD is disabled)
+        bool GetRagdollLODSignificance( AABB const& bounds, float& outDistance, bool& outIsVisible ) const;
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct RagdollLODStats
+        {
+            int32_t                                             m_numFullRate = 0;
+            int32_t                                             m_numReducedRate = 0;
+            int32_t                                             m_numOffscreen = 0;
+            int32_t                                             m_numSleeping = 0;
+        };
+
+        // Called by each ragdoll when it is updated
+        void RecordRagdollLOD( int32_t updateInterval, bool isVisible, bool isSleeping );
+
+        inline RagdollLODStats const& GetRagdollLODStatsForLastFrame() const { return m_ragdollLODStats; }
+        #endif
+
     private:
 
         PhysicsWorld( PhysicsWorld const& ) = delete;
@@ -233,6 +423,20 @@ namespace EE::Physics
 
         void Simulate( Seconds deltaTime );
 
+        // Kick off an asynchronous simulation, this returns immediately
+        void BeginSimulate( Seconds deltaTime );
+
+        // Resolve any queued deferred queries without simulating (i.e. when the world is paused)
+        void ResolvePendingDeferredQueries();
+
+        // Capture the transforms of the interpolated bodies, needs to be called while the world is write locked
+        void CaptureInterpolationStartTransforms();
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Calculate how much of the last asynchronous simulation was overlapped with the rest of the frame, needs to be called once the simulation has completed
+        void UpdateAsyncSimulationStats();
+        #endif
+
         AsyncTask* EnqueueAsyncTask( b3TaskCallback* pTask, void* pTaskContext );
         void WaitForAsyncTask( AsyncTask *pAsyncTask );
 
@@ -245,8 +449,28 @@ namespace EE::Physics
         bool CylinderCastInternal( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& end, Vector const& directionAndDistance, float distance, CastQuery& outQuery );
         bool BoxCastInternal( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, Vector const& direction, float distance, CastQuery& outQuery );
         bool CastInternal( b3ShapeProxy& shapeProxy, Transform const& startTransform, Vector const& end, Vector const& direction, float distance, CastQuery& outQuery );
+
+        // Note: the overlap internal functions do not lock the world
+        bool SphereOverlapInternal( float radius, Vector const& position, OverlapQuery& outQuery );
+        bool CapsuleOverlapInternal( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery );
+        bool CylinderOverlapInternal( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery );
+        bool BoxOverlapInternal( Vector halfExtents, Quaternion const& orientation, Vector const& position, OverlapQuery& outQuery );
         bool OverlapInternal( b3ShapeProxy& shapeProxy, Transform const& transform, OverlapQuery& outQuery );
 
+        // Deferred Queries
+        //-------------------------------------------------------------------------
+
+        DeferredQueryHandle EnqueueDeferredQuery( DeferredQuery& query, QueryRules const& rules );
+
+        // Resolve all queued queries, needs to be called while the world is write locked
+        void ResolveDeferredQueries();
+        void ExecuteDeferredQuery( int32_t queryIdx );
+
+        // Batched Queries
+        //-------------------------------------------------------------------------
+
+        void ExecuteBatchCasts( BatchCastQueries const& queries, b3QueryFilter const* pFilters, int32_t startIdx, int32_t endIdx, BatchCastResults& outResults ) const;
+
         #if EE_DEVELOPMENT_TOOLS
         void DrawDebug( Viewport* pViewport ) const;
         bool IsRecording() const { return m_pRecording != nullptr; }
@@ -269,10 +493,35 @@ namespace EE::Physics
         AsyncTask                                               m_tasks[s_maxAsyncTasks];
         int32_t                                                 m_usedTasks = 0;
 
+        mutable SimulationTask                                  m_simulationTask;
+        std::atomic<bool>                                       m_isSimulationInFlight = false;
+        int32_t                                                 m_numStepsInLastSimulation = 0;
+        float                                                   m_interpolationFactor = 1.0f;
+        TVector<b3BodyId>                                       m_interpolatedBodyIDs;
+        TVector<Transform>                                      m_interpolationStartTransforms;
+
         mutable Threading::ReadWriteMutex                       m_mutex; // Box3D doesnt have a locking mechanism
 
+        Threading::Mutex                                        m_deferredQueryMutex;
+        DeferredQueryBuffer                                     m_pendingQueries; // Guarded by the deferred query mutex
+        DeferredQueryBuffer                                     m_resolvedQueries; // The queries resolved during the last simulation
+        uint32_t                                                m_lastResolveIdx = 0;
+
+        RagdollLODSettings                                      m_ragdollLODSettings;
+        TInlineVector<Vector, 3>                                m_ragdollLODViewPositions;
+        TInlineVector<Math::ViewVolume, 3>                      m_ragdollLODViewVolumes;
+
         #if EE_DEVELOPMENT_TOOLS
-        Render::DebugMeshRegistry const&                        m_debugMeshRegistry;
+        AsyncSimulationStats                                    m_asyncSimulationStats;
+        uint64_t                                                m_simulationStartTime = 0;
+        std::atomic<uint64_t>                                   m_simulationEndTime = 0;
+        mutable std::atomic<uint64_t>                           m_firstSimulationWaitTime = UINT64_MAX;
+        RagdollLODStats                                         m_ragdollLODStats;
+        std::atomic<int32_t>                                    m_numFullRateRagdolls = 0;
+        std::atomic<int32_t>                                    m_numReducedRateRagdolls = 0;
+        std::atomic<int32_t>                                    m_numOffscreenRagdolls = 0;
+        std::atomic<int32_t>                                    m_numSleepingRagdolls = 0;
+        Render::DebugMeshRegistry const*                        m_pDebugMeshRegistry = nullptr; // Not present when running headless
         mutable std::atomic<int32_t>                            m_readLockCount = false;        // Assertion helper
         std::atomic<bool>                                       m_writeLockAcquired = false;    // Assertion helper
         b3Recording*                                            m_pRecording = nullptr;
@@ -9,6 +9,7 @@ namespace EE::Physics
         : m_pWorld( pWorld )
         , m_pDefinition( pDefinition )
         , m_userID( userID )
+        , m_lodFrameIdx( (uint32_t) userID )
     {
         EE_ASSERT( m_pWorld != nullptr );
         EE_ASSERT( pDefinition != nullptr && pDefinition->IsValid() );
@@ -44,6 +45,8 @@ namespace EE::Physics
             m_createdBodies[bodyIdx].m_material.restitution = body.m_restitution;
             m_createdBodies[bodyIdx].m_material.rollingResistance = body.m_rollingResistance;
 
+            m_lodBoundsRadius = Math::Max( m_lodBoundsRadius, body.m_initialGlobalTransform.GetTranslation().GetLength3() );
+
             // Shape
             //-------------------------------------------------------------------------
 
@@ -81,6 +84,9 @@ namespace EE::Physics
             }
         }
 
+        // Add some margin for the body shapes around the body origins
+        m_lodBoundsRadius += 0.5f;
+
         // Create joints
         //-------------------------------------------------------------------------
 
@@ -192,6 +198,8 @@ namespace EE::Physics
          {
              b3Body_SetAwake( body.m_bodyID, false );
          }
+
+         Freeze();
     }
 
     void Ragdoll::WakeUp()
@@ -202,6 +210,22 @@ namespace EE::Physics
         {
             b3Body_SetAwake( body.m_bodyID, true );
         }
+
+        m_isFrozen = false;
+        m_settledTime = 0.0f;
+    }
+
+    void Ragdoll::Freeze()
+    {
+        int32_t const numBodies = (int32_t) m_createdBodies.size();
+        m_frozenBodyTransforms.resize( numBodies );
+        for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
+        {
+            m_frozenBodyTransforms[bodyIdx] = FromBox3D( b3Body_GetTransform( m_createdBodies[bodyIdx].m_bodyID ) );
+        }
+
+        m_isFrozen = true;
+        m_settledTime = 0.0f;
     }
 
     void Ragdoll::SetGravityScale( float gravityScale )
@@ -235,6 +259,13 @@ namespace EE::Physics
         //-------------------------------------------------------------------------
 
         m_shouldFollowPose = shouldFollowPose;
+
+        // The frozen pose is no longer valid once we start driving the bodies towards the animated pose
+        if ( m_shouldFollowPose )
+        {
+            m_isFrozen = false;
+            m_settledTime = 0.0f;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -267,6 +298,8 @@ namespace EE::Physics
         {
             ScopedWriteLock const sl( m_pWorld );
             b3Body_ApplyLinearImpulse( b3Shape_GetBody( result.shapeId ), ToBox3D( impulseForceWS ), result.point, true );
+            m_isFrozen = false;
+            m_settledTime = 0.0f;
         }
     }
 
@@ -279,6 +312,8 @@ namespace EE::Physics
         if ( result.hit )
         {
             b3Body_ApplyLinearImpulse( m_createdBodies[bodyIdx].m_bodyID, ToBox3D( impulseForceWS ), result.point, true );
+            m_isFrozen = false;
+            m_settledTime = 0.0f;
         }
     }
 
@@ -300,6 +335,8 @@ namespace EE::Physics
         EE_ASSERT( bodyIdx >= 0 && bodyIdx < m_createdBodies.size() );
         ScopedWriteLock const sl( m_pWorld );
         b3Body_ApplyLinearImpulseToCenter( m_createdBodies[bodyIdx].m_bodyID, ToBox3D( impulseForceWS ), true );
+        m_isFrozen = false;
+        m_settledTime = 0.0f;
     }
 
     void Ragdoll::ApplyImpulseToBodyCOM( StringID boneID, Vector const& impulseForceWS )
@@ -317,6 +354,117 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    void Ragdoll::UpdateLOD( Transform const& worldTransform )
+    {
+        PhysicsWorld::RagdollLODSettings const& settings = m_pWorld->GetRagdollLODSettings();
+
+        m_lodFrameIdx++;
+        m_lodUpdateInterval = 1;
+        m_isVisible = true;
+
+        // Without any views we have no way to determine significance, so the ragdoll is updated at the full rate
+        float distance = 0.0f;
+        bool isVisible = true;
+        AABB const bounds( worldTransform.GetTranslation(), m_lodBoundsRadius );
+        if ( !m_pWorld->GetRagdollLODSignificance( bounds, distance, isVisible ) )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        int32_t const maxUpdateInterval = Math::Max( settings.m_maxUpdateInterval, 1 );
+
+        m_isVisible = isVisible;
+        if ( m_isVisible )
+        {
+            float const distancePerIntervalStep = Math::Max( settings.m_distancePerIntervalStep, 0.01f );
+            float const distanceBeyondFullRate = Math::Max( distance - settings.m_fullRateDistance, 0.0f );
+            int32_t const numIntervalSteps = (int32_t) Math::Ceiling( distanceBeyondFullRate / distancePerIntervalStep );
+            m_lodUpdateInterval = Math::Min( 1 + numIntervalSteps, maxUpdateInterval );
+        }
+        else
+        {
+            m_lodUpdateInterval = maxUpdateInterval;
+        }
+    }
+
+    void Ragdoll::UpdateSleeping( Seconds const deltaTime )
+    {
+        PhysicsWorld::RagdollLODSettings const& settings = m_pWorld->GetRagdollLODSettings();
+
+        // Frozen ragdolls remain frozen until something wakes the bodies (i.e. a collision or an impulse)
+        //-------------------------------------------------------------------------
+
+        if ( m_isFrozen )
+        {
+            bool isAwake = false;
+
+            {
+                ScopedReadLock const sl( m_pWorld );
+                for ( auto const& body : m_createdBodies )
+                {
+                    if ( b3Body_IsAwake( body.m_bodyID ) )
+                    {
+                        isAwake = true;
+                        break;
+                    }
+                }
+            }
+
+            if ( isAwake )
+            {
+                m_isFrozen = false;
+                m_settledTime = 0.0f;
+            }
+
+            return;
+        }
+
+        if ( !settings.m_isEnabled )
+        {
+            m_settledTime = 0.0f;
+            return;
+        }
+
+        // Check if all the bodies have settled
+        //-------------------------------------------------------------------------
+
+        float const settledLinearVelocitySq = settings.m_settledLinearVelocity * settings.m_settledLinearVelocity;
+        float const settledAngularVelocitySq = settings.m_settledAngularVelocity * settings.m_settledAngularVelocity;
+        bool isSettled = true;
+
+        {
+            ScopedReadLock const sl( m_pWorld );
+            for ( auto const& body : m_createdBodies )
+            {
+                if ( b3LengthSquared( b3Body_GetLinearVelocity( body.m_bodyID ) ) > settledLinearVelocitySq || b3LengthSquared( b3Body_GetAngularVelocity( body.m_bodyID ) ) > settledAngularVelocitySq )
+                {
+                    isSettled = false;
+                    break;
+                }
+            }
+        }
+
+        if ( !isSettled )
+        {
+            m_settledTime = 0.0f;
+            return;
+        }
+
+        // Distant and offscreen ragdolls are put to sleep more aggressively
+        //-------------------------------------------------------------------------
+
+        m_settledTime += deltaTime;
+
+        bool const isReducedRate = !m_isVisible || m_lodUpdateInterval > 1;
+        Seconds const settleTimeBeforeSleep = isReducedRate ? settings.m_reducedRateSettleTimeBeforeSleep : settings.m_settleTimeBeforeSleep;
+        if ( m_settledTime.ToFloat() >= settleTimeBeforeSleep.ToFloat() )
+        {
+            PutToSleep();
+        }
+    }
+
     void Ragdoll::Update( Seconds const deltaTime, Transform const& worldTransform, Animation::Pose* pPose, bool shouldInitializeBodies )
     {
         EE_ASSERT( IsValid() );
@@ -325,9 +473,34 @@ namespace EE::Physics
         m_lastUpdateWorldTransform = worldTransform;
         #endif
 
+        UpdateLOD( worldTransform );
+
+        // Fully simulated ragdolls have nothing to drive, we only need to track whether they have settled
         //-------------------------------------------------------------------------
 
         if ( ( !m_shouldFollowPose && !shouldInitializeBodies ) && !m_pDefinition->m_hasKinematicBodies )
+        {
+            UpdateSleeping( deltaTime );
+            EE_DEVELOPMENT_TOOLS_ONLY( m_pWorld->RecordRagdollLOD( m_lodUpdateInterval, m_isVisible, m_isFrozen ) );
+            return;
+        }
+
+        // A frozen ragdoll that needs to follow the pose again needs to be woken up
+        if ( m_isFrozen && m_shouldFollowPose )
+        {
+            WakeUp();
+        }
+
+        // Pose following is only updated every few frames for distant ragdolls, and is skipped entirely for offscreen ragdolls
+        //-------------------------------------------------------------------------
+
+        bool const isPoseFollowingFrame = ( m_lodFrameIdx % (uint32_t) m_lodUpdateInterval ) == 0;
+        bool const shouldSkipOffscreenPoseFollowing = !m_isVisible && m_pWorld->GetRagdollLODSettings().m_skipOffscreenPoseFollowing;
+        bool const shouldUpdateMotorTargets = m_shouldFollowPose && ( shouldInitializeBodies || ( isPoseFollowingFrame && !shouldSkipOffscreenPoseFollowing ) );
+
+        EE_DEVELOPMENT_TOOLS_ONLY( m_pWorld->RecordRagdollLOD( m_lodUpdateInterval, m_isVisible, m_isFrozen ) );
+
+        if ( !shouldUpdateMotorTargets && !shouldInitializeBodies && !m_pDefinition->m_hasKinematicBodies )
         {
             return;
         }
@@ -340,6 +513,13 @@ namespace EE::Physics
 
         ScopedWriteLock const sl( m_pWorld );
 
+        // Once the bodies are moved, the frozen pose is no longer valid
+        if ( shouldInitializeBodies || m_pDefinition->m_hasKinematicBodies )
+        {
+            m_isFrozen = false;
+            m_settledTime = 0.0f;
+        }
+
         // Update bodies and joint Targets
         //-------------------------------------------------------------------------
 
@@ -367,7 +547,7 @@ namespace EE::Physics
                 b3Body_SetTargetTransform( m_createdBodies[bodyIdx].m_bodyID, ToBox3D( bodyWorldTransform ), deltaTime, true );
             }
 
-            if( m_shouldFollowPose && B3_IS_NON_NULL( m_createdBodies[bodyIdx].m_jointID ) )
+            if( shouldUpdateMotorTargets && B3_IS_NON_NULL( m_createdBodies[bodyIdx].m_jointID ) )
             {
                 auto const& jointDefinition = m_pDefinition->m_bodies[bodyIdx].m_joint;
                 int32_t const parentBoneIdx = m_pDefinition->m_bodyToBoneMap[bodyDefinition.m_parentBodyIdx];
@@ -404,14 +584,20 @@ namespace EE::Physics
 
         int32_t const numBodies = (int32_t) m_createdBodies.size();
         TInlineVector<Transform, 40> bodyTransforms;
-        bodyTransforms.reserve( numBodies );
+        Transform const* pBodyTransforms = m_frozenBodyTransforms.data();
 
+        // Frozen ragdolls use the body transforms cached when they were put to sleep, so we dont need to access the world at all
+        if ( !m_isFrozen )
         {
+            bodyTransforms.reserve( numBodies );
+
             ScopedReadLock const sl( m_pWorld );
             for ( int32_t bodyIdx = 0; bodyIdx < numBodies; bodyIdx++ )
             {
                 bodyTransforms.emplace_back( FromBox3D( b3Body_GetTransform( m_createdBodies[bodyIdx].m_bodyID ) ) );
             }
+
+            pBodyTransforms = bodyTransforms.data();
         }
 
         // Fill out model space transforms
@@ -425,7 +611,7 @@ namespace EE::Physics
             int32_t const bodyIdx = m_pDefinition->m_boneToBodyMap[boneIdx];
             if ( bodyIdx != InvalidIndex )
             {
-                Transform const boneWorldTranform = m_pDefinition->m_bodies[bodyIdx].m_inverseOffsetTransform * bodyTransforms[bodyIdx];
+                Transform const boneWorldTranform = m_pDefinition->m_bodies[bodyIdx].m_inverseOffsetTransform * pBodyTransforms[bodyIdx];
                 m_globalBoneTransforms[boneIdx] = Transform::Delta( worldTransform, boneWorldTranform );
             }
             else
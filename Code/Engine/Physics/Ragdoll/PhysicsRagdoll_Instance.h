@@ -12,6 +12,11 @@ namespace EE::Physics
     //-------------------------------------------------------------------------
     // By default ragdolls with the same userID will not collide together
     // Ragdoll self-collision is user specified in the definition
+    //
+    // LOD: each update the ragdoll determines its significance from the physics world's ragdoll LOD views
+    //  * Distant ragdolls only update their pose-following motor targets every few frames
+    //  * Offscreen ragdolls skip pose-following entirely and keep their last motor targets
+    //  * Simulated ragdolls that have settled are put to sleep and their pose is frozen until they are woken up
 
     class EE_ENGINE_API Ragdoll
     {
@@ -41,6 +46,15 @@ namespace EE::Physics
         void PutToSleep();
         void WakeUp();
 
+        // Has this ragdoll been put to sleep, in which case we return the cached pose from when it went to sleep
+        inline bool IsFrozen() const { return m_isFrozen; }
+
+        // The number of frames between pose-following updates, as determined by the ragdoll LOD
+        inline int32_t GetLODUpdateInterval() const { return m_lodUpdateInterval; }
+
+        // Was this ragdoll visible in any of the ragdoll LOD views during the last update
+        inline bool IsVisible() const { return m_isVisible; }
+
         // Cast a ray against all the ragdoll bodies
         b3BodyCastResult RayCastAgainstBodies( Vector const& rayStart, Vector const& rayEnd ) const;
 
@@ -112,6 +126,17 @@ namespace EE::Physics
         void DrawDebug( DebugDrawContext& ctx, Transform const& worldTransform = Transform::Identity ) const;
         #endif
 
+    private:
+
+        // Calculate the pose-following update interval and visibility for this frame
+        void UpdateLOD( Transform const& worldTransform );
+
+        // Track how long a simulated ragdoll has been settled for and put it to sleep once it has settled for long enough
+        void UpdateSleeping( Seconds const deltaTime );
+
+        // Cache the current body transforms and mark the ragdoll as frozen, needs to be called with the world locked
+        void Freeze();
+
     private:
 
         PhysicsWorld*                                           m_pWorld = nullptr;
@@ -127,6 +152,14 @@ namespace EE::Physics
         float                                                   m_gravityScale = true;
         bool                                                    m_shouldFollowPose = false;
 
+        TInlineVector<Transform, 30>                            m_frozenBodyTransforms;         // The body transforms at the time the ragdoll was put to sleep
+        float                                                   m_lodBoundsRadius = 0.0f;       // Radius around the character origin that contains the ragdoll reference pose, used for visibility
+        uint32_t                                                m_lodFrameIdx = 0;
+        int32_t                                                 m_lodUpdateInterval = 1;
+        Seconds                                                 m_settledTime = 0.0f;
+        bool                                                    m_isVisible = true;
+        bool                                                    m_isFrozen = false;
+
         #if EE_DEVELOPMENT_TOOLS
         Transform                                               m_lastUpdateWorldTransform;
         TInlineString<100>                                      m_ragdollName;
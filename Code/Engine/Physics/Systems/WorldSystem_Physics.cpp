@@ -176,16 +176,49 @@ namespace EE::Physics
         {
             PostPhysicsUpdate( ctx );
         }
+        else if ( ctx.GetUpdateStage() == UpdateStage::Paused )
+        {
+            // The world isnt simulated while paused, so resolve the deferred queries here to avoid anyone waiting on them indefinitely
+            m_pPhysicsWorld->ResolvePendingDeferredQueries();
+        }
         else
         {
            // Do nothing for now
         }
     }
 
+    void PhysicsWorldSystem::SetAsyncSimulationEnabled( bool isEnabled )
+    {
+        if ( m_isAsyncSimulationEnabled == isEnabled )
+        {
+            return;
+        }
+
+        // The simulated transforms arent updated in synchronous mode, so resync them to avoid interpolating from stale transforms on the first asynchronous frame
+        if ( isEnabled )
+        {
+            for ( PhysicsShapeComponent* pDynamicPhysicsComponent : m_dynamicShapeComponents )
+            {
+                pDynamicPhysicsComponent->m_previousSimulatedTransform = pDynamicPhysicsComponent->m_simulatedTransform = pDynamicPhysicsComponent->GetWorldTransform();
+            }
+        }
+        else
+        {
+            // Ensure that any in-flight simulation is complete before we go back to simulating synchronously
+            m_pPhysicsWorld->WaitForSimulation();
+            m_pPhysicsWorld->GetInterpolatedBodies().clear();
+        }
+
+        m_isAsyncSimulationEnabled = isEnabled;
+    }
+
     void PhysicsWorldSystem::PhysicsUpdate( EntityWorldUpdateContext const& ctx )
     {
         EE_PROFILE_FUNCTION_PHYSICS();
 
+        // Ragdolls are updated before the physics stage, so these views will be used to determine ragdoll significance for the next frame
+        m_pPhysicsWorld->SetRagdollLODViews( ctx.GetViewports() );
+
         // Set kinematic target requests
         //-------------------------------------------------------------------------
 
@@ -202,13 +235,31 @@ namespace EE::Physics
         // Step world
         //-------------------------------------------------------------------------
 
-        m_pPhysicsWorld->Simulate( ctx.GetDeltaTime() );
+        if ( m_isAsyncSimulationEnabled )
+        {
+            // Register the dynamic bodies so their transforms get captured before the last step, this order needs to match the post-physics update
+            TVector<b3BodyId>& interpolatedBodies = m_pPhysicsWorld->GetInterpolatedBodies();
+            interpolatedBodies.clear();
+            for ( PhysicsShapeComponent const* pDynamicPhysicsComponent : m_dynamicShapeComponents )
+            {
+                interpolatedBodies.emplace_back( pDynamicPhysicsComponent->m_physicsBodyID );
+            }
+
+            m_pPhysicsWorld->BeginSimulate( ctx.GetDeltaTime() );
+        }
+        else
+        {
+            m_pPhysicsWorld->Simulate( ctx.GetDeltaTime() );
+        }
     }
 
     void PhysicsWorldSystem::PostPhysicsUpdate( EntityWorldUpdateContext const& ctx )
     {
         EE_PROFILE_FUNCTION_PHYSICS();
 
+        // This is the latest point in the frame that we can wait for an async simulation, as the rest of the frame needs the results
+        m_pPhysicsWorld->WaitForSimulation();
+
         // Transfer physics poses back to dynamic components
         //-------------------------------------------------------------------------
 
@@ -216,11 +267,43 @@ namespace EE::Physics
         {
             m_pPhysicsWorld->LockRead();
 
-            for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
+            if ( m_isAsyncSimulationEnabled )
+            {
+                EE_DEVELOPMENT_TOOLS_ONLY( m_pPhysicsWorld->UpdateAsyncSimulationStats() );
+
+                bool const wasStepped = m_pPhysicsWorld->GetNumStepsInLastSimulation() > 0;
+                float const interpolationFactor = m_pPhysicsWorld->GetInterpolationFactor();
+                TVector<b3BodyId> const& interpolatedBodies = m_pPhysicsWorld->GetInterpolatedBodies();
+                TVector<Transform> const& interpolationStartTransforms = m_pPhysicsWorld->GetInterpolationStartTransforms();
+
+                int32_t const numDynamicComponents = (int32_t) m_dynamicShapeComponents.size();
+                for ( int32_t i = 0; i < numDynamicComponents; i++ )
+                {
+                    PhysicsShapeComponent* pDynamicPhysicsComponent = m_dynamicShapeComponents[i];
+                    EE_ASSERT( pDynamicPhysicsComponent->IsPhysicsBodyCreated() && pDynamicPhysicsComponent->IsDynamic() );
+
+                    // Interpolate between the state before and after the last step, a frame without any steps keeps interpolating between the same two states
+                    // Components registered after the simulation was started have no captured state, so they dont get interpolated this frame
+                    if ( wasStepped )
+                    {
+                        pDynamicPhysicsComponent->m_simulatedTransform = FromBox3D( b3Body_GetTransform( pDynamicPhysicsComponent->m_physicsBodyID ) );
+
+                        bool const hasStartTransform = i < (int32_t) interpolationStartTransforms.size() && B3_ID_EQUALS( interpolatedBodies[i], pDynamicPhysicsComponent->m_physicsBodyID );
+                        pDynamicPhysicsComponent->m_previousSimulatedTransform = hasStartTransform ? interpolationStartTransforms[i] : pDynamicPhysicsComponent->m_simulatedTransform;
+                    }
+
+                    Transform const interpolatedTransform = Transform::Lerp( pDynamicPhysicsComponent->m_previousSimulatedTransform, pDynamicPhysicsComponent->m_simulatedTransform, interpolationFactor );
+                    pDynamicPhysicsComponent->SetWorldTransformDirectly( interpolatedTransform, false );
+                }
+            }
+            else
             {
-                EE_ASSERT( pDynamicPhysicsComponent->IsPhysicsBodyCreated() && pDynamicPhysicsComponent->IsDynamic() );
-                Transform const bodyTransform = FromBox3D( b3Body_GetTransform( pDynamicPhysicsComponent->m_physicsBodyID ) );
-                pDynamicPhysicsComponent->SetWorldTransformDirectly( bodyTransform, false );
+                for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
+                {
+                    EE_ASSERT( pDynamicPhysicsComponent->IsPhysicsBodyCreated() && pDynamicPhysicsComponent->IsDynamic() );
+                    Transform const bodyTransform = FromBox3D( b3Body_GetTransform( pDynamicPhysicsComponent->m_physicsBodyID ) );
+                    pDynamicPhysicsComponent->SetWorldTransformDirectly( bodyTransform, false );
+                }
             }
 
             m_pPhysicsWorld->UnlockRead();
@@ -38,7 +38,7 @@ namespace EE::Physics
 
     public:
 
-        EE_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::Physics ), RequiresUpdate( UpdateStage::PostPhysics ) );
+        EE_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::Physics ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Low ), RequiresUpdate( UpdateStage::Paused ) );
 
     public:
 
@@ -47,6 +47,11 @@ namespace EE::Physics
         PhysicsWorld const* GetPhysicsWorld() const { return m_pPhysicsWorld; }
         PhysicsWorld* GetPhysicsWorld() { return m_pPhysicsWorld; }
 
+        // Asynchronous simulation: the simulation runs alongside the rest of the frame and is only waited on when the results are needed
+        // Dynamic body transforms are interpolated between the last two fixed steps when running asynchronously
+        void SetAsyncSimulationEnabled( bool isEnabled );
+        inline bool IsAsyncSimulationEnabled() const { return m_isAsyncSimulationEnabled; }
+
     private:
 
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
@@ -81,5 +86,6 @@ namespace EE::Physics
         TEntityMessageQueue<PhysicsShapeComponent>              m_bodyRebuildRequests;
 
         TVector<PhysicsTestComponent*>                          m_testComponents;
+        bool                                                    m_isAsyncSimulationEnabled = false;
     };
 }
\ No newline at end of file
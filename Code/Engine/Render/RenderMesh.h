@@ -48,6 +48,7 @@ namespace EE::Render
         };
 
         constexpr static int32_t const s_sharedMeshVersion = 21;
+        constexpr static bool const s_compressCompiledData = true;
 
     private:
 
@@ -26,6 +26,13 @@ namespace EE::Render
         Material* pMaterial = EE::New<Material>();
         ( *pArchive ) << *pMaterial;
 
+        // Headless - there are no shaders to resolve
+        if ( m_pRenderSystem == nullptr )
+        {
+            pResourceRecord->SetResourceData( pMaterial );
+            return Resource::LoadResult::Complete;
+        }
+
         // Resolve shader (or use placeholder)
         //-------------------------------------------------------------------------
 
@@ -48,6 +55,12 @@ namespace EE::Render
         Material* pMaterial = pResourceRecord->GetResourceData<Material>();
         EE_ASSERT( pMaterial != nullptr );
 
+        // Headless - no device parameters to create
+        if ( m_pRenderSystem == nullptr )
+        {
+            return Resource::LoadResult::Complete;
+        }
+
         // Kick off async request
         if ( pMaterial->m_pMaterialParametersUpdate == nullptr )
         {
@@ -39,6 +39,13 @@ namespace EE::Render
 
             EE_ASSERT( pMeshResource->IsValid() );
 
+            // Headless - only the CPU data is needed, there are no device resources to create
+            if ( m_pRenderSystem == nullptr )
+            {
+                pResourceRecord->SetResourceData( pMeshResource );
+                return Resource::LoadResult::Complete;
+            }
+
             //-------------------------------------------------------------------------
 
             EE_ASSERT( pMeshResource->m_clusterBuffersState.size() == 0 );
@@ -244,6 +251,12 @@ namespace EE::Render
 
     Resource::UnloadResult MeshLoader::Unload( ResourceID const& resourceID, Resource::ResourceRecord* pResourceRecord ) const
     {
+        // Headless - no device resources were created
+        if ( m_pRenderSystem == nullptr )
+        {
+            return Resource::UnloadResult::Complete;
+        }
+
         bool isEverythingUnloaded = true;
 
         //-------------------------------------------------------------------------
@@ -28,6 +28,12 @@ namespace EE::Render
 
             pResourceRecord->SetResourceData( pTextureResource );
 
+            // Headless - only the texture descriptor is loaded, there is no device to upload the texel data to
+            if ( m_pRenderSystem == nullptr )
+            {
+                return Resource::LoadResult::Complete;
+            }
+
             RHI::TextureParameters textureParameters = {};
             textureParameters.m_width = pTextureResource->GetWidth();
             textureParameters.m_height = pTextureResource->GetHeight();
@@ -4,6 +4,8 @@
 #include "Base/Imgui/ImguiX.h"
 #include "Base/Resource/Settings/Settings_Resource.h"
 #include "Base/Resource/ResourceProviders/ResourceProvider_Network.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
@@ -228,6 +230,117 @@ namespace EE::Resource
         }
     }
 
+    void ResourceDebugView::DrawLoadStatistics( ResourceSystem* pResourceSystem )
+    {
+        EE_ASSERT( pResourceSystem != nullptr );
+
+        struct TypeStats
+        {
+            int32_t         m_numLoaded = 0;
+            size_t          m_rawDataSize = 0;
+            size_t          m_uncompressedDataSize = 0;
+            size_t          m_numBytesCopied = 0;
+            float           m_fileReadTime = 0.0f;
+            float           m_decompressionTime = 0.0f;
+            float           m_loadTime = 0.0f;
+        };
+
+        // Gather stats per resource type
+        //-------------------------------------------------------------------------
+
+        THashMap<ResourceTypeID, TypeStats> statsPerType;
+        TypeStats totalStats;
+
+        for ( auto const& recordTuple : pResourceSystem->m_resourceRecords )
+        {
+            ResourceRecord const* pRecord = recordTuple.second;
+            if ( !pRecord->IsLoaded() )
+            {
+                continue;
+            }
+
+            for ( TypeStats* pStats : { &statsPerType[pRecord->GetResourceTypeID()], &totalStats } )
+            {
+                pStats->m_numLoaded++;
+                pStats->m_rawDataSize += pRecord->GetRawDataSize();
+                pStats->m_uncompressedDataSize += pRecord->GetUncompressedDataSize();
+                pStats->m_numBytesCopied += pRecord->GetNumBytesCopied();
+                pStats->m_fileReadTime += pRecord->GetFileReadTime().ToFloat();
+                pStats->m_decompressionTime += pRecord->GetDecompressionTime().ToFloat();
+                pStats->m_loadTime += pRecord->GetLoadTime().ToFloat();
+            }
+        }
+
+        // Draw
+        //-------------------------------------------------------------------------
+
+        auto DrawRow = [] ( char const* pLabel, TypeStats const& stats )
+        {
+            float const averageLoadTime = ( stats.m_numLoaded > 0 ) ? stats.m_loadTime / stats.m_numLoaded : 0.0f;
+            float const compressionRatio = ( stats.m_uncompressedDataSize > 0 ) ? 100.0f * stats.m_rawDataSize / stats.m_uncompressedDataSize : 100.0f;
+
+            ImGui::TableNextRow();
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted( pLabel );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%d", stats.m_numLoaded );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.2fKB", stats.m_rawDataSize / 1024.0f );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.2fKB", stats.m_uncompressedDataSize / 1024.0f );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.1f%%", compressionRatio );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.2fKB", stats.m_numBytesCopied / 1024.0f );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.3fms", stats.m_fileReadTime );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.3fms", stats.m_decompressionTime );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.3fms", stats.m_loadTime );
+
+            ImGui::TableNextColumn();
+            ImGui::Text( "%.3fms", averageLoadTime );
+        };
+
+        if ( ImGui::BeginTable( "Resource Load Statistics Table", 10, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY, ImGui::GetContentRegionAvail() ) )
+        {
+            ImGui::TableSetupColumn( "Type", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Num Loaded", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Data Size", ImGuiTableColumnFlags_WidthFixed, 90 );
+            ImGui::TableSetupColumn( "Uncompressed", ImGuiTableColumnFlags_WidthFixed, 90 );
+            ImGui::TableSetupColumn( "Ratio", ImGuiTableColumnFlags_WidthFixed, 60 );
+            ImGui::TableSetupColumn( "Bytes Copied", ImGuiTableColumnFlags_WidthFixed, 90 );
+            ImGui::TableSetupColumn( "File Read", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Decompress", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Load", ImGuiTableColumnFlags_WidthFixed, 80 );
+            ImGui::TableSetupColumn( "Avg Load", ImGuiTableColumnFlags_WidthFixed, 80 );
+
+            ImGui::TableSetupScrollFreeze( 0, 1 );
+            ImGui::TableHeadersRow();
+
+            //-------------------------------------------------------------------------
+
+            for ( auto const& statsTuple : statsPerType )
+            {
+                DrawRow( statsTuple.first.ToString().c_str(), statsTuple.second );
+            }
+
+            DrawRow( "Total", totalStats );
+
+            ImGui::EndTable();
+        }
+    }
+
     void ResourceDebugView::DrawResourceProviderOverview( ResourceSettings const* pSettings, ResourceSystem* pResourceSystem )
     {
         EE_ASSERT( pSettings != nullptr && pResourceSystem != nullptr );
@@ -312,18 +425,154 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    void ResourceDebugView::RunStringIDBenchmark()
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
+        m_stringIDBenchmarkResults.clear();
+
+        // Every pass uses a new set of unique strings so that the first intern of each string always has to insert into the cache
+        auto GenerateStrings = [this] ( TVector<String>& strings, TVector<char const*>& stringPtrs )
+        {
+            strings.resize( m_numStringIDBenchmarkStrings );
+            stringPtrs.resize( m_numStringIDBenchmarkStrings );
+            for ( int32_t i = 0; i < m_numStringIDBenchmarkStrings; i++ )
+            {
+                strings[i].sprintf( "StringIDBenchmark_%d_%d", m_numStringIDBenchmarkRuns, i );
+                stringPtrs[i] = strings[i].c_str();
+            }
+
+            m_numStringIDBenchmarkRuns++;
+        };
+
+        TVector<String> strings;
+        TVector<char const*> stringPtrs;
+
+        // Power of two thread counts up to (and including) the worker count plus the main thread
+        TInlineVector<int32_t, 8> threadCounts;
+        int32_t const maxThreads = (int32_t) m_pTaskSystem->GetNumWorkers() + 1;
+        for ( int32_t numThreads = 1; numThreads < maxThreads; numThreads *= 2 )
+        {
+            threadCounts.emplace_back( numThreads );
+        }
+        threadCounts.emplace_back( maxThreads );
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t numThreads : threadCounts )
+        {
+            StringIDBenchmarkResult& result = m_stringIDBenchmarkResults.emplace_back();
+            result.m_numThreads = numThreads;
+            float const totalNumInterns = float( numThreads ) * m_numStringIDBenchmarkStrings;
+
+            // Individual creation
+            //-------------------------------------------------------------------------
+
+            GenerateStrings( strings, stringPtrs );
+
+            AsyncTask singleTask( numThreads, [&stringPtrs] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    for ( char const* pStr : stringPtrs )
+                    {
+                        [[maybe_unused]] StringID const ID( pStr );
+                    }
+                }
+            } );
+
+            Milliseconds elapsedTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                m_pTaskSystem->ScheduleTask( &singleTask );
+                m_pTaskSystem->WaitForTask( &singleTask );
+            }
+            result.m_singleMillionsPerSecond = ( totalNumInterns / 1000000.0f ) / Math::Max( elapsedTime.ToSeconds().ToFloat(), Math::Epsilon );
+
+            // Bulk creation
+            //-------------------------------------------------------------------------
+
+            GenerateStrings( strings, stringPtrs );
+
+            AsyncTask bulkTask( numThreads, [&stringPtrs] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                TVector<StringID> IDs;
+                IDs.resize( stringPtrs.size() );
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    StringID::CreateMultiple( stringPtrs.data(), stringPtrs.size(), IDs.data() );
+                }
+            } );
+
+            elapsedTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                m_pTaskSystem->ScheduleTask( &bulkTask );
+                m_pTaskSystem->WaitForTask( &bulkTask );
+            }
+            result.m_bulkMillionsPerSecond = ( totalNumInterns / 1000000.0f ) / Math::Max( elapsedTime.ToSeconds().ToFloat(), Math::Epsilon );
+        }
+    }
+
+    void ResourceDebugView::DrawStringIDBenchmark()
+    {
+        ImGui::TextColored( Colors::Yellow.ToFloat4(), "Note: Every run permanently adds the generated strings to the StringID cache!" );
+
+        ImGui::SetNextItemWidth( 150 );
+        ImGui::InputInt( "Num Strings", &m_numStringIDBenchmarkStrings );
+        m_numStringIDBenchmarkStrings = Math::Clamp( m_numStringIDBenchmarkStrings, 1, 1000000 );
+
+        ImGui::SameLine();
+        if ( ImGui::Button( "Run Benchmark" ) )
+        {
+            RunStringIDBenchmark();
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( ImGui::BeginTable( "StringIDBenchmarkTable", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+        {
+            ImGui::TableSetupColumn( "Threads", ImGuiTableColumnFlags_WidthFixed, 60 );
+            ImGui::TableSetupColumn( "Individual (M/s)", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Bulk (M/s)", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableHeadersRow();
+
+            for ( StringIDBenchmarkResult const& result : m_stringIDBenchmarkResults )
+            {
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", result.m_numThreads );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_singleMillionsPerSecond );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.2f", result.m_bulkMillionsPerSecond );
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void ResourceDebugView::Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld )
     {
         DebugView::Initialize( systemRegistry, pWorld );
         m_pResourceSystem = systemRegistry.GetSystem<ResourceSystem>();
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
 
         m_windows.emplace_back( "Resource Request History", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawRequestHistory( m_pResourceSystem ); } );
         m_windows.emplace_back( "Resource System Overview", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawResourceSystemOverview( m_pResourceSystem ); } );
+        m_windows.emplace_back( "Resource Load Statistics", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawLoadStatistics( m_pResourceSystem ); } );
+        m_windows.emplace_back( "StringID Interning Benchmark", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawStringIDBenchmark(); } );
     }
 
     void ResourceDebugView::Shutdown()
     {
         m_pResourceSystem = nullptr;
+        m_pTaskSystem = nullptr;
         DebugView::Shutdown();
     }
 
@@ -338,6 +587,18 @@ namespace EE::Resource
         {
             m_windows[1].m_isOpen = true;
         }
+
+        if ( ImGui::MenuItem( "Show Resource Load Statistics" ) )
+        {
+            m_windows[2].m_isOpen = true;
+        }
+
+        ImGui::Separator();
+
+        if ( ImGui::MenuItem( "Show StringID Interning Benchmark" ) )
+        {
+            m_windows[3].m_isOpen = true;
+        }
     }
 }
 #endif
\ No newline at end of file
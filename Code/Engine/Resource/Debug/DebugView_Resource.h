@@ -5,6 +5,10 @@
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Resource
 {
     class ResourceSystem;
@@ -16,11 +20,19 @@ namespace EE::Resource
     {
         EE_REFLECT_TYPE( ResourceDebugView );
 
+        struct StringIDBenchmarkResult
+        {
+            int32_t             m_numThreads = 0;
+            float               m_singleMillionsPerSecond = 0.0f;
+            float               m_bulkMillionsPerSecond = 0.0f;
+        };
+
     public:
 
         static void DrawRequestHistory( ResourceSystem* pResourceSystem );
         static void DrawResourceSystemOverview( ResourceSystem* pResourceSystem );
         static void DrawResourceProviderOverview( ResourceSettings const* pSettings, ResourceSystem* pResourceSystem );
+        static void DrawLoadStatistics( ResourceSystem* pResourceSystem );
 
     public:
 
@@ -33,9 +45,16 @@ namespace EE::Resource
         virtual void Shutdown() override;
         virtual void DrawMenu( EntityWorldUpdateContext const& context ) override;
 
+        void DrawStringIDBenchmark();
+        void RunStringIDBenchmark();
+
     private:
 
-        ResourceSystem*         m_pResourceSystem = nullptr;
+        ResourceSystem*                         m_pResourceSystem = nullptr;
+        TaskSystem*                             m_pTaskSystem = nullptr;
+        TVector<StringIDBenchmarkResult>        m_stringIDBenchmarkResults;
+        int32_t                                 m_numStringIDBenchmarkStrings = 10000;
+        int32_t                                 m_numStringIDBenchmarkRuns = 0;
     };
 }
 #endif
\ No newline at end of file
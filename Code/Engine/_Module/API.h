@@ -3,10 +3,14 @@
 //-------------------------------------------------------------------------
 
 #if EE_DLL
-    #ifdef ESOTERICA_ENGINE_RUNTIME
-        #define EE_ENGINE_API __declspec(dllexport)
+    #if _WIN32
+        #ifdef ESOTERICA_ENGINE_RUNTIME
+            #define EE_ENGINE_API __declspec(dllexport)
+        #else
+            #define EE_ENGINE_API __declspec(dllimport)
+        #endif
     #else
-        #define EE_ENGINE_API __declspec(dllimport)
+        #define EE_ENGINE_API __attribute__((visibility("default")))
     #endif
 #else
     #define EE_ENGINE_API
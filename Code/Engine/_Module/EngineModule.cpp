@@ -51,6 +51,8 @@ namespace EE
         // Initialize core systems
         //-------------------------------------------------------------------------
 
+        m_isHeadless = context.m_isHeadless;
+
         #if EE_DEVELOPMENT_TOOLS
         EntityModel::InitializeLogQueue();
         #endif
@@ -76,12 +78,15 @@ namespace EE
         context.m_pSystemRegistry->RegisterSystem( &m_entityWorldManager );
         context.m_pSystemRegistry->RegisterSystem( &m_physicsMaterialRegistry );
 
-        context.m_pSystemRegistry->RegisterSystem( &m_renderSystem );
+        if ( !m_isHeadless )
+        {
+            context.m_pSystemRegistry->RegisterSystem( &m_renderSystem );
 
-        #if EE_DEVELOPMENT_TOOLS
-        context.m_pSystemRegistry->RegisterSystem( &m_debugMeshRegistry );
-        context.m_pSystemRegistry->RegisterSystem( &m_imguiRenderer );
-        #endif
+            #if EE_DEVELOPMENT_TOOLS
+            context.m_pSystemRegistry->RegisterSystem( &m_debugMeshRegistry );
+            context.m_pSystemRegistry->RegisterSystem( &m_imguiRenderer );
+            #endif
+        }
 
         //-------------------------------------------------------------------------
         // Register resource loaders
@@ -92,9 +97,13 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
-        m_meshLoader.SetRenderSystem( &m_renderSystem );
-        m_textureLoader.SetRenderSystem( &m_renderSystem );
-        m_materialLoader.SetRenderSystem( &m_renderSystem );
+        // When headless, the render loaders only deserialize the CPU data and never create any device resources
+        if ( !m_isHeadless )
+        {
+            m_meshLoader.SetRenderSystem( &m_renderSystem );
+            m_textureLoader.SetRenderSystem( &m_renderSystem );
+            m_materialLoader.SetRenderSystem( &m_renderSystem );
+        }
 
         context.m_pResourceSystem->RegisterResourceLoader( &m_meshLoader );
         context.m_pResourceSystem->RegisterResourceLoader( &m_textureLoader );
@@ -129,6 +138,11 @@ namespace EE
         // Initialize and register renderers
         //-------------------------------------------------------------------------
 
+        if ( m_isHeadless )
+        {
+            return true;
+        }
+
         auto const pRenderSettings = context.m_pSettingsRegistry->GetSettings<Render::RenderSettings>();
 
         m_renderSystem.Initialize( *pRenderSettings );
@@ -211,20 +225,23 @@ namespace EE
         // Unregister and shutdown renderers
         //-------------------------------------------------------------------------
 
-        m_renderSystem.UnregisterRenderWindow( &m_renderWindow );
-        m_renderWindow.DestroySwapchain( m_renderSystem.GetContextRHI() );
+        if ( !m_isHeadless )
+        {
+            m_renderSystem.UnregisterRenderWindow( &m_renderWindow );
+            m_renderWindow.DestroySwapchain( m_renderSystem.GetContextRHI() );
 
-        #if EE_DEVELOPMENT_TOOLS
-        m_imguiRenderer.Shutdown();
-        m_debugMeshRegistry.Shutdown();
+            #if EE_DEVELOPMENT_TOOLS
+            m_imguiRenderer.Shutdown();
+            m_debugMeshRegistry.Shutdown();
 
-        context.m_pSystemRegistry->UnregisterSystem( &m_imguiRenderer );
-        context.m_pSystemRegistry->UnregisterSystem( &m_debugMeshRegistry );
-        #endif
+            context.m_pSystemRegistry->UnregisterSystem( &m_imguiRenderer );
+            context.m_pSystemRegistry->UnregisterSystem( &m_debugMeshRegistry );
+            #endif
 
-        m_forwardShadingRenderer.Shutdown();
-        m_renderSystem.Shutdown();
-        context.m_pSystemRegistry->UnregisterSystem( &m_renderSystem );
+            m_forwardShadingRenderer.Shutdown();
+            m_renderSystem.Shutdown();
+            context.m_pSystemRegistry->UnregisterSystem( &m_renderSystem );
+        }
 
         //-------------------------------------------------------------------------
         // Shutdown core systems
@@ -284,11 +301,16 @@ namespace EE
         EngineModule* pMutableModule = const_cast<EngineModule*>( this );
 
         TInlineVector<Resource::ResourcePtr*, 10> resources;
-        resources.emplace_back( &pMutableModule->m_tonemapLUT );
-        resources.emplace_back( &pMutableModule->m_smaaAreaTexture );
-        resources.emplace_back( &pMutableModule->m_smaaSearchTexture );
         resources.emplace_back( &pMutableModule->m_physicsMaterialDB );
-        resources.emplace_back( &pMutableModule->m_placeholderMaterial );
+
+        if ( !m_isHeadless )
+        {
+            resources.emplace_back( &pMutableModule->m_tonemapLUT );
+            resources.emplace_back( &pMutableModule->m_smaaAreaTexture );
+            resources.emplace_back( &pMutableModule->m_smaaSearchTexture );
+            resources.emplace_back( &pMutableModule->m_placeholderMaterial );
+        }
+
         return resources;
     }
 
@@ -298,6 +320,13 @@ namespace EE
     void EngineModule::LivePP_PreReload( ModuleContext const& context )
     {
         m_needShaderReload = false;
+
+        // There are no shaders to reload when headless
+        if ( m_isHeadless )
+        {
+            return;
+        }
+
         for ( FileSystem::Path const& modifiedFilePath : m_modifiedFiles )
         {
             String const& pathString = modifiedFilePath.GetString();
@@ -62,6 +62,9 @@ namespace EE
 
         inline EntityWorldManager* GetEntityWorldManager() { return &m_entityWorldManager; }
 
+        // Headless modules never create the render system, window or renderers
+        inline bool IsHeadless() const { return m_isHeadless; }
+
         #if EE_ENABLE_LPP
         virtual void LivePP_PreReload( ModuleContext const& context ) override;
         virtual void LivePP_PostReload( ModuleContext const& context ) override;
@@ -110,6 +113,8 @@ namespace EE
         // Game
         HitboxLoader                                    m_hitboxLoader;
 
+        bool                                            m_isHeadless = false;
+
         #if EE_ENABLE_LPP
         EventBindingID                                  m_lppReloadEventBindingID;
         TVector<FileSystem::Path>                       m_modifiedFiles; // The set of files that were modified and reloaded
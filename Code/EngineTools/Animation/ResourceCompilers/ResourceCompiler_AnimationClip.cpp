@@ -7,6 +7,7 @@
 #include "EngineTools/Timeline/Timeline.h"
 #include "Engine/Animation/AnimationSyncTrack.h"
 #include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/AnimationClipKeyframeReduction.h"
 #include "Base/Resource/ResourcePtr.h"
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/Serialization/BinarySerialization.h"
@@ -193,7 +194,7 @@ namespace EE::Animation
         {
             ScopedTimer<PlatformClock> timer( timeTaken );
             animClip.m_skeleton = pResourceDescriptor->m_skeleton;
-            result = KeepHighestSeverityCompilationResult( result, TransferAndCompressAnimationData( ctx, *importedAnimationPtr, importedAnimationPtr->GetPrimaryClip(), animClip, limitFrameRange, pResourceDescriptor->m_bonesToSampleInModelSpace, true ) );
+            result = KeepHighestSeverityCompilationResult( result, TransferAndCompressAnimationData( ctx, *pResourceDescriptor, *importedAnimationPtr, importedAnimationPtr->GetPrimaryClip(), animClip, limitFrameRange, pResourceDescriptor->m_bonesToSampleInModelSpace, true ) );
             if ( result == Resource::CompilationResult::Failure )
             {
                 return ctx.LogError( "Failed to compress animation!" );
@@ -206,7 +207,7 @@ namespace EE::Animation
                 {
                     AnimationClip& secondaryAnimClip = secondaryAnimClips.emplace_back();
                     secondaryAnimClip.m_skeleton = Resource::ResourcePtr( secondarySkeletonPaths[i] );
-                    result = KeepHighestSeverityCompilationResult( result, TransferAndCompressAnimationData( ctx, *importedAnimationPtr, importedSecondaryClip, secondaryAnimClip, limitFrameRange, pResourceDescriptor->m_bonesToSampleInModelSpace, false ) );
+                    result = KeepHighestSeverityCompilationResult( result, TransferAndCompressAnimationData( ctx, *pResourceDescriptor, *importedAnimationPtr, importedSecondaryClip, secondaryAnimClip, limitFrameRange, pResourceDescriptor->m_bonesToSampleInModelSpace, false ) );
                     if ( result == Resource::CompilationResult::Failure )
                     {
                         return ctx.LogError( "Failed to compress secondary animation!" );
@@ -450,7 +451,7 @@ namespace EE::Animation
         return Resource::CompilationResult::Success;
     }
 
-    Resource::CompilationResult AnimationClipCompiler::TransferAndCompressAnimationData( Resource::CompileContext const& ctx, Import::Animation const& importedAnimation, Import::AnimationClip const& importedClip, AnimationClip& outAnimClip, IntRange const& limitRange, TVector<StringID> const& bonesToSampleInModelSpace, bool isPrimaryClip ) const
+    Resource::CompilationResult AnimationClipCompiler::TransferAndCompressAnimationData( Resource::CompileContext const& ctx, AnimationClipResourceDescriptor const& resourceDescriptor, Import::Animation const& importedAnimation, Import::AnimationClip const& importedClip, AnimationClip& outAnimClip, IntRange const& limitRange, TVector<StringID> const& bonesToSampleInModelSpace, bool isPrimaryClip ) const
     {
         EE_ASSERT( importedClip.m_hasData );
 
@@ -622,12 +623,10 @@ namespace EE::Animation
 
         static constexpr float const defaultQuantizationRangeLength = 0.1f;
 
-        int32_t poseTrackReadOffset = 0;
         for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
         {
             TrackRangeData const& trackRangeData = trackRanges[boneIdx];
             TrackDefinition trackSettings;
-            trackSettings.m_trackReadOffset = poseTrackReadOffset;
 
             //-------------------------------------------------------------------------
 
@@ -684,73 +683,28 @@ namespace EE::Animation
             //-------------------------------------------------------------------------
 
             outAnimClip.m_trackDefs.emplace_back( trackSettings );
-
-            // Update track read offsetS
-            //-------------------------------------------------------------------------
-
-            if ( !trackSettings.IsRotationTrackStatic() )
-            {
-                poseTrackReadOffset += 3;
-            }
-
-            if ( !trackSettings.IsTranslationTrackStatic() )
-            {
-                poseTrackReadOffset += 3;
-            }
-
-            if ( !trackSettings.IsScaleTrackStatic() )
-            {
-                poseTrackReadOffset += 1;
-            }
         }
 
         //-------------------------------------------------------------------------
-        // Create 'pose wise' compressed track data
+        // Create pose data
         //-------------------------------------------------------------------------
 
-        for ( int32_t frameIdx = frameIdxStart; frameIdx <= frameIdxEnd; frameIdx++ )
+        if ( resourceDescriptor.m_compressionMode == AnimationClipResourceDescriptor::CompressionMode::KeyframeReduced )
         {
-            EE_ASSERT( frameIdx < numOriginalFrames );
-
-            outAnimClip.m_compressedPoseOffsets.emplace_back( (int32_t) outAnimClip.m_compressedPoseData.size() );
-
-            for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            if ( outAnimClip.m_isAdditive )
             {
-                TrackDefinition const& trackSettings = outAnimClip.m_trackDefs[boneIdx];
-
-                if ( !trackSettings.IsRotationTrackStatic() )
-                {
-                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_parentSpaceTransforms[frameIdx];
-                    Quaternion const rotation = rawBoneTransform.GetRotation();
-
-                    Quantization::EncodedQuaternion const encodedQuat( rotation );
-                    outAnimClip.m_compressedPoseData.push_back( encodedQuat.GetData0() );
-                    outAnimClip.m_compressedPoseData.push_back( encodedQuat.GetData1() );
-                    outAnimClip.m_compressedPoseData.push_back( encodedQuat.GetData2() );
-                }
-
-                if ( !trackSettings.IsTranslationTrackStatic() )
-                {
-                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_parentSpaceTransforms[frameIdx];
-                    Vector const& translation = rawBoneTransform.GetTranslation();
-
-                    uint16_t const tx = Quantization::EncodeFloat( translation.GetX(), trackSettings.m_translationRangeX.m_rangeStart, trackSettings.m_translationRangeX.m_rangeLength );
-                    uint16_t const ty = Quantization::EncodeFloat( translation.GetY(), trackSettings.m_translationRangeY.m_rangeStart, trackSettings.m_translationRangeY.m_rangeLength );
-                    uint16_t const tz = Quantization::EncodeFloat( translation.GetZ(), trackSettings.m_translationRangeZ.m_rangeStart, trackSettings.m_translationRangeZ.m_rangeLength );
-
-                    outAnimClip.m_compressedPoseData.push_back( tx );
-                    outAnimClip.m_compressedPoseData.push_back( ty );
-                    outAnimClip.m_compressedPoseData.push_back( tz );
-                }
-
-                if ( !trackSettings.IsScaleTrackStatic() )
-                {
-                    Transform const& rawBoneTransform = rawTrackData[boneIdx].m_parentSpaceTransforms[frameIdx];
-                    uint16_t const scl = Quantization::EncodeFloat( rawBoneTransform.GetScale(), trackSettings.m_scaleRange.m_rangeStart, trackSettings.m_scaleRange.m_rangeLength );
-                    outAnimClip.m_compressedPoseData.push_back( scl );
-                }
+                ctx.LogMessage( "Keyframe reduction is not supported for additive animations, using uniform compression!" );
+                CreateUniformPoseData( importedClip, frameIdxStart, frameIdxEnd, outAnimClip );
+            }
+            else
+            {
+                result = KeepHighestSeverityCompilationResult( result, CreateKeyframeReducedPoseData( ctx, resourceDescriptor, importedClip, frameIdxStart, outAnimClip ) );
             }
         }
+        else
+        {
+            CreateUniformPoseData( importedClip, frameIdxStart, frameIdxEnd, outAnimClip );
+        }
 
         //-------------------------------------------------------------------------
         // Create model space sampling bone chain
@@ -941,6 +895,665 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    void AnimationClipCompiler::CreateUniformPoseData( Import::AnimationClip const& importedClip, int32_t frameIdxStart, int32_t frameIdxEnd, AnimationClip& outAnimClip ) const
+    {
+        TVector<Import::AnimationClip::TrackData> const& rawTrackData = importedClip.GetTrackData();
+
+        // Add animated tracks to the pose data streams
+        //-------------------------------------------------------------------------
+
+        for ( int32_t boneIdx = 0; boneIdx < (int32_t) outAnimClip.m_trackDefs.size(); boneIdx++ )
+        {
+            TrackDefinition const& trackSettings = outAnimClip.m_trackDefs[boneIdx];
+
+            if ( !trackSettings.IsRotationTrackStatic() )
+            {
+                outAnimClip.m_animatedRotationBoneIndices.emplace_back( (uint16_t) boneIdx );
+            }
+
+            if ( !trackSettings.IsTranslationTrackStatic() )
+            {
+                outAnimClip.m_animatedTranslationBoneIndices.emplace_back( (uint16_t) boneIdx );
+            }
+
+            if ( !trackSettings.IsScaleTrackStatic() )
+            {
+                outAnimClip.m_animatedScaleBoneIndices.emplace_back( (uint16_t) boneIdx );
+            }
+        }
+
+        //-------------------------------------------------------------------------
+        // Create SIMD decoding data
+        //-------------------------------------------------------------------------
+        // Pad all streams to a full decode block, padded entries are decoded but never written to the pose
+
+        auto PadStream = [] ( TVector<uint16_t>& streamBoneIndices )
+        {
+            while ( ( streamBoneIndices.size() % AnimationClip::s_numTracksPerDecodeBlock ) != 0 )
+            {
+                streamBoneIndices.emplace_back( uint16_t( 0xFFFF ) );
+            }
+        };
+
+        PadStream( outAnimClip.m_animatedRotationBoneIndices );
+        PadStream( outAnimClip.m_animatedTranslationBoneIndices );
+        PadStream( outAnimClip.m_animatedScaleBoneIndices );
+
+        // Create the SoA decode ranges for each block of translation tracks
+        int32_t const numTranslationBlocks = (int32_t) outAnimClip.m_animatedTranslationBoneIndices.size() / AnimationClip::s_numTracksPerDecodeBlock;
+        outAnimClip.m_translationDecodeRanges.resize( numTranslationBlocks * AnimationClip::s_numTranslationDecodeRangesPerBlock, Float4( 0.0f ) );
+        for ( int32_t i = 0; i < (int32_t) outAnimClip.m_animatedTranslationBoneIndices.size(); i++ )
+        {
+            uint16_t const boneIdx = outAnimClip.m_animatedTranslationBoneIndices[i];
+            if ( boneIdx == 0xFFFF )
+            {
+                continue;
+            }
+
+            TrackDefinition const& trackSettings = outAnimClip.m_trackDefs[boneIdx];
+            Float4* pBlockRanges = &outAnimClip.m_translationDecodeRanges[( i / AnimationClip::s_numTracksPerDecodeBlock ) * AnimationClip::s_numTranslationDecodeRangesPerBlock];
+            int32_t const laneIdx = i % AnimationClip::s_numTracksPerDecodeBlock;
+            pBlockRanges[0][laneIdx] = trackSettings.m_translationRangeX.m_rangeStart;
+            pBlockRanges[1][laneIdx] = trackSettings.m_translationRangeX.m_rangeLength;
+            pBlockRanges[2][laneIdx] = trackSettings.m_translationRangeY.m_rangeStart;
+            pBlockRanges[3][laneIdx] = trackSettings.m_translationRangeY.m_rangeLength;
+            pBlockRanges[4][laneIdx] = trackSettings.m_translationRangeZ.m_rangeStart;
+            pBlockRanges[5][laneIdx] = trackSettings.m_translationRangeZ.m_rangeLength;
+        }
+
+        // Create the SoA decode ranges for each block of scale tracks
+        int32_t const numScaleBlocks = (int32_t) outAnimClip.m_animatedScaleBoneIndices.size() / AnimationClip::s_numTracksPerDecodeBlock;
+        outAnimClip.m_scaleDecodeRanges.resize( numScaleBlocks * AnimationClip::s_numScaleDecodeRangesPerBlock, Float4( 0.0f ) );
+        for ( int32_t i = 0; i < (int32_t) outAnimClip.m_animatedScaleBoneIndices.size(); i++ )
+        {
+            uint16_t const boneIdx = outAnimClip.m_animatedScaleBoneIndices[i];
+            if ( boneIdx == 0xFFFF )
+            {
+                continue;
+            }
+
+            TrackDefinition const& trackSettings = outAnimClip.m_trackDefs[boneIdx];
+            Float4* pBlockRanges = &outAnimClip.m_scaleDecodeRanges[( i / AnimationClip::s_numTracksPerDecodeBlock ) * AnimationClip::s_numScaleDecodeRangesPerBlock];
+            int32_t const laneIdx = i % AnimationClip::s_numTracksPerDecodeBlock;
+            pBlockRanges[0][laneIdx] = trackSettings.m_scaleRange.m_rangeStart;
+            pBlockRanges[1][laneIdx] = trackSettings.m_scaleRange.m_rangeLength;
+        }
+
+        //-------------------------------------------------------------------------
+        // Create 'pose wise' compressed track data
+        //-------------------------------------------------------------------------
+        // Each pose is stored as three streams: rotations, translations and scales (see AnimationClip)
+
+        for ( int32_t frameIdx = frameIdxStart; frameIdx <= frameIdxEnd; frameIdx++ )
+        {
+            EE_ASSERT( frameIdx < importedClip.GetNumFrames() );
+
+            outAnimClip.m_compressedPoseOffsets.emplace_back( (int32_t) outAnimClip.m_compressedPoseData.size() );
+
+            for ( uint16_t boneIdx : outAnimClip.m_animatedRotationBoneIndices )
+            {
+                if ( boneIdx == 0xFFFF )
+                {
+                    outAnimClip.m_compressedPoseData.insert( outAnimClip.m_compressedPoseData.end(), 3, uint16_t( 0 ) );
+                    continue;
+                }
+
+                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_parentSpaceTransforms[frameIdx];
+                Quaternion const rotation = rawBoneTransform.GetRotation();
+
+                Quantization::EncodedQuaternion const encodedQuat( rotation );
+                outAnimClip.m_compressedPoseData.push_back( encodedQuat.GetData0() );
+                outAnimClip.m_compressedPoseData.push_back( encodedQuat.GetData1() );
+                outAnimClip.m_compressedPoseData.push_back( encodedQuat.GetData2() );
+            }
+
+            for ( uint16_t boneIdx : outAnimClip.m_animatedTranslationBoneIndices )
+            {
+                if ( boneIdx == 0xFFFF )
+                {
+                    outAnimClip.m_compressedPoseData.insert( outAnimClip.m_compressedPoseData.end(), 3, uint16_t( 0 ) );
+                    continue;
+                }
+
+                TrackDefinition const& trackSettings = outAnimClip.m_trackDefs[boneIdx];
+                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_parentSpaceTransforms[frameIdx];
+                Vector const& translation = rawBoneTransform.GetTranslation();
+
+                uint16_t const tx = Quantization::EncodeFloat( translation.GetX(), trackSettings.m_translationRangeX.m_rangeStart, trackSettings.m_translationRangeX.m_rangeLength );
+                uint16_t const ty = Quantization::EncodeFloat( translation.GetY(), trackSettings.m_translationRangeY.m_rangeStart, trackSettings.m_translationRangeY.m_rangeLength );
+                uint16_t const tz = Quantization::EncodeFloat( translation.GetZ(), trackSettings.m_translationRangeZ.m_rangeStart, trackSettings.m_translationRangeZ.m_rangeLength );
+
+                outAnimClip.m_compressedPoseData.push_back( tx );
+                outAnimClip.m_compressedPoseData.push_back( ty );
+                outAnimClip.m_compressedPoseData.push_back( tz );
+            }
+
+            for ( uint16_t boneIdx : outAnimClip.m_animatedScaleBoneIndices )
+            {
+                if ( boneIdx == 0xFFFF )
+                {
+                    outAnimClip.m_compressedPoseData.push_back( 0 );
+                    continue;
+                }
+
+                TrackDefinition const& trackSettings = outAnimClip.m_trackDefs[boneIdx];
+                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_parentSpaceTransforms[frameIdx];
+                uint16_t const scl = Quantization::EncodeFloat( rawBoneTransform.GetScale(), trackSettings.m_scaleRange.m_rangeStart, trackSettings.m_scaleRange.m_rangeLength );
+                outAnimClip.m_compressedPoseData.push_back( scl );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+    // Keyframe Reduction
+    //-------------------------------------------------------------------------
+
+    // The raw data needed to measure the object space error of a keyframe reduced clip
+    struct KeyframeReductionSourceData
+    {
+        inline Transform const& GetParentSpaceTransform( int32_t frameIdx, int32_t boneIdx ) const { return m_parentSpaceTransforms[frameIdx * m_numBones + boneIdx]; }
+        inline Transform const& GetModelSpaceTransform( int32_t frameIdx, int32_t boneIdx ) const { return m_modelSpaceTransforms[frameIdx * m_numBones + boneIdx]; }
+
+    public:
+
+        int32_t                                 m_numBones = 0;
+        int32_t                                 m_numFrames = 0;
+        TVector<int32_t>                        m_parentBoneIndices;
+        TVector<Transform>                      m_parentSpaceTransforms;
+        TVector<Transform>                      m_modelSpaceTransforms;
+        TVector<float>                          m_measurementDistances; // Per bone: the distance of the virtual vertices used when reducing its channels (covers all descendants)
+    };
+
+    struct KeyframeReducedData
+    {
+        TVector<KeyframeReducedChannel>         m_channels;
+        TVector<uint16_t>                       m_keyFrameIndices;
+        TVector<uint8_t>                        m_keyData;
+        uint32_t                                m_numAnimatedChannels = 0;
+        uint32_t                                m_totalBitsPerComponent = 0;
+    };
+
+    struct KeyframeReductionStats
+    {
+        float                                   m_errorBound = 0.0f;
+        float                                   m_maxError = 0.0f;
+        float                                   m_averageError = 0.0f;
+        uint32_t                                m_numKeys = 0;
+        uint32_t                                m_numUnreducedKeys = 0;
+        float                                   m_averageBitsPerComponent = 0.0f;
+        size_t                                  m_poseDataSize = 0;
+    };
+
+    // The object space error is the max displacement of the bone and a set of virtual vertices around it
+    static float CalculateObjectSpaceError( Transform const& rawModelSpaceTransform, Transform const& lossyModelSpaceTransform, float measurementDistance )
+    {
+        float maxError = rawModelSpaceTransform.GetTranslation().GetDistance3( lossyModelSpaceTransform.GetTranslation() );
+
+        Vector const virtualVertices[3] = { Vector( measurementDistance, 0, 0 ), Vector( 0, measurementDistance, 0 ), Vector( 0, 0, measurementDistance ) };
+        for ( Vector const& virtualVertex : virtualVertices )
+        {
+            float const error = rawModelSpaceTransform.TransformPoint( virtualVertex ).GetDistance3( lossyModelSpaceTransform.TransformPoint( virtualVertex ) );
+            maxError = Math::Max( maxError, error );
+        }
+
+        return maxError;
+    }
+
+    // Channel values are stored as vectors: rotations are quaternions and scales are stored in X
+    static Vector GetChannelValue( Transform const& transform, KeyframeReduction::ChannelType channelType )
+    {
+        switch ( channelType )
+        {
+            case KeyframeReduction::Rotation: return transform.GetRotation().ToVector();
+            case KeyframeReduction::Translation: return transform.GetTranslation();
+            default: return Vector( transform.GetScale() );
+        }
+    }
+
+    static Transform SetChannelValue( Transform transform, KeyframeReduction::ChannelType channelType, Vector const& value )
+    {
+        switch ( channelType )
+        {
+            case KeyframeReduction::Rotation: transform.SetRotation( Quaternion( value ) ); break;
+            case KeyframeReduction::Translation: transform.SetTranslation( value ); break;
+            default: transform.SetScale( value.GetX() ); break;
+        }
+
+        return transform;
+    }
+
+    // This needs to match the interpolation in 'AnimationClip::DecodeKeyframeReducedTransform'
+    static Vector InterpolateChannelValue( KeyframeReduction::ChannelType channelType, Vector const& from, Vector const& to, float t )
+    {
+        if ( channelType == KeyframeReduction::Rotation )
+        {
+            return Quaternion::SLerp( Quaternion( from ), Quaternion( to ), t ).ToVector();
+        }
+
+        return Vector::Lerp( from, to, t );
+    }
+
+    // Returns the value the runtime will decode for the specified bit width
+    static Vector QuantizeChannelValue( KeyframeReduction::ChannelType channelType, Vector const& value, uint32_t numBits, TrackDefinition const& trackDef )
+    {
+        auto QuantizeFloat = [numBits] ( float v, Quantization::FloatRange const& range )
+        {
+            return KeyframeReduction::DecodeFloat( KeyframeReduction::EncodeFloat( v, range.m_rangeStart, range.m_rangeLength, numBits ), range.m_rangeStart, range.m_rangeLength, numBits );
+        };
+
+        switch ( channelType )
+        {
+            case KeyframeReduction::Rotation:
+            {
+                uint32_t largestComponentIdx = 0;
+                uint32_t values[3];
+                KeyframeReduction::EncodeRotation( Quaternion( value ), numBits, largestComponentIdx, values );
+                return KeyframeReduction::DecodeRotation( largestComponentIdx, values, numBits ).ToVector();
+            }
+
+            case KeyframeReduction::Translation:
+            {
+                return Vector( QuantizeFloat( value.GetX(), trackDef.m_translationRangeX ), QuantizeFloat( value.GetY(), trackDef.m_translationRangeY ), QuantizeFloat( value.GetZ(), trackDef.m_translationRangeZ ) );
+            }
+
+            default:
+            {
+                return Vector( QuantizeFloat( value.GetX(), trackDef.m_scaleRange ) );
+            }
+        }
+    }
+
+    // Select the bit width and the keys for a single channel, each channel is measured in isolation (i.e. the rest of the hierarchy uses the raw values)
+    static void ReduceChannel( KeyframeReductionSourceData const& sourceData, TrackDefinition const& trackDef, int32_t boneIdx, KeyframeReduction::ChannelType channelType, float errorThreshold, uint32_t& outNumBits, TVector<int32_t>& outKeyFrames )
+    {
+        int32_t const numFrames = sourceData.m_numFrames;
+        int32_t const parentBoneIdx = sourceData.m_parentBoneIndices[boneIdx];
+        float const measurementDistance = sourceData.m_measurementDistances[boneIdx];
+
+        auto CalculateError = [&] ( int32_t frameIdx, Vector const& value )
+        {
+            Transform const lossyTransform = SetChannelValue( sourceData.GetParentSpaceTransform( frameIdx, boneIdx ), channelType, value );
+            Transform const lossyModelSpaceTransform = ( parentBoneIdx == InvalidIndex ) ? lossyTransform : lossyTransform * sourceData.GetModelSpaceTransform( frameIdx, parentBoneIdx );
+            return CalculateObjectSpaceError( sourceData.GetModelSpaceTransform( frameIdx, boneIdx ), lossyModelSpaceTransform, measurementDistance );
+        };
+
+        // Select the smallest bit width whose quantization error uses at most half of the error budget, the rest is used for key removal
+        //-------------------------------------------------------------------------
+
+        TVector<Vector> quantizedValues;
+        quantizedValues.resize( numFrames );
+
+        auto QuantizeAllFrames = [&] ( uint32_t numBits, float maxAllowedError )
+        {
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                quantizedValues[frameIdx] = QuantizeChannelValue( channelType, GetChannelValue( sourceData.GetParentSpaceTransform( frameIdx, boneIdx ), channelType ), numBits, trackDef );
+                if ( CalculateError( frameIdx, quantizedValues[frameIdx] ) > maxAllowedError )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+        outNumBits = KeyframeReduction::g_maxBitsPerComponent;
+        for ( uint32_t numBits = KeyframeReduction::g_minBitsPerComponent; numBits < KeyframeReduction::g_maxBitsPerComponent; numBits++ )
+        {
+            if ( QuantizeAllFrames( numBits, errorThreshold * 0.5f ) )
+            {
+                outNumBits = numBits;
+                break;
+            }
+        }
+
+        if ( outNumBits == KeyframeReduction::g_maxBitsPerComponent )
+        {
+            QuantizeAllFrames( outNumBits, FLT_MAX );
+        }
+
+        // Greedily remove keys - extend each segment as far as possible while all the frames it covers stay within the error bound
+        //-------------------------------------------------------------------------
+
+        auto IsValidSegment = [&] ( int32_t startFrameIdx, int32_t endFrameIdx )
+        {
+            for ( int32_t frameIdx = startFrameIdx + 1; frameIdx < endFrameIdx; frameIdx++ )
+            {
+                float const t = float( frameIdx - startFrameIdx ) / float( endFrameIdx - startFrameIdx );
+                Vector const value = InterpolateChannelValue( channelType, quantizedValues[startFrameIdx], quantizedValues[endFrameIdx], t );
+                if ( CalculateError( frameIdx, value ) > errorThreshold )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        };
+
+        outKeyFrames.clear();
+        outKeyFrames.emplace_back( 0 );
+
+        int32_t segmentStartIdx = 0;
+        while ( segmentStartIdx < numFrames - 1 )
+        {
+            int32_t segmentEndIdx = segmentStartIdx + 1;
+            while ( segmentEndIdx < numFrames - 1 && IsValidSegment( segmentStartIdx, segmentEndIdx + 1 ) )
+            {
+                segmentEndIdx++;
+            }
+
+            outKeyFrames.emplace_back( segmentEndIdx );
+            segmentStartIdx = segmentEndIdx;
+        }
+    }
+
+    static void CreateKeyframeReducedData( KeyframeReductionSourceData const& sourceData, TVector<TrackDefinition> const& trackDefs, float errorThreshold, KeyframeReducedData& outData )
+    {
+        outData = KeyframeReducedData();
+
+        uint64_t bitOffset = 0;
+        TVector<int32_t> keyFrames;
+
+        for ( int32_t boneIdx = 0; boneIdx < sourceData.m_numBones; boneIdx++ )
+        {
+            TrackDefinition const& trackDef = trackDefs[boneIdx];
+            bool const isChannelStatic[KeyframeReduction::g_numChannelsPerTrack] = { trackDef.IsRotationTrackStatic(), trackDef.IsTranslationTrackStatic(), trackDef.IsScaleTrackStatic() };
+
+            for ( int32_t i = 0; i < KeyframeReduction::g_numChannelsPerTrack; i++ )
+            {
+                // Static channels have no keys
+                KeyframeReducedChannel& reducedChannel = outData.m_channels.emplace_back();
+                if ( isChannelStatic[i] )
+                {
+                    continue;
+                }
+
+                auto const channelType = KeyframeReduction::ChannelType( i );
+                uint32_t numBits = 0;
+                ReduceChannel( sourceData, trackDef, boneIdx, channelType, errorThreshold, numBits, keyFrames );
+
+                EE_ASSERT( bitOffset <= UINT32_MAX );
+                reducedChannel.m_firstKeyIdx = (uint32_t) outData.m_keyFrameIndices.size();
+                reducedChannel.m_dataBitOffset = (uint32_t) bitOffset;
+                reducedChannel.m_numKeys = (uint16_t) keyFrames.size();
+                reducedChannel.m_numBitsPerComponent = (uint8_t) numBits;
+
+                outData.m_numAnimatedChannels++;
+                outData.m_totalBitsPerComponent += numBits;
+
+                // Write keys
+                //-------------------------------------------------------------------------
+
+                for ( int32_t keyFrameIdx : keyFrames )
+                {
+                    outData.m_keyFrameIndices.emplace_back( (uint16_t) keyFrameIdx );
+
+                    Transform const& rawTransform = sourceData.GetParentSpaceTransform( keyFrameIdx, boneIdx );
+                    switch ( channelType )
+                    {
+                        case KeyframeReduction::Rotation:
+                        {
+                            KeyframeReduction::WriteRotationKey( outData.m_keyData, bitOffset, rawTransform.GetRotation(), numBits );
+                        }
+                        break;
+
+                        case KeyframeReduction::Translation:
+                        {
+                            KeyframeReduction::WriteTranslationKey( outData.m_keyData, bitOffset, rawTransform.GetTranslation(), numBits, trackDef.m_translationRangeX, trackDef.m_translationRangeY, trackDef.m_translationRangeZ );
+                        }
+                        break;
+
+                        case KeyframeReduction::Scale:
+                        {
+                            KeyframeReduction::WriteScaleKey( outData.m_keyData, bitOffset, rawTransform.GetScale(), numBits, trackDef.m_scaleRange );
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Pad the key data so that the runtime can always do a 64bit read
+        outData.m_keyData.resize( outData.m_keyData.size() + KeyframeReduction::g_numKeyDataPaddingBytes, 0 );
+    }
+
+    Resource::CompilationResult AnimationClipCompiler::CreateKeyframeReducedPoseData( Resource::CompileContext const& ctx, AnimationClipResourceDescriptor const& resourceDescriptor, Import::AnimationClip const& importedClip, int32_t frameIdxStart, AnimationClip& outAnimClip ) const
+    {
+        if ( outAnimClip.m_numFrames > UINT16_MAX )
+        {
+            return ctx.LogError( "Keyframe reduction only supports animations with up to %u frames!", UINT16_MAX );
+        }
+
+        if ( resourceDescriptor.m_maxObjectSpaceError <= 0.0f || resourceDescriptor.m_errorMeasurementDistance < 0.0f )
+        {
+            return ctx.LogError( "Invalid keyframe reduction error settings!" );
+        }
+
+        TVector<Import::AnimationClip::TrackData> const& rawTrackData = importedClip.GetTrackData();
+        Import::Skeleton const& skeleton = importedClip.GetSkeleton();
+
+        // Gather source data
+        //-------------------------------------------------------------------------
+
+        KeyframeReductionSourceData sourceData;
+        sourceData.m_numBones = (int32_t) importedClip.GetNumBones();
+        sourceData.m_numFrames = outAnimClip.m_numFrames;
+        sourceData.m_parentSpaceTransforms.resize( sourceData.m_numFrames * sourceData.m_numBones );
+        sourceData.m_modelSpaceTransforms.resize( sourceData.m_numFrames * sourceData.m_numBones );
+        sourceData.m_measurementDistances.resize( sourceData.m_numBones, resourceDescriptor.m_errorMeasurementDistance );
+
+        for ( int32_t boneIdx = 0; boneIdx < sourceData.m_numBones; boneIdx++ )
+        {
+            int32_t const parentBoneIdx = skeleton.GetParentBoneIndex( boneIdx );
+            EE_ASSERT( parentBoneIdx < boneIdx );
+            sourceData.m_parentBoneIndices.emplace_back( parentBoneIdx );
+        }
+
+        for ( int32_t frameIdx = 0; frameIdx < sourceData.m_numFrames; frameIdx++ )
+        {
+            for ( int32_t boneIdx = 0; boneIdx < sourceData.m_numBones; boneIdx++ )
+            {
+                int32_t const parentBoneIdx = sourceData.m_parentBoneIndices[boneIdx];
+                int32_t const transformIdx = frameIdx * sourceData.m_numBones + boneIdx;
+                Transform const& parentSpaceTransform = rawTrackData[boneIdx].m_parentSpaceTransforms[frameIdxStart + frameIdx];
+                sourceData.m_parentSpaceTransforms[transformIdx] = parentSpaceTransform;
+                sourceData.m_modelSpaceTransforms[transformIdx] = ( parentBoneIdx == InvalidIndex ) ? parentSpaceTransform : parentSpaceTransform * sourceData.GetModelSpaceTransform( frameIdx, parentBoneIdx );
+            }
+
+            // Error on a bone is propagated to all its descendants, so ensure that we measure at least as far as the furthest descendant
+            for ( int32_t boneIdx = 0; boneIdx < sourceData.m_numBones; boneIdx++ )
+            {
+                Vector const bonePosition = sourceData.GetModelSpaceTransform( frameIdx, boneIdx ).GetTranslation();
+                for ( int32_t ancestorIdx = sourceData.m_parentBoneIndices[boneIdx]; ancestorIdx != InvalidIndex; ancestorIdx = sourceData.m_parentBoneIndices[ancestorIdx] )
+                {
+                    float const distance = sourceData.GetModelSpaceTransform( frameIdx, ancestorIdx ).GetTranslation().GetDistance3( bonePosition );
+                    sourceData.m_measurementDistances[ancestorIdx] = Math::Max( sourceData.m_measurementDistances[ancestorIdx], distance );
+                }
+            }
+        }
+
+        // Measure the final object space error using the full hierarchy and the runtime decoder
+        //-------------------------------------------------------------------------
+
+        auto MeasureError = [&] ( KeyframeReductionStats& outStats )
+        {
+            KeyframeReducedCursor cursor;
+
+            TVector<Transform> decodedPose;
+            decodedPose.resize( sourceData.m_numBones );
+            TVector<Transform> decodedModelSpacePose;
+            decodedModelSpacePose.resize( sourceData.m_numBones );
+
+            double totalError = 0.0;
+            outStats.m_maxError = 0.0f;
+
+            for ( int32_t frameIdx = 0; frameIdx < sourceData.m_numFrames; frameIdx++ )
+            {
+                outAnimClip.DecodeKeyframeReducedPose( float( frameIdx ), sourceData.m_numBones, decodedPose.data(), &cursor );
+
+                for ( int32_t boneIdx = 0; boneIdx < sourceData.m_numBones; boneIdx++ )
+                {
+                    int32_t const parentBoneIdx = sourceData.m_parentBoneIndices[boneIdx];
+                    decodedModelSpacePose[boneIdx] = ( parentBoneIdx == InvalidIndex ) ? decodedPose[boneIdx] : decodedPose[boneIdx] * decodedModelSpacePose[parentBoneIdx];
+
+                    float const error = CalculateObjectSpaceError( sourceData.GetModelSpaceTransform( frameIdx, boneIdx ), decodedModelSpacePose[boneIdx], resourceDescriptor.m_errorMeasurementDistance );
+                    outStats.m_maxError = Math::Max( outStats.m_maxError, error );
+                    totalError += error;
+                }
+            }
+
+            outStats.m_averageError = float( totalError / Math::Max( 1, sourceData.m_numFrames * sourceData.m_numBones ) );
+        };
+
+        // Compress for a given error bound
+        //-------------------------------------------------------------------------
+        // Each channel is reduced in isolation so errors can accumulate down the hierarchy
+        // If the measured error exceeds the bound, we tighten the per-channel threshold and try again
+
+        static constexpr int32_t const maxRefinementIterations = 4;
+
+        auto Compress = [&] ( float errorBound, KeyframeReductionStats& outStats )
+        {
+            KeyframeReducedData reducedData;
+            float channelErrorThreshold = errorBound;
+
+            for ( int32_t i = 0; i <= maxRefinementIterations; i++ )
+            {
+                CreateKeyframeReducedData( sourceData, outAnimClip.m_trackDefs, channelErrorThreshold, reducedData );
+
+                outAnimClip.m_isKeyframeReduced = true;
+                outAnimClip.m_reducedChannels = reducedData.m_channels;
+                outAnimClip.m_reducedKeyFrameIndices = reducedData.m_keyFrameIndices;
+                outAnimClip.m_reducedKeyData = reducedData.m_keyData;
+
+                MeasureError( outStats );
+                if ( outStats.m_maxError <= errorBound )
+                {
+                    break;
+                }
+
+                channelErrorThreshold *= 0.5f;
+            }
+
+            outStats.m_errorBound = errorBound;
+            outStats.m_numKeys = (uint32_t) reducedData.m_keyFrameIndices.size();
+            outStats.m_numUnreducedKeys = reducedData.m_numAnimatedChannels * sourceData.m_numFrames;
+            outStats.m_averageBitsPerComponent = ( reducedData.m_numAnimatedChannels > 0 ) ? float( reducedData.m_totalBitsPerComponent ) / reducedData.m_numAnimatedChannels : 0.0f;
+            outStats.m_poseDataSize = reducedData.m_channels.size() * sizeof( KeyframeReducedChannel ) + reducedData.m_keyFrameIndices.size() * sizeof( uint16_t ) + reducedData.m_keyData.size();
+        };
+
+        // Calculate the size of the uniform pose data for comparison
+        //-------------------------------------------------------------------------
+
+        size_t uniformPoseDataSize = 0;
+        {
+            auto GetPaddedCount = [] ( int32_t count ) { return Math::RoundUpToNearestMultiple32( count, AnimationClip::s_numTracksPerDecodeBlock ); };
+
+            int32_t numRotationTracks = 0, numTranslationTracks = 0, numScaleTracks = 0;
+            for ( TrackDefinition const& trackDef : outAnimClip.m_trackDefs )
+            {
+                numRotationTracks += trackDef.IsRotationTrackStatic() ? 0 : 1;
+                numTranslationTracks += trackDef.IsTranslationTrackStatic() ? 0 : 1;
+                numScaleTracks += trackDef.IsScaleTrackStatic() ? 0 : 1;
+            }
+
+            size_t const numValuesPerFrame = GetPaddedCount( numRotationTracks ) * 3 + GetPaddedCount( numTranslationTracks ) * 3 + GetPaddedCount( numScaleTracks );
+            uniformPoseDataSize += numValuesPerFrame * sourceData.m_numFrames * sizeof( uint16_t );
+            uniformPoseDataSize += sourceData.m_numFrames * sizeof( uint32_t );
+            uniformPoseDataSize += ( GetPaddedCount( numRotationTracks ) + GetPaddedCount( numTranslationTracks ) + GetPaddedCount( numScaleTracks ) ) * sizeof( uint16_t );
+            uniformPoseDataSize += ( GetPaddedCount( numTranslationTracks ) / AnimationClip::s_numTracksPerDecodeBlock ) * AnimationClip::s_numTranslationDecodeRangesPerBlock * sizeof( Float4 );
+            uniformPoseDataSize += ( GetPaddedCount( numScaleTracks ) / AnimationClip::s_numTracksPerDecodeBlock ) * AnimationClip::s_numScaleDecodeRangesPerBlock * sizeof( Float4 );
+        }
+
+        // Error vs size report
+        //-------------------------------------------------------------------------
+
+        auto LogStats = [&] ( KeyframeReductionStats const& stats )
+        {
+            ctx.LogMessage( "Keyframe Reduction (Bound: %.3fmm): Size: %.2fKB (%.1f%% of uniform), Keys: %u/%u, Avg Bits: %.1f, Max Error: %.4fmm, Avg Error: %.4fmm", stats.m_errorBound * 1000.0f, stats.m_poseDataSize / 1024.0f, 100.0f * stats.m_poseDataSize / Math::Max( uniformPoseDataSize, size_t( 1 ) ), stats.m_numKeys, stats.m_numUnreducedKeys, stats.m_averageBitsPerComponent, stats.m_maxError * 1000.0f, stats.m_averageError * 1000.0f );
+        };
+
+        if ( resourceDescriptor.m_generateErrorVsSizeReport )
+        {
+            ctx.LogMessage( "Keyframe Reduction Report - Uniform Size: %.2fKB", uniformPoseDataSize / 1024.0f );
+
+            static constexpr float const reportErrorBoundMultipliers[] = { 0.25f, 0.5f, 2.0f, 4.0f, 8.0f };
+            for ( float multiplier : reportErrorBoundMultipliers )
+            {
+                KeyframeReductionStats reportStats;
+                Compress( resourceDescriptor.m_maxObjectSpaceError * multiplier, reportStats );
+                LogStats( reportStats );
+            }
+        }
+
+        // Compress
+        //-------------------------------------------------------------------------
+
+        KeyframeReductionStats stats;
+        Compress( resourceDescriptor.m_maxObjectSpaceError, stats );
+        LogStats( stats );
+
+        // Compare the sampling cost against the uniform pose data
+        //-------------------------------------------------------------------------
+        // Sequential playback uses a key cursor (like the graph nodes), random access has to search for every key
+
+        if ( resourceDescriptor.m_generateErrorVsSizeReport && outAnimClip.m_numFrames > 1 )
+        {
+            AnimationClip uniformClip;
+            uniformClip.m_numFrames = outAnimClip.m_numFrames;
+            uniformClip.m_trackDefs = outAnimClip.m_trackDefs;
+            CreateUniformPoseData( importedClip, frameIdxStart, frameIdxStart + outAnimClip.m_numFrames - 1, uniformClip );
+
+            static constexpr int32_t const numSamplesPerFrame = 4;
+            TVector<FrameTime> sequentialSampleTimes;
+            for ( int32_t i = 0; i < ( outAnimClip.m_numFrames - 1 ) * numSamplesPerFrame; i++ )
+            {
+                sequentialSampleTimes.emplace_back( FrameTime( i / numSamplesPerFrame, Percentage( float( i % numSamplesPerFrame ) / numSamplesPerFrame ) ) );
+            }
+
+            Math::RNG rng;
+            TVector<FrameTime> randomSampleTimes;
+            for ( int32_t i = 0; i < (int32_t) sequentialSampleTimes.size(); i++ )
+            {
+                randomSampleTimes.emplace_back( FrameTime( Percentage( rng.GetFloat() ), outAnimClip.m_numFrames ) );
+            }
+
+            TVector<Transform> sampledPose;
+            sampledPose.resize( sourceData.m_numBones );
+
+            auto GetSamplingTimePerPose = [&] ( AnimationClip const& clip, TVector<FrameTime> const& sampleTimes, KeyframeReducedCursor* pCursor )
+            {
+                Milliseconds samplingTime = 0;
+                {
+                    ScopedTimer<PlatformClock> timer( samplingTime );
+                    for ( FrameTime const& sampleTime : sampleTimes )
+                    {
+                        clip.SamplePose( sampleTime, sourceData.m_numBones, sampledPose.data(), false, pCursor );
+                    }
+                }
+                return samplingTime.ToMicroseconds().ToFloat() / sampleTimes.size();
+            };
+
+            KeyframeReducedCursor cursor;
+            float const uniformSequentialTime = GetSamplingTimePerPose( uniformClip, sequentialSampleTimes, nullptr );
+            float const uniformRandomTime = GetSamplingTimePerPose( uniformClip, randomSampleTimes, nullptr );
+            float const reducedSequentialTime = GetSamplingTimePerPose( outAnimClip, sequentialSampleTimes, &cursor );
+            float const reducedRandomTime = GetSamplingTimePerPose( outAnimClip, randomSampleTimes, nullptr );
+
+            ctx.LogMessage( "Keyframe Reduction Sampling Cost (us / pose) - Sequential: %.3f (Uniform: %.3f), Random Access: %.3f (Uniform: %.3f)", reducedSequentialTime, uniformSequentialTime, reducedRandomTime, uniformRandomTime );
+        }
+
+        if ( stats.m_maxError > resourceDescriptor.m_maxObjectSpaceError )
+        {
+            ctx.LogWarning( "Keyframe reduction could not reach the requested error bound (%.4fmm), max error: %.4fmm", resourceDescriptor.m_maxObjectSpaceError * 1000.0f, stats.m_maxError * 1000.0f );
+            return Resource::CompilationResult::SuccessWithWarnings;
+        }
+
+        return Resource::CompilationResult::Success;
+    }
+
+    //-------------------------------------------------------------------------
+
     Resource::CompilationResult AnimationClipCompiler::ProcessEventsData( Resource::CompileContext const& ctx, AnimationClipResourceDescriptor const& resourceDescriptor, Import::Animation const& rawAnimData, AnimationClipEventData& outEventData ) const
     {
         Resource::CompilationResult result = Resource::CompilationResult::Success;
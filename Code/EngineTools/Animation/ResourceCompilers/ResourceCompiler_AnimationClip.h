@@ -43,6 +43,12 @@ namespace EE::Animation
 
         Resource::CompilationResult ProcessEventsData( Resource::CompileContext const& ctx, AnimationClipResourceDescriptor const& resourceDescriptor, Import::Animation const& rawAnimData, AnimationClipEventData& outEventData ) const;
 
-        Resource::CompilationResult TransferAndCompressAnimationData( Resource::CompileContext const& ctx, Import::Animation const& importedAnimation, Import::AnimationClip const& importedClip, AnimationClip& outAnimClip, IntRange const& limitRange, TVector<StringID> const& bonesToSampleInModelSpace, bool isPrimaryClip ) const;
+        Resource::CompilationResult TransferAndCompressAnimationData( Resource::CompileContext const& ctx, AnimationClipResourceDescriptor const& resourceDescriptor, Import::Animation const& importedAnimation, Import::AnimationClip const& importedClip, AnimationClip& outAnimClip, IntRange const& limitRange, TVector<StringID> const& bonesToSampleInModelSpace, bool isPrimaryClip ) const;
+
+        // Store every frame of all animated tracks using 16bit quantization
+        void CreateUniformPoseData( Import::AnimationClip const& importedClip, int32_t frameIdxStart, int32_t frameIdxEnd, AnimationClip& outAnimClip ) const;
+
+        // Store only the keys (and bits) needed to keep the object space error within the error bound specified in the descriptor
+        Resource::CompilationResult CreateKeyframeReducedPoseData( Resource::CompileContext const& ctx, AnimationClipResourceDescriptor const& resourceDescriptor, Import::AnimationClip const& importedClip, int32_t frameIdxStart, AnimationClip& outAnimClip ) const;
     };
 }
\ No newline at end of file
@@ -19,6 +19,10 @@ namespace EE::Animation
         m_rootMotionGenerationPreRotation = EulerAngles();
         m_additiveType = AdditiveType::None;
         m_additiveBaseFrameIndex = 0;
+        m_compressionMode = CompressionMode::Uniform;
+        m_maxObjectSpaceError = 0.0001f;
+        m_errorMeasurementDistance = 0.03f;
+        m_generateErrorVsSizeReport = false;
     }
 
     void AnimationClipResourceDescriptor::GetCompileDependencies( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& sourceResourceDirectoryPath, String const& subResourceName, TVector<Resource::CompileDependency>& outDependencies ) const
@@ -33,6 +33,14 @@ namespace EE::Animation
             FixedValue,
         };
 
+        enum class CompressionMode
+        {
+            EE_REFLECT_ENUM
+
+            Uniform, // Every frame is stored using 16bit quantization
+            KeyframeReduced, // Redundant keys are removed and each track channel uses the smallest bit width that keeps the object space error within the error bound
+        };
+
     public:
 
         virtual bool IsValid() const override { return m_skeleton.IsSet() && m_animationPath.IsValid(); }
@@ -88,6 +96,24 @@ namespace EE::Animation
         EE_REFLECT( Category = "Advanced" );
         TVector<StringID>                       m_bonesToSampleInModelSpace;
 
+        // Compression
+        //-------------------------------------------------------------------------
+
+        EE_REFLECT( Category = "Compression" );
+        CompressionMode                         m_compressionMode = CompressionMode::Uniform;
+
+        // The max allowed object space error (in meters) for any bone when using keyframe reduction
+        EE_REFLECT( Category = "Compression" );
+        float                                   m_maxObjectSpaceError = 0.0001f;
+
+        // The distance (in meters) of the virtual vertices around each bone used to measure rotation error, this approximates the skinned mesh around a bone
+        EE_REFLECT( Category = "Compression" );
+        float                                   m_errorMeasurementDistance = 0.03f;
+
+        // Also compress the clip at a range of error bounds and log the resulting sizes/errors (slow)
+        EE_REFLECT( Category = "Compression" );
+        bool                                    m_generateErrorVsSizeReport = false;
+
         // Additive
         //-------------------------------------------------------------------------
 
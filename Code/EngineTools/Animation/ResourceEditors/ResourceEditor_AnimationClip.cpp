@@ -11,6 +11,7 @@
 #include "Engine/UpdateContext.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "Base/Math/MathUtils.h"
+#include "Base/Math/MathRandom.h"
 #include "Base/Types/Color.h"
 
 //-------------------------------------------------------------------------
@@ -80,6 +81,7 @@ namespace EE::Animation
         ImGui::DockBuilderDockWindow( GetToolWindowName( "Skeleton Outline" ).c_str(), leftDockID0 );
         ImGui::DockBuilderDockWindow( GetToolWindowName( "Float Curves" ).c_str(), leftDockID1 );
         ImGui::DockBuilderDockWindow( GetToolWindowName( "Bone Info" ).c_str(), leftDockID1 );
+        ImGui::DockBuilderDockWindow( GetToolWindowName( "Sampling Benchmark" ).c_str(), leftDockID1 );
         
         ImGui::DockBuilderDockWindow( GetToolWindowName( "Timeline" ).c_str(), centerDockID0 );
 
@@ -106,6 +108,7 @@ namespace EE::Animation
         CreateToolWindow( "Skeleton Outline", [this] ( UpdateContext const& context, bool isFocused ) { DrawSkeletonOutlineWindow( context, isFocused ); } );
         CreateToolWindow( "Bone Info", [this] ( UpdateContext const& context, bool isFocused ) { DrawBoneInfoWindow( context, isFocused ); } );
         CreateToolWindow( "Float Curves", [this] ( UpdateContext const& context, bool isFocused ) { DrawFloatCurvesWindow( context, isFocused ); } );
+        CreateToolWindow( "Sampling Benchmark", [this] ( UpdateContext const& context, bool isFocused ) { DrawSamplingBenchmarkWindow( context, isFocused ); } );
     }
 
     void AnimationClipEditor::Shutdown( UpdateContext const& context )
@@ -848,4 +851,132 @@ namespace EE::Animation
         TResourceEditor<AnimationClip>::PreUndoRedo( operation, pAction );
         m_propertyGrid.SetTypeToEdit( nullptr );
     }
+
+    //-------------------------------------------------------------------------
+    // Sampling Benchmark
+    //-------------------------------------------------------------------------
+
+    void AnimationClipEditor::RunSamplingBenchmark()
+    {
+        EE_ASSERT( IsResourceLoaded() );
+
+        AnimationClip const* pAnimation = m_editedResource.GetPtr();
+        Skeleton const* pSkeleton = pAnimation->GetSkeleton();
+
+        m_samplingBenchmarkResult = SamplingBenchmarkResult();
+        m_samplingBenchmarkResult.m_numSamples = Math::Max( 1, m_samplingBenchmarkNumSamples );
+        m_samplingBenchmarkResult.m_isKeyframeReduced = pAnimation->IsKeyframeReduced();
+
+        // Use the same set of random sample times for both decoders
+        Math::RNG rng;
+        TVector<FrameTime> sampleTimes;
+        sampleTimes.reserve( m_samplingBenchmarkResult.m_numSamples );
+        for ( int32_t i = 0; i < m_samplingBenchmarkResult.m_numSamples; i++ )
+        {
+            sampleTimes.emplace_back( pAnimation->GetFrameTime( Percentage( rng.GetFloat() ) ) );
+        }
+
+        Pose pose( pSkeleton );
+        Pose referencePose( pSkeleton );
+
+        // Time both decoders
+        //-------------------------------------------------------------------------
+
+        Milliseconds decodeTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( decodeTime );
+            for ( FrameTime const& sampleTime : sampleTimes )
+            {
+                pAnimation->GetPose( sampleTime, &pose, m_skeletonLOD, false );
+            }
+        }
+
+        m_samplingBenchmarkResult.m_decodeTime = decodeTime.ToMicroseconds();
+
+        // The reference decoder only exists for uniform pose data, a keyframe reduced clip would just be compared against itself
+        if ( m_samplingBenchmarkResult.m_isKeyframeReduced )
+        {
+            return;
+        }
+
+        Milliseconds referenceDecodeTime = 0;
+        {
+            ScopedTimer<PlatformClock> timer( referenceDecodeTime );
+            for ( FrameTime const& sampleTime : sampleTimes )
+            {
+                pAnimation->GetPoseReference( sampleTime, &referencePose, m_skeletonLOD );
+            }
+        }
+
+        m_samplingBenchmarkResult.m_referenceDecodeTime = referenceDecodeTime.ToMicroseconds();
+
+        // Compare decoder results
+        //-------------------------------------------------------------------------
+
+        int32_t const numBones = pSkeleton->GetNumBones( m_skeletonLOD );
+        for ( FrameTime const& sampleTime : sampleTimes )
+        {
+            pAnimation->GetPose( sampleTime, &pose, m_skeletonLOD, false );
+            pAnimation->GetPoseReference( sampleTime, &referencePose, m_skeletonLOD );
+
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                Transform const& transform = pose.GetTransform( boneIdx );
+                Transform const& referenceTransform = referencePose.GetTransform( boneIdx );
+
+                Radians const rotationError = Quaternion::Distance( transform.GetRotation(), referenceTransform.GetRotation() );
+                float const translationError = transform.GetTranslation().GetDistance3( referenceTransform.GetTranslation() );
+                float const scaleError = Math::Abs( transform.GetScale() - referenceTransform.GetScale() );
+
+                m_samplingBenchmarkResult.m_maxRotationError = Math::Max( m_samplingBenchmarkResult.m_maxRotationError.ToFloat(), rotationError.ToFloat() );
+                m_samplingBenchmarkResult.m_maxTranslationError = Math::Max( m_samplingBenchmarkResult.m_maxTranslationError, translationError );
+                m_samplingBenchmarkResult.m_maxScaleError = Math::Max( m_samplingBenchmarkResult.m_maxScaleError, scaleError );
+            }
+        }
+    }
+
+    void AnimationClipEditor::DrawSamplingBenchmarkWindow( UpdateContext const& context, bool isFocused )
+    {
+        if ( !IsResourceLoaded() )
+        {
+            return;
+        }
+
+        ImGui::SetNextItemWidth( 120 );
+        ImGui::InputInt( "Samples", &m_samplingBenchmarkNumSamples );
+        m_samplingBenchmarkNumSamples = Math::Clamp( m_samplingBenchmarkNumSamples, 1, 1000000 );
+
+        ImGui::SameLine();
+        if ( ImGui::Button( EE_ICON_PLAY" Run" ) )
+        {
+            RunSamplingBenchmark();
+        }
+
+        //-------------------------------------------------------------------------
+
+        SamplingBenchmarkResult const& result = m_samplingBenchmarkResult;
+        if ( result.m_numSamples == 0 )
+        {
+            return;
+        }
+
+        float const decodeTimePerPose = result.m_decodeTime.ToFloat() / result.m_numSamples;
+        float const referenceDecodeTimePerPose = result.m_referenceDecodeTime.ToFloat() / result.m_numSamples;
+
+        ImGui::Text( "Samples: %d (LOD: %s)", result.m_numSamples, m_skeletonLOD == Skeleton::LOD::High ? "High" : "Low" );
+
+        if ( result.m_isKeyframeReduced )
+        {
+            ImGui::Text( "Keyframe Reduced Decode: %.3fus / pose", decodeTimePerPose );
+            ImGui::TextWrapped( "Keyframe reduced clips have no reference decoder. Enable 'Generate Error Vs Size Report' and recompile to log the sampling cost against the uniform pose data." );
+            return;
+        }
+
+        ImGui::Text( "SIMD Decode: %.3fus / pose", decodeTimePerPose );
+        ImGui::Text( "Reference Decode: %.3fus / pose", referenceDecodeTimePerPose );
+        ImGui::Text( "Speedup: %.2fx", ( decodeTimePerPose > 0.0f ) ? referenceDecodeTimePerPose / decodeTimePerPose : 0.0f );
+        ImGui::Text( "Max Rotation Error: %.6f rad", result.m_maxRotationError.ToFloat() );
+        ImGui::Text( "Max Translation Error: %.6f", result.m_maxTranslationError );
+        ImGui::Text( "Max Scale Error: %.6f", result.m_maxScaleError );
+    }
 }
\ No newline at end of file
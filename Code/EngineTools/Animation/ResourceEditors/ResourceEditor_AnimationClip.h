@@ -50,6 +50,19 @@ namespace EE::Animation
             bool                            m_isExpanded = true;
         };
 
+        // Results of comparing the SIMD pose decoder against the scalar reference decoder
+        // Keyframe reduced clips have no reference decoder, their uniform comparison is part of the compiler's error vs size report
+        struct SamplingBenchmarkResult
+        {
+            int32_t                         m_numSamples = 0;
+            bool                            m_isKeyframeReduced = false;
+            Microseconds                    m_decodeTime = 0.0f;
+            Microseconds                    m_referenceDecodeTime = 0.0f;
+            Radians                         m_maxRotationError = 0.0f;
+            float                           m_maxTranslationError = 0.0f;
+            float                           m_maxScaleError = 0.0f;
+        };
+
     public:
 
         AnimationClipEditor( ToolsContext const* pToolsContext, ResourceID const& resourceID, EntityWorld* pWorld );
@@ -98,6 +111,11 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        void DrawSamplingBenchmarkWindow( UpdateContext const& context, bool isFocused );
+        void RunSamplingBenchmark();
+
+        //-------------------------------------------------------------------------
+
         virtual void OnDataFileUnload() override;
         virtual void OnDataFileLoadCompleted() override;
         virtual void OnResourceLoadCompleted( Resource::ResourcePtr* pResourcePtr ) override;
@@ -136,5 +154,8 @@ namespace EE::Animation
         Skeleton::LOD                   m_skeletonLOD = Skeleton::LOD::High;
 
         TVector<StringID>               m_secondarySkeletonAttachmentSocketIDs;
+
+        int32_t                         m_samplingBenchmarkNumSamples = 10000;
+        SamplingBenchmarkResult         m_samplingBenchmarkResult;
     };
 }
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "Engine/Animation/Systems/EntitySystem_Animation.h"
 #include "Engine/Animation/Systems/WorldSystem_Animation.h"
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_RecordingStream.h"
 #include "Engine/Animation/AnimationClip.h"
 #include "Engine/Render/Components/Component_SkeletalMesh.h"
 #include "Engine/Entity/EntityWorld.h"
@@ -1089,6 +1090,16 @@ namespace EE::Animation
 
                 m_graphRecording.Reset();
             }
+
+            if ( m_pStreamedRecording != nullptr && VectorContains( m_streamedRecordingResourceIDs, editedGraph ) )
+            {
+                if ( m_debugMode == DebugMode::ReviewRecording )
+                {
+                    StopPreview();
+                }
+
+                UnloadStreamedRecording();
+            }
         };
 
         m_globalGraphEditEventBindingID = s_graphModifiedEvent.Bind( OnGlobalGraphEdited );
@@ -1141,6 +1152,11 @@ namespace EE::Animation
 
         s_graphModifiedEvent.Unbind( m_globalGraphEditEventBindingID );
 
+        if ( m_pStreamedRecording != nullptr )
+        {
+            UnloadStreamedRecording();
+        }
+
         //-------------------------------------------------------------------------
 
         EE_ASSERT( !m_previewGraphDefinitionPtr.IsSet() );
@@ -1338,7 +1354,14 @@ namespace EE::Animation
                             }
                         }
 
-                        m_graphRecordingPlayer.StartPlayback( m_pDebugGraphInstance, externalGraphDefs, externalClips, &m_graphRecording );
+                        if ( m_pStreamedRecording != nullptr )
+                        {
+                            m_graphRecordingPlayer.StartPlayback( m_pDebugGraphInstance, externalGraphDefs, externalClips, m_pStreamedRecording );
+                        }
+                        else
+                        {
+                            m_graphRecordingPlayer.StartPlayback( m_pDebugGraphInstance, externalGraphDefs, externalClips, &m_graphRecording );
+                        }
                         m_reviewStarted = true;
                         SetUpdateToReview( 0 );
                     }
@@ -1934,7 +1957,14 @@ namespace EE::Animation
         //-------------------------------------------------------------------------
 
         EE_ASSERT( m_requestedDebugTarget.IsValid() );
-        if ( m_requestedDebugTarget.m_type == DebugTargetType::Recording )
+        if ( m_requestedDebugTarget.m_type == DebugTargetType::Recording && m_pStreamedRecording != nullptr )
+        {
+            for ( ResourceID const& resourceID : m_streamedRecordingResourceIDs )
+            {
+                VectorEmplaceBackUnique( graphResourceIDs, resourceID );
+            }
+        }
+        else if ( m_requestedDebugTarget.m_type == DebugTargetType::Recording )
         {
             EE_ASSERT( m_graphRecording.HasRecordedData() );
 
@@ -5888,7 +5918,7 @@ namespace EE::Animation
             }
             else // Show the start/join button
             {
-                ImGui::BeginDisabled( !m_graphRecording.HasRecordedData() );
+                ImGui::BeginDisabled( !HasRecordingToReview() );
                 if ( ImGuiX::IconButton( EE_ICON_PLAY, "##StartReview", Colors::Lime, buttonSize ) )
                 {
                     if ( IsDebugging() )
@@ -5928,6 +5958,23 @@ namespace EE::Animation
             }
             ImGui::EndDisabled();
 
+            // Load Streamed Recording
+            //-------------------------------------------------------------------------
+
+            ImGui::SameLine();
+
+            ImGui::BeginDisabled( m_isRecording || IsReviewingRecording() );
+            if ( ImGuiX::IconButton( EE_ICON_FOLDER_OPEN, "##LoadStreamedRecording", Colors::White, buttonSize ) )
+            {
+                FileDialog::Result const result = FileDialog::Load( { FileDialog::ExtensionFilter( "agrec", "Graph Recordings" ) }, "Load Streamed Recording..." );
+                if ( result )
+                {
+                    LoadStreamedRecording( result );
+                }
+            }
+            ImGuiX::ItemTooltip( "Load Streamed Recording" );
+            ImGui::EndDisabled();
+
             // Timeline
             //-------------------------------------------------------------------------
 
@@ -5943,7 +5990,7 @@ namespace EE::Animation
             ImGui::SameLine();
 
             ImGui::SetNextItemWidth( ImGui::GetContentRegionAvail().x - ( buttonSize.x + ImGui::GetStyle().ItemSpacing.x ) );
-            int32_t const numFramesRecorded = IsReviewingRecording() ? m_graphRecording.GetNumRecordedUpdates() : 1;
+            int32_t const numFramesRecorded = ( IsReviewingRecording() && m_reviewStarted ) ? m_graphRecordingPlayer.GetNumRecordedUpdates() : 1;
             int32_t frameIdx = IsReviewingRecording() ? m_currentlyReviewedUpdateIdx : 0;
             if ( ImGui::SliderInt( "##timeline", &frameIdx, 0, numFramesRecorded - 1 ) )
             {
@@ -5959,6 +6006,44 @@ namespace EE::Animation
 
             ImGui::EndDisabled();
 
+            // Streaming
+            //-------------------------------------------------------------------------
+
+            ImGui::BeginDisabled( m_isRecording );
+            bool streamToDisk = m_recordingStreamPath.IsValid();
+            if ( ImGui::Checkbox( "Stream To Disk", &streamToDisk ) )
+            {
+                m_recordingStreamPath.Clear();
+
+                if ( streamToDisk )
+                {
+                    FileDialog::Result const result = FileDialog::Save( { FileDialog::ExtensionFilter( "agrec", "Graph Recordings" ) }, "Stream Recording To..." );
+                    if ( result )
+                    {
+                        m_recordingStreamPath = result;
+                    }
+                }
+            }
+            ImGuiX::ItemTooltip( "Write the recording to disk in the background as it is recorded, rather than keeping it in memory.\nThe streamed recording is loaded for review once the recording is stopped." );
+            ImGui::EndDisabled();
+
+            if ( m_recordingStreamPath.IsValid() )
+            {
+                ImGui::SameLine();
+                ImGui::TextUnformatted( m_recordingStreamPath.c_str() );
+            }
+
+            if ( m_pStreamedRecording != nullptr && !m_isRecording )
+            {
+                ImGui::Text( "Loaded Streamed Recording: %d updates", m_pStreamedRecording->GetNumRecordedUpdates() );
+            }
+
+            if ( m_graphRecording.IsStreaming() )
+            {
+                GraphRecordingStreamWriter const* pStreamWriter = m_graphRecording.GetStreamWriter();
+                ImGui::Text( "Streamed Updates: %d, Written: %.2fMB, Stalls: %d", pStreamWriter->GetNumWrittenUpdates(), float( pStreamWriter->GetNumBytesWritten() ) / ( 1024 * 1024 ), pStreamWriter->GetNumWriterStalls() );
+            }
+
             // Frame Info
             //-------------------------------------------------------------------------
 
@@ -6010,6 +6095,20 @@ namespace EE::Animation
 
         ClearRecordedData();
 
+        if ( m_pStreamedRecording != nullptr )
+        {
+            UnloadStreamedRecording();
+        }
+
+        if ( m_recordingStreamPath.IsValid() )
+        {
+            if ( !m_graphRecording.StartStreaming( m_recordingStreamPath, GraphRecordingStreamWriter::s_defaultMemoryBudget ) )
+            {
+                MessageDialog::Error( "Recording Error", "Failed to open '%s' for streaming!", m_recordingStreamPath.c_str() );
+                return;
+            }
+        }
+
         m_pDebugGraphInstance->StartRecording( &m_graphRecording );
 
         m_isRecording = true;
@@ -6023,6 +6122,13 @@ namespace EE::Animation
         m_pDebugGraphInstance->StopRecording();
 
         m_isRecording = false;
+
+        // Load the streamed file so that it can be reviewed like an in-memory recording
+        if ( m_graphRecording.IsStreaming() )
+        {
+            m_graphRecording.StopStreaming();
+            LoadStreamedRecording( m_recordingStreamPath );
+        }
     }
 
     void AnimationGraphEditor::ClearRecordedData()
@@ -6031,6 +6137,55 @@ namespace EE::Animation
         m_graphRecording.Reset();
     }
 
+    bool AnimationGraphEditor::LoadStreamedRecording( FileSystem::Path const& filePath )
+    {
+        EE_ASSERT( !m_isRecording && !IsReviewingRecording() );
+
+        if ( m_pStreamedRecording != nullptr )
+        {
+            UnloadStreamedRecording();
+        }
+
+        ClearRecordedData();
+
+        //-------------------------------------------------------------------------
+
+        m_pStreamedRecording = EE::New<GraphRecordingStreamReader>();
+        if ( !m_pStreamedRecording->Open( filePath ) )
+        {
+            MessageDialog::Error( "Recording Error", "Failed to load streamed recording '%s'!", filePath.c_str() );
+            EE::Delete( m_pStreamedRecording );
+            return false;
+        }
+
+        // Only recordings of this graph can be reviewed
+        StringID const recordedVariationID = m_pStreamedRecording->GetRecordedGraphVariationID();
+        ResourceID const expectedGraphID = Variation::GenerateResourceDataPath( m_pToolsContext->GetSourceDataDirectory(), GetDataFileSystemPath(), recordedVariationID );
+        if ( m_pStreamedRecording->GetRecordedGraphID() != expectedGraphID || !GetEditedGraphData()->m_pGraphDefinition->IsValidVariation( recordedVariationID ) )
+        {
+            MessageDialog::Error( "Recording Error", "Streamed recording '%s' was not recorded from this graph!", filePath.c_str() );
+            UnloadStreamedRecording();
+            return false;
+        }
+
+        m_streamedRecordingResourceIDs = m_pStreamedRecording->GetAllRecordedResourceIDs();
+
+        if ( !IsDebugging() )
+        {
+            SetActiveVariation( recordedVariationID );
+        }
+
+        return true;
+    }
+
+    void AnimationGraphEditor::UnloadStreamedRecording()
+    {
+        EE_ASSERT( m_pStreamedRecording != nullptr && !IsReviewingRecording() );
+        m_pStreamedRecording->Close();
+        EE::Delete( m_pStreamedRecording );
+        m_streamedRecordingResourceIDs.clear();
+    }
+
     void AnimationGraphEditor::SetUpdateToReview( int32_t newUpdateIdx )
     {
         EE_ASSERT( IsReviewingRecording() && m_reviewStarted );
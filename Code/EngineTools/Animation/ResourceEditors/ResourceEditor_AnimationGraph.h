@@ -522,6 +522,15 @@ namespace EE::Animation
         // Clear recorded data
         void ClearRecordedData();
 
+        // Load a recording that was streamed to disk, this replaces any recorded data
+        bool LoadStreamedRecording( FileSystem::Path const& filePath );
+
+        // Close the loaded streamed recording
+        void UnloadStreamedRecording();
+
+        // Do we have either an in-memory or a streamed recording to review
+        inline bool HasRecordingToReview() const { return m_pStreamedRecording != nullptr || m_graphRecording.HasRecordedData(); }
+
         // Start recorder the live preview state
         void StartRecording();
 
@@ -683,5 +692,8 @@ namespace EE::Animation
         bool                                                                m_isRecording = false;
         bool                                                                m_reviewStarted = false;
         bool                                                                m_drawExtraRecordingInfo = false;
+        FileSystem::Path                                                    m_recordingStreamPath; // If set, the recording is streamed to this file instead of being kept in memory
+        GraphRecordingStreamReader*                                         m_pStreamedRecording = nullptr; // The loaded streamed recording, reviewed instead of the in-memory recording
+        TInlineVector<ResourceID, 4>                                        m_streamedRecordingResourceIDs;
     };
 }
\ No newline at end of file
@@ -15,13 +15,15 @@ namespace EE::EntityModel
     Resource::CompilationResult EntityCollectionCompiler::Compile( Resource::CompileContext const& ctx ) const
     {
         auto pCollectionResourceDescriptor = ctx.GetDescriptor<EntityCollectionResourceDescriptor>();
+        EntityCollection collection = pCollectionResourceDescriptor->m_collection;
+        collection.CompileInstantiationPrograms( ctx.m_typeRegistry );
 
         //-------------------------------------------------------------------------
         // Serialize
         //-------------------------------------------------------------------------
 
         Serialization::BinaryOutputArchive archive;
-        archive << Resource::ResourceHeader( EntityCollection::s_version, EntityCollection::GetStaticResourceTypeID(), ctx.m_sourceResourceHash ) << pCollectionResourceDescriptor->m_collection;
+        archive << Resource::ResourceHeader( EntityCollection::s_version, EntityCollection::GetStaticResourceTypeID(), ctx.m_sourceResourceHash ) << collection;
         
         if ( archive.WriteToFile( ctx.GetOutputPath() ) )
         {
@@ -88,6 +88,12 @@ namespace EE::EntityModel
             }
         }
 
+        //-------------------------------------------------------------------------
+        // Instantiation Programs
+        //-------------------------------------------------------------------------
+
+        map.CompileInstantiationPrograms( ctx.m_typeRegistry );
+
         //-------------------------------------------------------------------------
         // Serialize
         //-------------------------------------------------------------------------
@@ -1,6 +1,7 @@
 #include "FileSystemWatcher.h"
-#include "Base/FileSystem/FileSystem.h"
 
+#if _WIN32
+#include "Base/FileSystem/FileSystem.h"
 #include "Base/Platform/PlatformUtils_Win32.h"
 
 //-------------------------------------------------------------------------
@@ -17,7 +18,6 @@
 
 //-------------------------------------------------------------------------
 
-#if _WIN32
 namespace EE::FileSystem
 {
     constexpr static size_t const g_resultBufferByteSize = 1024 * 1024 * sizeof( uint8_t );
@@ -4,15 +4,19 @@
 #include "Base/FileSystem/FileSystemPath.h"
 #include "Base/Time/Time.h"
 #include "Base/Types/Event.h"
+#include "Base/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
-// Basic Win32 File System Watcher
+// Basic File System Watcher
 //-------------------------------------------------------------------------
 // Implementation will try to batch file modification notification to prevent sending multiple events for the same operation
 // The OS level function (ReadDirectoryChangesW) will trigger a modification event for multiple operations that are part of a logical operation
+//
+// On linux, inotify is used instead. Inotify watches are not recursive so a watch is added for each directory in the watched hierarchy.
+// File modifications are only reported once the file is closed after writing, so partial writes are never reported.
 //-------------------------------------------------------------------------
 
-#if _WIN32
+#if _WIN32 || __linux__
 namespace EE::FileSystem
 {
     class EE_ENGINETOOLS_API Watcher final
@@ -53,7 +57,11 @@ namespace EE::FileSystem
         ~Watcher();
 
         bool StartWatching( FileSystem::Path const& directoryToWatch );
+        #if _WIN32
         bool IsWatching() const { return m_pDirectoryHandle != nullptr; }
+        #else
+        bool IsWatching() const { return m_inotifyDescriptor >= 0; }
+        #endif
         void StopWatching();
 
         // Returns true if any filesystem changes detected!
@@ -70,19 +78,35 @@ namespace EE::FileSystem
 
     private:
 
+        #if _WIN32
         void RequestListOfDirectoryChanges();
         void ProcessListOfDirectoryChanges();
+        #else
+        bool AddWatchesForDirectory( FileSystem::Path const& directoryPath );
+        void RemoveWatchesForDirectory( FileSystem::Path const& directoryPath );
+        void ProcessListOfDirectoryChanges( size_t numBytesReturned );
+        void ProcessUnmatchedMoves();
+        void RemoveRedundantEventsForRename( Event const& renameEvent );
+        #endif
 
     private:
 
         FileSystem::Path                                m_directoryToWatch;
+
+        #if _WIN32
         void*                                           m_pDirectoryHandle = nullptr;
 
         // Request Data
         void*                                           m_pOverlappedEvent = nullptr;
-        uint8_t*                                        m_pResultBuffer = nullptr;
         unsigned long                                   m_numBytesReturned = 0;
         bool                                            m_requestPending = false;
+        #else
+        int32_t                                         m_inotifyDescriptor = -1;
+        THashMap<int32_t, FileSystem::Path>             m_watchedDirectories;
+        TInlineVector<eastl::pair<uint32_t, Event>, 8>  m_pendingMoves; // Moves are reported as two events that share a cookie
+        #endif
+
+        uint8_t*                                        m_pResultBuffer = nullptr;
 
         // File Modification buffers
         TInlineVector<Event, 50>                        m_unhandledEvents;
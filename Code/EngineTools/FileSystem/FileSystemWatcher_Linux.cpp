@@ -0,0 +1,319 @@
+#ifdef __linux__
+#include "FileSystemWatcher.h"
+#include "Base/FileSystem/FileSystemUtils.h"
+#include "Base/Platform/PlatformUtils_Linux.h"
+#include <errno.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    constexpr static size_t const g_resultBufferByteSize = 256 * 1024 * sizeof( uint8_t );
+    constexpr static uint32_t const g_watchMask = IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+
+    //-------------------------------------------------------------------------
+
+    Watcher::Watcher()
+    {
+        m_pResultBuffer = (uint8_t*) EE::Alloc( g_resultBufferByteSize, alignof( inotify_event ) );
+    }
+
+    Watcher::~Watcher()
+    {
+        StopWatching();
+        EE::Free( m_pResultBuffer );
+    }
+
+    bool Watcher::StartWatching( Path const& directoryToWatch )
+    {
+        EE_ASSERT( !IsWatching() );
+        EE_ASSERT( directoryToWatch.IsValid() && directoryToWatch.IsDirectoryPath() );
+        m_directoryToWatch = directoryToWatch;
+
+        m_inotifyDescriptor = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+        if ( m_inotifyDescriptor < 0 )
+        {
+            EE_LOG_ERROR( LogCategory::FileSystem, "File System Watcher", "Failed to create inotify instance for directory (%s), error: %s", m_directoryToWatch.c_str(), Platform::Linux::GetLastErrorMessage().c_str() );
+            return false;
+        }
+
+        if ( !AddWatchesForDirectory( m_directoryToWatch ) )
+        {
+            StopWatching();
+            return false;
+        }
+
+        return true;
+    }
+
+    void Watcher::StopWatching()
+    {
+        if ( m_inotifyDescriptor >= 0 )
+        {
+            close( m_inotifyDescriptor );
+        }
+
+        m_directoryToWatch = Path();
+        m_inotifyDescriptor = -1;
+        m_watchedDirectories.clear();
+        m_pendingMoves.clear();
+    }
+
+    bool Watcher::Update()
+    {
+        EE_ASSERT( IsWatching() );
+        m_unhandledEvents.clear();
+
+        //-------------------------------------------------------------------------
+
+        bool hasChanges = false;
+        while ( true )
+        {
+            ssize_t const numBytesReturned = read( m_inotifyDescriptor, m_pResultBuffer, g_resultBufferByteSize );
+            if ( numBytesReturned < 0 )
+            {
+                if ( errno == EINTR )
+                {
+                    continue;
+                }
+
+                // The descriptor is non-blocking, so 'EAGAIN' just means there are no more queued events
+                if ( errno != EAGAIN )
+                {
+                    EE_LOG_FATAL_ERROR( LogCategory::FileSystem, "FileSystemWatcher", "Failed to read inotify events: %s", Platform::Linux::GetLastErrorMessage().c_str() );
+                    EE_HALT();
+                }
+
+                break;
+            }
+
+            if ( numBytesReturned == 0 )
+            {
+                break;
+            }
+
+            ProcessListOfDirectoryChanges( (size_t) numBytesReturned );
+            hasChanges = true;
+        }
+
+        // Both halves of a move are queued together, so any move that is still unmatched was a move out of (or into) the watched hierarchy
+        ProcessUnmatchedMoves();
+
+        return hasChanges;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool Watcher::AddWatchesForDirectory( Path const& directoryPath )
+    {
+        EE_ASSERT( directoryPath.IsDirectoryPath() );
+
+        int32_t const watchDescriptor = inotify_add_watch( m_inotifyDescriptor, directoryPath.c_str(), g_watchMask );
+        if ( watchDescriptor < 0 )
+        {
+            EE_LOG_ERROR( LogCategory::FileSystem, "File System Watcher", "Failed to watch directory (%s), error: %s", directoryPath.c_str(), Platform::Linux::GetLastErrorMessage().c_str() );
+            return false;
+        }
+
+        m_watchedDirectories[watchDescriptor] = directoryPath;
+
+        // Inotify watches are not recursive
+        TVector<Path> subDirectories;
+        GetDirectoryContents( directoryPath, subDirectories, DirectoryReaderOutput::OnlyDirectories, DirectoryReaderMode::NoRecursion );
+        for ( Path const& subDirectory : subDirectories )
+        {
+            if ( !AddWatchesForDirectory( subDirectory ) )
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void Watcher::RemoveWatchesForDirectory( Path const& directoryPath )
+    {
+        for ( auto iter = m_watchedDirectories.begin(); iter != m_watchedDirectories.end(); )
+        {
+            if ( iter->second.IsUnderDirectory( directoryPath ) )
+            {
+                inotify_rm_watch( m_inotifyDescriptor, iter->first );
+                iter = m_watchedDirectories.erase( iter );
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+
+    void Watcher::ProcessListOfDirectoryChanges( size_t numBytesReturned )
+    {
+        size_t offset = 0;
+        while ( offset < numBytesReturned )
+        {
+            inotify_event const* pNotify = reinterpret_cast<inotify_event const*>( m_pResultBuffer + offset );
+            offset += sizeof( inotify_event ) + pNotify->len;
+
+            // The kernel event queue overflowed, this mean a massive change has occurred and needs to be handle externally
+            if ( pNotify->mask & IN_Q_OVERFLOW )
+            {
+                m_massiveChangeDetectedEvent.Execute();
+                continue;
+            }
+
+            // The watch was removed, either explicitly or because the directory was deleted
+            if ( pNotify->mask & IN_IGNORED )
+            {
+                m_watchedDirectories.erase( pNotify->wd );
+                continue;
+            }
+
+            auto const foundIter = m_watchedDirectories.find( pNotify->wd );
+            if ( foundIter == m_watchedDirectories.end() || pNotify->len == 0 )
+            {
+                continue;
+            }
+
+            bool const isDirectory = ( pNotify->mask & IN_ISDIR ) != 0;
+            Path const eventPath = foundIter->second.GetAppended( pNotify->name, isDirectory );
+
+            //-------------------------------------------------------------------------
+
+            if ( pNotify->mask & IN_CREATE )
+            {
+                Event& newEvent = m_unhandledEvents.emplace_back();
+                newEvent.m_path = eventPath;
+                newEvent.m_type = isDirectory ? Event::DirectoryCreated : Event::FileCreated;
+
+                // Watch the new directory and report any files that were created in it before the watch was added
+                if ( isDirectory && AddWatchesForDirectory( eventPath ) )
+                {
+                    TVector<Path> createdFiles;
+                    GetDirectoryContents( eventPath, createdFiles, DirectoryReaderOutput::OnlyFiles, DirectoryReaderMode::Recursive );
+                    for ( Path const& createdFile : createdFiles )
+                    {
+                        m_unhandledEvents.emplace_back( Event{ Event::FileCreated, createdFile, Path() } );
+                    }
+                }
+            }
+            else if ( pNotify->mask & IN_DELETE )
+            {
+                Event& newEvent = m_unhandledEvents.emplace_back();
+                newEvent.m_path = eventPath;
+                newEvent.m_type = isDirectory ? Event::DirectoryDeleted : Event::FileDeleted;
+            }
+            else if ( pNotify->mask & IN_CLOSE_WRITE )
+            {
+                // A file can be written multiple times in a single update, so only report the first modification (or creation)
+                bool isAlreadyQueued = false;
+                for ( Event const& evt : m_unhandledEvents )
+                {
+                    if ( evt.m_path == eventPath && ( evt.m_type == Event::FileModified || evt.m_type == Event::FileCreated ) )
+                    {
+                        isAlreadyQueued = true;
+                        break;
+                    }
+                }
+
+                if ( !isAlreadyQueued )
+                {
+                    m_unhandledEvents.emplace_back( Event{ Event::FileModified, eventPath, Path() } );
+                }
+            }
+            else if ( pNotify->mask & IN_MOVED_FROM )
+            {
+                Event pendingEvent;
+                pendingEvent.m_oldPath = eventPath;
+                pendingEvent.m_type = isDirectory ? Event::DirectoryRenamed : Event::FileRenamed;
+                m_pendingMoves.emplace_back( pNotify->cookie, pendingEvent );
+            }
+            else if ( pNotify->mask & IN_MOVED_TO )
+            {
+                int32_t const pendingMoveIdx = VectorFindIndex( m_pendingMoves, pNotify->cookie, [] ( eastl::pair<uint32_t, Event> const& pendingMove, uint32_t cookie ) { return pendingMove.first == cookie; } );
+                if ( pendingMoveIdx != InvalidIndex )
+                {
+                    Event& newEvent = m_unhandledEvents.emplace_back( m_pendingMoves[pendingMoveIdx].second );
+                    newEvent.m_path = eventPath;
+                    m_pendingMoves.erase_unsorted( m_pendingMoves.begin() + pendingMoveIdx );
+
+                    // Update the paths of all the watches for the renamed directory hierarchy
+                    if ( isDirectory )
+                    {
+                        size_t const oldPathLength = newEvent.m_oldPath.Length();
+                        for ( auto& watchedDirectory : m_watchedDirectories )
+                        {
+                            if ( watchedDirectory.second.IsUnderDirectory( newEvent.m_oldPath ) )
+                            {
+                                watchedDirectory.second = Path( eventPath.GetString() + watchedDirectory.second.GetString().substr( oldPathLength ) );
+                            }
+                        }
+                    }
+
+                    RemoveRedundantEventsForRename( newEvent );
+                }
+                else // Moved into the watched hierarchy
+                {
+                    m_unhandledEvents.emplace_back( Event{ isDirectory ? Event::DirectoryCreated : Event::FileCreated, eventPath, Path() } );
+
+                    if ( isDirectory )
+                    {
+                        AddWatchesForDirectory( eventPath );
+                    }
+                }
+            }
+        }
+    }
+
+    void Watcher::ProcessUnmatchedMoves()
+    {
+        for ( auto const& pendingMove : m_pendingMoves )
+        {
+            Event const& movedEvent = pendingMove.second;
+            bool const isDirectory = movedEvent.m_type == Event::DirectoryRenamed;
+            m_unhandledEvents.emplace_back( Event{ isDirectory ? Event::DirectoryDeleted : Event::FileDeleted, movedEvent.m_oldPath, Path() } );
+
+            // The kernel keeps the watches for directories that were moved out of the hierarchy
+            if ( isDirectory )
+            {
+                RemoveWatchesForDirectory( movedEvent.m_oldPath );
+            }
+        }
+
+        m_pendingMoves.clear();
+    }
+
+    void Watcher::RemoveRedundantEventsForRename( Event const& renameEvent )
+    {
+        EE_ASSERT( renameEvent.m_type == Event::FileRenamed || renameEvent.m_type == Event::DirectoryRenamed );
+
+        // Copy the paths since the rename event is stored in the event list and will move as we remove events
+        Path const newPath = renameEvent.m_path;
+        Path const oldPath = renameEvent.m_oldPath;
+
+        // Clean up action queue, the rename event is always the last queued event so skip it
+        for ( int32_t i = int32_t( m_unhandledEvents.size() - 2 ); i >= 0 ; i-- )
+        {
+            Event& evt = m_unhandledEvents[i];
+
+            // Check if we have any add/remove actions queued for this new path, if so remove them from the queue
+            if ( evt.m_path == newPath )
+            {
+                if ( evt.m_type == Event::FileDeleted || evt.m_type == Event::FileCreated )
+                {
+                    m_unhandledEvents.erase( m_unhandledEvents.begin() + i );
+                    continue;
+                }
+            }
+
+            // Check if we have any actions queued for the old path, if so remove them from the queue
+            if ( evt.m_path == oldPath )
+            {
+                m_unhandledEvents.erase( m_unhandledEvents.begin() + i );
+            }
+        }
+    }
+}
+#endif
\ No newline at end of file
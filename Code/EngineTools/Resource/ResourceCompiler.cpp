@@ -2,6 +2,7 @@
 #include "Base/FileSystem/FileSystem.h"
 #include "Base/TypeSystem/TypeRegistry.h"
 #include "Base/Time/Timers.h"
+#include "Base/ThirdParty/lzav/lzav_estoerica.h"
 
 //-------------------------------------------------------------------------
 
@@ -37,6 +38,20 @@ namespace EE::Resource
         return false;
     }
 
+    bool Compiler::WillCompressCompiledData( ResourceTypeID resourceTypeID ) const
+    {
+        for ( auto const& outputType : m_outputs )
+        {
+            if ( outputType.m_typeID == resourceTypeID )
+            {
+                return outputType.m_compressCompiledData;
+            }
+        }
+
+        EE_UNREACHABLE_CODE();
+        return false;
+    }
+
     //-------------------------------------------------------------------------
 
     void Compiler::PerformUpToDateCheck( CompileContext& ctx ) const
@@ -171,6 +186,12 @@ namespace EE::Resource
 
             ctx.m_result = Compile( ctx );
 
+            // Compress payload
+            if ( ( ctx.m_result == CompilationResult::Success || ctx.m_result == CompilationResult::SuccessWithWarnings ) && WillCompressCompiledData( ctx.m_resourceID.GetResourceTypeID() ) )
+            {
+                ctx.m_result = KeepHighestSeverityCompilationResult( ctx.m_result, CompressCompiledData( ctx ) );
+            }
+
             // Update database
             if ( ctx.m_result == CompilationResult::Success || ctx.m_result == CompilationResult::SuccessWithWarnings )
             {
@@ -219,4 +240,70 @@ namespace EE::Resource
             ctx.LogError( "Failed to compile resource: %s", ctx.m_resourceID.c_str() );
         }
     }
+
+    CompilationResult Compiler::CompressCompiledData( CompileContext& ctx ) const
+    {
+        FileSystem::Path const& outputPath = ctx.GetOutputPath();
+
+        Serialization::BinaryInputArchive inputArchive;
+        if ( !inputArchive.ReadFromFile( outputPath ) )
+        {
+            return ctx.LogError( "Failed to read compiled resource for compression: %s", outputPath.c_str() );
+        }
+
+        // Read header and get the payload
+        //-------------------------------------------------------------------------
+
+        ResourceHeader header;
+        inputArchive << header;
+
+        TArrayView<uint8_t const> const payload = inputArchive.GetRemainingData();
+        if ( header.IsPayloadCompressed() || payload.empty() )
+        {
+            return CompilationResult::Success;
+        }
+
+        // Compress
+        //-------------------------------------------------------------------------
+
+        Milliseconds compressionTime = 0;
+        Blob compressedPayload;
+
+        {
+            ScopedTimer<PlatformClock> timer( compressionTime );
+            compressedPayload.resize( lzav::lzav_compress_bound_hi( (int32_t) payload.size() ) );
+            int32_t const compressedSize = lzav::lzav_compress_hi( payload.data(), compressedPayload.data(), (int32_t) payload.size(), (int32_t) compressedPayload.size() );
+            compressedPayload.resize( compressedSize );
+        }
+
+        if ( compressedPayload.empty() )
+        {
+            return ctx.LogError( "Failed to compress resource data: %s", outputPath.c_str() );
+        }
+
+        // Dont bother storing compressed data if we dont save anything
+        if ( compressedPayload.size() >= payload.size() )
+        {
+            ctx.LogMessage( "Compression skipped, data is not compressible (%u bytes)", (uint32_t) payload.size() );
+            return CompilationResult::Success;
+        }
+
+        ctx.LogMessage( "Compressed data: %u -> %u bytes (%.1f%%) in %.2fms", (uint32_t) payload.size(), (uint32_t) compressedPayload.size(), 100.0f * compressedPayload.size() / payload.size(), compressionTime.ToFloat() );
+
+        // Write compressed file
+        //-------------------------------------------------------------------------
+
+        header.m_uncompressedPayloadSize = (uint32_t) payload.size();
+
+        Serialization::BinaryOutputArchive outputArchive;
+        outputArchive << header << compressedPayload;
+        inputArchive.Reset();
+
+        if ( !outputArchive.WriteToFile( outputPath ) )
+        {
+            return ctx.LogError( "Failed to write compressed resource: %s", outputPath.c_str() );
+        }
+
+        return CompilationResult::Success;
+    }
 }
\ No newline at end of file
@@ -27,13 +27,14 @@ namespace EE::Resource
         constexpr static char const * const s_forceArg = "-force";
         constexpr static char const * const s_packageArg = "-package";
         constexpr static char const* const s_logDelimiter = "Esoterica Resource Compiler\n-------------------------------------------------------------------------\n\n";
-        constexpr static uint64_t const s_binarySerializationVersion = 14;
+        constexpr static uint64_t const s_binarySerializationVersion = 15;
 
         struct Output final
         {
             ResourceTypeID                                  m_typeID;
             uint64_t                                        m_version;
             bool                                            m_requiresAdditionalDataFile;
+            bool                                            m_compressCompiledData;
         };
 
     public:
@@ -52,6 +53,9 @@ namespace EE::Resource
         // Will this compiler generate an additional data file for this resource type?
         bool WillGenerateAdditionalDataFile( ResourceTypeID resourceTypeID ) const;
 
+        // Will the compiled data for this resource type be compressed?
+        bool WillCompressCompiledData( ResourceTypeID resourceTypeID ) const;
+
         // Override this function to provide additional dependencies that cannot be trivially found via the descriptor
         // Generally needed for things like navmesh generation where the map descriptor doesnt have the necessary information to extract exact dependencies
         virtual void GetAdditionalCompileDependencies( TypeSystem::TypeRegistry const& typeRegistry, FileSystem::Path const& sourceResourceDirectoryPath, ResourceID const& resourceID, ResourceDescriptor const* pDescriptor, TVector<CompileDependency>& outDependencies ) const {}
@@ -75,7 +79,7 @@ namespace EE::Resource
         void RegisterOutput()
         {
             static_assert( std::is_base_of<EE::Resource::IResource, T>::value, "T is not derived from IResource" );
-            m_outputs.emplace_back( T::GetStaticResourceTypeID(), T::s_version, T::s_requiresAdditionalDataFile );
+            m_outputs.emplace_back( T::GetStaticResourceTypeID(), T::s_version, T::s_requiresAdditionalDataFile, T::s_compressCompiledData );
         }
 
         // Override this to check any third-party versions for a given resource type
@@ -101,6 +105,9 @@ namespace EE::Resource
 
         Compiler& operator=( Compiler const& ) = delete;
 
+        // Compress the payload of the compiled resource file in-place
+        CompilationResult CompressCompiledData( CompileContext& ctx ) const;
+
     private:
 
         String const                                m_name;
@@ -93,8 +93,8 @@ namespace EE
         CharacterComponent*                     m_pCC = nullptr;
         b3WorldId                               m_worldID = {};
         b3QueryFilter                           m_moverFilter = {};
-        TInlineVector<b3CollisionPlane, 100>    m_planes;
-        TInlineVector<PlaneExtra, 100>          m_planeExtras;
+        TInlineFrameVector<b3CollisionPlane, 100>   m_planes;
+        TInlineFrameVector<PlaneExtra, 100>         m_planeExtras;
     };
 
     bool MoverFilterFcn( b3ShapeId shapeID, void* pUserContext )
@@ -0,0 +1,235 @@
+#include "DebugView_Damage.h"
+#include "Game/Damage/Systems/WorldSystem_Damage.h"
+#include "Game/Player/Systems/WorldSystem_PlayerTargetingSystem.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "Base/Math/MathRandom.h"
+#include "Base/Math/Intersection.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
+#include "Base/Imgui/ImguiX.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE
+{
+    void DamageDebugView::Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld )
+    {
+        DebugView::Initialize( systemRegistry, pWorld );
+        m_pDamageSystem = pWorld->GetWorldSystem<DamageSystem>();
+        m_pTargetingSystem = pWorld->GetWorldSystem<PlayerTargetingSystem>();
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+        m_windows.emplace_back( "Damage Broadphase", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawBroadphaseWindow( context ); } );
+        m_windows.emplace_back( "Damage Broadphase Benchmark", [this] ( EntityWorldUpdateContext const& context, bool isFocused, uint64_t ) { DrawBenchmarkWindow( context ); } );
+    }
+
+    void DamageDebugView::Shutdown()
+    {
+        m_pDamageSystem = nullptr;
+        m_pTargetingSystem = nullptr;
+        m_pTaskSystem = nullptr;
+        DebugView::Shutdown();
+    }
+
+    void DamageDebugView::DrawMenu( EntityWorldUpdateContext const& context )
+    {
+        ImGui::Checkbox( "Draw Receiver Broadphase", &m_drawBroadphase );
+
+        if ( ImGui::MenuItem( "Broadphase Stats" ) )
+        {
+            m_windows[0].m_isOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Broadphase Benchmark" ) )
+        {
+            m_windows[1].m_isOpen = true;
+        }
+    }
+
+    void DamageDebugView::Update( EntityWorldUpdateContext const& context )
+    {
+        if ( m_drawBroadphase )
+        {
+            auto drawCtx = context.GetDebugDrawContext();
+            m_pDamageSystem->GetReceiverBroadphase().DrawDebug( drawCtx );
+        }
+    }
+
+    void DamageDebugView::DrawBroadphaseWindow( EntityWorldUpdateContext const& context )
+    {
+        ImGui::Text( "Receivers In Broadphase: %d", m_pDamageSystem->GetNumReceiversInBroadphase() );
+        ImGui::Text( "Requests Resolved: %d", m_pDamageSystem->GetNumResolvedRequests() );
+        ImGui::Text( "Resolve Time: %.3fms", m_pDamageSystem->GetResolveTime().ToFloat() );
+
+        ImGui::SeparatorText( "Hitbox Updates" );
+        ImGui::Text( "Updated: %d", m_pTargetingSystem->GetNumHitboxesUpdated() );
+        ImGui::Text( "Skipped (Unchanged Pose): %d", m_pTargetingSystem->GetNumHitboxesSkipped() );
+        ImGui::Text( "Culled (Not In View): %d", m_pTargetingSystem->GetNumHitboxesCulled() );
+        ImGui::Text( "Update Time: %.3fms", m_pTargetingSystem->GetHitboxUpdateTime().ToFloat() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void DamageDebugView::RunBroadphaseBenchmark()
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
+        constexpr static int32_t const s_receiverCounts[] = { 10, 50, 100, 250, 500, 1000 };
+        constexpr static float const s_receiverSpacing = 3.0f;
+
+        m_benchmarkResults.clear();
+
+        for ( int32_t numReceivers : s_receiverCounts )
+        {
+            BroadphaseBenchmarkResult& result = m_benchmarkResults.emplace_back();
+            result.m_numReceivers = numReceivers;
+
+            // Deterministic layout so that runs are comparable: character sized boxes on a jittered grid and shotgun-like ray bursts
+            Math::RNG rng( 1337 );
+
+            int32_t const gridSize = Math::CeilingToInt32( Math::Sqrt( (float) numReceivers ) );
+            float const gridExtent = gridSize * s_receiverSpacing;
+
+            TVector<AABB> receiverBounds;
+            receiverBounds.reserve( numReceivers );
+            for ( int32_t i = 0; i < numReceivers; i++ )
+            {
+                Vector const center( ( i % gridSize ) * s_receiverSpacing + rng.GetFloat( -0.5f, 0.5f ), ( i / gridSize ) * s_receiverSpacing + rng.GetFloat( -0.5f, 0.5f ), 0.9f );
+                receiverBounds.emplace_back( center, Vector( 0.4f, 0.4f, 0.9f ) );
+            }
+
+            TVector<Ray> rays;
+            rays.reserve( m_numBenchmarkRays );
+            for ( int32_t i = 0; i < m_numBenchmarkRays; i++ )
+            {
+                Vector const start( rng.GetFloat( 0.0f, gridExtent ), rng.GetFloat( 0.0f, gridExtent ), 1.5f );
+                Vector const end( rng.GetFloat( 0.0f, gridExtent ), rng.GetFloat( 0.0f, gridExtent ), rng.GetFloat( 0.0f, 1.8f ) );
+                rays.emplace_back( Ray::StartEnd, start, end );
+            }
+
+            // Brute force
+            //-------------------------------------------------------------------------
+
+            int32_t numBruteForceHits = 0;
+            Milliseconds elapsedTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                for ( Ray const& ray : rays )
+                {
+                    for ( AABB const& bounds : receiverBounds )
+                    {
+                        if ( Math::IntersectRayBox( ray, bounds ) )
+                        {
+                            numBruteForceHits++;
+                        }
+                    }
+                }
+            }
+            result.m_bruteForceTime = elapsedTime.ToFloat();
+
+            // Tree build
+            //-------------------------------------------------------------------------
+
+            Math::AABBTree tree;
+            elapsedTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                for ( int32_t i = 0; i < numReceivers; i++ )
+                {
+                    tree.InsertBox( receiverBounds[i], uint64_t( i + 1 ) );
+                }
+            }
+            result.m_treeBuildTime = elapsedTime.ToFloat();
+
+            // Tree query
+            //-------------------------------------------------------------------------
+
+            result.m_numHits = 0;
+            elapsedTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                TVector<uint64_t> candidates;
+                for ( Ray const& ray : rays )
+                {
+                    tree.FindOverlaps( ray, candidates );
+                    result.m_numHits += (int32_t) candidates.size();
+                }
+            }
+            result.m_treeQueryTime = elapsedTime.ToFloat();
+            EE_ASSERT( result.m_numHits == numBruteForceHits );
+
+            // Batched parallel tree query
+            //-------------------------------------------------------------------------
+
+            AsyncTask queryTask( (uint32_t) rays.size(), [&tree, &rays] ( TaskSetPartition range, uint32_t threadnum )
+            {
+                TVector<uint64_t> candidates;
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    tree.FindOverlaps( rays[i], candidates );
+                }
+            } );
+
+            elapsedTime = 0;
+            {
+                ScopedTimer<PlatformClock> timer( elapsedTime );
+                m_pTaskSystem->ScheduleTask( &queryTask );
+                m_pTaskSystem->WaitForTask( &queryTask );
+            }
+            result.m_treeParallelQueryTime = elapsedTime.ToFloat();
+        }
+    }
+
+    void DamageDebugView::DrawBenchmarkWindow( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextItemWidth( 150 );
+        ImGui::InputInt( "Num Rays", &m_numBenchmarkRays );
+        m_numBenchmarkRays = Math::Clamp( m_numBenchmarkRays, 1, 100000 );
+
+        ImGui::SameLine();
+        if ( ImGui::Button( "Run Benchmark" ) )
+        {
+            RunBroadphaseBenchmark();
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( ImGui::BeginTable( "DamageBenchmarkTable", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg ) )
+        {
+            ImGui::TableSetupColumn( "Receivers", ImGuiTableColumnFlags_WidthFixed, 70 );
+            ImGui::TableSetupColumn( "Brute Force (ms)", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Tree Build (ms)", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Tree Query (ms)", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Parallel Tree Query (ms)", ImGuiTableColumnFlags_WidthStretch );
+            ImGui::TableSetupColumn( "Candidates", ImGuiTableColumnFlags_WidthFixed, 70 );
+            ImGui::TableHeadersRow();
+
+            for ( BroadphaseBenchmarkResult const& result : m_benchmarkResults )
+            {
+                ImGui::TableNextRow();
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", result.m_numReceivers );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", result.m_bruteForceTime );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", result.m_treeBuildTime );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", result.m_treeQueryTime );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%.3f", result.m_treeParallelQueryTime );
+
+                ImGui::TableNextColumn();
+                ImGui::Text( "%d", result.m_numHits );
+            }
+
+            ImGui::EndTable();
+        }
+    }
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Engine/Debug/DebugView.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE
+{
+    class DamageSystem;
+    class PlayerTargetingSystem;
+    class TaskSystem;
+
+    //-------------------------------------------------------------------------
+
+    class DamageDebugView : public DebugView
+    {
+        EE_REFLECT_TYPE( DamageDebugView );
+
+        struct BroadphaseBenchmarkResult
+        {
+            int32_t             m_numReceivers = 0;
+            float               m_bruteForceTime = 0.0f;
+            float               m_treeBuildTime = 0.0f;
+            float               m_treeQueryTime = 0.0f;
+            float               m_treeParallelQueryTime = 0.0f;
+            int32_t             m_numHits = 0;
+        };
+
+    public:
+
+        virtual Category GetCategory() const override { return Category::Game; }
+        virtual char const* GetMenuPath() const override { return "Damage"; }
+
+    private:
+
+        virtual void Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld ) override;
+        virtual void Shutdown() override;
+        virtual void Update( EntityWorldUpdateContext const& context ) override;
+        virtual void DrawMenu( EntityWorldUpdateContext const& context ) override;
+
+        void DrawBroadphaseWindow( EntityWorldUpdateContext const& context );
+        void DrawBenchmarkWindow( EntityWorldUpdateContext const& context );
+        void RunBroadphaseBenchmark();
+
+    private:
+
+        DamageSystem const*                     m_pDamageSystem = nullptr;
+        PlayerTargetingSystem const*            m_pTargetingSystem = nullptr;
+        TaskSystem*                             m_pTaskSystem = nullptr;
+        TVector<BroadphaseBenchmarkResult>      m_benchmarkResults;
+        int32_t                                 m_numBenchmarkRays = 256;
+        bool                                    m_drawBroadphase = false;
+    };
+}
+#endif
\ No newline at end of file
@@ -2,17 +2,47 @@
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/Entity.h"
 #include "Engine/Hitbox/Components/Component_Hitbox.h"
-#include "Game/Damage/Components/Component_Damage.h"
 #include "Game/Damage/Components/Component_Health.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    static float GetDamageMultiplier( HitboxDamageSeverity severity )
+    {
+        switch ( severity )
+        {
+            case HitboxDamageSeverity::Critical:
+            return 8.0f;
+
+            case HitboxDamageSeverity::High:
+            return 4.5f;
+
+            case HitboxDamageSeverity::Medium:
+            return 2.5f;
+
+            case HitboxDamageSeverity::Low:
+            return 1.0f;
+        }
+
+        return 1.0f;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void DamageSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+    }
+
     void DamageSystem::ShutdownSystem()
     {
         EE_ASSERT( m_dealers.empty() );
         EE_ASSERT( m_receivers.empty() );
+        EE_ASSERT( m_receiverTree.IsEmpty() );
+        m_pTaskSystem = nullptr;
     }
 
     //-------------------------------------------------------------------------
@@ -37,12 +67,67 @@ namespace EE
         }
         else if ( auto pHitboxComponent = TryCast<HitboxComponent>( pComponent ) )
         {
+            if ( m_receiverTree.ContainsBox( pHitboxComponent ) )
+            {
+                m_receiverTree.RemoveBox( pHitboxComponent );
+            }
+
             m_receivers.Remove( pHitboxComponent->GetID() );
         }
     }
 
     //-------------------------------------------------------------------------
 
+    void DamageSystem::UpdateReceiverBroadphase()
+    {
+        for ( auto& receiver : m_receivers )
+        {
+            HitboxComponent* pHitboxComponent = receiver.m_pComponent;
+            bool const isInTree = m_receiverTree.ContainsBox( pHitboxComponent );
+            bool const shouldBeInTree = pHitboxComponent->IsEnabled() && pHitboxComponent->HasHitbox() && pHitboxComponent->GetBounds().IsValid();
+
+            if ( shouldBeInTree )
+            {
+                if ( isInTree )
+                {
+                    m_receiverTree.UpdateBox( pHitboxComponent->GetBounds(), pHitboxComponent, s_receiverBoundsMargin );
+                }
+                else
+                {
+                    AABB inflatedBounds = pHitboxComponent->GetBounds();
+                    inflatedBounds.Expand( Vector( s_receiverBoundsMargin ) );
+                    m_receiverTree.InsertBox( inflatedBounds, pHitboxComponent );
+                }
+            }
+            else if ( isInTree )
+            {
+                m_receiverTree.RemoveBox( pHitboxComponent );
+            }
+        }
+    }
+
+    void DamageSystem::ResolveRequest( PendingRequest& request, TVector<HitboxComponent const*>& candidatesScratch ) const
+    {
+        request.m_hits.clear();
+
+        Ray const ray( Ray::StartEnd, request.m_pRequest->m_start, request.m_pRequest->m_end );
+        if ( !m_receiverTree.FindOverlaps( ray, candidatesScratch ) )
+        {
+            return;
+        }
+
+        TInlineVector<Hitbox::Hit, 10> hits;
+        for ( HitboxComponent const* pHitboxComponent : candidatesScratch )
+        {
+            if ( pHitboxComponent->GetHitbox()->CollideRay( ray, hits ) )
+            {
+                request.m_hits.emplace_back( pHitboxComponent, GetDamageMultiplier( hits.front().m_pShape->m_severity ) );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void DamageSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( !ctx.IsGameWorld() )
@@ -52,53 +137,84 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
-        TInlineVector<Hitbox::Hit, 10> hits;
+        #if EE_DEVELOPMENT_TOOLS
+        ScopedTimer<PlatformClock> resolveTimer( m_resolveTime );
+        #endif
+
+        // Gather all requests
+        //-------------------------------------------------------------------------
 
+        m_pendingRequests.clear();
         for ( auto& dealer : m_dealers )
         {
-            for ( DamageComponent::Request& dmg : dealer.m_pComponent->m_requests )
+            for ( DamageComponent::Request const& dmg : dealer.m_pComponent->m_requests )
             {
-                for ( auto& receiver : m_receivers )
+                m_pendingRequests.emplace_back().m_pRequest = &dmg;
+            }
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_numResolvedRequests = (int32_t) m_pendingRequests.size();
+        #endif
+
+        // Update the broadphase, this is needed even when there are no requests since the tree is updated incrementally
+        //-------------------------------------------------------------------------
+
+        UpdateReceiverBroadphase();
+
+        // Resolve all requests
+        //-------------------------------------------------------------------------
+
+        if ( !m_pendingRequests.empty() )
+        {
+            int32_t const numRequests = (int32_t) m_pendingRequests.size();
+            if ( m_pTaskSystem != nullptr && numRequests >= s_minRequestsForParallelResolve )
+            {
+                AsyncTask resolveTask( numRequests, [this] ( TaskSetPartition range, uint32_t threadnum )
                 {
-                    Hitbox const* pHitBox = receiver.m_pComponent->GetHitbox();
-                    if ( !receiver.m_pComponent->IsEnabled() )
+                    TVector<HitboxComponent const*> candidates;
+                    for ( uint32_t i = range.start; i < range.end; i++ )
                     {
-                        continue;
+                        ResolveRequest( m_pendingRequests[i], candidates );
                     }
+                } );
 
-                    if ( pHitBox->CollideRay( dmg.m_start, dmg.m_end, hits ) )
+                m_pTaskSystem->ScheduleTask( &resolveTask );
+                m_pTaskSystem->WaitForTask( &resolveTask );
+            }
+            else
+            {
+                TVector<HitboxComponent const*> candidates;
+                for ( PendingRequest& request : m_pendingRequests )
+                {
+                    ResolveRequest( request, candidates );
+                }
+            }
+
+            // Apply damage, this is done serially and in request order
+            //-------------------------------------------------------------------------
+
+            for ( PendingRequest const& request : m_pendingRequests )
+            {
+                for ( ReceiverHit const& hit : request.m_hits )
+                {
+                    auto pReceiver = m_receivers.FindItem( hit.m_pReceiver->GetID() );
+                    EE_ASSERT( pReceiver != nullptr );
+
+                    auto pHealthComponent = pReceiver->m_pEntity->TryGetComponent<HealthComponent>();
+                    if ( pHealthComponent != nullptr )
                     {
-                        auto pHealthComponent = receiver.m_pEntity->TryGetComponent<HealthComponent>();
-                        if ( pHealthComponent != nullptr )
-                        {
-                            float dmgMultiplier = 1.0f;
-
-                            switch ( hits.front().m_pShape->m_severity )
-                            {
-                                case HitboxDamageSeverity::Critical:
-                                dmgMultiplier = 8.0f;
-                                break;
-
-                                case HitboxDamageSeverity::High:
-                                dmgMultiplier = 4.5f;
-                                break;
-
-                                case HitboxDamageSeverity::Medium:
-                                dmgMultiplier = 2.5f;
-                                break;
-
-                                case HitboxDamageSeverity::Low:
-                                dmgMultiplier = 1.0f;
-                                break;
-                            }
-
-                            pHealthComponent->SetHP( pHealthComponent->GetHP() - ( dmg.m_info.m_hitpoints * dmgMultiplier ) );
-                        }
+                        pHealthComponent->SetHP( pHealthComponent->GetHP() - ( request.m_pRequest->m_info.m_hitpoints * hit.m_damageMultiplier ) );
                     }
                 }
             }
 
-            dealer.m_pComponent->m_requests.clear();
+            m_pendingRequests.clear();
+
+            for ( auto& dealer : m_dealers )
+            {
+                dealer.m_pComponent->m_requests.clear();
+            }
         }
 
         //-------------------------------------------------------------------------
@@ -1,14 +1,22 @@
 #pragma once
 
 #include "Game/_Module/API.h"
+#include "Game/Damage/Components/Component_Damage.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Base/Math/AABBTree.h"
 #include "Base/Types/IDVector.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
+// Damage System
+//-------------------------------------------------------------------------
+// Resolves all the damage requests against the registered hitboxes
+// The bounds for all enabled hitboxes are kept in a dynamic AABB tree that is used to find the candidate receivers for each request
+// The per-shape collision tests for all requests are then run as a single batched (and parallel) job and the damage is applied serially
 
 namespace EE
 {
-    class DamageComponent;
+    class TaskSystem;
     class HitboxComponent;
 
     //-------------------------------------------------------------------------
@@ -17,17 +25,64 @@ namespace EE
     {
         EE_ENTITY_WORLD_SYSTEM( DamageSystem, RequiresUpdate( UpdateStage::GamePostPhysics ) );
 
+        struct ReceiverHit
+        {
+            ReceiverHit() = default;
+            ReceiverHit( HitboxComponent const* pReceiver, float damageMultiplier ) : m_pReceiver( pReceiver ), m_damageMultiplier( damageMultiplier ) {}
+
+            HitboxComponent const*                                                  m_pReceiver = nullptr;
+            float                                                                   m_damageMultiplier = 1.0f;
+        };
+
+        struct PendingRequest
+        {
+            DamageComponent::Request const*                                         m_pRequest = nullptr;
+            TInlineFrameVector<ReceiverHit, 4>                                      m_hits;         // Transient, the pending requests are cleared every frame
+        };
+
+    public:
+
+        // The margin added to the receiver bounds stored in the tree, small movements within this margin don't require a tree update
+        constexpr static float const s_receiverBoundsMargin = 0.2f;
+
+        // Below this number of requests, all requests are resolved on the calling thread
+        constexpr static int32_t const s_minRequestsForParallelResolve = 8;
+
+    public:
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline int32_t GetNumReceiversInBroadphase() const { return m_receiverTree.GetNumBoxes(); }
+        inline int32_t GetNumResolvedRequests() const { return m_numResolvedRequests; }
+        inline Milliseconds GetResolveTime() const { return m_resolveTime; }
+        inline Math::AABBTree const& GetReceiverBroadphase() const { return m_receiverTree; }
+        #endif
+
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
         virtual void ShutdownSystem() override;
 
         virtual void RegisterComponent( Entity* pEntity, EntityComponent* pComponent ) override;
         virtual void UnregisterComponent( Entity* pEntity, EntityComponent* pComponent ) override;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        // Insert/update/remove the receiver bounds in the tree
+        void UpdateReceiverBroadphase();
+
+        // Find all the receivers hit by a request, this is threadsafe as long as the broadphase is not modified
+        void ResolveRequest( PendingRequest& request, TVector<HitboxComponent const*>& candidatesScratch ) const;
+
     private:
 
+        TaskSystem*                                                                 m_pTaskSystem = nullptr;
         TIDVector<ComponentID, TEntityComponentPair<DamageComponent>>               m_dealers;
         TIDVector<ComponentID, TEntityComponentPair<HitboxComponent>>               m_receivers;
+        Math::AABBTree                                                              m_receiverTree;
+        TVector<PendingRequest>                                                     m_pendingRequests;
+
+        #if EE_DEVELOPMENT_TOOLS
+        int32_t                                                                     m_numResolvedRequests = 0;
+        Milliseconds                                                                m_resolveTime = 0;
+        #endif
     };
 }
\ No newline at end of file
@@ -4,15 +4,43 @@
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Hitbox/Components/Component_Hitbox.h"
 #include "Engine/Camera/Components/Component_Camera.h"
+#include "Engine/Animation/Components/Component_AnimationGraph.h"
+#include "Engine/Render/Components/Component_SkeletalMesh.h"
+#include "Base/Threading/TaskSystem.h"
+#include "Base/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    static bool IsInAnyViewVolume( TInlineVector<Math::ViewVolume const*, 2> const& viewVolumes, SpatialEntityComponent const* pSpatialComponent )
+    {
+        AABB bounds( pSpatialComponent->GetWorldBounds() );
+        bounds.Expand( Vector( PlayerTargetingSystem::s_viewVolumeCullingMargin ) );
+
+        for ( Math::ViewVolume const* pViewVolume : viewVolumes )
+        {
+            if ( pViewVolume->Contains( bounds ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void PlayerTargetingSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+    }
+
     void PlayerTargetingSystem::ShutdownSystem()
     {
         EE_ASSERT( m_targets.empty() );
         EE_ASSERT( m_trackers.empty() );
+        m_pTaskSystem = nullptr;
     }
 
     void PlayerTargetingSystem::RegisterComponent( Entity* pEntity, EntityComponent* pComponent )
@@ -39,6 +67,33 @@ namespace EE
         }
     }
 
+    void PlayerTargetingSystem::CreateHitboxUpdateRequest( Entity const* pEntity, HitboxComponent* pHitboxComponent, Hitbox::UpdateRequest& outRequest ) const
+    {
+        outRequest.m_pHitbox = pHitboxComponent->GetHitbox();
+        outRequest.m_pSpatialComponent = pEntity->GetRootSpatialComponent();
+
+        // We can only read the final animation pose directly if the root component is the mesh that the graph is animating
+        auto pMeshComponent = TryCast<Render::SkeletalMeshComponent>( outRequest.m_pSpatialComponent );
+        if ( pMeshComponent == nullptr )
+        {
+            return;
+        }
+
+        auto pGraphComponent = pEntity->TryGetComponent<Animation::GraphComponent>();
+        if ( pGraphComponent == nullptr || !pGraphComponent->HasGraphInstance() || pGraphComponent->GetPrimarySkeleton() != pMeshComponent->GetSkeleton() )
+        {
+            return;
+        }
+
+        Animation::Pose const* pPose = pGraphComponent->GetPrimaryPose();
+        if ( pPose->IsPoseSet() && pPose->HasModelSpaceTransforms() )
+        {
+            outRequest.m_pPose = pPose;
+            outRequest.m_poseWorldTransform = pMeshComponent->GetWorldTransform();
+            outRequest.m_poseUpdateID = pGraphComponent->GetPoseUpdateID();
+        }
+    }
+
     void PlayerTargetingSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( ctx.GetUpdateStage() == UpdateStage::GameSetup )
@@ -47,23 +102,66 @@ namespace EE
             auto drawContext = ctx.GetDebugDrawContext();
             #endif
 
-            // Update targets
+            // Gather the view volumes for all trackers
+            TInlineVector<Math::ViewVolume const*, 2> viewVolumes;
+            for ( auto const& trackerRecord : m_trackers )
+            {
+                auto pCamera = trackerRecord.m_pEntity->TryGetComponent<CameraComponent>();
+                EE_ASSERT( pCamera != nullptr );
+                viewVolumes.emplace_back( &pCamera->GetViewVolume() );
+            }
+
+            // Gather targets, targets not visible to any tracker are not updated
+            //-------------------------------------------------------------------------
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_numHitboxesCulled = 0;
+            #endif
+
+            m_hitboxUpdateRequests.clear();
             TInlineVector<HitboxComponent const*, 20> targets;
             for ( auto const& targetRecord : m_targets )
             {
-                if ( targetRecord.m_pComponent->IsEnabled() && targetRecord.m_pComponent->HasHitbox() )
+                if ( !targetRecord.m_pComponent->IsEnabled() || !targetRecord.m_pComponent->HasHitbox() )
                 {
-                    Hitbox* pHitbox = targetRecord.m_pComponent->GetHitbox();
-                    pHitbox->Update( ctx.GetScaledDeltaTime(), targetRecord.m_pEntity->GetRootSpatialComponent() );
-                    targets.emplace_back( targetRecord.m_pComponent );
+                    continue;
+                }
 
+                if ( !viewVolumes.empty() && !IsInAnyViewVolume( viewVolumes, targetRecord.m_pEntity->GetRootSpatialComponent() ) )
+                {
                     #if EE_DEVELOPMENT_TOOLS
-                    //targetRecord.m_pComponent->GetHitbox()->DrawDebug( drawContext );
+                    m_numHitboxesCulled++;
                     #endif
+                    continue;
                 }
+
+                CreateHitboxUpdateRequest( targetRecord.m_pEntity, targetRecord.m_pComponent, m_hitboxUpdateRequests.emplace_back() );
+                targets.emplace_back( targetRecord.m_pComponent );
+
+                #if EE_DEVELOPMENT_TOOLS
+                //targetRecord.m_pComponent->GetHitbox()->DrawDebug( drawContext );
+                #endif
+            }
+
+            // Update all target hitboxes
+            //-------------------------------------------------------------------------
+
+            {
+                #if EE_DEVELOPMENT_TOOLS
+                ScopedTimer<PlatformClock> timer( m_hitboxUpdateTime );
+                #endif
+
+                int32_t const numSkipped = Hitbox::UpdateBatch( m_pTaskSystem, ctx.GetScaledDeltaTime(), m_hitboxUpdateRequests );
+
+                #if EE_DEVELOPMENT_TOOLS
+                m_numHitboxesSkipped = numSkipped;
+                m_numHitboxesUpdated = (int32_t) m_hitboxUpdateRequests.size() - numSkipped;
+                #endif
             }
 
             // Reflect to trackers
+            //-------------------------------------------------------------------------
+
             for ( auto const& trackerRecord : m_trackers )
             {
                 auto pCamera = trackerRecord.m_pEntity->TryGetComponent<CameraComponent>();
@@ -2,14 +2,19 @@
 
 #include "Game/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Hitbox/Hitbox_Instance.h"
 #include "Base/Types/IDVector.h"
+#include "Base/Time/Time.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    class TaskSystem;
     class HitboxComponent;
     class PlayerTargetingComponent;
+    class SpatialEntityComponent;
+    namespace Math { class ViewVolume; }
 
     //-------------------------------------------------------------------------
 
@@ -19,16 +24,39 @@ namespace EE
 
         EE_ENTITY_WORLD_SYSTEM( PlayerTargetingSystem, RequiresUpdate( UpdateStage::GameSetup ) );
 
+        // The margin added to the target bounds when checking whether it is visible to any of the trackers
+        constexpr static float const s_viewVolumeCullingMargin = 1.0f;
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline int32_t GetNumHitboxesUpdated() const { return m_numHitboxesUpdated; }
+        inline int32_t GetNumHitboxesSkipped() const { return m_numHitboxesSkipped; }
+        inline int32_t GetNumHitboxesCulled() const { return m_numHitboxesCulled; }
+        inline Milliseconds GetHitboxUpdateTime() const { return m_hitboxUpdateTime; }
+        #endif
+
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override;
         virtual void ShutdownSystem() override;
         virtual void RegisterComponent( Entity* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        // Create the update request for a target, this will read the bone transforms directly from the final animation pose if possible
+        void CreateHitboxUpdateRequest( Entity const* pEntity, HitboxComponent* pHitboxComponent, Hitbox::UpdateRequest& outRequest ) const;
+
     private:
 
+        TaskSystem*                                                                 m_pTaskSystem = nullptr;
         TIDVector<ComponentID, TEntityComponentPair<HitboxComponent>>               m_targets;
         TIDVector<ComponentID, TEntityComponentPair<PlayerTargetingComponent>>      m_trackers;
+        TVector<Hitbox::UpdateRequest>                                              m_hitboxUpdateRequests;
+
+        #if EE_DEVELOPMENT_TOOLS
+        int32_t                                                                     m_numHitboxesUpdated = 0;
+        int32_t                                                                     m_numHitboxesSkipped = 0;
+        int32_t                                                                     m_numHitboxesCulled = 0;
+        Milliseconds                                                                m_hitboxUpdateTime = 0;
+        #endif
     };
 } 
\ No newline at end of file
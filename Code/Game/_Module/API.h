@@ -2,10 +2,14 @@
 //-------------------------------------------------------------------------
 
 #if EE_DLL
-    #ifdef ESOTERICA_GAME_RUNTIME
-        #define EE_GAME_API __declspec(dllexport)
+    #if _WIN32
+        #ifdef ESOTERICA_GAME_RUNTIME
+            #define EE_GAME_API __declspec(dllexport)
+        #else
+            #define EE_GAME_API __declspec(dllimport)
+        #endif
     #else
-        #define EE_GAME_API __declspec(dllimport)
+        #define EE_GAME_API __attribute__((visibility("default")))
     #endif
 #else
     #define EE_GAME_API